@@ -0,0 +1,74 @@
+# Copyright 2018-2019 Dynatrace LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+SET(OPENKIT_AGENT_SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/src/openkit-agent.cxx
+)
+
+include(CompilerConfiguration)
+fix_compiler_flags()
+
+function(build_open_kit_agent)
+    message("Configuring OpenKit agent ... ")
+
+    ## the shared memory ring buffers of the sidecar mode are only supported on POSIX systems
+    if (WIN32)
+        message("INFO the OpenKit agent is not supported on Windows - skip building it")
+        return()
+    endif()
+
+    find_package(ZLIB)
+    find_package(CURL)
+
+    # the agent is built from the OpenKit internals next to the public headers
+    set(AGENT_INCLUDE_DIRS
+        ${ZLIB_INCLUDE_DIR}
+        ${CURL_INCLUDE_DIR}
+        ${OpenKit_SOURCE_DIR}/include
+        ${OpenKit_SOURCE_DIR}/src
+        ${OpenKit_BINARY_DIR}/include
+    )
+
+    include(CompilerConfiguration)
+    include(BuildFunctions)
+
+    if (BUILD_SHARED_LIBS)
+        ## the internal symbols are not exported from the shared library,
+        ## therefore the OpenKit sources are built as separate static library, like for the unit tests
+        _determine_compiler_language(OpenKit_Agent ${OPENKIT_SOURCES})
+        open_kit_build_static_library(OpenKit_Agent "${AGENT_INCLUDE_DIRS}" "" ${OPENKIT_SOURCES})
+        target_compile_definitions(OpenKit_Agent PRIVATE -DOPENKIT_STATIC_DEFINE -DCURL_STATICLIB)
+        enforce_cxx11_standard(OpenKit_Agent)
+
+        set(AGENT_LIBS
+            OpenKit_Agent
+            ${ZLIB_LIBRARY}
+            ${CURL_LIBRARY})
+    else()
+        set(AGENT_LIBS
+            OpenKit
+            ${ZLIB_LIBRARY}
+            ${CURL_LIBRARY})
+    endif()
+
+    open_kit_build_executable(openkit-agent "${AGENT_INCLUDE_DIRS}" "${AGENT_LIBS}" ${OPENKIT_AGENT_SOURCES})
+    enforce_cxx11_standard(openkit-agent)
+    if (NOT BUILD_SHARED_LIBS OR OPENKIT_MONOLITHIC_SHARED_LIB)
+        target_compile_definitions(openkit-agent PRIVATE -DCURL_STATICLIB)
+    endif()
+    target_compile_definitions(openkit-agent PRIVATE -DOPENKIT_STATIC_DEFINE)
+
+    set_target_properties(openkit-agent PROPERTIES FOLDER Agent)
+    source_group("Source Files" FILES ${OPENKIT_AGENT_SOURCES})
+endfunction()
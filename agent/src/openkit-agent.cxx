@@ -0,0 +1,297 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// The OpenKit agent, which caches and sends the data of all OpenKit instances on this host running in sidecar mode.
+/// Each OpenKit instance configured with @c withSidecarDirectory writes its data into a shared memory ring buffer
+/// file in the given directory. The agent attaches to these ring buffers, reads them continuously and sends their
+/// data to the collector. All OpenKit instances must belong to the application given to the agent.
+///
+/// On SIGTERM or SIGINT the agent reads all remaining data, sends it within the flush timeout and terminates.
+///
+/// While the ring buffers stay empty, the time to sleep is doubled after each poll, starting at the poll interval up to
+/// the maximum poll interval. Data written into an idle ring buffer is therefore picked up with a delay of up to the
+/// maximum poll interval, a smaller value reduces this latency at the cost of more wakeups of an idle agent.
+///
+/// Usage: openkit-agent --endpoint <url> --application-id <id> [options]
+///   --directory <dir>                directory of the ring buffer files (default /dev/shm)
+///   --scan-interval <ms>             interval for attaching new ring buffers (default 1000)
+///   --poll-interval <ms>             time to sleep, if no ring buffer contained data (default 1)
+///   --max-poll-interval <ms>         maximum time to sleep, if the ring buffers stay empty (default 100)
+///   --flush-timeout <ms>             timeout for sending the remaining data on termination (default 10000)
+///   --log-level <level>              debug, info, warn or error (default warn)
+///   --cache-max-record-age <ms>      maximum age of cached records (default 105 minutes)
+///   --cache-lower-bound <bytes>      lower memory boundary of the beacon cache (default 80 MB)
+///   --cache-upper-bound <bytes>      upper memory boundary of the beacon cache (default 100 MB)
+///   --server-configuration-file <f>  file persisting the server configuration across restarts
+
+#include "OpenKit/DynatraceOpenKitBuilder.h"
+#include "core/sidecar/SidecarAgent.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+	///
+	/// Options of the agent
+	///
+	struct AgentOptions
+	{
+		AgentOptions()
+			: endpointURL()
+			, applicationID()
+			, directory("/dev/shm")
+			, serverConfigurationFile()
+			, scanIntervalInMillis(1000)
+			, pollIntervalInMillis(1)
+			, maxPollIntervalInMillis(100)
+			, flushTimeoutInMillis(10000)
+			, logLevel(openkit::LogLevel::LOG_LEVEL_WARN)
+			, cacheMaxRecordAgeInMillis(-1)
+			, cacheLowerBoundInBytes(-1)
+			, cacheUpperBoundInBytes(-1)
+		{
+		}
+
+		std::string endpointURL;
+		std::string applicationID;
+		std::string directory;
+		std::string serverConfigurationFile;
+		int64_t scanIntervalInMillis;
+		int64_t pollIntervalInMillis;
+		int64_t maxPollIntervalInMillis;
+		int64_t flushTimeoutInMillis;
+		openkit::LogLevel logLevel;
+		int64_t cacheMaxRecordAgeInMillis;
+		int64_t cacheLowerBoundInBytes;
+		int64_t cacheUpperBoundInBytes;
+	};
+
+	/// cleared by the termination signals
+	volatile sig_atomic_t gIsRunning = 1;
+
+	void onTerminationSignal(int32_t /* signal */)
+	{
+		gIsRunning = 0;
+	}
+
+	void printUsage(const char* program)
+	{
+		fprintf(stderr, "Usage: %s --endpoint <url> --application-id <id> [--directory <dir>] [--scan-interval <ms>]"
+			" [--poll-interval <ms>] [--max-poll-interval <ms>] [--flush-timeout <ms>] [--log-level <debug|info|warn|error>]"
+			" [--cache-max-record-age <ms>] [--cache-lower-bound <bytes>] [--cache-upper-bound <bytes>]"
+			" [--server-configuration-file <file>]\n", program);
+		fprintf(stderr, "While no ring buffer contains data, the time to sleep doubles from --poll-interval (default 1)"
+			" up to --max-poll-interval (default 100),\nwhich bounds the latency of picking up data of an idle"
+			" OpenKit instance. Smaller values lower this latency at the cost of more wakeups.\n");
+	}
+
+	bool parseLogLevel(const char* value, openkit::LogLevel& logLevel)
+	{
+		if (strcmp(value, "debug") == 0)
+		{
+			logLevel = openkit::LogLevel::LOG_LEVEL_DEBUG;
+		}
+		else if (strcmp(value, "info") == 0)
+		{
+			logLevel = openkit::LogLevel::LOG_LEVEL_INFO;
+		}
+		else if (strcmp(value, "warn") == 0)
+		{
+			logLevel = openkit::LogLevel::LOG_LEVEL_WARN;
+		}
+		else if (strcmp(value, "error") == 0)
+		{
+			logLevel = openkit::LogLevel::LOG_LEVEL_ERROR;
+		}
+		else
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	bool parseOptions(int32_t argc, char** argv, AgentOptions& options)
+	{
+		for (int32_t i = 1; i < argc; i++)
+		{
+			if (i + 1 >= argc)
+			{
+				return false;
+			}
+
+			const char* option = argv[i];
+			const char* value = argv[++i];
+			auto number = std::strtoll(value, nullptr, 10);
+
+			if (strcmp(option, "--endpoint") == 0)
+			{
+				options.endpointURL = value;
+			}
+			else if (strcmp(option, "--application-id") == 0)
+			{
+				options.applicationID = value;
+			}
+			else if (strcmp(option, "--directory") == 0)
+			{
+				options.directory = value;
+			}
+			else if (strcmp(option, "--server-configuration-file") == 0)
+			{
+				options.serverConfigurationFile = value;
+			}
+			else if (strcmp(option, "--scan-interval") == 0)
+			{
+				options.scanIntervalInMillis = number;
+			}
+			else if (strcmp(option, "--poll-interval") == 0)
+			{
+				options.pollIntervalInMillis = number;
+			}
+			else if (strcmp(option, "--max-poll-interval") == 0)
+			{
+				options.maxPollIntervalInMillis = number;
+			}
+			else if (strcmp(option, "--flush-timeout") == 0)
+			{
+				options.flushTimeoutInMillis = number;
+			}
+			else if (strcmp(option, "--log-level") == 0)
+			{
+				if (!parseLogLevel(value, options.logLevel))
+				{
+					return false;
+				}
+			}
+			else if (strcmp(option, "--cache-max-record-age") == 0)
+			{
+				options.cacheMaxRecordAgeInMillis = number;
+			}
+			else if (strcmp(option, "--cache-lower-bound") == 0)
+			{
+				options.cacheLowerBoundInBytes = number;
+			}
+			else if (strcmp(option, "--cache-upper-bound") == 0)
+			{
+				options.cacheUpperBoundInBytes = number;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return !options.endpointURL.empty() && !options.applicationID.empty();
+	}
+}
+
+int32_t main(int32_t argc, char** argv)
+{
+	AgentOptions options;
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	signal(SIGTERM, onTerminationSignal);
+	signal(SIGINT, onTerminationSignal);
+	// a connection closed by the collector must not terminate the process
+	signal(SIGPIPE, SIG_IGN);
+
+	// the device ID is not sent, the beacons carry the device IDs of the OpenKit instances writing the ring buffers
+	openkit::DynatraceOpenKitBuilder builder(options.endpointURL.c_str(), options.applicationID.c_str(), 1);
+	builder.withLogLevel(options.logLevel)
+		.enableStatistics();
+	if (options.cacheMaxRecordAgeInMillis > 0)
+	{
+		builder.withBeaconCacheMaxRecordAge(options.cacheMaxRecordAgeInMillis);
+	}
+	if (options.cacheLowerBoundInBytes > 0)
+	{
+		builder.withBeaconCacheLowerMemoryBoundary(options.cacheLowerBoundInBytes);
+	}
+	if (options.cacheUpperBoundInBytes > 0)
+	{
+		builder.withBeaconCacheUpperMemoryBoundary(options.cacheUpperBoundInBytes);
+	}
+	if (!options.serverConfigurationFile.empty())
+	{
+		builder.withServerConfigurationFile(options.serverConfigurationFile.c_str());
+	}
+
+	auto agent = std::make_shared<core::sidecar::SidecarAgent>(builder, options.directory);
+	agent->initialize();
+
+	auto scanInterval = std::chrono::milliseconds(options.scanIntervalInMillis);
+	auto minPollInterval = std::chrono::milliseconds(options.pollIntervalInMillis);
+	auto maxPollInterval = std::chrono::milliseconds(std::max(options.maxPollIntervalInMillis, options.pollIntervalInMillis));
+	auto pollInterval = minPollInterval;
+	auto nextScan = std::chrono::steady_clock::now();
+	while (gIsRunning)
+	{
+		auto now = std::chrono::steady_clock::now();
+		if (now >= nextScan)
+		{
+			agent->scanRingDirectory();
+			nextScan = now + scanInterval;
+		}
+
+		if (agent->pollRings() > 0)
+		{
+			pollInterval = minPollInterval;
+			continue;
+		}
+
+		// back off exponentially while the rings stay empty, to not wake up an idle agent every millisecond
+		std::this_thread::sleep_for(pollInterval);
+		pollInterval = std::min(std::max(pollInterval * 2, std::chrono::milliseconds(1)), maxPollInterval);
+	}
+
+	// pick up the data of OpenKit instances which finished since the last scan
+	agent->scanRingDirectory();
+	while (agent->pollRings() > 0)
+	{
+	}
+
+	auto statistics = agent->getStatistics();
+	auto shutdownResult = agent->shutdown(options.flushTimeoutInMillis);
+
+	printf("openkit-agent:\n");
+	printf("  records read:             %" PRId64 "\n", agent->getNumberOfReadRecords());
+	printf("  records orphaned:         %" PRId64 "\n", agent->getNumberOfOrphanedRecords());
+	printf("  records dropped by rings: %" PRId64 " (%" PRId64 " bytes)\n",
+		statistics.numberOfSidecarRecordsDropped, statistics.numberOfSidecarBytesDropped);
+	printf("  HTTP requests:            %" PRId64 "\n", statistics.numberOfHTTPRequests);
+	printf("  HTTP errors:              %" PRId64 "\n", statistics.numberOfHTTPErrors);
+	printf("  records evicted:          %" PRId64 " by age, %" PRId64 " by space\n",
+		statistics.numberOfRecordsEvictedByAge, statistics.numberOfRecordsEvictedBySpace);
+	printf("  shutdown completed:       %s\n", shutdownResult.isCompleted ? "yes" : "no");
+	printf("  records flushed:          %" PRId64 "\n", shutdownResult.numberOfFlushedRecords);
+	printf("  records dropped:          %" PRId64 "\n", shutdownResult.numberOfDroppedRecords);
+
+	return shutdownResult.isCompleted ? 0 : 2;
+}
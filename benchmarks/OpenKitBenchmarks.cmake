@@ -0,0 +1,118 @@
+# Copyright 2018-2019 Dynatrace LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+SET(OPENKIT_BENCHMARK_SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/src/ApiBenchmarks.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/src/BenchmarkRunner.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/src/BenchmarkRunner.h
+    ${CMAKE_CURRENT_LIST_DIR}/src/Benchmarks.h
+    ${CMAKE_CURRENT_LIST_DIR}/src/CoreBenchmarks.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/src/NullLogger.h
+    ${CMAKE_CURRENT_LIST_DIR}/src/ProtocolBenchmarks.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/src/openkit-benchmarks.cxx
+)
+
+SET(OPENKIT_LOADTEST_SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/loadtest/LatencyHistogram.h
+    ${CMAKE_CURRENT_LIST_DIR}/loadtest/MockCollector.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/loadtest/MockCollector.h
+    ${CMAKE_CURRENT_LIST_DIR}/loadtest/openkit-loadtest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/src/NullLogger.h
+)
+
+include(CompilerConfiguration)
+fix_compiler_flags()
+
+function(build_open_kit_benchmarks)
+    message("Configuring OpenKit benchmarks ... ")
+
+    find_package(ZLIB)
+    find_package(CURL)
+
+    # the benchmarks of the internal hot paths need the OpenKit sources next to the public headers
+    set(BENCHMARK_INCLUDE_DIRS
+        ${ZLIB_INCLUDE_DIR}
+        ${CURL_INCLUDE_DIR}
+        ${OpenKit_SOURCE_DIR}/include
+        ${OpenKit_SOURCE_DIR}/src
+        ${OpenKit_BINARY_DIR}/include
+    )
+
+    include(CompilerConfiguration)
+    include(BuildFunctions)
+
+    if (BUILD_SHARED_LIBS)
+        ## the internal symbols are not exported from the shared library,
+        ## therefore the OpenKit sources are built as separate static library, like for the unit tests
+        _determine_compiler_language(OpenKit_UnderBenchmark ${OPENKIT_SOURCES})
+        open_kit_build_static_library(OpenKit_UnderBenchmark "${BENCHMARK_INCLUDE_DIRS}" "" ${OPENKIT_SOURCES})
+        target_compile_definitions(OpenKit_UnderBenchmark PRIVATE -DOPENKIT_STATIC_DEFINE -DCURL_STATICLIB)
+        enforce_cxx11_standard(OpenKit_UnderBenchmark)
+
+        set(BENCHMARK_LIBS
+            OpenKit_UnderBenchmark
+            ${ZLIB_LIBRARY}
+            ${CURL_LIBRARY})
+    else()
+        set(BENCHMARK_LIBS
+            OpenKit
+            ${ZLIB_LIBRARY}
+            ${CURL_LIBRARY})
+    endif()
+
+    open_kit_build_executable(openkit-benchmarks "${BENCHMARK_INCLUDE_DIRS}" "${BENCHMARK_LIBS}" ${OPENKIT_BENCHMARK_SOURCES})
+    enforce_cxx11_standard(openkit-benchmarks)
+    if (NOT BUILD_SHARED_LIBS OR OPENKIT_MONOLITHIC_SHARED_LIB)
+        target_compile_definitions(openkit-benchmarks PRIVATE -DCURL_STATICLIB)
+    endif()
+    target_compile_definitions(openkit-benchmarks PRIVATE -DOPENKIT_STATIC_DEFINE)
+
+    if (WIN32 AND BUILD_SHARED_LIBS AND NOT OPENKIT_MONOLITHIC_SHARED_LIB)
+        add_custom_command ( TARGET openkit-benchmarks POST_BUILD
+            COMMAND ${CMAKE_COMMAND} -E copy_if_different $<TARGET_FILE:zlib> $<TARGET_FILE_DIR:openkit-benchmarks>
+            COMMAND ${CMAKE_COMMAND} -E copy_if_different $<TARGET_FILE:libcurl> $<TARGET_FILE_DIR:openkit-benchmarks>  )
+    endif()
+
+    set_target_properties(openkit-benchmarks PROPERTIES FOLDER Benchmarks)
+    source_group("Source Files" FILES ${OPENKIT_BENCHMARK_SOURCES})
+
+    ## the load generator only uses the public API,
+    ## the mock collector is implemented with POSIX sockets and therefore not available on Windows
+    if (NOT WIN32)
+        set(LOADTEST_INCLUDE_DIRS
+            ${ZLIB_INCLUDE_DIR}
+            ${OpenKit_SOURCE_DIR}/include
+            ${OpenKit_BINARY_DIR}/include
+            ${OpenKit_SOURCE_DIR}/benchmarks/src
+        )
+
+        set(LOADTEST_LIBS
+            OpenKit
+            ${ZLIB_LIBRARY})
+        if (NOT OPENKIT_MONOLITHIC_SHARED_LIB)
+            set(LOADTEST_LIBS
+                ${LOADTEST_LIBS}
+                ${CURL_LIBRARY})
+        endif()
+
+        open_kit_build_executable(openkit-loadtest "${LOADTEST_INCLUDE_DIRS}" "${LOADTEST_LIBS}" ${OPENKIT_LOADTEST_SOURCES})
+        enforce_cxx11_standard(openkit-loadtest)
+        if (NOT BUILD_SHARED_LIBS)
+            target_compile_definitions(openkit-loadtest PRIVATE -DOPENKIT_STATIC_DEFINE)
+        endif()
+
+        set_target_properties(openkit-loadtest PROPERTIES FOLDER Benchmarks)
+        source_group("Source Files" FILES ${OPENKIT_LOADTEST_SOURCES})
+    endif()
+endfunction()
@@ -0,0 +1,168 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _BENCHMARKS_LOADTEST_LATENCYHISTOGRAM_H
+#define _BENCHMARKS_LOADTEST_LATENCYHISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace loadtest
+{
+	///
+	/// Histogram of latencies in nanoseconds with a relative precision of about 6 percent.
+	///
+	/// @par
+	/// Values below 16 get their own bucket, every larger power of two range is divided into 16 buckets.
+	/// The memory needed is constant, so recording does not influence the measured memory consumption.
+	/// A histogram must only be recorded by a single thread, histograms of several threads are merged.
+	///
+	class LatencyHistogram
+	{
+	public:
+
+		LatencyHistogram()
+			: mBuckets()
+			, mCount(0)
+			, mMax(0)
+		{
+			mBuckets.fill(0);
+		}
+
+		///
+		/// Records the given latency
+		/// @param[in] nanoseconds the latency in nanoseconds
+		///
+		void record(int64_t nanoseconds)
+		{
+			auto value = nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0;
+			mBuckets[getBucketIndex(value)]++;
+			mCount++;
+			if (value > mMax)
+			{
+				mMax = value;
+			}
+		}
+
+		///
+		/// Adds all values recorded by the given histogram to this one
+		///
+		void merge(const LatencyHistogram& other)
+		{
+			for (size_t i = 0; i < NUMBER_OF_BUCKETS; i++)
+			{
+				mBuckets[i] += other.mBuckets[i];
+			}
+			mCount += other.mCount;
+			if (other.mMax > mMax)
+			{
+				mMax = other.mMax;
+			}
+		}
+
+		///
+		/// Returns the number of recorded values
+		///
+		uint64_t getCount() const
+		{
+			return mCount;
+		}
+
+		///
+		/// Returns the largest recorded value
+		///
+		uint64_t getMax() const
+		{
+			return mMax;
+		}
+
+		///
+		/// Returns the value below which the given percentage of the recorded values are, i.e. the lower bound of its bucket
+		/// @param[in] percentile the percentile, e.g. @c 99.9
+		///
+		uint64_t getPercentile(double percentile) const
+		{
+			if (mCount == 0)
+			{
+				return 0;
+			}
+
+			auto rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(mCount));
+			uint64_t numberOfValues = 0;
+			for (size_t i = 0; i < NUMBER_OF_BUCKETS; i++)
+			{
+				numberOfValues += mBuckets[i];
+				if (numberOfValues > rank)
+				{
+					return getBucketLowerBound(i);
+				}
+			}
+
+			return mMax;
+		}
+
+	private:
+
+		/// number of buckets each power of two range is divided into
+		static constexpr uint32_t SUB_BUCKET_BITS = 4;
+		static constexpr uint64_t SUB_BUCKETS = uint64_t(1) << SUB_BUCKET_BITS;
+
+		/// values up to 2^64 are covered
+		static constexpr size_t NUMBER_OF_BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+		static size_t getBucketIndex(uint64_t value)
+		{
+			if (value < SUB_BUCKETS)
+			{
+				return static_cast<size_t>(value);
+			}
+
+			uint32_t highestBit = 0;
+			for (auto remaining = value >> 1; remaining != 0; remaining >>= 1)
+			{
+				highestBit++;
+			}
+
+			auto shift = highestBit - SUB_BUCKET_BITS;
+			auto subBucket = (value >> shift) & (SUB_BUCKETS - 1);
+			return static_cast<size_t>(SUB_BUCKETS + shift * SUB_BUCKETS + subBucket);
+		}
+
+		static uint64_t getBucketLowerBound(size_t index)
+		{
+			if (index < SUB_BUCKETS)
+			{
+				return index;
+			}
+
+			auto shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+			auto subBucket = (index - SUB_BUCKETS) % SUB_BUCKETS;
+			return (SUB_BUCKETS + subBucket) << shift;
+		}
+
+		/// number of recorded values per bucket
+		std::array<uint64_t, NUMBER_OF_BUCKETS> mBuckets;
+
+		/// number of recorded values
+		uint64_t mCount;
+
+		/// largest recorded value
+		uint64_t mMax;
+	};
+}
+
+#endif
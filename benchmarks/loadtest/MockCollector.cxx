@@ -0,0 +1,481 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MockCollector.h"
+
+#include "zlib.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace loadtest;
+
+namespace
+{
+	/// time after which blocking socket operations check whether the collector is stopped
+	constexpr int32_t POLL_TIMEOUT_MILLIS = 100;
+
+	/// size of the buffer data is received into
+	constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+#ifdef MSG_NOSIGNAL
+	constexpr int32_t SEND_FLAGS = MSG_NOSIGNAL;
+#else
+	constexpr int32_t SEND_FLAGS = 0;
+#endif
+
+	bool sendAll(int32_t socket, const std::string& data)
+	{
+		size_t offset = 0;
+		while (offset < data.size())
+		{
+			auto sent = send(socket, data.data() + offset, data.size() - offset, SEND_FLAGS);
+			if (sent <= 0)
+			{
+				return false;
+			}
+			offset += static_cast<size_t>(sent);
+		}
+
+		return true;
+	}
+
+	bool waitForData(int32_t socket)
+	{
+		struct pollfd descriptor;
+		descriptor.fd = socket;
+		descriptor.events = POLLIN;
+		descriptor.revents = 0;
+
+		return poll(&descriptor, 1, POLL_TIMEOUT_MILLIS) > 0;
+	}
+
+	std::string toLowerCase(std::string value)
+	{
+		std::transform(value.begin(), value.end(), value.begin(), [](unsigned char character)
+		{
+			return static_cast<char>(std::tolower(character));
+		});
+
+		return value;
+	}
+
+	///
+	/// Request line and the headers relevant for the beacon protocol
+	///
+	struct RequestHeader
+	{
+		RequestHeader()
+			: method()
+			, target()
+			, contentLength(0)
+			, isGzipEncoded(false)
+			, isContinueExpected(false)
+			, isConnectionClosed(false)
+		{
+		}
+
+		std::string method;
+		std::string target;
+		size_t contentLength;
+		bool isGzipEncoded;
+		bool isContinueExpected;
+		bool isConnectionClosed;
+	};
+
+	RequestHeader parseRequestHeader(const std::string& header)
+	{
+		RequestHeader result;
+
+		auto lineEnd = header.find("\r\n");
+		auto requestLine = header.substr(0, lineEnd);
+		auto methodEnd = requestLine.find(' ');
+		auto targetEnd = requestLine.find(' ', methodEnd + 1);
+		result.method = requestLine.substr(0, methodEnd);
+		result.target = requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+
+		while (lineEnd != std::string::npos && lineEnd + 2 < header.size())
+		{
+			auto lineStart = lineEnd + 2;
+			lineEnd = header.find("\r\n", lineStart);
+			auto line = header.substr(lineStart, lineEnd == std::string::npos ? std::string::npos : lineEnd - lineStart);
+
+			auto separator = line.find(':');
+			if (separator == std::string::npos)
+			{
+				continue;
+			}
+
+			auto name = toLowerCase(line.substr(0, separator));
+			auto valueStart = line.find_first_not_of(' ', separator + 1);
+			auto value = valueStart == std::string::npos ? std::string() : toLowerCase(line.substr(valueStart));
+
+			if (name == "content-length")
+			{
+				result.contentLength = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+			}
+			else if (name == "content-encoding")
+			{
+				result.isGzipEncoded = value.find("gzip") != std::string::npos;
+			}
+			else if (name == "expect")
+			{
+				result.isContinueExpected = value == "100-continue";
+			}
+			else if (name == "connection")
+			{
+				result.isConnectionClosed = value == "close";
+			}
+		}
+
+		return result;
+	}
+
+	bool decompress(const std::string& input, std::string& output)
+	{
+		z_stream stream;
+		stream.zalloc = Z_NULL;
+		stream.zfree = Z_NULL;
+		stream.opaque = Z_NULL;
+		stream.avail_in = 0;
+		stream.next_in = Z_NULL;
+
+		// automatically detect gzip or zlib encoded data
+		if (inflateInit2(&stream, 32 + MAX_WBITS) != Z_OK)
+		{
+			return false;
+		}
+
+		stream.avail_in = static_cast<uInt>(input.size());
+		stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+
+		char chunk[16 * 1024];
+		int32_t result = Z_OK;
+		do
+		{
+			stream.avail_out = sizeof(chunk);
+			stream.next_out = reinterpret_cast<Bytef*>(chunk);
+			result = inflate(&stream, Z_NO_FLUSH);
+			if (result != Z_OK && result != Z_STREAM_END)
+			{
+				inflateEnd(&stream);
+				return false;
+			}
+			output.append(chunk, sizeof(chunk) - stream.avail_out);
+		} while (result != Z_STREAM_END && stream.avail_in > 0);
+
+		inflateEnd(&stream);
+		return result == Z_STREAM_END;
+	}
+
+	int64_t countRecords(const std::string& beaconData)
+	{
+		// every record starts with its event type, records are separated by '&'
+		int64_t numberOfRecords = 0;
+		size_t position = 0;
+		while ((position = beaconData.find("et=", position)) != std::string::npos)
+		{
+			if (position == 0 || beaconData[position - 1] == '&')
+			{
+				numberOfRecords++;
+			}
+			position += 3;
+		}
+
+		return numberOfRecords;
+	}
+
+	std::string createResponse(int32_t statusCode, const char* reason, const std::string& additionalHeaders, const std::string& body)
+	{
+		std::string response("HTTP/1.1 ");
+		response.append(std::to_string(statusCode)).append(" ").append(reason).append("\r\n");
+		response.append("Content-Type: text/plain\r\n");
+		response.append("Content-Length: ").append(std::to_string(body.size())).append("\r\n");
+		response.append(additionalHeaders);
+		response.append("\r\n");
+		response.append(body);
+
+		return response;
+	}
+}
+
+MockCollector::MockCollector(const MockCollectorConfiguration& configuration)
+	: mConfiguration(configuration)
+	, mListeningSocket(-1)
+	, mPort(0)
+	, mIsRunning(false)
+	, mAcceptThread()
+	, mConnectionThreads()
+	, mConnectionThreadsMutex()
+	, mNumberOfStatusRequests(0)
+	, mNumberOfNewSessionRequests(0)
+	, mNumberOfBeaconRequests(0)
+	, mNumberOfTooManyRequestsResponses(0)
+	, mNumberOfCompressedBytes(0)
+	, mNumberOfUncompressedBytes(0)
+	, mNumberOfRecords(0)
+	, mNumberOfMalformedRequests(0)
+{
+}
+
+MockCollector::~MockCollector()
+{
+	stop();
+}
+
+uint16_t MockCollector::start()
+{
+	mListeningSocket = socket(AF_INET, SOCK_STREAM, 0);
+	if (mListeningSocket < 0)
+	{
+		return 0;
+	}
+
+	int32_t reuseAddress = 1;
+	setsockopt(mListeningSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(mConfiguration.port);
+
+	socklen_t addressLength = sizeof(address);
+	if (bind(mListeningSocket, reinterpret_cast<struct sockaddr*>(&address), addressLength) != 0
+		|| listen(mListeningSocket, SOMAXCONN) != 0
+		|| getsockname(mListeningSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength) != 0)
+	{
+		close(mListeningSocket);
+		mListeningSocket = -1;
+		return 0;
+	}
+
+	mPort = ntohs(address.sin_port);
+	mIsRunning = true;
+	mAcceptThread = std::thread(&MockCollector::acceptConnections, this);
+
+	return mPort;
+}
+
+void MockCollector::stop()
+{
+	if (!mIsRunning.exchange(false))
+	{
+		return;
+	}
+
+	mAcceptThread.join();
+	close(mListeningSocket);
+	mListeningSocket = -1;
+
+	// the connection threads notice the stop within the poll timeout
+	std::lock_guard<std::mutex> lock(mConnectionThreadsMutex);
+	for (auto& thread : mConnectionThreads)
+	{
+		thread.join();
+	}
+	mConnectionThreads.clear();
+}
+
+std::string MockCollector::getEndpointURL() const
+{
+	return "http://127.0.0.1:" + std::to_string(mPort) + "/mbeacon";
+}
+
+MockCollectorStatistics MockCollector::getStatistics() const
+{
+	MockCollectorStatistics statistics;
+	statistics.numberOfStatusRequests = mNumberOfStatusRequests.load();
+	statistics.numberOfNewSessionRequests = mNumberOfNewSessionRequests.load();
+	statistics.numberOfBeaconRequests = mNumberOfBeaconRequests.load();
+	statistics.numberOfTooManyRequestsResponses = mNumberOfTooManyRequestsResponses.load();
+	statistics.numberOfCompressedBytes = mNumberOfCompressedBytes.load();
+	statistics.numberOfUncompressedBytes = mNumberOfUncompressedBytes.load();
+	statistics.numberOfRecords = mNumberOfRecords.load();
+	statistics.numberOfMalformedRequests = mNumberOfMalformedRequests.load();
+
+	return statistics;
+}
+
+void MockCollector::acceptConnections()
+{
+	while (mIsRunning)
+	{
+		if (!waitForData(mListeningSocket))
+		{
+			continue;
+		}
+
+		auto connection = accept(mListeningSocket, nullptr, nullptr);
+		if (connection < 0)
+		{
+			continue;
+		}
+
+		int32_t noDelay = 1;
+		setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+		std::lock_guard<std::mutex> lock(mConnectionThreadsMutex);
+		mConnectionThreads.emplace_back(&MockCollector::serveConnection, this, connection);
+	}
+}
+
+void MockCollector::serveConnection(int32_t socket)
+{
+	std::string buffer;
+	std::vector<char> receiveBuffer(RECEIVE_BUFFER_SIZE);
+	bool isContinueSent = false;
+	bool isConnectionClosed = false;
+
+	while (mIsRunning && !isConnectionClosed)
+	{
+		if (!waitForData(socket))
+		{
+			continue;
+		}
+
+		auto received = recv(socket, receiveBuffer.data(), receiveBuffer.size(), 0);
+		if (received <= 0)
+		{
+			break;
+		}
+		buffer.append(receiveBuffer.data(), static_cast<size_t>(received));
+
+		// handle all complete requests in the buffer
+		while (!isConnectionClosed)
+		{
+			auto headerEnd = buffer.find("\r\n\r\n");
+			if (headerEnd == std::string::npos)
+			{
+				break;
+			}
+
+			auto header = parseRequestHeader(buffer.substr(0, headerEnd));
+			auto bodyStart = headerEnd + 4;
+			if (buffer.size() < bodyStart + header.contentLength)
+			{
+				if (header.isContinueExpected && !isContinueSent)
+				{
+					isContinueSent = sendAll(socket, "HTTP/1.1 100 Continue\r\n\r\n");
+				}
+				break;
+			}
+
+			auto body = buffer.substr(bodyStart, header.contentLength);
+			buffer.erase(0, bodyStart + header.contentLength);
+			isContinueSent = false;
+
+			auto response = handleRequest(header.method, header.target, body, header.isGzipEncoded);
+			isConnectionClosed = !sendAll(socket, response) || header.isConnectionClosed;
+		}
+	}
+
+	close(socket);
+}
+
+std::string MockCollector::handleRequest(const std::string& method, const std::string& target, const std::string& body, bool isGzipEncoded)
+{
+	if (mConfiguration.latencyInMillis > 0)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(mConfiguration.latencyInMillis));
+	}
+
+	if (method == "POST")
+	{
+		if (isTooManyRequests())
+		{
+			mNumberOfTooManyRequestsResponses++;
+			auto retryAfter = "Retry-After: " + std::to_string(mConfiguration.retryAfterInSeconds) + "\r\n";
+			return createResponse(429, "Too Many Requests", retryAfter, "");
+		}
+
+		handleBeaconData(body, isGzipEncoded);
+	}
+	else if (target.find("&ns=1") != std::string::npos)
+	{
+		mNumberOfNewSessionRequests++;
+	}
+	else
+	{
+		mNumberOfStatusRequests++;
+	}
+
+	return createResponse(200, "OK", "", createStatusResponseBody());
+}
+
+void MockCollector::handleBeaconData(const std::string& body, bool isGzipEncoded)
+{
+	mNumberOfCompressedBytes += static_cast<int64_t>(body.size());
+
+	std::string beaconData;
+	if (!isGzipEncoded)
+	{
+		beaconData = body;
+	}
+	else if (!decompress(body, beaconData))
+	{
+		mNumberOfMalformedRequests++;
+		return;
+	}
+
+	mNumberOfUncompressedBytes += static_cast<int64_t>(beaconData.size());
+	mNumberOfRecords += countRecords(beaconData);
+}
+
+bool MockCollector::isTooManyRequests()
+{
+	auto requestNumber = ++mNumberOfBeaconRequests;
+	auto percentage = static_cast<int64_t>(mConfiguration.tooManyRequestsPercentage);
+
+	// spread the rejected requests evenly, e.g. every 4th request for 25 percent
+	return (requestNumber * percentage) / 100 != ((requestNumber - 1) * percentage) / 100;
+}
+
+std::string MockCollector::createStatusResponseBody() const
+{
+	char body[512];
+	if (mConfiguration.responseFormat == ResponseFormat::KEY_VALUE)
+	{
+		snprintf(body, sizeof(body), "type=m&si=%lld&bl=%lld&id=1&cp=1&cr=1&er=1&mp=1",
+			static_cast<long long>(mConfiguration.sendIntervalInSeconds),
+			static_cast<long long>(mConfiguration.maxBeaconSizeInKB));
+	}
+	else
+	{
+		auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+		snprintf(body, sizeof(body),
+			"{\"mobileAgentConfig\":{\"maxBeaconSizeKb\":%lld,\"sendIntervalSec\":%lld},"
+			"\"appConfig\":{\"capture\":1,\"reportCrashes\":1,\"reportErrors\":1},"
+			"\"dynamicConfig\":{\"multiplicity\":1,\"serverId\":1},"
+			"\"timestamp\":%lld}",
+			static_cast<long long>(mConfiguration.maxBeaconSizeInKB),
+			static_cast<long long>(mConfiguration.sendIntervalInSeconds),
+			static_cast<long long>(timestamp));
+	}
+
+	return body;
+}
@@ -0,0 +1,202 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _BENCHMARKS_LOADTEST_MOCKCOLLECTOR_H
+#define _BENCHMARKS_LOADTEST_MOCKCOLLECTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace loadtest
+{
+	///
+	/// Format of the status responses sent by the @ref MockCollector
+	///
+	enum class ResponseFormat
+	{
+		/// key-value pairs as sent by AppMon, e.g. @c type=m&si=120
+		KEY_VALUE,
+		/// JSON as sent by Dynatrace clusters
+		JSON
+	};
+
+	///
+	/// Configuration of the @ref MockCollector
+	///
+	struct MockCollectorConfiguration
+	{
+		MockCollectorConfiguration()
+			: port(0)
+			, responseFormat(ResponseFormat::JSON)
+			, latencyInMillis(0)
+			, tooManyRequestsPercentage(0)
+			, retryAfterInSeconds(1)
+			, sendIntervalInSeconds(1)
+			, maxBeaconSizeInKB(150)
+		{
+		}
+
+		/// port to listen on, @c 0 picks a free port
+		uint16_t port;
+
+		/// format of the status responses
+		ResponseFormat responseFormat;
+
+		/// time to wait before answering a request
+		int64_t latencyInMillis;
+
+		/// percentage of beacon requests answered with status code 429 (too many requests)
+		uint32_t tooManyRequestsPercentage;
+
+		/// value of the Retry-After header of 429 responses
+		int64_t retryAfterInSeconds;
+
+		/// send interval configured in OpenKit by the status responses
+		int64_t sendIntervalInSeconds;
+
+		/// maximum beacon size configured in OpenKit by the status responses
+		int64_t maxBeaconSizeInKB;
+	};
+
+	///
+	/// Counters of the requests received by the @ref MockCollector
+	///
+	struct MockCollectorStatistics
+	{
+		/// number of status requests, i.e. GET requests without new session flag
+		int64_t numberOfStatusRequests;
+
+		/// number of new session requests
+		int64_t numberOfNewSessionRequests;
+
+		/// number of beacon requests, i.e. POST requests
+		int64_t numberOfBeaconRequests;
+
+		/// number of requests answered with status code 429
+		int64_t numberOfTooManyRequestsResponses;
+
+		/// number of request body bytes as sent over the wire
+		int64_t numberOfCompressedBytes;
+
+		/// number of request body bytes after gzip decoding
+		int64_t numberOfUncompressedBytes;
+
+		/// number of beacon records (actions, events, values, web requests, ...) received
+		int64_t numberOfRecords;
+
+		/// number of malformed requests, e.g. with a body which could not be decoded
+		int64_t numberOfMalformedRequests;
+	};
+
+	///
+	/// Minimal HTTP/1.1 server on the loopback interface speaking the beacon protocol.
+	///
+	/// @par
+	/// Status and new session requests are answered with a status response configuring capture, the send interval
+	/// and the beacon size. Beacon requests are gzip decoded and the contained records are counted.
+	/// Each connection is served by its own thread, keep-alive connections are supported.
+	///
+	class MockCollector
+	{
+	public:
+
+		///
+		/// Constructor
+		/// @param[in] configuration the configuration of this collector
+		///
+		explicit MockCollector(const MockCollectorConfiguration& configuration);
+
+		MockCollector(const MockCollector&) = delete;
+
+		MockCollector& operator=(const MockCollector&) = delete;
+
+		///
+		/// Destructor stopping the collector
+		///
+		~MockCollector();
+
+		///
+		/// Starts listening and accepting connections
+		/// @returns the port the collector listens on, @c 0 if it could not be started
+		///
+		uint16_t start();
+
+		///
+		/// Stops accepting connections and waits until all connections are closed
+		///
+		void stop();
+
+		///
+		/// Returns the URL OpenKit sends its requests to
+		///
+		std::string getEndpointURL() const;
+
+		///
+		/// Returns a snapshot of the request counters
+		///
+		MockCollectorStatistics getStatistics() const;
+
+	private:
+
+		void acceptConnections();
+
+		void serveConnection(int32_t socket);
+
+		std::string handleRequest(const std::string& method, const std::string& target, const std::string& body, bool isGzipEncoded);
+
+		void handleBeaconData(const std::string& body, bool isGzipEncoded);
+
+		bool isTooManyRequests();
+
+		std::string createStatusResponseBody() const;
+
+		/// configuration of this collector
+		const MockCollectorConfiguration mConfiguration;
+
+		/// socket accepting connections, @c -1 if not started
+		int32_t mListeningSocket;
+
+		/// port the collector listens on
+		uint16_t mPort;
+
+		/// flag indicating whether the collector is running
+		std::atomic<bool> mIsRunning;
+
+		/// thread accepting connections
+		std::thread mAcceptThread;
+
+		/// threads serving the accepted connections
+		std::list<std::thread> mConnectionThreads;
+
+		/// mutex guarding the connection threads
+		std::mutex mConnectionThreadsMutex;
+
+		std::atomic<int64_t> mNumberOfStatusRequests;
+		std::atomic<int64_t> mNumberOfNewSessionRequests;
+		std::atomic<int64_t> mNumberOfBeaconRequests;
+		std::atomic<int64_t> mNumberOfTooManyRequestsResponses;
+		std::atomic<int64_t> mNumberOfCompressedBytes;
+		std::atomic<int64_t> mNumberOfUncompressedBytes;
+		std::atomic<int64_t> mNumberOfRecords;
+		std::atomic<int64_t> mNumberOfMalformedRequests;
+	};
+}
+
+#endif
@@ -0,0 +1,844 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// End-to-end load generator for OpenKit.
+/// A local mock collector speaking the beacon protocol is started and OpenKit sends its beacons to it, while
+/// a configurable number of threads create sessions and report actions, events, values and web requests.
+/// The latency percentiles of the API calls, the throughput, the upload volume, the peak memory consumption
+/// and the outcome of the final flush are reported.
+///
+/// With --serialization compare the load is generated twice within this process, with events serialized on the
+/// reporting thread and with deferred serialization, and the p50/p99 latencies of both runs are reported side by side.
+///
+/// With --sidecar-workers the load is generated by the given number of worker processes in sidecar mode instead,
+/// each running the configured number of threads, and the openkit-agent process sends their data to the collector.
+///
+/// Usage: openkit-loadtest [options]
+///   --threads <n>                    number of threads creating sessions (default 4)
+///   --sessions <n>                   number of sessions created by each thread (default 10)
+///   --actions <n>                    number of actions per session (default 100)
+///   --events <n>                     number of events per action (default 5)
+///   --values <n>                     number of values per action (default 2)
+///   --web-requests <n>               number of traced web requests per action (default 1)
+///   --latency <ms>                   time the collector waits before answering (default 0)
+///   --too-many-requests-percent <p>  percentage of beacon requests answered with 429 (default 0)
+///   --retry-after <s>                value of the Retry-After header of 429 responses (default 1)
+///   --response-format <kv|json>      format of the status responses (default json)
+///   --send-interval <s>              send interval configured by the collector (default 1)
+///   --flush-timeout <ms>             timeout of the final flush on shutdown (default 10000)
+///   --serialization <mode>           immediate, deferred or compare, which runs the load in both modes (default immediate)
+///   --sidecar-workers <n>            number of worker processes in sidecar mode (default 0, i.e. in-process)
+///   --sidecar-ring-capacity <bytes>  ring buffer capacity of each worker process (default 1 MiB)
+///   --agent <path>                   the openkit-agent executable (default: next to this executable)
+
+#include "LatencyHistogram.h"
+#include "MockCollector.h"
+#include "NullLogger.h"
+
+#include "OpenKit.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+	///
+	/// Serialization of the reported events
+	///
+	enum class SerializationMode
+	{
+		IMMEDIATE,
+		DEFERRED,
+		COMPARE
+	};
+
+	///
+	/// Options of a load test run
+	///
+	struct LoadTestOptions
+	{
+		LoadTestOptions()
+			: numberOfThreads(4)
+			, numberOfSessionsPerThread(10)
+			, numberOfActionsPerSession(100)
+			, numberOfEventsPerAction(5)
+			, numberOfValuesPerAction(2)
+			, numberOfWebRequestsPerAction(1)
+			, flushTimeoutInMillis(10000)
+			, serializationMode(SerializationMode::IMMEDIATE)
+			, numberOfSidecarWorkers(0)
+			, sidecarRingCapacity(-1)
+			, agentPath()
+			, collector()
+		{
+		}
+
+		uint32_t numberOfThreads;
+		uint32_t numberOfSessionsPerThread;
+		uint32_t numberOfActionsPerSession;
+		uint32_t numberOfEventsPerAction;
+		uint32_t numberOfValuesPerAction;
+		uint32_t numberOfWebRequestsPerAction;
+		int64_t flushTimeoutInMillis;
+		SerializationMode serializationMode;
+		uint32_t numberOfSidecarWorkers;
+		int64_t sidecarRingCapacity;
+		std::string agentPath;
+		loadtest::MockCollectorConfiguration collector;
+	};
+
+	///
+	/// Operations whose latency is measured
+	///
+	enum Operation
+	{
+		CREATE_SESSION,
+		ENTER_ACTION,
+		REPORT_EVENT,
+		REPORT_VALUE,
+		TRACE_WEB_REQUEST,
+		LEAVE_ACTION,
+		END_SESSION,
+		NUMBER_OF_OPERATIONS
+	};
+
+	const char* const OPERATION_NAMES[NUMBER_OF_OPERATIONS] =
+	{
+		"createSession",
+		"enterAction",
+		"reportEvent",
+		"reportValue",
+		"traceWebRequest",
+		"leaveAction",
+		"endSession"
+	};
+
+	///
+	/// Result of a worker process in sidecar mode, passed as raw bytes to the parent process
+	///
+	struct WorkerResult
+	{
+		loadtest::LatencyHistogram histograms[NUMBER_OF_OPERATIONS];
+		int64_t numberOfDroppedRecords;
+		int64_t numberOfDroppedBytes;
+		int64_t numberOfAddedRecords;
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	int64_t elapsedNanos(const Clock::time_point& start)
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+	}
+
+	///
+	/// Returns the peak resident set size of this process in bytes
+	///
+	int64_t getPeakResidentSetSize()
+	{
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+		{
+			return 0;
+		}
+#if defined(__APPLE__)
+		return static_cast<int64_t>(usage.ru_maxrss);
+#else
+		return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+	}
+
+	void printUsage(const char* program)
+	{
+		fprintf(stderr, "Usage: %s [--threads <n>] [--sessions <n>] [--actions <n>] [--events <n>] [--values <n>]"
+			" [--web-requests <n>] [--latency <ms>] [--too-many-requests-percent <p>] [--retry-after <s>]"
+			" [--response-format <kv|json>] [--send-interval <s>] [--flush-timeout <ms>]"
+			" [--serialization <immediate|deferred|compare>]"
+			" [--sidecar-workers <n>] [--sidecar-ring-capacity <bytes>] [--agent <path>]\n", program);
+	}
+
+	bool parseOptions(int32_t argc, char** argv, LoadTestOptions& options)
+	{
+		for (int32_t i = 1; i < argc; i++)
+		{
+			if (i + 1 >= argc)
+			{
+				return false;
+			}
+
+			const char* option = argv[i];
+			const char* value = argv[++i];
+			auto number = std::strtoll(value, nullptr, 10);
+
+			if (strcmp(option, "--threads") == 0)
+			{
+				options.numberOfThreads = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--sessions") == 0)
+			{
+				options.numberOfSessionsPerThread = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--actions") == 0)
+			{
+				options.numberOfActionsPerSession = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--events") == 0)
+			{
+				options.numberOfEventsPerAction = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--values") == 0)
+			{
+				options.numberOfValuesPerAction = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--web-requests") == 0)
+			{
+				options.numberOfWebRequestsPerAction = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--latency") == 0)
+			{
+				options.collector.latencyInMillis = number;
+			}
+			else if (strcmp(option, "--too-many-requests-percent") == 0)
+			{
+				options.collector.tooManyRequestsPercentage = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--retry-after") == 0)
+			{
+				options.collector.retryAfterInSeconds = number;
+			}
+			else if (strcmp(option, "--response-format") == 0)
+			{
+				if (strcmp(value, "kv") == 0)
+				{
+					options.collector.responseFormat = loadtest::ResponseFormat::KEY_VALUE;
+				}
+				else if (strcmp(value, "json") == 0)
+				{
+					options.collector.responseFormat = loadtest::ResponseFormat::JSON;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else if (strcmp(option, "--send-interval") == 0)
+			{
+				options.collector.sendIntervalInSeconds = number;
+			}
+			else if (strcmp(option, "--flush-timeout") == 0)
+			{
+				options.flushTimeoutInMillis = number;
+			}
+			else if (strcmp(option, "--serialization") == 0)
+			{
+				if (strcmp(value, "immediate") == 0)
+				{
+					options.serializationMode = SerializationMode::IMMEDIATE;
+				}
+				else if (strcmp(value, "deferred") == 0)
+				{
+					options.serializationMode = SerializationMode::DEFERRED;
+				}
+				else if (strcmp(value, "compare") == 0)
+				{
+					options.serializationMode = SerializationMode::COMPARE;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else if (strcmp(option, "--sidecar-workers") == 0)
+			{
+				options.numberOfSidecarWorkers = static_cast<uint32_t>(number);
+			}
+			else if (strcmp(option, "--sidecar-ring-capacity") == 0)
+			{
+				options.sidecarRingCapacity = number;
+			}
+			else if (strcmp(option, "--agent") == 0)
+			{
+				options.agentPath = value;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// events of worker processes in sidecar mode are serialized by the agent
+		return options.numberOfThreads > 0
+			&& (options.numberOfSidecarWorkers == 0 || options.serializationMode == SerializationMode::IMMEDIATE);
+	}
+
+	///
+	/// Creates the sessions of a single thread and records the latencies of all API calls
+	///
+	void generateLoad(std::shared_ptr<openkit::IOpenKit> openKit, const LoadTestOptions& options, uint32_t threadIndex,
+		std::vector<loadtest::LatencyHistogram>& histograms)
+	{
+		auto userTag = "user-" + std::to_string(threadIndex);
+
+		for (uint32_t s = 0; s < options.numberOfSessionsPerThread; s++)
+		{
+			auto start = Clock::now();
+			auto session = openKit->createSession("127.0.0.1");
+			histograms[CREATE_SESSION].record(elapsedNanos(start));
+
+			session->identifyUser(userTag.c_str());
+
+			for (uint32_t a = 0; a < options.numberOfActionsPerSession; a++)
+			{
+				start = Clock::now();
+				auto action = session->enterAction("loadtest action");
+				histograms[ENTER_ACTION].record(elapsedNanos(start));
+
+				for (uint32_t e = 0; e < options.numberOfEventsPerAction; e++)
+				{
+					start = Clock::now();
+					action->reportEvent("loadtest event");
+					histograms[REPORT_EVENT].record(elapsedNanos(start));
+				}
+
+				for (uint32_t v = 0; v < options.numberOfValuesPerAction; v++)
+				{
+					start = Clock::now();
+					action->reportValue("loadtest value", static_cast<int32_t>(v));
+					histograms[REPORT_VALUE].record(elapsedNanos(start));
+				}
+
+				for (uint32_t w = 0; w < options.numberOfWebRequestsPerAction; w++)
+				{
+					start = Clock::now();
+					action->traceWebRequest("http://example.com/loadtest")->start()->stop(200);
+					histograms[TRACE_WEB_REQUEST].record(elapsedNanos(start));
+				}
+
+				start = Clock::now();
+				action->leaveAction();
+				histograms[LEAVE_ACTION].record(elapsedNanos(start));
+			}
+
+			start = Clock::now();
+			session->end();
+			histograms[END_SESSION].record(elapsedNanos(start));
+		}
+	}
+
+	double toMicros(uint64_t nanoseconds)
+	{
+		return static_cast<double>(nanoseconds) / 1000.0;
+	}
+
+	///
+	/// Runs the configured number of threads generating load and returns their merged latencies
+	///
+	std::vector<loadtest::LatencyHistogram> runThreads(std::shared_ptr<openkit::IOpenKit> openKit, const LoadTestOptions& options)
+	{
+		std::vector<std::vector<loadtest::LatencyHistogram>> threadHistograms(options.numberOfThreads,
+			std::vector<loadtest::LatencyHistogram>(NUMBER_OF_OPERATIONS));
+		std::vector<std::thread> threads;
+
+		for (uint32_t i = 0; i < options.numberOfThreads; i++)
+		{
+			threads.emplace_back(generateLoad, openKit, std::cref(options), i, std::ref(threadHistograms[i]));
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		std::vector<loadtest::LatencyHistogram> histograms(NUMBER_OF_OPERATIONS);
+		for (const auto& perThread : threadHistograms)
+		{
+			for (size_t op = 0; op < NUMBER_OF_OPERATIONS; op++)
+			{
+				histograms[op].merge(perThread[op]);
+			}
+		}
+
+		return histograms;
+	}
+
+	void printLatencies(const LoadTestOptions& options, const std::vector<loadtest::LatencyHistogram>& histograms,
+		uint32_t numberOfProcesses, int64_t loadDurationInNanos)
+	{
+		uint64_t numberOfCalls = 0;
+		for (const auto& histogram : histograms)
+		{
+			numberOfCalls += histogram.getCount();
+		}
+		auto loadDurationInSeconds = static_cast<double>(loadDurationInNanos) / 1e9;
+
+		if (numberOfProcesses > 0)
+		{
+			printf("Sidecar mode: %" PRIu32 " worker processes\n", numberOfProcesses);
+		}
+		printf("Load: %" PRIu32 " threads x %" PRIu32 " sessions x %" PRIu32 " actions"
+			" (%" PRIu32 " events, %" PRIu32 " values, %" PRIu32 " web requests per action)\n",
+			options.numberOfThreads, options.numberOfSessionsPerThread, options.numberOfActionsPerSession,
+			options.numberOfEventsPerAction, options.numberOfValuesPerAction, options.numberOfWebRequestsPerAction);
+		printf("Duration: %.3f s, throughput: %.0f calls/s, %.0f events/s\n\n",
+			loadDurationInSeconds,
+			static_cast<double>(numberOfCalls) / loadDurationInSeconds,
+			static_cast<double>(histograms[REPORT_EVENT].getCount()) / loadDurationInSeconds);
+
+		printf("%-16s %12s %10s %10s %10s %10s %10s\n", "operation [us]", "count", "p50", "p90", "p99", "p99.9", "max");
+		for (size_t op = 0; op < NUMBER_OF_OPERATIONS; op++)
+		{
+			const auto& histogram = histograms[op];
+			printf("%-16s %12" PRIu64 " %10.1f %10.1f %10.1f %10.1f %10.1f\n", OPERATION_NAMES[op], histogram.getCount(),
+				toMicros(histogram.getPercentile(50.0)), toMicros(histogram.getPercentile(90.0)),
+				toMicros(histogram.getPercentile(99.0)), toMicros(histogram.getPercentile(99.9)),
+				toMicros(histogram.getMax()));
+		}
+	}
+
+	void printCollectorStatistics(const loadtest::MockCollectorStatistics& collectorStatistics, int64_t totalDurationInNanos)
+	{
+		auto totalDurationInSeconds = static_cast<double>(totalDurationInNanos) / 1e9;
+
+		printf("\nCollector:\n");
+		printf("  status requests:          %" PRId64 "\n", collectorStatistics.numberOfStatusRequests);
+		printf("  new session requests:     %" PRId64 "\n", collectorStatistics.numberOfNewSessionRequests);
+		printf("  beacon requests:          %" PRId64 "\n", collectorStatistics.numberOfBeaconRequests);
+		printf("  429 responses:            %" PRId64 "\n", collectorStatistics.numberOfTooManyRequestsResponses);
+		printf("  malformed requests:       %" PRId64 "\n", collectorStatistics.numberOfMalformedRequests);
+		printf("  records received:         %" PRId64 "\n", collectorStatistics.numberOfRecords);
+		printf("  bytes received:           %" PRId64 " compressed, %" PRId64 " uncompressed\n",
+			collectorStatistics.numberOfCompressedBytes, collectorStatistics.numberOfUncompressedBytes);
+		printf("  upload rate:              %.0f bytes/s\n",
+			static_cast<double>(collectorStatistics.numberOfCompressedBytes) / totalDurationInSeconds);
+	}
+
+	///
+	/// Builds an OpenKit instance sending to the given collector
+	///
+	std::shared_ptr<openkit::IOpenKit> buildOpenKit(const std::string& endpointURL, bool isSerializationDeferred)
+	{
+		openkit::DynatraceOpenKitBuilder builder(endpointURL.c_str(), "loadtest", 1);
+		builder.withLogger(std::make_shared<benchmarks::NullLogger>())
+			.enableStatistics();
+		if (isSerializationDeferred)
+		{
+			builder.enableDeferredSerialization();
+		}
+
+		return builder.build();
+	}
+
+	///
+	/// Generates the load within this process and sends it to the collector
+	///
+	int32_t runInProcess(const LoadTestOptions& options)
+	{
+		loadtest::MockCollector collector(options.collector);
+		if (collector.start() == 0)
+		{
+			fprintf(stderr, "Failed to start the mock collector\n");
+			return 1;
+		}
+
+		auto residentSetSizeBefore = getPeakResidentSetSize();
+
+		auto openKit = buildOpenKit(collector.getEndpointURL(),
+			options.serializationMode == SerializationMode::DEFERRED);
+		if (!openKit->waitForInitCompletion(10000))
+		{
+			fprintf(stderr, "OpenKit did not initialize within 10 seconds\n");
+			openKit->shutdown();
+			return 1;
+		}
+
+		auto loadStart = Clock::now();
+		auto histograms = runThreads(openKit, options);
+		auto loadDurationInNanos = elapsedNanos(loadStart);
+
+		auto openKitStatistics = openKit->getStatistics();
+		auto shutdownStart = Clock::now();
+		auto shutdownResult = openKit->shutdown(options.flushTimeoutInMillis);
+		auto shutdownDurationInNanos = elapsedNanos(shutdownStart);
+		auto totalDurationInNanos = elapsedNanos(loadStart);
+		openKit = nullptr;
+
+		auto residentSetSizeAfter = getPeakResidentSetSize();
+
+		collector.stop();
+		auto collectorStatistics = collector.getStatistics();
+
+		auto numberOfSessions = static_cast<uint64_t>(options.numberOfThreads) * options.numberOfSessionsPerThread;
+
+		printLatencies(options, histograms, 0, loadDurationInNanos);
+		printCollectorStatistics(collectorStatistics, totalDurationInNanos);
+
+		printf("\nOpenKit (before shutdown):\n");
+		printf("  HTTP requests:            %" PRId64 "\n", openKitStatistics.numberOfHTTPRequests);
+		printf("  HTTP retries:             %" PRId64 "\n", openKitStatistics.numberOfHTTPRetries);
+		printf("  HTTP errors:              %" PRId64 "\n", openKitStatistics.numberOfHTTPErrors);
+		printf("  records evicted:          %" PRId64 " by age, %" PRId64 " by space\n",
+			openKitStatistics.numberOfRecordsEvictedByAge, openKitStatistics.numberOfRecordsEvictedBySpace);
+		printf("  cached records:           %" PRId64 " (%" PRId64 " bytes)\n",
+			openKitStatistics.numberOfCachedRecords, openKitStatistics.beaconCacheSizeInBytes);
+
+		printf("\nShutdown:\n");
+		printf("  completed:                %s in %.3f s\n", shutdownResult.isCompleted ? "yes" : "no",
+			static_cast<double>(shutdownDurationInNanos) / 1e9);
+		printf("  records flushed:          %" PRId64 "\n", shutdownResult.numberOfFlushedRecords);
+		printf("  records dropped:          %" PRId64 "\n", shutdownResult.numberOfDroppedRecords);
+
+		printf("\nMemory:\n");
+		printf("  peak resident set size:   %" PRId64 " bytes\n", residentSetSizeAfter);
+		printf("  growth per session:       %.0f bytes\n", numberOfSessions == 0 ? 0.0
+			: static_cast<double>(residentSetSizeAfter - residentSetSizeBefore) / static_cast<double>(numberOfSessions));
+
+		return 0;
+	}
+
+	///
+	/// Generates the load within this process with the given serialization and returns the latencies of the API calls,
+	/// or an empty vector if the collector or OpenKit could not be started
+	///
+	std::vector<loadtest::LatencyHistogram> runSerializationMode(const LoadTestOptions& options, bool isSerializationDeferred)
+	{
+		loadtest::MockCollector collector(options.collector);
+		if (collector.start() == 0)
+		{
+			fprintf(stderr, "Failed to start the mock collector\n");
+			return std::vector<loadtest::LatencyHistogram>();
+		}
+
+		auto openKit = buildOpenKit(collector.getEndpointURL(), isSerializationDeferred);
+		if (!openKit->waitForInitCompletion(10000))
+		{
+			fprintf(stderr, "OpenKit did not initialize within 10 seconds\n");
+			openKit->shutdown();
+			collector.stop();
+			return std::vector<loadtest::LatencyHistogram>();
+		}
+
+		auto histograms = runThreads(openKit, options);
+		openKit->shutdown(options.flushTimeoutInMillis);
+		openKit = nullptr;
+		collector.stop();
+
+		return histograms;
+	}
+
+	///
+	/// Generates the load with immediate and with deferred serialization and reports the latencies side by side
+	///
+	int32_t runSerializationComparison(const LoadTestOptions& options)
+	{
+		auto immediateHistograms = runSerializationMode(options, false);
+		auto deferredHistograms = runSerializationMode(options, true);
+		if (immediateHistograms.empty() || deferredHistograms.empty())
+		{
+			return 1;
+		}
+
+		printf("Load: %" PRIu32 " threads x %" PRIu32 " sessions x %" PRIu32 " actions"
+			" (%" PRIu32 " events, %" PRIu32 " values, %" PRIu32 " web requests per action)\n\n",
+			options.numberOfThreads, options.numberOfSessionsPerThread, options.numberOfActionsPerSession,
+			options.numberOfEventsPerAction, options.numberOfValuesPerAction, options.numberOfWebRequestsPerAction);
+
+		printf("%-16s %12s %12s %12s %12s\n", "", "immediate", "", "deferred", "");
+		printf("%-16s %12s %12s %12s %12s\n", "operation [us]", "p50", "p99", "p50", "p99");
+		for (size_t op = 0; op < NUMBER_OF_OPERATIONS; op++)
+		{
+			printf("%-16s %12.1f %12.1f %12.1f %12.1f\n", OPERATION_NAMES[op],
+				toMicros(immediateHistograms[op].getPercentile(50.0)), toMicros(immediateHistograms[op].getPercentile(99.0)),
+				toMicros(deferredHistograms[op].getPercentile(50.0)), toMicros(deferredHistograms[op].getPercentile(99.0)));
+		}
+
+		return 0;
+	}
+
+	///
+	/// Generates the load of a worker process in sidecar mode, once the parent process closes the start pipe
+	///
+	void runSidecarWorker(const LoadTestOptions& options, const std::string& directory, int32_t startFd, int32_t resultFd)
+	{
+		char buffer;
+		while (read(startFd, &buffer, 1) > 0)
+		{
+		}
+		close(startFd);
+
+		openkit::DynatraceOpenKitBuilder builder("http://localhost/unused", "loadtest", static_cast<int64_t>(getpid()));
+		builder.withLogger(std::make_shared<benchmarks::NullLogger>())
+			.enableStatistics()
+			.withSidecarDirectory(directory.c_str());
+		if (options.sidecarRingCapacity > 0)
+		{
+			builder.withSidecarRingCapacity(options.sidecarRingCapacity);
+		}
+		auto openKit = builder.build();
+
+		auto histograms = runThreads(openKit, options);
+		openKit->shutdown(options.flushTimeoutInMillis);
+		auto statistics = openKit->getStatistics();
+
+		WorkerResult result;
+		for (size_t op = 0; op < NUMBER_OF_OPERATIONS; op++)
+		{
+			result.histograms[op] = histograms[op];
+		}
+		result.numberOfDroppedRecords = statistics.numberOfSidecarRecordsDropped;
+		result.numberOfDroppedBytes = statistics.numberOfSidecarBytesDropped;
+		result.numberOfAddedRecords = statistics.numberOfEventRecordsAdded + statistics.numberOfActionRecordsAdded;
+
+		auto data = reinterpret_cast<const char*>(&result);
+		size_t remaining = sizeof(result);
+		while (remaining > 0)
+		{
+			auto written = write(resultFd, data, remaining);
+			if (written <= 0)
+			{
+				break;
+			}
+			data += written;
+			remaining -= static_cast<size_t>(written);
+		}
+		close(resultFd);
+	}
+
+	bool readWorkerResult(int32_t resultFd, WorkerResult& result)
+	{
+		auto data = reinterpret_cast<char*>(&result);
+		size_t remaining = sizeof(result);
+		while (remaining > 0)
+		{
+			auto numberOfBytes = read(resultFd, data, remaining);
+			if (numberOfBytes <= 0)
+			{
+				break;
+			}
+			data += numberOfBytes;
+			remaining -= static_cast<size_t>(numberOfBytes);
+		}
+		close(resultFd);
+
+		return remaining == 0;
+	}
+
+	std::string getDefaultAgentPath(const char* program)
+	{
+		std::string path(program);
+		auto separator = path.rfind('/');
+		return (separator == std::string::npos ? std::string(".") : path.substr(0, separator)) + "/openkit-agent";
+	}
+
+	std::string createRingDirectory()
+	{
+		// the ring buffers should be located in memory
+		for (const char* base : { "/dev/shm", "/tmp" })
+		{
+			auto directoryTemplate = std::string(base) + "/openkit-loadtest-XXXXXX";
+			std::vector<char> directory(directoryTemplate.begin(), directoryTemplate.end());
+			directory.push_back('\0');
+			if (mkdtemp(directory.data()) != nullptr)
+			{
+				return std::string(directory.data());
+			}
+		}
+
+		return std::string();
+	}
+
+	///
+	/// Generates the load in worker processes in sidecar mode, whose data is sent to the collector by the agent
+	///
+	int32_t runSidecar(const LoadTestOptions& options, const char* program)
+	{
+		auto agentPath = options.agentPath.empty() ? getDefaultAgentPath(program) : options.agentPath;
+		if (access(agentPath.c_str(), X_OK) != 0)
+		{
+			fprintf(stderr, "The agent %s is not executable\n", agentPath.c_str());
+			return 1;
+		}
+
+		auto directory = createRingDirectory();
+		if (directory.empty())
+		{
+			fprintf(stderr, "Failed to create the ring directory\n");
+			return 1;
+		}
+
+		// the workers are forked before any thread is started, they wait for the start pipe to be closed
+		int32_t startPipe[2];
+		if (pipe(startPipe) != 0)
+		{
+			fprintf(stderr, "Failed to create the start pipe\n");
+			return 1;
+		}
+		fflush(stdout);
+
+		std::vector<pid_t> workers;
+		std::vector<int32_t> resultFds;
+		for (uint32_t i = 0; i < options.numberOfSidecarWorkers; i++)
+		{
+			int32_t resultPipe[2];
+			if (pipe(resultPipe) != 0)
+			{
+				fprintf(stderr, "Failed to create the result pipe\n");
+				break;
+			}
+
+			auto pid = fork();
+			if (pid == 0)
+			{
+				close(startPipe[1]);
+				close(resultPipe[0]);
+				for (auto fd : resultFds)
+				{
+					close(fd);
+				}
+				runSidecarWorker(options, directory, startPipe[0], resultPipe[1]);
+				_exit(0);
+			}
+
+			close(resultPipe[1]);
+			if (pid < 0)
+			{
+				close(resultPipe[0]);
+				fprintf(stderr, "Failed to fork worker process\n");
+				break;
+			}
+			workers.push_back(pid);
+			resultFds.push_back(resultPipe[0]);
+		}
+		close(startPipe[0]);
+
+		loadtest::MockCollector collector(options.collector);
+		auto isCollectorStarted = collector.start() != 0;
+		pid_t agent = -1;
+		if (isCollectorStarted)
+		{
+			auto endpointURL = collector.getEndpointURL();
+			auto flushTimeout = std::to_string(options.flushTimeoutInMillis);
+			agent = fork();
+			if (agent == 0)
+			{
+				close(startPipe[1]);
+				execl(agentPath.c_str(), agentPath.c_str(), "--endpoint", endpointURL.c_str(), "--application-id", "loadtest",
+					"--directory", directory.c_str(), "--scan-interval", "100", "--flush-timeout", flushTimeout.c_str(),
+					static_cast<const char*>(nullptr));
+				_exit(127);
+			}
+		}
+		else
+		{
+			fprintf(stderr, "Failed to start the mock collector\n");
+		}
+
+		// start the workers, or let them terminate, if the collector or agent could not be started
+		auto loadStart = Clock::now();
+		close(startPipe[1]);
+
+		std::vector<loadtest::LatencyHistogram> histograms(NUMBER_OF_OPERATIONS);
+		int64_t numberOfDroppedRecords = 0;
+		int64_t numberOfDroppedBytes = 0;
+		int64_t numberOfAddedRecords = 0;
+		uint32_t numberOfFinishedWorkers = 0;
+		for (size_t i = 0; i < workers.size(); i++)
+		{
+			WorkerResult result;
+			if (readWorkerResult(resultFds[i], result))
+			{
+				for (size_t op = 0; op < NUMBER_OF_OPERATIONS; op++)
+				{
+					histograms[op].merge(result.histograms[op]);
+				}
+				numberOfDroppedRecords += result.numberOfDroppedRecords;
+				numberOfDroppedBytes += result.numberOfDroppedBytes;
+				numberOfAddedRecords += result.numberOfAddedRecords;
+				numberOfFinishedWorkers++;
+			}
+			waitpid(workers[i], nullptr, 0);
+		}
+		auto loadDurationInNanos = elapsedNanos(loadStart);
+
+		auto exitCode = 1;
+		if (agent > 0)
+		{
+			// the agent sends the remaining data of all workers on termination
+			fflush(stdout);
+			kill(agent, SIGTERM);
+			int32_t status = 0;
+			waitpid(agent, &status, 0);
+			exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+		}
+		auto totalDurationInNanos = elapsedNanos(loadStart);
+
+		if (isCollectorStarted)
+		{
+			collector.stop();
+		}
+		rmdir(directory.c_str());
+
+		if (!isCollectorStarted || agent < 0)
+		{
+			return 1;
+		}
+
+		printf("\n");
+		printLatencies(options, histograms, numberOfFinishedWorkers, loadDurationInNanos);
+		printCollectorStatistics(collector.getStatistics(), totalDurationInNanos);
+
+		printf("\nWorkers:\n");
+		printf("  records added:            %" PRId64 "\n", numberOfAddedRecords);
+		printf("  records dropped by rings: %" PRId64 " (%" PRId64 " bytes)\n", numberOfDroppedRecords, numberOfDroppedBytes);
+
+		return exitCode;
+	}
+}
+
+int32_t main(int32_t argc, char** argv)
+{
+	LoadTestOptions options;
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	// a connection closed by the collector must not terminate the process
+	signal(SIGPIPE, SIG_IGN);
+
+	if (options.numberOfSidecarWorkers > 0)
+	{
+		return runSidecar(options, argv[0]);
+	}
+	if (options.serializationMode == SerializationMode::COMPARE)
+	{
+		return runSerializationComparison(options);
+	}
+
+	return runInProcess(options);
+}
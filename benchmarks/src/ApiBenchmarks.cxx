@@ -0,0 +1,219 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmarks.h"
+#include "NullLogger.h"
+
+#include "OpenKit.h"
+#include "api-c/OpenKit-c.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace
+{
+	bool isLogLevelDisabled(LOG_LEVEL)
+	{
+		return false;
+	}
+
+	void discardLogStatement(LOG_LEVEL, const char*)
+	{
+	}
+
+	/// number of elements reported per request by the C API benchmarks, like a typical data plane request
+	constexpr size_t NUMBER_OF_EVENTS_PER_REQUEST = 16;
+
+	///
+	/// Benchmarks reporting a request's events via the C API one by one versus all at once
+	///
+	void runCApiBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		auto loggerHandle = createLogger(isLogLevelDisabled, discardLogStatement);
+		auto configurationHandle = createOpenKitConfiguration("http://127.0.0.1:1/mbeacon", "benchmark", 1);
+		useLoggerForConfiguration(configurationHandle, loggerHandle);
+		auto openKitHandle = createDynatraceOpenKit(configurationHandle);
+		auto sessionHandle = createSession(openKitHandle, "127.0.0.1");
+		auto rootActionHandle = enterRootAction(sessionHandle, "request");
+
+		const char* const names[NUMBER_OF_EVENTS_PER_REQUEST] =
+		{
+			"request received", "status", "bytes sent", "bytes received",
+			"upstream time", "queue time", "cache lookup", "cache hit",
+			"retries", "upstream status", "ttfb", "total time",
+			"worker", "connections", "response sent", "handler time"
+		};
+		OpenKitEventDescriptor events[NUMBER_OF_EVENTS_PER_REQUEST];
+		for (size_t i = 0; i < NUMBER_OF_EVENTS_PER_REQUEST; i++)
+		{
+			events[i] = OpenKitEventDescriptor();
+			events[i].type = i % 4 == 0 ? EVENT_DESCRIPTOR_TYPE_NAMED_EVENT
+				: (i % 4 == 3 ? EVENT_DESCRIPTOR_TYPE_VALUE_DOUBLE : EVENT_DESCRIPTOR_TYPE_VALUE_INT);
+			events[i].name = names[i];
+			events[i].nameLength = strlen(names[i]);
+			events[i].intValue = static_cast<int32_t>(i * 100);
+			events[i].doubleValue = static_cast<double>(i) * 1.5;
+		}
+
+		runner.run("C API report 16 events per call", [rootActionHandle, &events]()
+		{
+			for (const auto& event : events)
+			{
+				switch (event.type)
+				{
+				case EVENT_DESCRIPTOR_TYPE_NAMED_EVENT:
+					reportEventOnRootAction(rootActionHandle, event.name);
+					break;
+				case EVENT_DESCRIPTOR_TYPE_VALUE_INT:
+					reportIntValueOnRootAction(rootActionHandle, event.name, event.intValue);
+					break;
+				default:
+					reportDoubleValueOnRootAction(rootActionHandle, event.name, event.doubleValue);
+					break;
+				}
+			}
+		});
+
+		runner.run("C API report 16 events per call with explicit length", [rootActionHandle, &events]()
+		{
+			for (const auto& event : events)
+			{
+				switch (event.type)
+				{
+				case EVENT_DESCRIPTOR_TYPE_NAMED_EVENT:
+					reportEventOnRootActionWithLength(rootActionHandle, event.name, event.nameLength);
+					break;
+				case EVENT_DESCRIPTOR_TYPE_VALUE_INT:
+					reportIntValueOnRootActionWithLength(rootActionHandle, event.name, event.nameLength, event.intValue);
+					break;
+				default:
+					reportDoubleValueOnRootActionWithLength(rootActionHandle, event.name, event.nameLength, event.doubleValue);
+					break;
+				}
+			}
+		});
+
+		runner.run("C API report 16 events batched", [rootActionHandle, &events]()
+		{
+			reportEventsOnRootAction(rootActionHandle, events, NUMBER_OF_EVENTS_PER_REQUEST);
+		});
+
+		leaveRootAction(rootActionHandle);
+		endSession(sessionHandle);
+		shutdownOpenKit(openKitHandle);
+		destroyOpenKitConfiguration(configurationHandle);
+		destroyLogger(loggerHandle);
+	}
+}
+
+void benchmarks::runApiBenchmarks(BenchmarkRunner& runner)
+{
+	// the endpoint is not reachable, actions are only recorded in the beacon cache
+	openkit::DynatraceOpenKitBuilder builder("http://127.0.0.1:1/mbeacon", "benchmark", 1);
+	builder.withLogger(std::make_shared<NullLogger>());
+	auto openKit = builder.build();
+	auto session = openKit->createSession("127.0.0.1");
+
+	runner.run("Session enterAction/leaveAction", [&session]()
+	{
+		auto rootAction = session->enterAction("root action");
+		rootAction->leaveAction();
+	});
+
+	runner.run("RootAction enterAction/leaveAction", [&session]()
+	{
+		auto rootAction = session->enterAction("root action");
+		auto childAction = rootAction->enterAction("child action");
+		childAction->leaveAction();
+		rootAction->leaveAction();
+	});
+
+	runner.run("RootAction traceWebRequest/stop", [&session]()
+	{
+		auto rootAction = session->enterAction("root action");
+		auto tracer = rootAction->traceWebRequest("http://localhost/path");
+		tracer->start();
+		tracer->stop(200);
+		rootAction->leaveAction();
+	});
+
+	// URLs as they are typically traced, the query part is stripped by the tracer
+	const char* const urls[] =
+	{
+		"https://www.example.com/",
+		"http://localhost:8080/api/v1/users/1337",
+		"https://api.example.com/v2/search?query=openkit&page=3&pageSize=50&sort=relevance",
+		"https://cdn.example.com/static/js/app.8f3a2c1b.min.js",
+		"https://auth.example.com/oauth2/authorize?response_type=code&client_id=abc123"
+			"&redirect_uri=https%3A%2F%2Fapp.example.com%2Fcallback&scope=openid%20profile&state=xyz",
+		"ftp://files.example.com/pub/releases/openkit-native-1.1.0.tar.gz",
+		"https://www.example.com/de/produkte/\xC3\xBC" "bersicht?filter=neu",
+		"invalid url without scheme",
+	};
+	const auto numberOfUrls = sizeof(urls) / sizeof(urls[0]);
+	size_t urlIndex = 0;
+
+	runner.run("RootAction traceWebRequest (URL corpus)", [&session, &urls, numberOfUrls, &urlIndex]()
+	{
+		auto rootAction = session->enterAction("root action");
+		auto tracer = rootAction->traceWebRequest(urls[urlIndex++ % numberOfUrls]);
+		tracer->stop(200);
+		rootAction->leaveAction();
+	});
+
+	// many threads reporting on the same action, comparing the shared pointer returning fluent API
+	// with the reference returning one, which avoids the atomic reference count updates
+	auto numberOfThreads = std::max(2u, std::thread::hardware_concurrency());
+	auto sharedRootAction = session->enterAction("shared root action");
+
+	runner.runConcurrent("RootAction reportValue", numberOfThreads, [&sharedRootAction]()
+	{
+		sharedRootAction->reportValue("value", 42);
+	});
+
+	runner.runConcurrent("RootAction reportValueRef", numberOfThreads, [&sharedRootAction]()
+	{
+		sharedRootAction->reportValueRef("value", 42);
+	});
+
+	sharedRootAction->leaveAction();
+	session->end();
+	openKit->shutdown();
+
+	// after shutdown only null objects are returned, leaving the reference counting as the only cost
+	auto nullSession = openKit->createSession("127.0.0.1");
+	auto nullRootAction = nullSession->enterAction("null root action");
+
+	runner.runConcurrent("NullRootAction reportEvent", numberOfThreads, [&nullRootAction]()
+	{
+		nullRootAction->reportEvent("event");
+	});
+
+	runner.runConcurrent("NullRootAction reportEventRef", numberOfThreads, [&nullRootAction]()
+	{
+		nullRootAction->reportEventRef("event");
+	});
+
+	runner.run("NullRootAction enterAction/leaveAction", [&nullRootAction]()
+	{
+		auto action = nullRootAction->enterAction("action");
+		action->leaveAction();
+	});
+
+	runCApiBenchmarks(runner);
+}
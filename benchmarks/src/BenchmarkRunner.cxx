@@ -0,0 +1,230 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkRunner.h"
+
+#include "OpenKitVersion.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace benchmarks;
+
+namespace
+{
+	/// number of heap allocations done via the global operator new
+	std::atomic<uint64_t> numberOfAllocations(0);
+
+	double getNanosecondsPerIteration(std::chrono::steady_clock::duration duration, double iterations)
+	{
+		auto durationInNanoseconds = static_cast<double>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+		return durationInNanoseconds / iterations;
+	}
+
+	void writeJsonString(FILE* stream, const std::string& value)
+	{
+		fputc('"', stream);
+		for (auto character : value)
+		{
+			if (character == '"' || character == '\\')
+			{
+				fputc('\\', stream);
+			}
+			fputc(character, stream);
+		}
+		fputc('"', stream);
+	}
+}
+
+///
+/// Replacement of the global allocation functions counting the number of allocations
+///
+void* operator new(size_t size)
+{
+	numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+	auto memory = std::malloc(size == 0 ? 1 : size);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+BenchmarkRunner::BenchmarkRunner(uint64_t iterations, OutputFormat outputFormat, const std::string& filter)
+	: mIterations(iterations > 0 ? iterations : 1)
+	, mOutputFormat(outputFormat)
+	, mFilter(filter)
+	, mResults()
+{
+}
+
+uint64_t BenchmarkRunner::getIterations() const
+{
+	return mIterations;
+}
+
+void BenchmarkRunner::run(const std::string& name, const std::function<void()>& body)
+{
+	run(name, mIterations, body);
+}
+
+void BenchmarkRunner::run(const std::string& name, uint64_t iterations, const std::function<void()>& body)
+{
+	if (!isSelected(name))
+	{
+		return;
+	}
+
+	iterations = iterations > 0 ? iterations : 1;
+
+	// warm up, e.g. to fill object pools
+	for (uint64_t i = 0; i < iterations / 10; i++)
+	{
+		body();
+	}
+
+	auto allocationsBefore = numberOfAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < iterations; i++)
+	{
+		body();
+	}
+	auto end = std::chrono::steady_clock::now();
+	auto allocations = numberOfAllocations.load() - allocationsBefore;
+
+	BenchmarkResult result(
+		name,
+		1,
+		iterations,
+		getNanosecondsPerIteration(end - start, static_cast<double>(iterations)),
+		static_cast<double>(allocations) / static_cast<double>(iterations)
+	);
+	addResult(result, false);
+}
+
+void BenchmarkRunner::runConcurrent(const std::string& name, uint32_t numberOfThreads, const std::function<void()>& body)
+{
+	if (!isSelected(name))
+	{
+		return;
+	}
+
+	std::atomic<bool> started(false);
+	std::atomic<uint32_t> numberOfReadyThreads(0);
+	auto iterations = mIterations;
+
+	std::vector<std::thread> threads;
+	threads.reserve(numberOfThreads);
+	for (uint32_t i = 0; i < numberOfThreads; i++)
+	{
+		threads.emplace_back([&]()
+		{
+			numberOfReadyThreads++;
+			while (!started.load())
+			{
+				std::this_thread::yield();
+			}
+			for (uint64_t j = 0; j < iterations; j++)
+			{
+				body();
+			}
+		});
+	}
+
+	while (numberOfReadyThreads.load() < numberOfThreads)
+	{
+		std::this_thread::yield();
+	}
+
+	auto allocationsBefore = numberOfAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+	started = true;
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	auto end = std::chrono::steady_clock::now();
+	auto allocations = numberOfAllocations.load() - allocationsBefore;
+
+	auto totalIterations = iterations * numberOfThreads;
+
+	BenchmarkResult result(
+		name,
+		numberOfThreads,
+		totalIterations,
+		getNanosecondsPerIteration(end - start, static_cast<double>(totalIterations)),
+		static_cast<double>(allocations) / static_cast<double>(totalIterations)
+	);
+	addResult(result, true);
+}
+
+bool BenchmarkRunner::isSelected(const std::string& name) const
+{
+	return mFilter.empty() || name.find(mFilter) != std::string::npos;
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::getResults() const
+{
+	return mResults;
+}
+
+void BenchmarkRunner::writeJson(FILE* stream) const
+{
+	fprintf(stream, "{\n");
+	fprintf(stream, "  \"openkitVersion\": \"%s\",\n", OPENKIT_VERSION_STRING);
+	fprintf(stream, "  \"hardwareConcurrency\": %u,\n", std::thread::hardware_concurrency());
+	fprintf(stream, "  \"benchmarks\": [");
+	for (size_t i = 0; i < mResults.size(); i++)
+	{
+		const auto& result = mResults[i];
+		fprintf(stream, "%s\n    {\"name\": ", i == 0 ? "" : ",");
+		writeJsonString(stream, result.name);
+		fprintf(stream, ", \"threads\": %u, \"iterations\": %llu, \"nsPerOp\": %.1f, \"opsPerSecond\": %.0f, \"allocsPerOp\": %.2f}",
+			result.numberOfThreads,
+			static_cast<unsigned long long>(result.iterations),
+			result.nanosecondsPerIteration,
+			1e9 / result.nanosecondsPerIteration,
+			result.allocationsPerIteration);
+	}
+	fprintf(stream, "\n  ]\n}\n");
+}
+
+void BenchmarkRunner::addResult(const BenchmarkResult& result, bool isConcurrent)
+{
+	mResults.push_back(result);
+
+	if (mOutputFormat == OutputFormat::TEXT)
+	{
+		auto name = isConcurrent
+			? result.name + " (" + std::to_string(result.numberOfThreads) + " threads)"
+			: result.name;
+		printf("%-56s %12.1f ns/op %14.0f ops/s %10.2f allocs/op\n",
+			name.c_str(),
+			result.nanosecondsPerIteration,
+			1e9 / result.nanosecondsPerIteration,
+			result.allocationsPerIteration);
+		fflush(stdout);
+	}
+}
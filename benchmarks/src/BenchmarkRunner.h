@@ -0,0 +1,147 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _BENCHMARKS_BENCHMARKRUNNER_H
+#define _BENCHMARKS_BENCHMARKRUNNER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmarks
+{
+	///
+	/// Result of a single benchmark
+	///
+	struct BenchmarkResult
+	{
+		BenchmarkResult(const std::string& name, uint32_t numberOfThreads, uint64_t iterations,
+			double nanosecondsPerIteration, double allocationsPerIteration)
+			: name(name)
+			, numberOfThreads(numberOfThreads)
+			, iterations(iterations)
+			, nanosecondsPerIteration(nanosecondsPerIteration)
+			, allocationsPerIteration(allocationsPerIteration)
+		{
+		}
+
+		/// name of the benchmark
+		std::string name;
+
+		/// number of threads running the benchmark body concurrently
+		uint32_t numberOfThreads;
+
+		/// total number of measured iterations over all threads
+		uint64_t iterations;
+
+		/// wall clock time in nanoseconds per iteration
+		double nanosecondsPerIteration;
+
+		/// number of heap allocations per iteration
+		double allocationsPerIteration;
+	};
+
+	///
+	/// Format the benchmark results are written in
+	///
+	enum class OutputFormat
+	{
+		/// one human readable line per benchmark, printed when the benchmark finished
+		TEXT,
+		/// a single JSON document, written by @ref BenchmarkRunner::writeJson after all benchmarks finished
+		JSON
+	};
+
+	///
+	/// Runs benchmark bodies, measures the time and heap allocations per iteration and collects the results.
+	///
+	class BenchmarkRunner
+	{
+	public:
+
+		///
+		/// Constructor
+		/// @param[in] iterations default number of iterations per benchmark
+		/// @param[in] outputFormat format the results are written in
+		/// @param[in] filter only benchmarks containing this string in their name are run, all if empty
+		///
+		BenchmarkRunner(uint64_t iterations, OutputFormat outputFormat, const std::string& filter);
+
+		///
+		/// Returns the default number of iterations per benchmark
+		///
+		uint64_t getIterations() const;
+
+		///
+		/// Runs the given benchmark body for the default number of iterations.
+		///
+		void run(const std::string& name, const std::function<void()>& body);
+
+		///
+		/// Runs the given benchmark body for the given number of iterations, used for expensive bodies.
+		///
+		void run(const std::string& name, uint64_t iterations, const std::function<void()>& body);
+
+		///
+		/// Runs the given benchmark body concurrently on the given number of threads.
+		///
+		/// @par
+		/// All threads start at the same time and perform the default number of iterations each.
+		/// The reported time per operation is the wall clock time divided by the total number of iterations.
+		///
+		void runConcurrent(const std::string& name, uint32_t numberOfThreads, const std::function<void()>& body);
+
+		///
+		/// Returns whether a benchmark with the given name is run, i.e. whether it matches the filter.
+		///
+		bool isSelected(const std::string& name) const;
+
+		///
+		/// Returns the results of all benchmarks run so far
+		///
+		const std::vector<BenchmarkResult>& getResults() const;
+
+		///
+		/// Writes all results as JSON document to the given stream
+		///
+		void writeJson(FILE* stream) const;
+
+	private:
+
+		///
+		/// Stores the given result and prints it in case of text output
+		/// @param[in] result the result to store
+		/// @param[in] isConcurrent @c true if the result was measured by @ref runConcurrent
+		///
+		void addResult(const BenchmarkResult& result, bool isConcurrent);
+
+		/// default number of iterations per benchmark
+		const uint64_t mIterations;
+
+		/// format the results are written in
+		const OutputFormat mOutputFormat;
+
+		/// filter for the names of the benchmarks to run
+		const std::string mFilter;
+
+		/// results of all benchmarks run so far
+		std::vector<BenchmarkResult> mResults;
+	};
+}
+
+#endif
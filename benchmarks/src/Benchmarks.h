@@ -0,0 +1,40 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _BENCHMARKS_BENCHMARKS_H
+#define _BENCHMARKS_BENCHMARKS_H
+
+#include "BenchmarkRunner.h"
+
+namespace benchmarks
+{
+	///
+	/// Benchmarks of the public OpenKit API, i.e. sessions, actions and web request tracers
+	///
+	void runApiBenchmarks(BenchmarkRunner& runner);
+
+	///
+	/// Benchmarks of the core utilities and the beacon cache
+	///
+	void runCoreBenchmarks(BenchmarkRunner& runner);
+
+	///
+	/// Benchmarks of the beacon serialization and the server response parsers
+	///
+	void runProtocolBenchmarks(BenchmarkRunner& runner);
+}
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmarks.h"
+#include "NullLogger.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCache.h"
+#include "core/caching/BeaconCacheEntry.h"
+#include "core/caching/BeaconCacheRecord.h"
+#include "core/util/Compressor.h"
+#include "core/util/URLEncoding.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/// a record as it is typically stored in the beacon cache
+	const char* const RECORD = "et=12&na=button%20clicked&it=1&pa=42&s0=7&t0=1234&s1=8&t1=12";
+
+	///
+	/// Returns the numbers of threads the concurrent benchmarks are run with, i.e. 1, 2, 4, ... up to the number of cores
+	///
+	std::vector<uint32_t> getNumbersOfThreads()
+	{
+		auto maxNumberOfThreads = std::max(2u, std::thread::hardware_concurrency());
+
+		std::vector<uint32_t> numbersOfThreads;
+		for (uint32_t numberOfThreads = 1; numberOfThreads < maxNumberOfThreads; numberOfThreads *= 2)
+		{
+			numbersOfThreads.push_back(numberOfThreads);
+		}
+		numbersOfThreads.push_back(maxNumberOfThreads);
+
+		return numbersOfThreads;
+	}
+
+	///
+	/// Returns beacon data of the given size, made up of typical records
+	///
+	std::string createBeaconData(size_t size)
+	{
+		std::string data;
+		data.reserve(size + strlen(RECORD) + 1);
+		while (data.size() < size)
+		{
+			data.append(RECORD).append("&");
+		}
+		data.resize(size);
+
+		return data;
+	}
+
+	void runUTF8StringBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		runner.run("UTF8String construct (ASCII)", []()
+		{
+			core::UTF8String string("button clicked");
+		});
+
+		runner.run("UTF8String construct (multibyte)", []()
+		{
+			core::UTF8String string("\xC3\xBC" "bersicht \xE2\x82\xAC \xF0\x9F\x98\x80");
+		});
+
+		runner.run("UTF8String construct (invalid)", []()
+		{
+			core::UTF8String string("invalid \xC3 sequence \xFF");
+		});
+
+		core::UTF8String suffix("&na=button%20clicked");
+		runner.run("UTF8String concatenate", [&suffix]()
+		{
+			core::UTF8String string("et=12");
+			string.concatenate(suffix);
+			string.concatenate("&it=1", 5);
+		});
+	}
+
+	void runURLEncodingBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		core::UTF8String unreserved("button_clicked-on.main~page");
+		runner.run("URLEncoding urlencode (unreserved)", [&unreserved]()
+		{
+			core::util::URLEncoding::urlencode(unreserved);
+		});
+
+		core::UTF8String reserved("button clicked on \"main\" page & \xC3\xBC" "bersicht");
+		runner.run("URLEncoding urlencode (reserved)", [&reserved]()
+		{
+			core::util::URLEncoding::urlencode(reserved);
+		});
+	}
+
+	void runCompressorBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		const size_t sizes[] = { 256, 4 * 1024, 64 * 1024 };
+		for (auto size : sizes)
+		{
+			auto data = createBeaconData(size);
+			std::vector<unsigned char> compressed;
+
+			// compressing is expensive, scale down the iterations with the size
+			auto iterations = std::max(uint64_t(1), runner.getIterations() * 256 / size);
+			runner.run("Compressor compressMemory (" + std::to_string(size) + " bytes)", iterations, [&data, &compressed]()
+			{
+				compressed.clear();
+				base::util::Compressor::compressMemory(data.c_str(), data.size(), compressed);
+			});
+		}
+	}
+
+	void runBeaconCacheEntryBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		core::caching::BeaconCacheEntry entry;
+		for (int64_t i = 0; i < 100; i++)
+		{
+			entry.addEventData(core::caching::BeaconCacheRecord(i, RECORD));
+			entry.addActionData(core::caching::BeaconCacheRecord(i, RECORD));
+		}
+
+		core::UTF8String prefix("vv=3&va=7.0.0000&ap=benchmark&an=benchmark&vn=1.0&pt=1&tt=okc&vi=1&sn=1");
+		core::UTF8String delimiter("&");
+
+		runner.run("BeaconCacheEntry getChunk (200 records)", [&entry, &prefix, &delimiter]()
+		{
+			entry.copyDataForChunking();
+			entry.getChunk(prefix, 8 * 1024, delimiter);
+			entry.resetDataMarkedForSending();
+		});
+	}
+
+	void runBeaconCacheBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		auto logger = std::make_shared<benchmarks::NullLogger>();
+		core::UTF8String record(RECORD);
+		core::UTF8String prefix("vv=3&va=7.0.0000&ap=benchmark&an=benchmark&vn=1.0&pt=1&tt=okc&vi=1&sn=1");
+		core::UTF8String delimiter("&");
+
+		for (auto numberOfThreads : getNumbersOfThreads())
+		{
+			// each thread works on its own beacon, like the sessions of an application do
+			auto beaconCache = std::make_shared<core::caching::BeaconCache>(logger);
+			std::atomic<int32_t> nextBeaconID(1);
+
+			runner.runConcurrent("BeaconCache addEventData", numberOfThreads, [&beaconCache, &nextBeaconID, &record]()
+			{
+				static thread_local int32_t beaconID = nextBeaconID++;
+				static thread_local int64_t timestamp = 0;
+				beaconCache->addEventData(beaconID, timestamp++, record);
+			});
+		}
+
+		for (auto numberOfThreads : getNumbersOfThreads())
+		{
+			auto beaconCache = std::make_shared<core::caching::BeaconCache>(logger);
+			std::atomic<int32_t> nextBeaconID(1);
+			auto createBeacon = [&beaconCache, &nextBeaconID, &record]()
+			{
+				auto beaconID = nextBeaconID++;
+				for (int64_t i = 0; i < 100; i++)
+				{
+					beaconCache->addEventData(beaconID, i, record);
+				}
+				return beaconID;
+			};
+
+			runner.runConcurrent("BeaconCache getNextBeaconChunk", numberOfThreads,
+				[&beaconCache, &createBeacon, &prefix, &delimiter]()
+			{
+				static thread_local int32_t beaconID = createBeacon();
+				beaconCache->getNextBeaconChunk(beaconID, prefix, 8 * 1024, delimiter);
+				beaconCache->resetChunkedData(beaconID);
+			});
+		}
+
+		for (auto numberOfThreads : getNumbersOfThreads())
+		{
+			auto beaconCache = std::make_shared<core::caching::BeaconCache>(logger);
+			std::atomic<int32_t> nextBeaconID(1);
+
+			runner.runConcurrent("BeaconCache addEventData/evictRecordsByAge", numberOfThreads,
+				[&beaconCache, &nextBeaconID, &record]()
+			{
+				static thread_local int32_t beaconID = nextBeaconID++;
+				static thread_local int64_t timestamp = 0;
+				beaconCache->addEventData(beaconID, timestamp++, record);
+				beaconCache->evictRecordsByAge(beaconID, timestamp);
+			});
+		}
+	}
+}
+
+void benchmarks::runCoreBenchmarks(BenchmarkRunner& runner)
+{
+	runUTF8StringBenchmarks(runner);
+	runURLEncodingBenchmarks(runner);
+	runCompressorBenchmarks(runner);
+	runBeaconCacheEntryBenchmarks(runner);
+	runBeaconCacheBenchmarks(runner);
+}
@@ -0,0 +1,42 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _BENCHMARKS_NULLLOGGER_H
+#define _BENCHMARKS_NULLLOGGER_H
+
+#include "OpenKit/ILogger.h"
+
+namespace benchmarks
+{
+	///
+	/// Logger dropping all messages, so that log output does not distort measurements
+	///
+	class NullLogger : public openkit::ILogger
+	{
+	public:
+		void log(openkit::LogLevel, const char*, ...) override {}
+		void error(const char*, ...) override {}
+		void warning(const char*, ...) override {}
+		void info(const char*, ...) override {}
+		void debug(const char*, ...) override {}
+		bool isErrorEnabled() const override { return false; }
+		bool isInfoEnabled() const override { return false; }
+		bool isWarningEnabled() const override { return false; }
+		bool isDebugEnabled() const override { return false; }
+	};
+}
+
+#endif
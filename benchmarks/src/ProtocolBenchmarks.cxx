@@ -0,0 +1,159 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmarks.h"
+#include "NullLogger.h"
+
+#include "OpenKit/DynatraceOpenKitBuilder.h"
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCache.h"
+#include "core/configuration/BeaconConfiguration.h"
+#include "core/configuration/OpenKitConfiguration.h"
+#include "core/configuration/PrivacyConfiguration.h"
+#include "protocol/Beacon.h"
+#include "protocol/JsonResponseParser.h"
+#include "protocol/KeyValueResponseParser.h"
+#include "providers/DefaultSessionIDProvider.h"
+#include "providers/DefaultThreadIDProvider.h"
+#include "providers/DefaultTimingProvider.h"
+#include "util/json/JsonParser.h"
+
+#include <memory>
+#include <string>
+
+namespace
+{
+	/// status response as it is sent by a Dynatrace cluster
+	const char* const JSON_RESPONSE =
+		"{"
+			"\"mobileAgentConfig\":{"
+				"\"maxBeaconSizeKb\":150,"
+				"\"maxSessionDurationInMins\":360,"
+				"\"maxEventsPerSession\":200,"
+				"\"sessionTimeoutSec\":600,"
+				"\"sendIntervalSec\":120,"
+				"\"visitStoreVersion\":1"
+			"},"
+			"\"appConfig\":{"
+				"\"capture\":1,"
+				"\"reportCrashes\":1,"
+				"\"reportErrors\":1"
+			"},"
+			"\"dynamicConfig\":{"
+				"\"multiplicity\":1,"
+				"\"serverId\":1"
+			"},"
+			"\"timestamp\":1581350400000"
+		"}";
+
+	/// status response as it is sent by AppMon
+	const char* const KEY_VALUE_RESPONSE = "type=m&bl=150&si=120&cp=1&cr=1&er=1&id=1&mp=1";
+
+	void runBeaconBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		auto logger = std::make_shared<benchmarks::NullLogger>();
+
+		openkit::DynatraceOpenKitBuilder builder("http://127.0.0.1:1/mbeacon", "benchmark", 1);
+		builder.withLogger(logger);
+		auto beaconConfiguration = core::configuration::BeaconConfiguration::from(
+			core::configuration::OpenKitConfiguration::from(builder),
+			core::configuration::PrivacyConfiguration::from(builder),
+			1
+		);
+
+		auto beacon = std::make_shared<protocol::Beacon>(
+			logger,
+			std::make_shared<core::caching::BeaconCache>(logger),
+			beaconConfiguration,
+			"127.0.0.1",
+			std::make_shared<providers::DefaultSessionIDProvider>(),
+			std::make_shared<providers::DefaultThreadIDProvider>(),
+			std::make_shared<providers::DefaultTimingProvider>()
+		);
+
+		core::UTF8String valueName("value name");
+		core::UTF8String stringValue("string value");
+		core::UTF8String eventName("button clicked");
+		core::UTF8String errorName("error name");
+		core::UTF8String reason("error reason");
+		core::UTF8String stacktrace("at Foo.bar(Foo.cxx:42)\nat Foo.main(Foo.cxx:7)");
+
+		// the serialized records are discarded after each benchmark, to not measure a growing cache
+		runner.run("Beacon reportValue (int)", [&beacon, &valueName]()
+		{
+			beacon->reportValue(1, valueName, 42);
+		});
+		beacon->clearData();
+
+		runner.run("Beacon reportValue (double)", [&beacon, &valueName]()
+		{
+			beacon->reportValue(1, valueName, 3.1415);
+		});
+		beacon->clearData();
+
+		runner.run("Beacon reportValue (string)", [&beacon, &valueName, &stringValue]()
+		{
+			beacon->reportValue(1, valueName, stringValue);
+		});
+		beacon->clearData();
+
+		runner.run("Beacon reportEvent", [&beacon, &eventName]()
+		{
+			beacon->reportEvent(1, eventName);
+		});
+		beacon->clearData();
+
+		runner.run("Beacon reportError", [&beacon, &errorName, &reason]()
+		{
+			beacon->reportError(1, errorName, 42, reason);
+		});
+		beacon->clearData();
+
+		runner.run("Beacon reportCrash", [&beacon, &errorName, &reason, &stacktrace]()
+		{
+			beacon->reportCrash(errorName, reason, stacktrace);
+		});
+		beacon->clearData();
+	}
+
+	void runResponseParserBenchmarks(benchmarks::BenchmarkRunner& runner)
+	{
+		std::string json(JSON_RESPONSE);
+		runner.run("JsonParser parse (status response)", [&json]()
+		{
+			util::json::JsonParser parser(json);
+			parser.parse();
+		});
+
+		core::UTF8String jsonResponse(JSON_RESPONSE);
+		runner.run("JsonResponseParser parse", [&jsonResponse]()
+		{
+			protocol::JsonResponseParser::parse(jsonResponse);
+		});
+
+		core::UTF8String keyValueResponse(KEY_VALUE_RESPONSE);
+		runner.run("KeyValueResponseParser parse", [&keyValueResponse]()
+		{
+			protocol::KeyValueResponseParser::parse(keyValueResponse);
+		});
+	}
+}
+
+void benchmarks::runProtocolBenchmarks(BenchmarkRunner& runner)
+{
+	runBeaconBenchmarks(runner);
+	runResponseParserBenchmarks(runner);
+}
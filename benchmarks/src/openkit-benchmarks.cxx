@@ -0,0 +1,68 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Benchmarks for the OpenKit hot paths.
+/// Each benchmark reports the time and the number of heap allocations per iteration.
+///
+/// Usage: openkit-benchmarks [iterations] [--json] [--filter <part of benchmark name>]
+///
+/// With @c --json the results are written as a single JSON document to stdout, so that they
+/// can be stored and compared between releases.
+
+#include "BenchmarkRunner.h"
+#include "Benchmarks.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+int32_t main(int32_t argc, char** argv)
+{
+	uint64_t iterations = 100000;
+	auto outputFormat = benchmarks::OutputFormat::TEXT;
+	std::string filter;
+
+	for (int32_t i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--json") == 0)
+		{
+			outputFormat = benchmarks::OutputFormat::JSON;
+		}
+		else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+		{
+			filter = argv[++i];
+		}
+		else
+		{
+			iterations = std::strtoull(argv[i], nullptr, 10);
+		}
+	}
+
+	benchmarks::BenchmarkRunner runner(iterations, outputFormat, filter);
+
+	benchmarks::runCoreBenchmarks(runner);
+	benchmarks::runProtocolBenchmarks(runner);
+	benchmarks::runApiBenchmarks(runner);
+
+	if (outputFormat == benchmarks::OutputFormat::JSON)
+	{
+		runner.writeJson(stdout);
+	}
+
+	return 0;
+}
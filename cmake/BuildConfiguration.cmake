@@ -21,6 +21,12 @@ include (CMakeDependentOption)
 # Option enabling or disableing building and running of unit tests
 option(OPENKIT_BUILD_TESTS "Build tests (default: ON)" ON)
 
+# Option enabling or disabling building of the benchmarks
+option(OPENKIT_BUILD_BENCHMARKS "Build benchmarks (default: OFF)" OFF)
+
+# Option enabling or disabling building of the OpenKit agent for the sidecar mode (not supported on Windows)
+option(OPENKIT_BUILD_AGENT "Build the OpenKit agent (default: ON)" ON)
+
 # option to build API documentation via Doxygen
 option(BUILD_DOC "Create and install the HTML based API documentation (requires Doxygen)" OFF)
 
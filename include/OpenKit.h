@@ -21,11 +21,16 @@
 #include "OpenKit/OpenKitConstants.h"
 #include "OpenKit/ILogger.h"
 #include "OpenKit/IWebRequestTracer.h"
+#include "OpenKit/EventDescriptor.h"
 #include "OpenKit/IAction.h"
 #include "OpenKit/IRootAction.h"
 #include "OpenKit/ISession.h"
+#include "OpenKit/ShutdownResult.h"
+#include "OpenKit/Statistics.h"
 #include "OpenKit/AppMonOpenKitBuilder.h"
 #include "OpenKit/DynatraceOpenKitBuilder.h"
+#include "OpenKit/IOpenKitRuntime.h"
+#include "OpenKit/OpenKitRuntimeBuilder.h"
 #include "OpenKit/ISSLTrustManager.h"
 
 #endif
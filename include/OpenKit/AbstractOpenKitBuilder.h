@@ -20,6 +20,7 @@
 #include "OpenKit_export.h"
 #include "OpenKit/IOpenKit.h"
 #include "OpenKit/IOpenKitBuilder.h"
+#include "OpenKit/IOpenKitRuntime.h"
 #include "OpenKit/ILogger.h"
 #include "OpenKit/ISSLTrustManager.h"
 #include "OpenKit/DataCollectionLevel.h"
@@ -177,6 +178,88 @@ namespace openkit
 			///
 			AbstractOpenKitBuilder& withCrashReportingLevel(openkit::CrashReportingLevel crashReportingLevel);
 
+			///
+			/// Enables deferred serialization of reported events.
+			///
+			/// When enabled, values, named events and errors reported on an action are only captured on the
+			/// calling thread and serialized into the beacon protocol format later on the beacon sending thread.
+			/// This reduces the time spent in the reporting calls, while the data sent to the server stays the same.
+			///
+			/// Deferred serialization is disabled by default.
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& enableDeferredSerialization();
+
+			///
+			/// Enables the collection of statistics about OpenKit's own processing.
+			///
+			/// When enabled, OpenKit counts the records added to and evicted from the beacon cache, measures
+			/// the size and sending duration of beacon chunks as well as the HTTP requests and the time spent
+			/// in the beacon sending states. The collected values are obtained via @ref openkit::IOpenKit::getStatistics.
+			///
+			/// Statistics are disabled by default.
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& enableStatistics();
+
+			///
+			/// Sets the file the last configuration received from the server is persisted in.
+			///
+			/// When set, OpenKit stores the server configuration (server id, multiplicity, beacon size, capture flags)
+			/// after every successful status request and loads it again when it is started. New sessions are
+			/// configured right away with the loaded configuration and capture data while the status request
+			/// to the server is still running.
+			///
+			/// By default the server configuration is not persisted and sessions wait for the first status response.
+			/// @param[in] filePath path of the file to persist the server configuration in
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withServerConfigurationFile(const char* filePath);
+
+			///
+			/// Attaches the OpenKit instance to a runtime shared with other OpenKit instances in this process.
+			///
+			/// When set, the instance does not start own threads for sending beacon data and evicting cached records,
+			/// but uses the threads of the shared runtime. The beacon cache memory boundaries configured on this builder
+			/// are replaced by an equal share of the runtime's boundaries, the maximum record age still applies.
+			///
+			/// By default every OpenKit instance runs an own thread for sending beacon data and one for evicting cached records.
+			/// @param[in] runtime the runtime created by @ref openkit::OpenKitRuntimeBuilder
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withSharedRuntime(std::shared_ptr<openkit::IOpenKitRuntime> runtime);
+
+			///
+			/// Runs the OpenKit instance in sidecar mode, passing all data to the OpenKit agent process.
+			///
+			/// When set, the instance neither caches nor sends any data and does not start any threads. Instead all data
+			/// is written to a ring buffer in shared memory, which is created in the given directory. The separate
+			/// @c openkit-agent process, watching the same directory, caches and sends the data of all processes on
+			/// the host. The agent must be configured with the same endpoint URL and application ID.
+			///
+			/// If the ring buffer is full, because the agent does not keep up or is not running, data is dropped.
+			/// Dropped data is counted in the statistics, see @ref enableStatistics.
+			///
+			/// The directory should be located on a memory backed file system, like @c /dev/shm.
+			/// Sidecar mode is only supported on POSIX systems, if the ring buffer cannot be created the instance
+			/// sends its data itself. Sidecar mode takes precedence over a shared runtime and deferred serialization.
+			///
+			/// By default every OpenKit instance caches and sends its data itself.
+			/// @param[in] directory the directory watched by the OpenKit agent process
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withSidecarDirectory(const char* directory);
+
+			///
+			/// Sets the capacity of the ring buffer passing data to the OpenKit agent process in sidecar mode.
+			///
+			/// The default capacity is 1 MiB, see @ref core::configuration::ConfigurationDefaults::DEFAULT_SIDECAR_RING_CAPACITY_IN_BYTES.
+			/// Values which are not positive are ignored.
+			/// @param[in] capacityInBytes the ring buffer's capacity in bytes
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withSidecarRingCapacity(int64_t capacityInBytes);
+
 			///
 			/// Builds an @ref openkit::IOpenKit instance
 			/// @return an @ref openkit::IOpenKit instance
@@ -217,10 +300,22 @@ namespace openkit
 
 			CrashReportingLevel getCrashReportingLevel() const override;
 
+			bool isDeferredSerializationEnabled() const override;
+
+			bool isStatisticsEnabled() const override;
+
+			const std::string& getServerConfigurationFile() const override;
+
 			openkit::LogLevel getLogLevel() const override;
 
 			std::shared_ptr<openkit::ILogger> getLogger() const override;
 
+			std::shared_ptr<openkit::IOpenKitRuntime> getSharedRuntime() const override;
+
+			const std::string& getSidecarDirectory() const override;
+
+			int64_t getSidecarRingCapacity() const override;
+
 		protected:
 
 			///
@@ -292,6 +387,24 @@ namespace openkit
 
 			/// crash reporting level
 			openkit::CrashReportingLevel mCrashReportingLevel;
+
+			/// flag indicating whether reported events are serialized on the beacon sending thread
+			bool mIsDeferredSerializationEnabled;
+
+			/// flag indicating whether statistics about OpenKit's own processing are collected
+			bool mIsStatisticsEnabled;
+
+			/// file the server configuration is persisted in, empty if not persisted
+			std::string mServerConfigurationFile;
+
+			/// runtime shared with other OpenKit instances
+			std::shared_ptr<openkit::IOpenKitRuntime> mSharedRuntime;
+
+			/// directory of the ring buffers shared with the agent process, empty if not in sidecar mode
+			std::string mSidecarDirectory;
+
+			/// capacity of the ring buffer shared with the agent process
+			int64_t mSidecarRingCapacity;
 	};
 }
 
@@ -0,0 +1,76 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _OPENKIT_EVENTDESCRIPTOR_H
+#define _OPENKIT_EVENTDESCRIPTOR_H
+
+#include "OpenKit_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace openkit
+{
+	///
+	/// Kind of data described by an @ref EventDescriptor
+	///
+	enum class EventDescriptorType
+	{
+		/// named event without value, like reported via @c reportEvent
+		NAMED_EVENT,
+		/// int value, like reported via @c reportValue(const char*, int32_t)
+		VALUE_INT,
+		/// double value, like reported via @c reportValue(const char*, double)
+		VALUE_DOUBLE,
+		/// string value, like reported via @c reportValue(const char*, const char*)
+		VALUE_STRING,
+		/// error, like reported via @c reportError
+		FAILURE_ERROR
+	};
+
+	///
+	/// A single event, value or error reported in a batch via @ref openkit::IRootAction::reportEvents
+	/// or @ref openkit::IAction::reportEvents
+	///
+	/// Strings are given as pointer and length in bytes and do not need to be null terminated,
+	/// so slices of larger buffers can be reported without copying them.
+	///
+	struct OPENKIT_EXPORT EventDescriptor
+	{
+		/// kind of the reported data, determines which of the value fields are used
+		EventDescriptorType type;
+
+		/// name of the event, value or error
+		const char* name;
+
+		/// length of @ref name in bytes
+		size_t nameLength;
+
+		/// value of @ref EventDescriptorType::VALUE_INT or error code of @ref EventDescriptorType::FAILURE_ERROR
+		int32_t intValue;
+
+		/// value of @ref EventDescriptorType::VALUE_DOUBLE
+		double doubleValue;
+
+		/// value of @ref EventDescriptorType::VALUE_STRING or reason of @ref EventDescriptorType::FAILURE_ERROR
+		const char* stringValue;
+
+		/// length of @ref stringValue in bytes
+		size_t stringValueLength;
+	};
+}
+
+#endif
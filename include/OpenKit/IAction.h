@@ -18,7 +18,9 @@
 #define _OPENKIT_IACTION_H
 
 #include "OpenKit_export.h"
+#include "OpenKit/EventDescriptor.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -85,6 +87,196 @@ namespace openkit
 		///
 		virtual std::shared_ptr<IAction> reportError(const char* errorName, int32_t errorCode, const char* reason) = 0;
 
+		///
+		/// Reports an event with a specified name, like @ref reportEvent(const char*), but the name is given by its
+		/// first byte and its length in bytes.
+		///
+		/// @par
+		/// The name does not need to be terminated, which allows passing a slice of a larger buffer without copying it.
+		/// Exactly @c eventNameLength bytes are used, @c '\0' characters included.
+		/// The same applies to all other string parameters given together with a length.
+		///
+		/// @param eventName       name of the event
+		/// @param eventNameLength number of bytes of @c eventName
+		/// @return this Action (for usage as fluent API)
+		///
+		virtual std::shared_ptr<IAction> reportEvent(const char* eventName, size_t eventNameLength) = 0;
+
+		///
+		/// Reports an int value with a specified name, like @ref reportValue(const char*, int32_t), but the name is
+		/// given by its first byte and its length in bytes.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @return this Action (for usage as fluent API)
+		///
+		virtual std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, int32_t value) = 0;
+
+		///
+		/// Reports a double value with a specified name, like @ref reportValue(const char*, double), but the name is
+		/// given by its first byte and its length in bytes.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @return this Action (for usage as fluent API)
+		///
+		virtual std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, double value) = 0;
+
+		///
+		/// Reports a String value with a specified name, like @ref reportValue(const char*, const char*), but name and
+		/// value are given by their first byte and their length in bytes.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @param valueLength     number of bytes of @c value
+		/// @return this Action (for usage as fluent API)
+		///
+		virtual std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) = 0;
+
+		///
+		/// Reports an error with a specified name, error code and reason, like
+		/// @ref reportError(const char*, int32_t, const char*), but name and reason are given by their first byte and
+		/// their length in bytes.
+		///
+		/// @param errorName       name of this error
+		/// @param errorNameLength number of bytes of @c errorName
+		/// @param errorCode       numeric error code of this error
+		/// @param reason          reason for this error
+		/// @param reasonLength    number of bytes of @c reason
+		/// @return this Action (for usage as fluent API)
+		///
+		virtual std::shared_ptr<IAction> reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) = 0;
+
+		///
+		/// Reports an event with a specified name, like @ref reportEvent(const char*), but returns a reference to this
+		/// IAction instead of a shared pointer.
+		///
+		/// @par
+		/// Returning a reference avoids the atomic reference count operations of a temporary @c std::shared_ptr, which
+		/// makes this variant preferable for frequently called code paths which discard the return value anyway.
+		/// The returned reference is valid as long as the caller keeps its own reference to this IAction.
+		///
+		/// @param eventName name of the event
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportEventRef(const char* eventName) = 0;
+
+		///
+		/// Reports an int value with a specified name, like @ref reportValue(const char*, int32_t), but returns a
+		/// reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName name of this value
+		/// @param value     value itself
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, int32_t value) = 0;
+
+		///
+		/// Reports a double value with a specified name, like @ref reportValue(const char*, double), but returns a
+		/// reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName name of this value
+		/// @param value     value itself
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, double value) = 0;
+
+		///
+		/// Reports a String value with a specified name, like @ref reportValue(const char*, const char*), but returns a
+		/// reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName name of this value
+		/// @param value     value itself
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, const char* value) = 0;
+
+		///
+		/// Reports an error with a specified name, error code and reason, like
+		/// @ref reportError(const char*, int32_t, const char*), but returns a reference to this IAction instead of a
+		/// shared pointer.
+		///
+		/// @param errorName name of this error
+		/// @param errorCode numeric error code of this error
+		/// @param reason    reason for this error
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportErrorRef(const char* errorName, int32_t errorCode, const char* reason) = 0;
+
+		///
+		/// Reports an event with a specified name, like @ref reportEvent(const char*, size_t), but returns a reference to
+		/// this IAction instead of a shared pointer.
+		///
+		/// @param eventName       name of the event
+		/// @param eventNameLength number of bytes of @c eventName
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportEventRef(const char* eventName, size_t eventNameLength) = 0;
+
+		///
+		/// Reports an int value with a specified name, like @ref reportValue(const char*, size_t, int32_t), but returns
+		/// a reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, size_t valueNameLength, int32_t value) = 0;
+
+		///
+		/// Reports a double value with a specified name, like @ref reportValue(const char*, size_t, double), but returns
+		/// a reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, size_t valueNameLength, double value) = 0;
+
+		///
+		/// Reports a String value with a specified name, like @ref reportValue(const char*, size_t, const char*, size_t),
+		/// but returns a reference to this IAction instead of a shared pointer.
+		///
+		/// @param valueName       name of this value
+		/// @param valueNameLength number of bytes of @c valueName
+		/// @param value           value itself
+		/// @param valueLength     number of bytes of @c value
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportValueRef(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) = 0;
+
+		///
+		/// Reports an error with a specified name, error code and reason, like
+		/// @ref reportError(const char*, size_t, int32_t, const char*, size_t), but returns a reference to this IAction
+		/// instead of a shared pointer.
+		///
+		/// @param errorName       name of this error
+		/// @param errorNameLength number of bytes of @c errorName
+		/// @param errorCode       numeric error code of this error
+		/// @param reason          reason for this error
+		/// @param reasonLength    number of bytes of @c reason
+		/// @return reference to this IAction (for usage as fluent API)
+		///
+		virtual IAction& reportErrorRef(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) = 0;
+
+		///
+		/// Reports several events, values and errors on this IAction with a single call.
+		///
+		/// @par
+		/// The result is the same as reporting each element via @ref reportEvent, @ref reportValue or
+		/// @ref reportError, but the IAction is synchronized and the data is serialized only once for the whole batch.
+		/// Elements with a @c nullptr or empty name are skipped.
+		///
+		/// @param events         array of the elements to report
+		/// @param numberOfEvents number of elements in @c events
+		///
+		virtual void reportEvents(const EventDescriptor* events, size_t numberOfEvents) = 0;
+
 		///
 		/// Allows tracing and timing of a web request handled by any 3rd party HTTP Client (e.g. CURL, EasyHttp, ...).
 		/// In this case the Dynatrace HTTP header (@ref openkit::OpenKitConstants::WEBREQUEST_TAG_HEADER) has to be set manually to the
@@ -97,6 +289,16 @@ namespace openkit
 		///
 		virtual std::shared_ptr<IWebRequestTracer> traceWebRequest(const char* url) = 0;
 
+		///
+		/// Allows tracing and timing of a web request, like @ref traceWebRequest(const char*), but the URL is given by its
+		/// first byte and its length in bytes.
+		///
+		/// @param url       the URL of the web request to be tagged and timed
+		/// @param urlLength number of bytes of @c url
+		/// @return a WebRequestTracer which allows getting the tag value and adding timing information
+		///
+		virtual std::shared_ptr<IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) = 0;
+
 		///
 		/// Leaves this Action.
 		/// @returns the parent Action, or @c nullptr if there is no parent Action
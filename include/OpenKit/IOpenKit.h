@@ -18,6 +18,8 @@
 #define _OPENKIT_IOPENKIT_H
 
 #include "OpenKit_export.h"
+#include "OpenKit/ShutdownResult.h"
+#include "OpenKit/Statistics.h"
 
 #include <cstdint>
 #include <memory>
@@ -90,7 +92,29 @@ namespace openkit
 		///
 		/// Shuts down OpenKit, ending all open Sessions and waiting for them to be sent.
 		///
+		/// This is equivalent to calling @ref shutdown(int64_t) with a timeout of 10 seconds.
+		///
 		virtual void shutdown() = 0;
+
+		///
+		/// Shuts down OpenKit, ending all open Sessions and sending them until the given timeout expires.
+		///
+		/// Sessions are sent in parallel, sessions containing errors or crashes first, followed by the oldest ones.
+		/// Data which could not be sent when the timeout expires is discarded, since it is not persisted.
+		/// Calling this method a second time returns immediately with a completed result without any records.
+		/// @param[in] timeoutMillis The maximum number of milliseconds to wait for the data being sent.
+		/// @returns the number of records sent and discarded during the shutdown
+		///
+		virtual ShutdownResult shutdown(int64_t timeoutMillis) = 0;
+
+		///
+		/// Returns the statistics collected about OpenKit's own processing.
+		///
+		/// Statistics are only collected if they were enabled when building OpenKit, otherwise all values
+		/// are zero and @ref Statistics::isEnabled is @c false.
+		/// @returns a snapshot of the current statistics
+		///
+		virtual Statistics getStatistics() = 0;
 	};
 }
 
@@ -20,6 +20,7 @@
 #include "OpenKit/CrashReportingLevel.h"
 #include "OpenKit/DataCollectionLevel.h"
 #include "OpenKit/ILogger.h"
+#include "OpenKit/IOpenKitRuntime.h"
 #include "OpenKit/LogLevel.h"
 #include "OpenKit/ISSLTrustManager.h"
 
@@ -177,6 +178,32 @@ namespace openkit
 		///
 		virtual openkit::CrashReportingLevel getCrashReportingLevel() const = 0;
 
+		///
+		/// Returns whether the serialization of reported events is deferred to the beacon sending thread.
+		///
+		/// @par
+		/// If deferred serialization was not configured, the @ref core::configuration::ConfigurationDefaults::DEFAULT_DEFERRED_SERIALIZATION_ENABLED
+		/// is returned.
+		///
+		virtual bool isDeferredSerializationEnabled() const = 0;
+
+		///
+		/// Returns whether statistics about OpenKit's own processing are collected.
+		///
+		/// @par
+		/// If statistics were not configured, the @ref core::configuration::ConfigurationDefaults::DEFAULT_STATISTICS_ENABLED
+		/// is returned.
+		///
+		virtual bool isStatisticsEnabled() const = 0;
+
+		///
+		/// Returns the path of the file the last server configuration is persisted in.
+		///
+		/// @par
+		/// If no file was set, an empty string is returned and the server configuration is not persisted.
+		///
+		virtual const std::string& getServerConfigurationFile() const = 0;
+
 		///
 		/// Returns the log level that was set on this builder
 		///
@@ -192,6 +219,31 @@ namespace openkit
 		/// If no logger was set, a default logger instance is returned.
 		///
 		virtual std::shared_ptr<openkit::ILogger> getLogger() const = 0;
+
+		///
+		/// Returns the runtime shared with other OpenKit instances.
+		///
+		/// @par
+		/// If no shared runtime was set, @c nullptr is returned and the OpenKit instance runs its own threads.
+		///
+		virtual std::shared_ptr<openkit::IOpenKitRuntime> getSharedRuntime() const = 0;
+
+		///
+		/// Returns the directory of the ring buffers shared with the OpenKit agent process.
+		///
+		/// @par
+		/// If no directory was set, an empty string is returned and the OpenKit instance sends its data itself.
+		///
+		virtual const std::string& getSidecarDirectory() const = 0;
+
+		///
+		/// Returns the capacity in bytes of the ring buffer shared with the OpenKit agent process.
+		///
+		/// @par
+		/// If no capacity was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_SIDECAR_RING_CAPACITY_IN_BYTES
+		/// is returned.
+		///
+		virtual int64_t getSidecarRingCapacity() const = 0;
 	};
 }
 
@@ -0,0 +1,58 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _OPENKIT_IOPENKITRUNTIME_H
+#define _OPENKIT_IOPENKITRUNTIME_H
+
+#include "OpenKit_export.h"
+
+#include <cstdint>
+
+namespace openkit
+{
+	///
+	/// Runtime shared by several OpenKit instances living in the same process.
+	///
+	/// OpenKit instances attached to a runtime (see @ref openkit::AbstractOpenKitBuilder::withSharedRuntime) do not start
+	/// own threads. Instead the runtime provides
+	/// <ul>
+	///   <li> a fixed number of threads sending the beacon data of all instances,
+	///   <li> a single thread evicting records from their beacon caches,
+	///   <li> a global beacon cache memory budget, which is split equally across the attached instances,
+	///   <li> a pool of HTTP connections shared by all instances.
+	/// </ul>
+	///
+	/// The runtime is kept alive by the attached OpenKit instances.
+	///
+	class OPENKIT_EXPORT IOpenKitRuntime
+	{
+	public:
+		///
+		/// Destructor
+		///
+		virtual ~IOpenKitRuntime() {}
+
+		///
+		/// Returns the number of OpenKit instances currently attached to this runtime.
+		///
+		/// An instance is attached from its creation until it is shut down.
+		///
+		virtual int32_t getNumberOfAttachedInstances() const = 0;
+	};
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "OpenKit_export.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <memory>
 
@@ -73,6 +74,55 @@ namespace openkit
 		///
 		virtual std::shared_ptr<IWebRequestTracer> traceWebRequest(const char* url) = 0;
 
+		///
+		/// Enters an Action with a specified name in this Session, like @ref enterAction(const char*), but the name is
+		/// given by its first byte and its length in bytes.
+		///
+		/// @par
+		/// The name does not need to be terminated, which allows passing a slice of a larger buffer without copying it.
+		/// Exactly @c actionNameLength bytes are used, @c '\0' characters included.
+		/// The same applies to all other string parameters given together with a length.
+		///
+		/// @param[in] actionName       name of the Action
+		/// @param[in] actionNameLength number of bytes of @c actionName
+		/// @returns Action instance to work with
+		///
+		virtual std::shared_ptr<IRootAction> enterAction(const char* actionName, size_t actionNameLength) = 0;
+
+		///
+		/// Tags a session with the provided @c userTag, like @ref identifyUser(const char*), but the user tag is given
+		/// by its first byte and its length in bytes.
+		///
+		/// @param[in] userTag       id of the user
+		/// @param[in] userTagLength number of bytes of @c userTag
+		///
+		virtual void identifyUser(const char* userTag, size_t userTagLength) = 0;
+
+		///
+		/// Reports a crash with a specified error name, crash reason and a stacktrace, like
+		/// @ref reportCrash(const char*, const char*, const char*), but all strings are given by their first byte and
+		/// their length in bytes.
+		///
+		/// @param[in] errorName        name of the error leading to the crash(e.g.Exception class)
+		/// @param[in] errorNameLength  number of bytes of @c errorName
+		/// @param[in] reason           reason or description of that error
+		/// @param[in] reasonLength     number of bytes of @c reason
+		/// @param[in] stacktrace       stacktrace leading to that crash
+		/// @param[in] stacktraceLength number of bytes of @c stacktrace
+		///
+		virtual void reportCrash(const char* errorName, size_t errorNameLength, const char* reason, size_t reasonLength,
+			const char* stacktrace, size_t stacktraceLength) = 0;
+
+		///
+		/// Allows tracing and timing of a web request, like @ref traceWebRequest(const char*), but the URL is given by its
+		/// first byte and its length in bytes.
+		///
+		/// @param url       the URL of the web request to be tagged and timed
+		/// @param urlLength number of bytes of @c url
+		/// @return a WebRequestTracer which allows getting the tag value and adding timing information
+		///
+		virtual std::shared_ptr<IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) = 0;
+
 		///
 		/// Ends this Session and marks it as ready for immediate sending.
 		/// @remarks All previously added action are implicitly closed
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _OPENKIT_OPENKITRUNTIMEBUILDER_H
+#define _OPENKIT_OPENKITRUNTIMEBUILDER_H
+
+#include "OpenKit_export.h"
+#include "OpenKit/ILogger.h"
+#include "OpenKit/IOpenKitRuntime.h"
+#include "OpenKit/LogLevel.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace openkit
+{
+	///
+	/// Builder for an @ref openkit::IOpenKitRuntime shared by several OpenKit instances.
+	///
+	class OPENKIT_EXPORT OpenKitRuntimeBuilder
+	{
+		public:
+
+			///
+			/// Constructor
+			///
+			OpenKitRuntimeBuilder();
+
+			///
+			/// Destructor
+			///
+			virtual ~OpenKitRuntimeBuilder() = default;
+
+			///
+			/// Sets the log level if the default logger is used.
+			/// If a custom logger is provided by calling @ref withLogger, debug and info log output
+			/// depends on the values returned by @ref openkit::ILogger::isDebugEnabled() and @ref openkit::ILogger::isInfoEnabled().
+			/// @param[in] logLevel The logLevel for the custom logger
+			/// @return @c this for fluent usage
+			///
+			OpenKitRuntimeBuilder& withLogLevel(openkit::LogLevel logLevel);
+
+			///
+			/// Sets the logger used by the runtime's threads. If no logger is set the default console logger is used.
+			/// @param[in] logger the logger
+			/// @return @c this for fluent usage
+			///
+			OpenKitRuntimeBuilder& withLogger(std::shared_ptr<openkit::ILogger> logger);
+
+			///
+			/// Sets the lower memory boundary of all beacon caches together.
+			///
+			/// Each attached OpenKit instance gets an equal share of this boundary, replacing the instance's own
+			/// lower memory boundary.
+			/// @param[in] lowerMemoryBoundaryInBytes The lower boundary of all beacon caches or negative if unlimited.
+			/// @returns @c this
+			///
+			OpenKitRuntimeBuilder& withBeaconCacheLowerMemoryBoundary(int64_t lowerMemoryBoundaryInBytes);
+
+			///
+			/// Sets the upper memory boundary of all beacon caches together.
+			///
+			/// Each attached OpenKit instance gets an equal share of this boundary, replacing the instance's own
+			/// upper memory boundary.
+			/// @param[in] upperMemoryBoundaryInBytes The upper boundary of all beacon caches or negative if unlimited.
+			/// @returns @c this
+			///
+			OpenKitRuntimeBuilder& withBeaconCacheUpperMemoryBoundary(int64_t upperMemoryBoundaryInBytes);
+
+			///
+			/// Sets the number of threads sending the beacon data of all attached OpenKit instances.
+			/// Records are evicted from the instances' beacon caches by an additional thread.
+			///
+			/// Default is @ref core::configuration::DEFAULT_NUMBER_OF_SENDING_THREADS.
+			/// @param[in] numberOfSendingThreads the number of threads, at least one thread is used
+			/// @returns @c this
+			///
+			OpenKitRuntimeBuilder& withNumberOfSendingThreads(int32_t numberOfSendingThreads);
+
+			///
+			/// Builds an @ref openkit::IOpenKitRuntime instance
+			/// @return an @ref openkit::IOpenKitRuntime instance
+			///
+			std::shared_ptr<openkit::IOpenKitRuntime> build();
+
+			///
+			/// Returns the logger used by the runtime.
+			///
+			std::shared_ptr<openkit::ILogger> getLogger() const;
+
+			///
+			/// Returns the lower memory boundary of all beacon caches together.
+			///
+			int64_t getBeaconCacheLowerMemoryBoundary() const;
+
+			///
+			/// Returns the upper memory boundary of all beacon caches together.
+			///
+			int64_t getBeaconCacheUpperMemoryBoundary() const;
+
+			///
+			/// Returns the number of threads sending beacon data.
+			///
+			int32_t getNumberOfSendingThreads() const;
+
+		private:
+
+			/// Log level used for the default logger
+			LogLevel mLogLevel;
+
+			/// The logger used to log traces
+			std::shared_ptr<ILogger> mLogger;
+
+			/// lower memory boundary of all beacon caches
+			int64_t mBeaconCacheLowerMemoryBoundary;
+
+			/// upper memory boundary of all beacon caches
+			int64_t mBeaconCacheUpperMemoryBoundary;
+
+			/// number of threads sending beacon data
+			int32_t mNumberOfSendingThreads;
+	};
+}
+
+#endif
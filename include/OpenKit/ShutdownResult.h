@@ -0,0 +1,44 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _OPENKIT_SHUTDOWNRESULT_H
+#define _OPENKIT_SHUTDOWNRESULT_H
+
+#include "OpenKit_export.h"
+
+#include <cstdint>
+
+namespace openkit
+{
+	///
+	/// Outcome of shutting down OpenKit via @ref openkit::IOpenKit::shutdown(int64_t)
+	///
+	/// A record is a single piece of data reported via OpenKit, like an action, an event or an error.
+	///
+	struct OPENKIT_EXPORT ShutdownResult
+	{
+		/// @c true if sending all data was finished or given up before the timeout expired, @c false otherwise
+		bool isCompleted;
+
+		/// number of records sent to the server while shutting down
+		int64_t numberOfFlushedRecords;
+
+		/// number of records discarded, because they could not be sent before the timeout expired
+		int64_t numberOfDroppedRecords;
+	};
+}
+
+#endif
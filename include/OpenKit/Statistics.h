@@ -0,0 +1,132 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _OPENKIT_STATISTICS_H
+#define _OPENKIT_STATISTICS_H
+
+#include "OpenKit_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace openkit
+{
+	/// number of buckets of a @ref HistogramStatistics
+	constexpr size_t NUMBER_OF_HISTOGRAM_BUCKETS = 32;
+
+	///
+	/// Distribution of recorded values using buckets with exponentially growing bounds
+	///
+	/// Bucket 0 counts values less than 1, bucket @c i counts values in the range [2^(i-1), 2^i)
+	/// and the last bucket additionally counts all larger values.
+	///
+	struct OPENKIT_EXPORT HistogramStatistics
+	{
+		/// number of recorded values
+		int64_t count;
+
+		/// sum of all recorded values
+		int64_t sum;
+
+		/// number of recorded values per bucket
+		int64_t buckets[NUMBER_OF_HISTOGRAM_BUCKETS];
+	};
+
+	///
+	/// Snapshot of the self-monitoring metrics of an OpenKit instance, see @ref openkit::IOpenKit::getStatistics()
+	///
+	/// Counters and histograms accumulate since the OpenKit instance was created, rates like the number of
+	/// ingested records per second are obtained by comparing two snapshots. A record is a single piece of
+	/// data reported via OpenKit, like an action, an event or an error.
+	///
+	struct OPENKIT_EXPORT Statistics
+	{
+		/// @c true if statistics are enabled, if @c false all other values are zero
+		bool isEnabled;
+
+		/// number of event records (events, values, errors, crashes, ...) added to the beacon cache
+		int64_t numberOfEventRecordsAdded;
+
+		/// number of action records added to the beacon cache
+		int64_t numberOfActionRecordsAdded;
+
+		/// current number of bytes in the beacon cache, not counting data which is currently sent
+		int64_t beaconCacheSizeInBytes;
+
+		/// current number of records in the beacon cache
+		int64_t numberOfCachedRecords;
+
+		/// current number of sessions having data in the beacon cache
+		int64_t numberOfCachedSessions;
+
+		/// number of records evicted from the beacon cache, because they exceeded the maximum record age
+		int64_t numberOfRecordsEvictedByAge;
+
+		/// number of records evicted from the beacon cache, because the cache exceeded its memory boundary
+		int64_t numberOfRecordsEvictedBySpace;
+
+		/// sizes in bytes of the uncompressed beacon chunks taken from the beacon cache
+		HistogramStatistics beaconChunkSizeInBytes;
+
+		/// total number of bytes of beacon chunks before compression
+		int64_t numberOfUncompressedBeaconBytes;
+
+		/// total number of bytes of beacon chunks after compression
+		int64_t numberOfCompressedBeaconBytes;
+
+		/// durations in milliseconds of sending all data of a session
+		HistogramStatistics beaconSendDurationInMillis;
+
+		/// number of HTTP requests, including retries
+		int64_t numberOfHTTPRequests;
+
+		/// number of HTTP requests which were retries of a failed request
+		int64_t numberOfHTTPRetries;
+
+		/// number of HTTP requests which failed without a response or with an error response
+		int64_t numberOfHTTPErrors;
+
+		/// number of HTTP responses with status code 429 (too many requests)
+		int64_t numberOfHTTPTooManyRequestsResponses;
+
+		/// durations in milliseconds of single HTTP requests
+		HistogramStatistics httpRequestDurationInMillis;
+
+		/// current number of sessions known by the beacon sender
+		int64_t numberOfSendingSessions;
+
+		/// total time in milliseconds spent in the initial beacon sending state
+		int64_t timeInInitialStateInMillis;
+
+		/// total time in milliseconds spent in the capture on beacon sending state
+		int64_t timeInCaptureOnStateInMillis;
+
+		/// total time in milliseconds spent in the capture off beacon sending state
+		int64_t timeInCaptureOffStateInMillis;
+
+		/// total time in milliseconds spent in the flush sessions beacon sending state
+		int64_t timeInFlushSessionsStateInMillis;
+
+		/// number of records dropped in sidecar mode, because the ring buffer to the agent process was full
+		int64_t numberOfSidecarRecordsDropped;
+
+		/// number of payload bytes dropped in sidecar mode, because the ring buffer to the agent process was full
+		int64_t numberOfSidecarBytesDropped;
+	};
+}
+
+#endif
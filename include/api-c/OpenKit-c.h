@@ -18,6 +18,7 @@
 #define _API_C_OPENKIT_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "curl/curl.h"
 
@@ -227,6 +228,50 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void useCrashReportingLevelForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, CrashReportingLevel crashReportingLevel);
 
+	///
+	/// Enable or disable deferred serialization of reported events in the OpenKit configuration
+	///
+	/// If enabled, reported values, events and errors are serialized on the beacon sending thread.
+	/// @param[in] configurationHandle configuration storing the given parameter
+	/// @param[in] deferredSerialization optional parameter, default is @c false
+	///
+	OPENKIT_EXPORT void useDeferredSerializationForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, bool deferredSerialization);
+
+	///
+	/// Sets the file the last server configuration is persisted in for the OpenKit configuration
+	///
+	/// If set, new sessions are configured with the persisted server configuration right after startup.
+	/// @param[in] configurationHandle configuration storing the given parameter
+	/// @param[in] serverConfigurationFile optional parameter, by default the server configuration is not persisted
+	///
+	OPENKIT_EXPORT void useServerConfigurationFileForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, const char* serverConfigurationFile);
+
+	///
+	/// Enable or disable the collection of statistics about OpenKit's own processing in the OpenKit configuration
+	///
+	/// If enabled, the statistics are obtained via @ref getStatisticsOfOpenKit.
+	/// @param[in] configurationHandle configuration storing the given parameter
+	/// @param[in] statistics optional parameter, default is @c false
+	///
+	OPENKIT_EXPORT void useStatisticsForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, bool statistics);
+
+	///
+	/// Runs OpenKit in sidecar mode, passing all data to the openkit-agent process watching the given directory
+	///
+	/// See @ref openkit::AbstractOpenKitBuilder::withSidecarDirectory for details.
+	/// @param[in] configurationHandle configuration storing the given parameter
+	/// @param[in] sidecarDirectory optional parameter, by default OpenKit sends its data itself
+	///
+	OPENKIT_EXPORT void useSidecarDirectoryForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, const char* sidecarDirectory);
+
+	///
+	/// Sets the capacity of the ring buffer passing data to the openkit-agent process in sidecar mode
+	///
+	/// @param[in] configurationHandle configuration storing the given parameter
+	/// @param[in] sidecarRingCapacity optional parameter in bytes, default is 1 MiB
+	///
+	OPENKIT_EXPORT void useSidecarRingCapacityForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, int64_t sidecarRingCapacity);
+
 	//--------------
 	//  OpenKit
 	//--------------
@@ -255,6 +300,19 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void shutdownOpenKit(struct OpenKitHandle* openKitHandle);
 
+	///
+	/// Shuts down the OpenKit, ending all open Sessions and sending them until the given timeout expires.
+	/// Sessions which could not be sent when the timeout expires are discarded.
+	/// After calling @c shutdownOpenKitWithTimeout the openKitHandle is released and must not be used any more.
+	/// If a request is still in progress when the timeout expires, releasing the handle waits until it returns.
+	/// @param[in] openKitHandle the handle returned by @ref createDynatraceOpenKit or @ref createAppMonOpenKit
+	/// @param[in] timeoutMillis the maximum number of milliseconds to wait for the sessions being sent
+	/// @param[out] numberOfFlushedRecords receives the number of records sent while shutting down, might be @c NULL
+	/// @param[out] numberOfDroppedRecords receives the number of records discarded while shutting down, might be @c NULL
+	/// @return @c true if all sessions were sent or discarded before the timeout expired, @c false otherwise
+	///
+	OPENKIT_EXPORT bool shutdownOpenKitWithTimeout(struct OpenKitHandle* openKitHandle, int64_t timeoutMillis, int64_t* numberOfFlushedRecords, int64_t* numberOfDroppedRecords);
+
 	///
 	/// Waits until OpenKit is fully initialized.
 	///
@@ -292,6 +350,58 @@ extern "C" {
 	///
 	OPENKIT_EXPORT bool isInitialized(struct OpenKitHandle* openKitHandle);
 
+	/// number of buckets of an @ref OpenKitHistogramStatistics
+	#define OPENKIT_HISTOGRAM_BUCKETS 32
+
+	///
+	/// Distribution of recorded values, see @ref openkit::HistogramStatistics
+	///
+	struct OpenKitHistogramStatistics
+	{
+		int64_t count;
+		int64_t sum;
+		int64_t buckets[OPENKIT_HISTOGRAM_BUCKETS];
+	};
+
+	///
+	/// Statistics about OpenKit's own processing, see @ref openkit::Statistics for the meaning of the fields
+	///
+	struct OpenKitStatistics
+	{
+		bool isEnabled;
+		int64_t numberOfEventRecordsAdded;
+		int64_t numberOfActionRecordsAdded;
+		int64_t beaconCacheSizeInBytes;
+		int64_t numberOfCachedRecords;
+		int64_t numberOfCachedSessions;
+		int64_t numberOfRecordsEvictedByAge;
+		int64_t numberOfRecordsEvictedBySpace;
+		struct OpenKitHistogramStatistics beaconChunkSizeInBytes;
+		int64_t numberOfUncompressedBeaconBytes;
+		int64_t numberOfCompressedBeaconBytes;
+		struct OpenKitHistogramStatistics beaconSendDurationInMillis;
+		int64_t numberOfHTTPRequests;
+		int64_t numberOfHTTPRetries;
+		int64_t numberOfHTTPErrors;
+		int64_t numberOfHTTPTooManyRequestsResponses;
+		struct OpenKitHistogramStatistics httpRequestDurationInMillis;
+		int64_t numberOfSendingSessions;
+		int64_t timeInInitialStateInMillis;
+		int64_t timeInCaptureOnStateInMillis;
+		int64_t timeInCaptureOffStateInMillis;
+		int64_t timeInFlushSessionsStateInMillis;
+		int64_t numberOfSidecarRecordsDropped;
+		int64_t numberOfSidecarBytesDropped;
+	};
+
+	///
+	/// Returns the statistics collected about OpenKit's own processing.
+	/// @param[in] openKitHandle the handle returned by @ref createDynatraceOpenKit or @ref createAppMonOpenKit
+	/// @param[out] statistics receives the current statistics, all values are zero if statistics are disabled
+	/// @returns @c true if statistics are enabled and were written, @c false otherwise
+	///
+	OPENKIT_EXPORT bool getStatisticsOfOpenKit(struct OpenKitHandle* openKitHandle, struct OpenKitStatistics* statistics);
+
 
 	//--------------
 	//  Session
@@ -335,6 +445,16 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void identifyUser(struct SessionHandle* sessionHandle, const char* userTag);
 
+	///
+	/// Like @ref identifyUser, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] sessionHandle the handle returned by @ref createSession
+	/// @param[in] userTag       id of the user
+	/// @param[in] userTagLength number of bytes of @c userTag
+	///
+	OPENKIT_EXPORT void identifyUserWithLength(struct SessionHandle* sessionHandle, const char* userTag, size_t userTagLength);
+
 	///
 	/// Reports a crash with a specified error name, crash reason and a stacktrace.
 	/// Note: If the given @c errorName is @c NULL or an empty string, no crash report will be sent to the server.
@@ -345,6 +465,49 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportCrash(struct SessionHandle* sessionHandle, const char* errorName, const char* reason, const char* stacktrace);
 
+	///
+	/// Like @ref reportCrash, but the strings are given together with their length in bytes.
+	/// The strings do not need to be terminated. Exactly the given number of bytes is used for each one, NUL characters included.
+	///
+	/// @param[in] sessionHandle    the handle returned by @ref createSession
+	/// @param[in] errorName        name of the error leading to the crash (e.g. Exception class)
+	/// @param[in] errorNameLength  number of bytes of @c errorName
+	/// @param[in] reason           reason or description of that error
+	/// @param[in] reasonLength     number of bytes of @c reason
+	/// @param[in] stacktrace       stacktrace leading to that crash
+	/// @param[in] stacktraceLength number of bytes of @c stacktrace
+	///
+	OPENKIT_EXPORT void reportCrashWithLength(struct SessionHandle* sessionHandle, const char* errorName, size_t errorNameLength, const char* reason, size_t reasonLength, const char* stacktrace, size_t stacktraceLength);
+
+	//--------------
+	//  Event batches
+	//--------------
+
+	typedef enum EVENT_DESCRIPTOR_TYPE
+	{
+		EVENT_DESCRIPTOR_TYPE_NAMED_EVENT = 0,	///< named event without value
+		EVENT_DESCRIPTOR_TYPE_VALUE_INT = 1,	///< int value, see @c intValue
+		EVENT_DESCRIPTOR_TYPE_VALUE_DOUBLE = 2,	///< double value, see @c doubleValue
+		EVENT_DESCRIPTOR_TYPE_VALUE_STRING = 3,	///< string value, see @c stringValue
+		EVENT_DESCRIPTOR_TYPE_FAILURE_ERROR = 4	///< error with error code @c intValue and reason @c stringValue
+	} EVENT_DESCRIPTOR_TYPE;
+
+	///
+	/// A single event, value or error reported in a batch via @ref reportEventsOnRootAction or @ref reportEventsOnAction.
+	///
+	/// Strings are given as pointer and length in bytes and do not need to be null terminated.
+	///
+	struct OpenKitEventDescriptor
+	{
+		EVENT_DESCRIPTOR_TYPE type;		///< kind of the reported data, determines which of the value fields are used
+		const char* name;				///< name of the event, value or error
+		size_t nameLength;				///< length of @c name in bytes
+		int32_t intValue;				///< int value or error code
+		double doubleValue;				///< double value
+		const char* stringValue;		///< string value or error reason, may be @c NULL
+		size_t stringValueLength;		///< length of @c stringValue in bytes
+	};
+
 	//--------------
 	//  Root Action
 	//--------------
@@ -360,6 +523,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT struct RootActionHandle* enterRootAction(struct SessionHandle* sessionHandle, const char* rootActionName);
 
+	///
+	/// Like @ref enterRootAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] sessionHandle        the handle returned by @ref createSession
+	/// @param[in] rootActionName       name of the Action
+	/// @param[in] rootActionNameLength number of bytes of @c rootActionName
+	/// @returns Root action instance to work with
+	///
+	OPENKIT_EXPORT struct RootActionHandle* enterRootActionWithLength(struct SessionHandle* sessionHandle, const char* rootActionName, size_t rootActionNameLength);
+
 	///
 	/// Leaves this root action.
 	/// @param[in] rootActionHandle the handle returned by @ref enterRootAction
@@ -376,6 +550,16 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportEventOnRootAction(struct RootActionHandle* rootActionHandle, const char* eventName);
 
+	///
+	/// Like @ref reportEventOnRootAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] eventName		name of the event
+	/// @param[in] eventNameLength	number of bytes of @c eventName
+	///
+	OPENKIT_EXPORT void reportEventOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* eventName, size_t eventNameLength);
+
 	///
 	/// Reports an int value with a specified name.
 	///
@@ -385,6 +569,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportIntValueOnRootAction(struct RootActionHandle* rootActionHandle, const char* valueName, int32_t value);
 
+	///
+	/// Like @ref reportIntValueOnRootAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] valueName		name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value			value itself
+	///
+	OPENKIT_EXPORT void reportIntValueOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, int32_t value);
+
 	///
 	/// Reports a double value with a specified name.
 	///
@@ -394,6 +589,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportDoubleValueOnRootAction(struct RootActionHandle* rootActionHandle, const char* valueName, double value);
 
+	///
+	/// Like @ref reportDoubleValueOnRootAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] valueName		name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value			value itself
+	///
+	OPENKIT_EXPORT void reportDoubleValueOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, double value);
+
 	///
 	/// Reports a String value with a specified name.
 	///
@@ -403,6 +609,18 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportStringValueOnRootAction(struct RootActionHandle* rootActionHandle, const char* valueName, const char* value);
 
+	///
+	/// Like @ref reportStringValueOnRootAction, but the strings are given together with their length in bytes.
+	/// The strings do not need to be terminated. Exactly the given number of bytes is used for each one, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] valueName		name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value			value itself
+	/// @param[in] valueLength	number of bytes of @c value
+	///
+	OPENKIT_EXPORT void reportStringValueOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, const char* value, size_t valueLength);
+
 	///
 	/// Reports an error with a specified name, error code and reason.
 	///
@@ -413,6 +631,33 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportErrorOnRootAction(struct RootActionHandle* rootActionHandle, const char* errorName, int32_t errorCode, const char* reason);
 
+	///
+	/// Like @ref reportErrorOnRootAction, but the strings are given together with their length in bytes.
+	/// The strings do not need to be terminated. Exactly the given number of bytes is used for each one, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] errorName		name of this error
+	/// @param[in] errorNameLength	number of bytes of @c errorName
+	/// @param[in] errorCode		numeric error code of this error
+	/// @param[in] reason			reason for this error
+	/// @param[in] reasonLength	number of bytes of @c reason
+	///
+	OPENKIT_EXPORT void reportErrorOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength);
+
+	///
+	/// Reports several events, values and errors with a single call.
+	///
+	/// The result is the same as calling @ref reportEventOnRootAction, @ref reportIntValueOnRootAction,
+	/// @ref reportDoubleValueOnRootAction, @ref reportStringValueOnRootAction or @ref reportErrorOnRootAction
+	/// for each element, but the handle is validated, the action is locked and the data is serialized only once.
+	/// Elements with a @c NULL or empty name are skipped.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] events			array of the elements to report
+	/// @param[in] numberOfEvents	number of elements in @c events
+	///
+	OPENKIT_EXPORT void reportEventsOnRootAction(struct RootActionHandle* rootActionHandle, const struct OpenKitEventDescriptor* events, size_t numberOfEvents);
+
 	//--------------
 	//  Action
 	//--------------
@@ -428,6 +673,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT struct ActionHandle* enterAction(struct RootActionHandle* rootActionHandle, const char* actionName);
 
+	///
+	/// Like @ref enterAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] rootActionHandle the handle returned by @ref enterRootAction
+	/// @param[in] actionName       name of the Action
+	/// @param[in] actionNameLength number of bytes of @c actionName
+	/// @returns Root action instance to work with
+	///
+	OPENKIT_EXPORT struct ActionHandle* enterActionWithLength(struct RootActionHandle* rootActionHandle, const char* actionName, size_t actionNameLength);
+
 	///
 	/// Leaves this action.
 	/// @param[in] actionHandle the handle returned by @ref enterAction
@@ -444,6 +700,16 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportEventOnAction(struct ActionHandle* actionHandle, const char* eventName);
 
+	///
+	/// Like @ref reportEventOnAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] eventName	name of the event
+	/// @param[in] eventNameLength	number of bytes of @c eventName
+	///
+	OPENKIT_EXPORT void reportEventOnActionWithLength(struct ActionHandle* actionHandle, const char* eventName, size_t eventNameLength);
+
 	///
 	/// Reports an int value with a specified name.
 	///
@@ -453,6 +719,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportIntValueOnAction(struct ActionHandle* actionHandle, const char* valueName, int32_t value);
 
+	///
+	/// Like @ref reportIntValueOnAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] valueName	name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value		value itself
+	///
+	OPENKIT_EXPORT void reportIntValueOnActionWithLength(struct ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, int32_t value);
+
 	///
 	/// Reports a double value with a specified name.
 	///
@@ -462,6 +739,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportDoubleValueOnAction(struct ActionHandle* actionHandle, const char* valueName, double value);
 
+	///
+	/// Like @ref reportDoubleValueOnAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] valueName	name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value		value itself
+	///
+	OPENKIT_EXPORT void reportDoubleValueOnActionWithLength(struct ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, double value);
+
 	///
 	/// Reports a String value with a specified name.
 	///
@@ -471,6 +759,18 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportStringValueOnAction(struct ActionHandle* actionHandle, const char* valueName, const char* value);
 
+	///
+	/// Like @ref reportStringValueOnAction, but the strings are given together with their length in bytes.
+	/// The strings do not need to be terminated. Exactly the given number of bytes is used for each one, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] valueName	name of this value
+	/// @param[in] valueNameLength	number of bytes of @c valueName
+	/// @param[in] value		value itself
+	/// @param[in] valueLength	number of bytes of @c value
+	///
+	OPENKIT_EXPORT void reportStringValueOnActionWithLength(struct ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, const char* value, size_t valueLength);
+
 	///
 	/// Reports an error with a specified name, error code and reason.
 	///
@@ -481,6 +781,28 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportErrorOnAction(struct ActionHandle* actionHandle, const char* errorName, int32_t errorCode, const char* reason);
 
+	///
+	/// Like @ref reportErrorOnAction, but the strings are given together with their length in bytes.
+	/// The strings do not need to be terminated. Exactly the given number of bytes is used for each one, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] errorName	name of this error
+	/// @param[in] errorNameLength	number of bytes of @c errorName
+	/// @param[in] errorCode	numeric error code of this error
+	/// @param[in] reason		reason for this error
+	/// @param[in] reasonLength	number of bytes of @c reason
+	///
+	OPENKIT_EXPORT void reportErrorOnActionWithLength(struct ActionHandle* actionHandle, const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength);
+
+	///
+	/// Reports several events, values and errors with a single call, like @ref reportEventsOnRootAction.
+	///
+	/// @param[in] actionHandle		the handle returned by @ref enterAction
+	/// @param[in] events			array of the elements to report
+	/// @param[in] numberOfEvents	number of elements in @c events
+	///
+	OPENKIT_EXPORT void reportEventsOnAction(struct ActionHandle* actionHandle, const struct OpenKitEventDescriptor* events, size_t numberOfEvents);
+
 
 	//--------------------
 	//  Webrequest Tracer
@@ -504,6 +826,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnSession(struct SessionHandle* sessionHandle, const char* url);
 
+	///
+	/// Like @ref traceWebRequestOnSession, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] sessionHandle	the handle returned by @ref createSession
+	/// @param[in] url				the URL of the web request to be tagged and timed
+	/// @param[in] urlLength	number of bytes of @c url
+	/// @return a WebRequestTracer which allows getting the tag value and adding timing information
+	///
+	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnSessionWithLength(struct SessionHandle* sessionHandle, const char* url, size_t urlLength);
+
 	///
 	/// Allows tracing and timing of a web request handled by any 3rd party HTTP Client (e.g. CURL, EasyHttp, ...).
 	/// In this case the Dynatrace HTTP header (@ref WEBREQUEST_TAG_HEADER) has to be set manually to the
@@ -517,6 +850,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnRootAction(struct RootActionHandle* rootActionHandle, const char* url);
 
+	///
+	/// Like @ref traceWebRequestOnRootAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] rootActionHandle	the handle returned by @ref enterRootAction
+	/// @param[in] url				the URL of the web request to be tagged and timed
+	/// @param[in] urlLength	number of bytes of @c url
+	/// @return a WebRequestTracer which allows getting the tag value and adding timing information
+	///
+	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnRootActionWithLength(struct RootActionHandle* rootActionHandle, const char* url, size_t urlLength);
+
 	///
 	/// Allows tracing and timing of a web request handled by any 3rd party HTTP Client (e.g. CURL, EasyHttp, ...).
 	/// In this case the Dynatrace HTTP header (@ref WEBREQUEST_TAG_HEADER) has to be set manually to the
@@ -530,6 +874,17 @@ extern "C" {
 	///
 	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnAction(struct ActionHandle* actionHandle, const char* url);
 
+	///
+	/// Like @ref traceWebRequestOnAction, but the string is given together with its length in bytes.
+	/// The string does not need to be terminated. Exactly the given number of bytes is used, NUL characters included.
+	///
+	/// @param[in] actionHandle	the handle returned by @ref enterAction
+	/// @param[in] url			the URL of the web request to be tagged and timed
+	/// @param[in] urlLength	number of bytes of @c url
+	/// @return a WebRequestTracer which allows getting the tag value and adding timing information
+	///
+	OPENKIT_EXPORT struct WebRequestTracerHandle* traceWebRequestOnActionWithLength(struct ActionHandle* actionHandle, const char* url, size_t urlLength);
+
 	///
 	/// Starts the web request timing. Should be called when the web request is initiated.
 	/// @param[in] webRequestTracerHandle the handle returned by @ref traceWebRequestOnRootAction or @ref traceWebRequestOnAction
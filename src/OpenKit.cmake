@@ -18,16 +18,21 @@ set(OPENKIT_PUBLIC_HEADERS_CXX_API
     ${CMAKE_SOURCE_DIR}/include/OpenKit/CrashReportingLevel.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/DataCollectionLevel.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/DynatraceOpenKitBuilder.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/EventDescriptor.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/IAction.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/ILogger.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/IOpenKit.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/IOpenKitBuilder.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/IOpenKitRuntime.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/IRootAction.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/ISession.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/ISSLTrustManager.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/IWebRequestTracer.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/LogLevel.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/OpenKitConstants.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/OpenKitRuntimeBuilder.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/ShutdownResult.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/Statistics.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit.h
 )
 
@@ -40,6 +45,7 @@ set(OPENKIT_SOURCES_CXX_API
     ${CMAKE_CURRENT_LIST_DIR}/api/AppMonOpenKitBuilder.cxx
     ${CMAKE_CURRENT_LIST_DIR}/api/DynatraceOpenKitBuilder.cxx
     ${CMAKE_CURRENT_LIST_DIR}/api/LogLevel.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/api/OpenKitRuntimeBuilder.cxx
 )
 
 set(OPENKIT_SOURCES_C_API
@@ -51,6 +57,8 @@ set(OPENKIT_SOURCES_C_API
 )
 
 set(OPENKIT_SOURCES_CORE_CACHING
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AttachedBeaconCacheEvictor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AttachedBeaconCacheEvictor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCache.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEntry.cxx
@@ -62,6 +70,10 @@ set(OPENKIT_SOURCES_CORE_CACHING
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IBeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IBeaconCacheEvictor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IObserver.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/NullBeaconCacheEvictor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/NullBeaconCacheEvictor.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/SharedBeaconCacheEvictor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/SharedBeaconCacheEvictor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/SpaceEvictionStrategy.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/SpaceEvictionStrategy.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/TimeEvictionStrategy.cxx
@@ -97,6 +109,8 @@ set(OPENKIT_SOURCES_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/BeaconConfiguration.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/BeaconConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ConfigurationDefaults.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/FileResponseAttributesStore.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/FileResponseAttributesStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/HTTPClientConfiguration.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/HTTPClientConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IBeaconCacheConfiguration.h
@@ -104,6 +118,7 @@ set(OPENKIT_SOURCES_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IHTTPClientConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IOpenKitConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IPrivacyConfiguration.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IResponseAttributesStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/IServerConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/OpenKitConfiguration.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/OpenKitConfiguration.h
@@ -111,6 +126,8 @@ set(OPENKIT_SOURCES_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/PrivacyConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfiguration.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfiguration.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/SharedBeaconCacheConfiguration.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/SharedBeaconCacheConfiguration.h
 )
 
 set(OPENKIT_SOURCES_CORE_UTIL
@@ -124,10 +141,17 @@ set(OPENKIT_SOURCES_CORE_UTIL
     ${CMAKE_CURRENT_LIST_DIR}/core/util/DefaultLogger.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidator.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidator.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/MetricsRegistry.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/MetricsRegistry.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ObjectPool.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ObjectPool.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/PoolAllocator.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ReadWriteLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedReadLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedWriteLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueue.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/TaskExecutor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/TaskExecutor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncoding.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncoding.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/StringUtil.cxx
@@ -137,6 +161,8 @@ set(OPENKIT_SOURCES_CORE_UTIL
 set(OPENKIT_SOURCES_CORE
     ${CMAKE_CURRENT_LIST_DIR}/core/BeaconSender.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/BeaconSender.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/BeaconSendingScheduler.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/BeaconSendingScheduler.h
     ${CMAKE_CURRENT_LIST_DIR}/core/IBeaconSender.h
     ${CMAKE_CURRENT_LIST_DIR}/core/UTF8String.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/UTF8String.h
@@ -162,6 +188,8 @@ set(OPENKIT_SOURCES_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKit.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitComposite.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitComposite.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitRuntime.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitRuntime.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/RootAction.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/RootAction.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/Session.cxx
@@ -171,6 +199,18 @@ set(OPENKIT_SOURCES_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestTracer.h
 )
 
+set(OPENKIT_SOURCES_CORE_SIDECAR
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SharedMemoryRing.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SharedMemoryRing.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarAgent.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarAgent.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarBeaconCache.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarBeaconCache.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarBeaconSender.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarBeaconSender.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarRecord.h
+)
+
 set(OPENKIT_SOURCES_PROTOCOL_SSL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ssl/SSLBlindTrustManager.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ssl/SSLBlindTrustManager.cxx
@@ -185,6 +225,8 @@ set(OPENKIT_SOURCES_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/EventType.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPConnectionPool.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPConnectionPool.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/IBeacon.h
@@ -193,6 +235,8 @@ set(OPENKIT_SOURCES_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/IStatusResponse.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseParser.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseParser.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseWriter.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseWriter.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParser.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttribute.h
@@ -230,6 +274,8 @@ set(OPENKIT_SOURCES_UTIL_JSON_CONSTANTS
 )
 
 set(OPENKIT_SOURCES_UTIL_JSON_LEXER
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonBufferLexer.h
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonBufferLexer.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonLexer.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonLexer.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonLexerConstants.h
@@ -239,6 +285,8 @@ set(OPENKIT_SOURCES_UTIL_JSON_LEXER
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonToken.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonToken.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonTokenType.h
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonTokenView.h
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonTokenView.cxx
 )
 
 set(OPENKIT_SOURCES_UTIL_JSON_READER
@@ -264,12 +312,15 @@ set(OPENKIT_SOURCES_UTIL_JSON_OBJECTS
 )
 
 set(OPENKIT_SOURCES_UTIL_JSON_PARSER
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/parser/IJsonEventHandler.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/parser/JsonParserState.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/parser/JsonParserException.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/parser/JsonParserException.cxx
 )
 
 set(OPENKIT_SOURCES_UTIL_JSON
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonEventParser.h
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonEventParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonParser.h
     ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonParser.cxx
 )
@@ -285,6 +336,7 @@ set(OPENKIT_SOURCES
     ${OPENKIT_SOURCES_CORE_COMMUNICATION}
     ${OPENKIT_SOURCES_CORE_CONFIGURATION}
     ${OPENKIT_SOURCES_CORE_OBJECTS}
+    ${OPENKIT_SOURCES_CORE_SIDECAR}
     ${OPENKIT_SOURCES_CORE_UTIL}
     ${OPENKIT_SOURCES_PROTOCOL_SSL}
     ${OPENKIT_SOURCES_PROTOCOL}
@@ -437,6 +489,7 @@ function(build_open_kit)
     source_group("Source Files\\Core\\Caching" FILES ${OPENKIT_SOURCES_CORE_CACHING})
     source_group("Source Files\\Core\\Communication" FILES ${OPENKIT_SOURCES_CORE_COMMUNICATION})
     source_group("Source Files\\Core\\Configuration" FILES ${OPENKIT_SOURCES_CORE_CONFIGURATION})
+    source_group("Source Files\\Core\\Sidecar" FILES ${OPENKIT_SOURCES_CORE_SIDECAR})
     source_group("Source Files\\Core\\Util" FILES ${OPENKIT_SOURCES_CORE_UTIL})
     source_group("Source Files\\Protocol" FILES ${OPENKIT_SOURCES_PROTOCOL})
     source_group("Source Files\\Protocol\\SSL" FILES ${OPENKIT_SOURCES_PROTOCOL_SSL})
@@ -32,6 +32,7 @@
 #include "protocol/ssl/SSLBlindTrustManager.h"
 
 #include <list>
+#include <vector>
 #include <exception>
 #include <assert.h>
 #include <string.h>
@@ -261,6 +262,11 @@ extern "C" {
 		int64_t beaconCacheUpperMemoryBoundary = -1;
 		DataCollectionLevel dataCollectionLevel = DATA_COLLECTION_LEVEL_USER_BEHAVIOR;
 		CrashReportingLevel crashReportingLevel = CRASH_REPORTING_LEVEL_OPT_IN_CRASHES;
+		bool deferredSerialization = false;
+		char* serverConfigurationFile = nullptr;
+		bool statistics = false;
+		char* sidecarDirectory = nullptr;
+		int64_t sidecarRingCapacity = -1;
 	} OpenKitConfigurationHandle;
 
 	struct OpenKitConfigurationHandle* createOpenKitConfigurationWithOrigAndHashedDeviceId(const char* endpointURL, const char* applicationID, int64_t deviceID, const char* origDeviceID)
@@ -310,6 +316,8 @@ extern "C" {
 		FREE_DUPLICATED_STRING(configurationHandle->operatingSystem);
 		FREE_DUPLICATED_STRING(configurationHandle->manufacturer);
 		FREE_DUPLICATED_STRING(configurationHandle->modelID);
+		FREE_DUPLICATED_STRING(configurationHandle->serverConfigurationFile);
+		FREE_DUPLICATED_STRING(configurationHandle->sidecarDirectory);
 
 		// release configuration object
 		delete configurationHandle;
@@ -414,6 +422,43 @@ extern "C" {
 		configurationHandle->crashReportingLevel = crashReportingLevel;
 	}
 
+	void useDeferredSerializationForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, bool deferredSerialization)
+	{
+		configurationHandle->deferredSerialization = deferredSerialization;
+	}
+
+	void useServerConfigurationFileForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, const char* serverConfigurationFile)
+	{
+		//sanity
+		if (configurationHandle != nullptr && serverConfigurationFile != nullptr)
+		{
+			configurationHandle->serverConfigurationFile = duplicateString(serverConfigurationFile);
+		}
+	}
+
+	void useStatisticsForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, bool statistics)
+	{
+		configurationHandle->statistics = statistics;
+	}
+
+	void useSidecarDirectoryForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, const char* sidecarDirectory)
+	{
+		//sanity
+		if (configurationHandle != nullptr && sidecarDirectory != nullptr)
+		{
+			FREE_DUPLICATED_STRING(configurationHandle->sidecarDirectory);
+			configurationHandle->sidecarDirectory = duplicateString(sidecarDirectory);
+		}
+	}
+
+	void useSidecarRingCapacityForConfiguration(struct OpenKitConfigurationHandle* configurationHandle, int64_t sidecarRingCapacity)
+	{
+		if (configurationHandle != nullptr && sidecarRingCapacity > 0)
+		{
+			configurationHandle->sidecarRingCapacity = sidecarRingCapacity;
+		}
+	}
+
 	//--------------
 	//  OpenKit
 	//--------------
@@ -528,6 +573,31 @@ extern "C" {
 		{
 			builder.withCrashReportingLevel((openkit::CrashReportingLevel)configurationHandle->crashReportingLevel);
 		}
+
+		if (configurationHandle->deferredSerialization)
+		{
+			builder.enableDeferredSerialization();
+		}
+
+		if (configurationHandle->serverConfigurationFile != nullptr)
+		{
+			builder.withServerConfigurationFile(configurationHandle->serverConfigurationFile);
+		}
+
+		if (configurationHandle->statistics)
+		{
+			builder.enableStatistics();
+		}
+
+		if (configurationHandle->sidecarDirectory != nullptr)
+		{
+			builder.withSidecarDirectory(configurationHandle->sidecarDirectory);
+		}
+
+		if (configurationHandle->sidecarRingCapacity > 0)
+		{
+			builder.withSidecarRingCapacity(configurationHandle->sidecarRingCapacity);
+		}
 	}
 
 	static OpenKitHandle* createOpenKitHandle(struct OpenKitConfigurationHandle* configurationHandle, std::shared_ptr<openkit::IOpenKit> openKit)
@@ -587,6 +657,25 @@ extern "C" {
 		return handle;
 	}
 
+	static void destroyOpenKitHandle(OpenKitHandle* openKitHandle)
+	{
+		// release shared pointer
+		openKitHandle->sharedPointer = nullptr;
+		openKitHandle->logger = nullptr;
+		if (openKitHandle->ownsTrustManagerHandle &&  openKitHandle->trustManagerHandle != nullptr)
+		{
+			destroyTrustManager(openKitHandle->trustManagerHandle);
+			openKitHandle->trustManagerHandle = nullptr;
+		}
+		if (openKitHandle->ownsLoggerHandle && openKitHandle->loggerHandle != nullptr)
+		{
+			destroyLogger(openKitHandle->loggerHandle);
+			openKitHandle->loggerHandle = nullptr;
+		}
+
+		delete openKitHandle;
+	}
+
 	void shutdownOpenKit(OpenKitHandle* openKitHandle)
 	{
 		// Sanity
@@ -601,23 +690,40 @@ extern "C" {
 			assert(openKitHandle->sharedPointer != nullptr);
 			openKitHandle->sharedPointer->shutdown();
 
-			// release shared pointer
-			openKitHandle->sharedPointer = nullptr;
-			openKitHandle->logger = nullptr;
-			if (openKitHandle->ownsTrustManagerHandle &&  openKitHandle->trustManagerHandle != nullptr)
+			destroyOpenKitHandle(openKitHandle);
+		}
+		CATCH_AND_LOG(openKitHandle)
+	}
+
+	bool shutdownOpenKitWithTimeout(OpenKitHandle* openKitHandle, int64_t timeoutMillis, int64_t* numberOfFlushedRecords, int64_t* numberOfDroppedRecords)
+	{
+		// Sanity
+		if (openKitHandle == nullptr)
+		{
+			return false;
+		}
+
+		TRY
+		{
+			// retrieve the OpenKit instance from the handle and call the respective method
+			assert(openKitHandle->sharedPointer != nullptr);
+			auto result = openKitHandle->sharedPointer->shutdown(timeoutMillis);
+			if (numberOfFlushedRecords != nullptr)
 			{
-				destroyTrustManager(openKitHandle->trustManagerHandle);
-				openKitHandle->trustManagerHandle = nullptr;
+				*numberOfFlushedRecords = result.numberOfFlushedRecords;
 			}
-			if (openKitHandle->ownsLoggerHandle && openKitHandle->loggerHandle != nullptr)
+			if (numberOfDroppedRecords != nullptr)
 			{
-				destroyLogger(openKitHandle->loggerHandle);
-				openKitHandle->loggerHandle = nullptr;
+				*numberOfDroppedRecords = result.numberOfDroppedRecords;
 			}
 
-			delete openKitHandle;
+			destroyOpenKitHandle(openKitHandle);
+
+			return result.isCompleted;
 		}
 		CATCH_AND_LOG(openKitHandle)
+
+		return false;
 	}
 
 	bool waitForInitCompletion(struct OpenKitHandle* openKitHandle)
@@ -668,6 +774,61 @@ extern "C" {
 		return false;
 	}
 
+	static void copyHistogramStatistics(struct OpenKitHistogramStatistics& target, const openkit::HistogramStatistics& source)
+	{
+		static_assert(OPENKIT_HISTOGRAM_BUCKETS == openkit::NUMBER_OF_HISTOGRAM_BUCKETS, "number of histogram buckets differs");
+
+		target.count = source.count;
+		target.sum = source.sum;
+		memcpy(target.buckets, source.buckets, sizeof(target.buckets));
+	}
+
+	bool getStatisticsOfOpenKit(struct OpenKitHandle* openKitHandle, struct OpenKitStatistics* statistics)
+	{
+		// Sanity
+		if (openKitHandle == nullptr || statistics == nullptr)
+		{
+			return false;
+		}
+
+		TRY
+		{
+			// retrieve the OpenKit instance from the handle and call the respective method
+			assert(openKitHandle->sharedPointer != nullptr);
+			auto source = openKitHandle->sharedPointer->getStatistics();
+
+			statistics->isEnabled = source.isEnabled;
+			statistics->numberOfEventRecordsAdded = source.numberOfEventRecordsAdded;
+			statistics->numberOfActionRecordsAdded = source.numberOfActionRecordsAdded;
+			statistics->beaconCacheSizeInBytes = source.beaconCacheSizeInBytes;
+			statistics->numberOfCachedRecords = source.numberOfCachedRecords;
+			statistics->numberOfCachedSessions = source.numberOfCachedSessions;
+			statistics->numberOfRecordsEvictedByAge = source.numberOfRecordsEvictedByAge;
+			statistics->numberOfRecordsEvictedBySpace = source.numberOfRecordsEvictedBySpace;
+			copyHistogramStatistics(statistics->beaconChunkSizeInBytes, source.beaconChunkSizeInBytes);
+			statistics->numberOfUncompressedBeaconBytes = source.numberOfUncompressedBeaconBytes;
+			statistics->numberOfCompressedBeaconBytes = source.numberOfCompressedBeaconBytes;
+			copyHistogramStatistics(statistics->beaconSendDurationInMillis, source.beaconSendDurationInMillis);
+			statistics->numberOfHTTPRequests = source.numberOfHTTPRequests;
+			statistics->numberOfHTTPRetries = source.numberOfHTTPRetries;
+			statistics->numberOfHTTPErrors = source.numberOfHTTPErrors;
+			statistics->numberOfHTTPTooManyRequestsResponses = source.numberOfHTTPTooManyRequestsResponses;
+			copyHistogramStatistics(statistics->httpRequestDurationInMillis, source.httpRequestDurationInMillis);
+			statistics->numberOfSendingSessions = source.numberOfSendingSessions;
+			statistics->timeInInitialStateInMillis = source.timeInInitialStateInMillis;
+			statistics->timeInCaptureOnStateInMillis = source.timeInCaptureOnStateInMillis;
+			statistics->timeInCaptureOffStateInMillis = source.timeInCaptureOffStateInMillis;
+			statistics->timeInFlushSessionsStateInMillis = source.timeInFlushSessionsStateInMillis;
+			statistics->numberOfSidecarRecordsDropped = source.numberOfSidecarRecordsDropped;
+			statistics->numberOfSidecarBytesDropped = source.numberOfSidecarBytesDropped;
+
+			return source.isEnabled;
+		}
+		CATCH_AND_LOG(openKitHandle)
+
+		return false;
+	}
+
 	//--------------
 	//  Session
 	//--------------
@@ -744,6 +905,20 @@ extern "C" {
 		CATCH_AND_LOG(sessionHandle)
 	}
 
+	void identifyUserWithLength(SessionHandle* sessionHandle, const char* userTag, size_t userTagLength)
+	{
+		TRY
+		{
+			if (sessionHandle)
+			{
+				// retrieve the Session instance from the handle and call the respective method
+				assert(sessionHandle->sharedPointer != nullptr);
+				sessionHandle->sharedPointer->identifyUser(userTag, userTagLength);
+			}
+		}
+		CATCH_AND_LOG(sessionHandle)
+	}
+
 	void reportCrash(SessionHandle* sessionHandle, const char* errorName, const char* reason, const char* stacktrace)
 	{
 		TRY
@@ -758,6 +933,75 @@ extern "C" {
 		CATCH_AND_LOG(sessionHandle)
 	}
 
+	void reportCrashWithLength(SessionHandle* sessionHandle, const char* errorName, size_t errorNameLength, const char* reason, size_t reasonLength, const char* stacktrace, size_t stacktraceLength)
+	{
+		TRY
+		{
+			if (sessionHandle)
+			{
+				// retrieve the Session instance from the handle and call the respective method
+				assert(sessionHandle->sharedPointer != nullptr);
+				sessionHandle->sharedPointer->reportCrash(errorName, errorNameLength, reason, reasonLength, stacktrace, stacktraceLength);
+			}
+		}
+		CATCH_AND_LOG(sessionHandle)
+	}
+
+	//--------------
+	//  Event batches
+	//--------------
+
+	static bool toCppEventDescriptorType(EVENT_DESCRIPTOR_TYPE cType, openkit::EventDescriptorType& cppType)
+	{
+		switch (cType)
+		{
+		case EVENT_DESCRIPTOR_TYPE_NAMED_EVENT:
+			cppType = openkit::EventDescriptorType::NAMED_EVENT;
+			return true;
+		case EVENT_DESCRIPTOR_TYPE_VALUE_INT:
+			cppType = openkit::EventDescriptorType::VALUE_INT;
+			return true;
+		case EVENT_DESCRIPTOR_TYPE_VALUE_DOUBLE:
+			cppType = openkit::EventDescriptorType::VALUE_DOUBLE;
+			return true;
+		case EVENT_DESCRIPTOR_TYPE_VALUE_STRING:
+			cppType = openkit::EventDescriptorType::VALUE_STRING;
+			return true;
+		case EVENT_DESCRIPTOR_TYPE_FAILURE_ERROR:
+			cppType = openkit::EventDescriptorType::FAILURE_ERROR;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	static std::vector<openkit::EventDescriptor> toCppEventDescriptors(const OpenKitEventDescriptor* events, size_t numberOfEvents,
+		const std::shared_ptr<openkit::ILogger>& logger)
+	{
+		std::vector<openkit::EventDescriptor> cppEvents;
+		cppEvents.reserve(numberOfEvents);
+		for (size_t i = 0; i < numberOfEvents; i++)
+		{
+			const auto& event = events[i];
+
+			auto cppEvent = openkit::EventDescriptor();
+			if (!toCppEventDescriptorType(event.type, cppEvent.type))
+			{
+				logger->warning("reportEvents: unknown type %d of event at index %zu", static_cast<int32_t>(event.type), i);
+				continue;
+			}
+			cppEvent.name = event.name;
+			cppEvent.nameLength = event.nameLength;
+			cppEvent.intValue = event.intValue;
+			cppEvent.doubleValue = event.doubleValue;
+			cppEvent.stringValue = event.stringValue;
+			cppEvent.stringValueLength = event.stringValueLength;
+			cppEvents.push_back(cppEvent);
+		}
+
+		return cppEvents;
+	}
+
 	//--------------
 	//  Root Action
 	//--------------
@@ -793,6 +1037,31 @@ extern "C" {
 		return handle;
 	}
 
+	RootActionHandle* enterRootActionWithLength(SessionHandle* sessionHandle, const char* rootActionName, size_t rootActionNameLength)
+	{
+		// Sanity
+		if (sessionHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		RootActionHandle* handle = nullptr;
+		TRY
+		{
+			// retrieve the Session instance from the handle and call the respective method
+			assert(sessionHandle->sharedPointer != nullptr);
+			std::shared_ptr<openkit::IRootAction> rootAction = sessionHandle->sharedPointer->enterAction(rootActionName, rootActionNameLength);
+
+			// storing the returned shared pointer in the handle prevents it from going out of scope
+			handle = new RootActionHandle();
+			handle->sharedPointer = rootAction;
+			handle->logger = sessionHandle->logger;
+		}
+		CATCH_AND_LOG(sessionHandle)
+
+		return handle;
+	}
+
 	void leaveRootAction(RootActionHandle* rootActionHandle)
 	{
 		// Sanity
@@ -823,7 +1092,21 @@ extern "C" {
 			{
 				// retrieve the RootAction instance from the handle and call the respective method
 				assert(rootActionHandle->sharedPointer != nullptr);
-				rootActionHandle->sharedPointer->reportEvent(eventName);
+				rootActionHandle->sharedPointer->reportEventRef(eventName);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportEventOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* eventName, size_t eventNameLength)
+	{
+		TRY
+		{
+			if (rootActionHandle)
+			{
+				// retrieve the RootAction instance from the handle and call the respective method
+				assert(rootActionHandle->sharedPointer != nullptr);
+				rootActionHandle->sharedPointer->reportEventRef(eventName, eventNameLength);
 			}
 		}
 		CATCH_AND_LOG(rootActionHandle)
@@ -837,7 +1120,21 @@ extern "C" {
 			{
 				// retrieve the RootAction instance from the handle and call the respective method
 				assert(rootActionHandle->sharedPointer != nullptr);
-				rootActionHandle->sharedPointer->reportValue(valueName, value);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportIntValueOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, int32_t value)
+	{
+		TRY
+		{
+			if (rootActionHandle)
+			{
+				// retrieve the RootAction instance from the handle and call the respective method
+				assert(rootActionHandle->sharedPointer != nullptr);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value);
 			}
 		}
 		CATCH_AND_LOG(rootActionHandle)
@@ -851,7 +1148,21 @@ extern "C" {
 			{
 				// retrieve the RootAction instance from the handle and call the respective method
 				assert(rootActionHandle->sharedPointer != nullptr);
-				rootActionHandle->sharedPointer->reportValue(valueName, value);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportDoubleValueOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, double value)
+	{
+		TRY
+		{
+			if (rootActionHandle)
+			{
+				// retrieve the RootAction instance from the handle and call the respective method
+				assert(rootActionHandle->sharedPointer != nullptr);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value);
 			}
 		}
 		CATCH_AND_LOG(rootActionHandle)
@@ -865,7 +1176,21 @@ extern "C" {
 			{
 				// retrieve the RootAction instance from the handle and call the respective method
 				assert(rootActionHandle->sharedPointer != nullptr);
-				rootActionHandle->sharedPointer->reportValue(valueName, value);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportStringValueOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+	{
+		TRY
+		{
+			if (rootActionHandle)
+			{
+				// retrieve the RootAction instance from the handle and call the respective method
+				assert(rootActionHandle->sharedPointer != nullptr);
+				rootActionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value, valueLength);
 			}
 		}
 		CATCH_AND_LOG(rootActionHandle)
@@ -879,7 +1204,36 @@ extern "C" {
 			{
 				// retrieve the RootAction instance from the handle and call the respective method
 				assert(rootActionHandle->sharedPointer != nullptr);
-				rootActionHandle->sharedPointer->reportError(errorName, errorCode, reason);
+				rootActionHandle->sharedPointer->reportErrorRef(errorName, errorCode, reason);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportErrorOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+	{
+		TRY
+		{
+			if (rootActionHandle)
+			{
+				// retrieve the RootAction instance from the handle and call the respective method
+				assert(rootActionHandle->sharedPointer != nullptr);
+				rootActionHandle->sharedPointer->reportErrorRef(errorName, errorNameLength, errorCode, reason, reasonLength);
+			}
+		}
+		CATCH_AND_LOG(rootActionHandle)
+	}
+
+	void reportEventsOnRootAction(RootActionHandle* rootActionHandle, const OpenKitEventDescriptor* events, size_t numberOfEvents)
+	{
+		TRY
+		{
+			if (rootActionHandle && events && numberOfEvents > 0)
+			{
+				// retrieve the RootAction instance from the handle and report the whole batch at once
+				assert(rootActionHandle->sharedPointer != nullptr);
+				auto cppEvents = toCppEventDescriptors(events, numberOfEvents, rootActionHandle->logger);
+				rootActionHandle->sharedPointer->reportEvents(cppEvents.data(), cppEvents.size());
 			}
 		}
 		CATCH_AND_LOG(rootActionHandle)
@@ -921,6 +1275,31 @@ extern "C" {
 		return handle;
 	}
 
+	ActionHandle* enterActionWithLength(RootActionHandle* rootActionHandle, const char* actionName, size_t actionNameLength)
+	{
+		// Sanity
+		if (rootActionHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		ActionHandle* handle = nullptr;
+		TRY
+		{
+			// retrieve the RootAction instance from the handle and call the respective method
+			assert(rootActionHandle->sharedPointer != nullptr);
+			std::shared_ptr<openkit::IAction> action = rootActionHandle->sharedPointer->enterAction(actionName, actionNameLength);
+
+			// storing the returned shared pointer in the handle prevents it from going out of scope
+			handle = new ActionHandle();
+			handle->sharedPointer = action;
+			handle->logger = rootActionHandle->logger;
+		}
+		CATCH_AND_LOG(rootActionHandle)
+
+		return handle;
+	}
+
 	void leaveAction(ActionHandle* actionHandle)
 	{
 		// Sanity
@@ -951,7 +1330,21 @@ extern "C" {
 			{
 				// retrieve the Action instance from the handle and call the respective method
 				assert(actionHandle->sharedPointer != nullptr);
-				actionHandle->sharedPointer->reportEvent(eventName);
+				actionHandle->sharedPointer->reportEventRef(eventName);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportEventOnActionWithLength(ActionHandle* actionHandle, const char* eventName, size_t eventNameLength)
+	{
+		TRY
+		{
+			if (actionHandle)
+			{
+				// retrieve the Action instance from the handle and call the respective method
+				assert(actionHandle->sharedPointer != nullptr);
+				actionHandle->sharedPointer->reportEventRef(eventName, eventNameLength);
 			}
 		}
 		CATCH_AND_LOG(actionHandle)
@@ -965,7 +1358,21 @@ extern "C" {
 			{
 				// retrieve the Action instance from the handle and call the respective method
 				assert(actionHandle->sharedPointer != nullptr);
-				actionHandle->sharedPointer->reportValue(valueName, value);
+				actionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportIntValueOnActionWithLength(ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, int32_t value)
+	{
+		TRY
+		{
+			if (actionHandle)
+			{
+				// retrieve the Action instance from the handle and call the respective method
+				assert(actionHandle->sharedPointer != nullptr);
+				actionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value);
 			}
 		}
 		CATCH_AND_LOG(actionHandle)
@@ -979,7 +1386,21 @@ extern "C" {
 			{
 				// retrieve the Action instance from the handle and call the respective method
 				assert(actionHandle->sharedPointer != nullptr);
-				actionHandle->sharedPointer->reportValue(valueName, value);
+				actionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportDoubleValueOnActionWithLength(ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, double value)
+	{
+		TRY
+		{
+			if (actionHandle)
+			{
+				// retrieve the Action instance from the handle and call the respective method
+				assert(actionHandle->sharedPointer != nullptr);
+				actionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value);
 			}
 		}
 		CATCH_AND_LOG(actionHandle)
@@ -993,7 +1414,21 @@ extern "C" {
 			{
 				// retrieve the Action instance from the handle and call the respective method
 				assert(actionHandle->sharedPointer != nullptr);
-				actionHandle->sharedPointer->reportValue(valueName, value);
+				actionHandle->sharedPointer->reportValueRef(valueName, value);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportStringValueOnActionWithLength(ActionHandle* actionHandle, const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+	{
+		TRY
+		{
+			if (actionHandle)
+			{
+				// retrieve the Action instance from the handle and call the respective method
+				assert(actionHandle->sharedPointer != nullptr);
+				actionHandle->sharedPointer->reportValueRef(valueName, valueNameLength, value, valueLength);
 			}
 		}
 		CATCH_AND_LOG(actionHandle)
@@ -1007,7 +1442,36 @@ extern "C" {
 			{
 				// retrieve the Action instance from the handle and call the respective method
 				assert(actionHandle->sharedPointer != nullptr);
-				actionHandle->sharedPointer->reportError(errorName, errorCode, reason);
+				actionHandle->sharedPointer->reportErrorRef(errorName, errorCode, reason);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportErrorOnActionWithLength(ActionHandle* actionHandle, const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+	{
+		TRY
+		{
+			if (actionHandle)
+			{
+				// retrieve the Action instance from the handle and call the respective method
+				assert(actionHandle->sharedPointer != nullptr);
+				actionHandle->sharedPointer->reportErrorRef(errorName, errorNameLength, errorCode, reason, reasonLength);
+			}
+		}
+		CATCH_AND_LOG(actionHandle)
+	}
+
+	void reportEventsOnAction(ActionHandle* actionHandle, const OpenKitEventDescriptor* events, size_t numberOfEvents)
+	{
+		TRY
+		{
+			if (actionHandle && events && numberOfEvents > 0)
+			{
+				// retrieve the Action instance from the handle and report the whole batch at once
+				assert(actionHandle->sharedPointer != nullptr);
+				auto cppEvents = toCppEventDescriptors(events, numberOfEvents, actionHandle->logger);
+				actionHandle->sharedPointer->reportEvents(cppEvents.data(), cppEvents.size());
 			}
 		}
 		CATCH_AND_LOG(actionHandle)
@@ -1049,6 +1513,31 @@ extern "C" {
 		return handle;
 	}
 
+	WebRequestTracerHandle* traceWebRequestOnSessionWithLength(struct SessionHandle* sessionHandle, const char* url, size_t urlLength)
+	{
+		// Sanity
+		if (sessionHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		WebRequestTracerHandle* handle = nullptr;
+		TRY
+		{
+			// retrieve the RootAction instance from the handle and call the respective method
+			assert(sessionHandle->sharedPointer != nullptr);
+			auto traceWebRequest = sessionHandle->sharedPointer->traceWebRequest(url, urlLength);
+
+			// storing the returned shared pointer in the handle prevents it from going out of scope
+			handle = new WebRequestTracerHandle();
+			handle->sharedPointer = traceWebRequest;
+			handle->logger = sessionHandle->logger;
+		}
+		CATCH_AND_LOG(sessionHandle)
+
+		return handle;
+	}
+
 	WebRequestTracerHandle* traceWebRequestOnRootAction(RootActionHandle* rootActionHandle, const char* url)
 	{
 		// Sanity
@@ -1074,6 +1563,31 @@ extern "C" {
 		return handle;
 	}
 
+	WebRequestTracerHandle* traceWebRequestOnRootActionWithLength(RootActionHandle* rootActionHandle, const char* url, size_t urlLength)
+	{
+		// Sanity
+		if (rootActionHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		WebRequestTracerHandle* handle = nullptr;
+		TRY
+		{
+			// retrieve the RootAction instance from the handle and call the respective method
+			assert(rootActionHandle->sharedPointer != nullptr);
+			auto traceWebRequest = rootActionHandle->sharedPointer->traceWebRequest(url, urlLength);
+
+			// storing the returned shared pointer in the handle prevents it from going out of scope
+			handle = new WebRequestTracerHandle();
+			handle->sharedPointer = traceWebRequest;
+			handle->logger = rootActionHandle->logger;
+		}
+		CATCH_AND_LOG(rootActionHandle)
+
+		return handle;
+	}
+
 	WebRequestTracerHandle* traceWebRequestOnAction(ActionHandle* actionHandle, const char* url)
 	{
 		// Sanity
@@ -1099,6 +1613,31 @@ extern "C" {
 		return handle;
 	}
 
+	WebRequestTracerHandle* traceWebRequestOnActionWithLength(ActionHandle* actionHandle, const char* url, size_t urlLength)
+	{
+		// Sanity
+		if (actionHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		WebRequestTracerHandle* handle = nullptr;
+		TRY
+		{
+			// retrieve the Action instance from the handle and call the respective method
+			assert(actionHandle->sharedPointer != nullptr);
+			auto traceWebRequest = actionHandle->sharedPointer->traceWebRequest(url, urlLength);
+
+			// storing the returned shared pointer in the handle prevents it from going out of scope
+			handle = new WebRequestTracerHandle();
+			handle->sharedPointer = traceWebRequest;
+			handle->logger = actionHandle->logger;
+		}
+		CATCH_AND_LOG(actionHandle)
+
+		return handle;
+	}
+
 	void startWebRequest(WebRequestTracerHandle* webRequestTracerHandle)
 	{
 		TRY
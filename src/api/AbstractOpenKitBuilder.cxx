@@ -50,6 +50,12 @@ AbstractOpenKitBuilder::AbstractOpenKitBuilder(const char* endpointURL, int64_t
 	, mBeaconCacheUpperMemoryBoundary(core::configuration::DEFAULT_UPPER_MEMORY_BOUNDARY_IN_BYTES)
 	, mDataCollectionLevel(core::configuration::DEFAULT_DATA_COLLECTION_LEVEL)
 	, mCrashReportingLevel(core::configuration::DEFAULT_CRASH_REPORTING_LEVEL)
+	, mIsDeferredSerializationEnabled(core::configuration::DEFAULT_DEFERRED_SERIALIZATION_ENABLED)
+	, mIsStatisticsEnabled(core::configuration::DEFAULT_STATISTICS_ENABLED)
+	, mServerConfigurationFile()
+	, mSharedRuntime(nullptr)
+	, mSidecarDirectory()
+	, mSidecarRingCapacity(core::configuration::DEFAULT_SIDECAR_RING_CAPACITY_IN_BYTES)
 {
 }
 
@@ -145,6 +151,51 @@ AbstractOpenKitBuilder& AbstractOpenKitBuilder::withCrashReportingLevel(CrashRep
 	return *this;
 }
 
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::enableDeferredSerialization()
+{
+	mIsDeferredSerializationEnabled = true;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::enableStatistics()
+{
+	mIsStatisticsEnabled = true;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withServerConfigurationFile(const char* filePath)
+{
+	if (filePath != nullptr && strlen(filePath) > 0)
+	{
+		mServerConfigurationFile = filePath;
+	}
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withSharedRuntime(std::shared_ptr<openkit::IOpenKitRuntime> runtime)
+{
+	mSharedRuntime = runtime;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withSidecarDirectory(const char* directory)
+{
+	if (directory != nullptr && strlen(directory) > 0)
+	{
+		mSidecarDirectory = directory;
+	}
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withSidecarRingCapacity(int64_t capacityInBytes)
+{
+	if (capacityInBytes > 0)
+	{
+		mSidecarRingCapacity = capacityInBytes;
+	}
+	return *this;
+}
+
 std::shared_ptr<openkit::IOpenKit> AbstractOpenKitBuilder::build()
 {
 	auto openKit = std::make_shared<core::objects::OpenKit>(*this);
@@ -217,6 +268,21 @@ openkit::CrashReportingLevel AbstractOpenKitBuilder::getCrashReportingLevel() co
 	return mCrashReportingLevel;
 }
 
+bool AbstractOpenKitBuilder::isDeferredSerializationEnabled() const
+{
+	return mIsDeferredSerializationEnabled;
+}
+
+bool AbstractOpenKitBuilder::isStatisticsEnabled() const
+{
+	return mIsStatisticsEnabled;
+}
+
+const std::string& AbstractOpenKitBuilder::getServerConfigurationFile() const
+{
+	return mServerConfigurationFile;
+}
+
 openkit::LogLevel AbstractOpenKitBuilder::getLogLevel() const
 {
 	return mLogLevel;
@@ -230,3 +296,18 @@ std::shared_ptr<openkit::ILogger> AbstractOpenKitBuilder::getLogger() const
 	}
 	return std::make_shared<core::util::DefaultLogger>(mLogLevel);
 }
+
+std::shared_ptr<openkit::IOpenKitRuntime> AbstractOpenKitBuilder::getSharedRuntime() const
+{
+	return mSharedRuntime;
+}
+
+const std::string& AbstractOpenKitBuilder::getSidecarDirectory() const
+{
+	return mSidecarDirectory;
+}
+
+int64_t AbstractOpenKitBuilder::getSidecarRingCapacity() const
+{
+	return mSidecarRingCapacity;
+}
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "OpenKit/OpenKitRuntimeBuilder.h"
+#include "core/configuration/ConfigurationDefaults.h"
+#include "core/objects/OpenKitRuntime.h"
+#include "core/util/DefaultLogger.h"
+
+using namespace openkit;
+
+OpenKitRuntimeBuilder::OpenKitRuntimeBuilder()
+	: mLogLevel(LogLevel::LOG_LEVEL_WARN)
+	, mLogger(nullptr)
+	, mBeaconCacheLowerMemoryBoundary(core::configuration::DEFAULT_LOWER_MEMORY_BOUNDARY_IN_BYTES)
+	, mBeaconCacheUpperMemoryBoundary(core::configuration::DEFAULT_UPPER_MEMORY_BOUNDARY_IN_BYTES)
+	, mNumberOfSendingThreads(core::configuration::DEFAULT_NUMBER_OF_SENDING_THREADS)
+{
+}
+
+OpenKitRuntimeBuilder& OpenKitRuntimeBuilder::withLogLevel(openkit::LogLevel logLevel)
+{
+	mLogLevel = logLevel;
+	return *this;
+}
+
+OpenKitRuntimeBuilder& OpenKitRuntimeBuilder::withLogger(std::shared_ptr<openkit::ILogger> logger)
+{
+	mLogger = logger;
+	return *this;
+}
+
+OpenKitRuntimeBuilder& OpenKitRuntimeBuilder::withBeaconCacheLowerMemoryBoundary(int64_t lowerMemoryBoundaryInBytes)
+{
+	mBeaconCacheLowerMemoryBoundary = lowerMemoryBoundaryInBytes;
+	return *this;
+}
+
+OpenKitRuntimeBuilder& OpenKitRuntimeBuilder::withBeaconCacheUpperMemoryBoundary(int64_t upperMemoryBoundaryInBytes)
+{
+	mBeaconCacheUpperMemoryBoundary = upperMemoryBoundaryInBytes;
+	return *this;
+}
+
+OpenKitRuntimeBuilder& OpenKitRuntimeBuilder::withNumberOfSendingThreads(int32_t numberOfSendingThreads)
+{
+	mNumberOfSendingThreads = numberOfSendingThreads;
+	return *this;
+}
+
+std::shared_ptr<openkit::IOpenKitRuntime> OpenKitRuntimeBuilder::build()
+{
+	return std::make_shared<core::objects::OpenKitRuntime>(*this);
+}
+
+std::shared_ptr<openkit::ILogger> OpenKitRuntimeBuilder::getLogger() const
+{
+	if (mLogger != nullptr)
+	{
+		return mLogger;
+	}
+	return std::make_shared<core::util::DefaultLogger>(mLogLevel);
+}
+
+int64_t OpenKitRuntimeBuilder::getBeaconCacheLowerMemoryBoundary() const
+{
+	return mBeaconCacheLowerMemoryBoundary;
+}
+
+int64_t OpenKitRuntimeBuilder::getBeaconCacheUpperMemoryBoundary() const
+{
+	return mBeaconCacheUpperMemoryBoundary;
+}
+
+int32_t OpenKitRuntimeBuilder::getNumberOfSendingThreads() const
+{
+	return mNumberOfSendingThreads;
+}
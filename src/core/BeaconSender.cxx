@@ -26,15 +26,34 @@ using namespace core;
 using namespace core::communication;
 using namespace providers;
 
-constexpr int32_t SHUTDOWN_TIMEOUT_MILLISECONDS = 10 * 1000;
-constexpr int32_t SHUTDOWN_SLICED_WAIT_TIME_MILLISECONDS = 100;
-
 BeaconSender::BeaconSender
 (
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider
+)
+	: BeaconSender(
+		logger,
+		httpClientConfiguration,
+		httpClientProvider,
+		timingProvider,
+		nullptr,
+		nullptr,
+		std::make_shared<BeaconSendingScheduler>(logger, std::make_shared<util::TaskExecutor>(1))
+	)
+{
+}
+
+BeaconSender::BeaconSender
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
+	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+	std::shared_ptr<BeaconSendingScheduler> scheduler
 )
 	: mLogger(logger)
 	, mBeaconSendingContext(
@@ -42,36 +61,19 @@ BeaconSender::BeaconSender
 			logger,
 			httpClientConfiguration,
 			httpClientProvider,
-			timingProvider
+			timingProvider,
+			responseAttributesStore,
+			metricsRegistry
 		)
 	)
-	, mSendingThread()
-	, mTimingProvider(timingProvider)
+	, mScheduler(scheduler)
+	, mTerminated()
 {
 }
 
 bool BeaconSender::initialize()
 {
-	mSendingThread = std::async(std::launch::async, [this] {
-		// run the loop as long as OpenKit does not get shutdown or ends itself.
-		if (mLogger->isDebugEnabled())
-		{
-			mLogger->debug("BeaconSender thread started");
-		}
-
-		while (mBeaconSendingContext != nullptr && !mBeaconSendingContext->isInTerminalState())
-		{
-			mBeaconSendingContext->executeCurrentState();
-		}
-
-		if (mLogger->isDebugEnabled())
-		{
-			mLogger->debug("BeaconSender thread stopped");
-		}
-
-		return mBeaconSendingContext->isShutdownRequested();
-	});
-
+	mTerminated = mScheduler->schedule(mBeaconSendingContext);
 	return true;
 }
 
@@ -90,29 +92,26 @@ bool BeaconSender::isInitialized() const
 	return mBeaconSendingContext->isInitialized();
 }
 
-void BeaconSender::shutdown()
+openkit::ShutdownResult BeaconSender::shutdown(std::chrono::steady_clock::time_point deadline)
 {
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconSender thread request shutdown");
 	}
 
+	mBeaconSendingContext->setShutdownDeadline(deadline);
 	mBeaconSendingContext->requestShutdown();
+	mScheduler->wakeUp(mBeaconSendingContext);
 
-	auto start = mTimingProvider->provideTimestampInMilliseconds();
-	int64_t timePassed = 0;
-	while (timePassed < SHUTDOWN_TIMEOUT_MILLISECONDS)
+	auto isCompleted = !mTerminated.valid() || mTerminated.wait_until(deadline) == std::future_status::ready;
+	if (!isCompleted)
 	{
-		//sleep in slices of 100ms
-		auto threadStatus = mSendingThread.wait_for(std::chrono::milliseconds(SHUTDOWN_SLICED_WAIT_TIME_MILLISECONDS));
-		if (threadStatus == std::future_status::ready)
-		{
-			return;//thread finished before timeout occurs
-		}
-		timePassed = mTimingProvider->provideTimestampInMilliseconds() - start;
+		// the state machine finishes later or is abandoned when the scheduler is destroyed
+		mLogger->warning("BeaconSender shutdown() - beacon sending was not finished in time");
 	}
 
-	// if the thread is still running here it will either finish later or killed when the main process is ended
+	// sessions flushed after this point are not accounted anymore, they are already counted as dropped
+	return mBeaconSendingContext->finishFlush(isCompleted);
 }
 
 int32_t BeaconSender::getCurrentServerID() const
@@ -19,9 +19,12 @@
 
 #include "OpenKit/ILogger.h"
 #include "communication/IBeaconSendingContext.h"
+#include "core/BeaconSendingScheduler.h"
 #include "core/IBeaconSender.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
+#include "core/configuration/IResponseAttributesStore.h"
 #include "core/objects/SessionInternals.h"
+#include "core/util/MetricsRegistry.h"
 #include "providers/IHTTPClientProvider.h"
 #include "providers/ITimingProvider.h"
 
@@ -31,14 +34,14 @@
 namespace core
 {
 	///
-	/// The BeaconSender runs a thread executing the beacon sending states
+	/// The BeaconSender executes the beacon sending states on a @ref BeaconSendingScheduler
 	///
 	class BeaconSender
 		: public IBeaconSender
 	{
 	public:
 		///
-		/// Default constructor
+		/// Default constructor, executing the beacon sending states on an own single threaded scheduler
 		/// @param[in] logger to write traces to
 		/// @param[in] httpClientConfiguration initial HTTP client configuration.
 		/// @param[in] httpClientProvider the provider for HTTPClient instances
@@ -52,6 +55,27 @@ namespace core
 			std::shared_ptr<providers::ITimingProvider> timingProvider
 		);
 
+		///
+		/// Constructor executing the beacon sending states on the given scheduler
+		/// @param[in] logger to write traces to
+		/// @param[in] httpClientConfiguration initial HTTP client configuration.
+		/// @param[in] httpClientProvider the provider for HTTPClient instances
+		/// @param[in] timingProvider utility required for timing related stuff
+		/// @param[in] responseAttributesStore store persisting the server configuration, @c nullptr if not persisted
+		/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+		/// @param[in] scheduler the scheduler, possibly shared with other beacon senders
+		///
+		BeaconSender
+		(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
+			std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+			std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+			std::shared_ptr<BeaconSendingScheduler> scheduler
+		);
+
 		~BeaconSender() override = default;
 
 		bool initialize() override;
@@ -62,7 +86,7 @@ namespace core
 
 		bool isInitialized() const override;
 
-		void shutdown() override;
+		openkit::ShutdownResult shutdown(std::chrono::steady_clock::time_point deadline) override;
 
 		int32_t getCurrentServerID() const override;
 
@@ -75,11 +99,11 @@ namespace core
 		/// Beacon sending context managing the state transitions and shutdown
 		std::shared_ptr<communication::IBeaconSendingContext> mBeaconSendingContext;
 
-		/// thread instance running the beacon sending state machine
-		std::future<bool> mSendingThread;
+		/// scheduler executing the beacon sending state machine
+		std::shared_ptr<BeaconSendingScheduler> mScheduler;
 
-		/// timing provider for shutdown timeout
-		std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+		/// future becoming ready once the beacon sending state machine reached its terminal state
+		std::future<bool> mTerminated;
 	};
 }
 #endif
@@ -0,0 +1,193 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BeaconSendingScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace core;
+using namespace core::communication;
+
+BeaconSendingScheduler::BeaconSendingScheduler(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<util::TaskExecutor> executor)
+	: mLogger(logger)
+	, mExecutor(executor)
+	, mMutex()
+	, mConditionVariable()
+	, mScheduledContexts()
+	, mStop(false)
+{
+}
+
+BeaconSendingScheduler::~BeaconSendingScheduler()
+{
+	std::vector<util::TaskExecutor::TaskID> pendingTasks;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+
+		for (auto& scheduledContext : mScheduledContexts)
+		{
+			// interrupts contexts sleeping while retrying requests
+			scheduledContext->context->requestShutdown();
+			pendingTasks.push_back(scheduledContext->taskID);
+		}
+	}
+
+	// tasks which already started return immediately, since mStop is set
+	for (auto taskID : pendingTasks)
+	{
+		mExecutor->cancel(taskID);
+	}
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mConditionVariable.wait(lock, [this]
+	{
+		for (auto& scheduledContext : mScheduledContexts)
+		{
+			if (scheduledContext->isRunning)
+			{
+				return false;
+			}
+		}
+		return true;
+	});
+
+	for (auto& scheduledContext : mScheduledContexts)
+	{
+		scheduledContext->terminated.set_value(scheduledContext->context->isShutdownRequested());
+	}
+}
+
+std::future<bool> BeaconSendingScheduler::schedule(std::shared_ptr<IBeaconSendingContext> context)
+{
+	auto scheduledContext = std::make_shared<ScheduledContext>(context);
+
+	auto terminated = scheduledContext->terminated.get_future();
+	context->setTaskExecutor(mExecutor.get());
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mScheduledContexts.push_back(scheduledContext);
+	scheduleStep(scheduledContext, 0);
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconSendingScheduler schedule() - %zu contexts scheduled", mScheduledContexts.size());
+	}
+
+	return terminated;
+}
+
+void BeaconSendingScheduler::wakeUp(const std::shared_ptr<IBeaconSendingContext>& context)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto& scheduledContext : mScheduledContexts)
+	{
+		if (scheduledContext->context == context)
+		{
+			if (scheduledContext->isRunning)
+			{
+				scheduledContext->isWakeUpRequested = true;
+			}
+			else
+			{
+				mExecutor->reschedule(scheduledContext->taskID, std::chrono::milliseconds::zero());
+			}
+			return;
+		}
+	}
+}
+
+size_t BeaconSendingScheduler::getNumberOfScheduledContexts() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mScheduledContexts.size();
+}
+
+std::shared_ptr<util::TaskExecutor> BeaconSendingScheduler::getExecutor() const
+{
+	return mExecutor;
+}
+
+void BeaconSendingScheduler::executeScheduledContext(std::shared_ptr<ScheduledContext> scheduledContext)
+{
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mStop)
+		{
+			return;
+		}
+
+		scheduledContext->taskID = util::TaskExecutor::INVALID_TASK_ID;
+		scheduledContext->isRunning = true;
+	}
+
+	auto delay = executeStep(*scheduledContext);
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	completeStep(scheduledContext, delay);
+}
+
+int64_t BeaconSendingScheduler::executeStep(ScheduledContext& scheduledContext)
+{
+	auto& context = scheduledContext.context;
+	if (context->isInTerminalState())
+	{
+		return 0;
+	}
+
+	if (!scheduledContext.isPrepared)
+	{
+		auto delay = context->prepareCurrentState();
+		if (delay > 0 && !context->isShutdownRequested())
+		{
+			scheduledContext.isPrepared = true;
+			return delay;
+		}
+	}
+
+	scheduledContext.isPrepared = false;
+	context->executePreparedState();
+
+	return 0;
+}
+
+void BeaconSendingScheduler::completeStep(const std::shared_ptr<ScheduledContext>& scheduledContext, int64_t delayMilliseconds)
+{
+	scheduledContext->isRunning = false;
+	mConditionVariable.notify_all();
+
+	auto& context = scheduledContext->context;
+	if (context->isInTerminalState())
+	{
+		scheduledContext->terminated.set_value(context->isShutdownRequested());
+		mScheduledContexts.remove(scheduledContext);
+	}
+	else if (!mStop)
+	{
+		scheduleStep(scheduledContext, scheduledContext->isWakeUpRequested ? 0 : delayMilliseconds);
+	}
+	scheduledContext->isWakeUpRequested = false;
+}
+
+void BeaconSendingScheduler::scheduleStep(const std::shared_ptr<ScheduledContext>& scheduledContext, int64_t delayMilliseconds)
+{
+	scheduledContext->taskID = mExecutor->schedule(
+		std::bind(&BeaconSendingScheduler::executeScheduledContext, this, scheduledContext),
+		std::chrono::milliseconds(std::max(delayMilliseconds, int64_t(0)))
+	);
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_BEACONSENDINGSCHEDULER_H
+#define _CORE_BEACONSENDINGSCHEDULER_H
+
+#include "OpenKit/ILogger.h"
+#include "communication/IBeaconSendingContext.h"
+#include "core/util/TaskExecutor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace core
+{
+	///
+	/// Executes the beacon sending state machines of one or several @ref BeaconSender instances as tasks of a @ref util::TaskExecutor.
+	///
+	/// Instead of sleeping inside a state, a scheduled context is prepared (see @ref communication::IBeaconSendingContext::prepareCurrentState())
+	/// and its execution is scheduled after the returned delay, so the executor's threads are only occupied while a state does work.
+	///
+	class BeaconSendingScheduler
+	{
+	public:
+
+		///
+		/// Constructor
+		/// @param[in] logger to write traces to
+		/// @param[in] executor the executor running the beacon sending steps
+		///
+		BeaconSendingScheduler(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<util::TaskExecutor> executor);
+
+		///
+		/// Destructor requesting shutdown of all contexts still scheduled and waiting until none of them is executed.
+		/// @remarks Must not be called from within a scheduled step, the contexts therefore must not own the scheduler.
+		///
+		~BeaconSendingScheduler();
+
+		///
+		/// Delete the copy constructor
+		///
+		BeaconSendingScheduler(const BeaconSendingScheduler&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		BeaconSendingScheduler& operator = (const BeaconSendingScheduler&) = delete;
+
+		///
+		/// Schedules the given context until it reaches its terminal state.
+		/// @param[in] context the beacon sending context to execute
+		/// @return future becoming ready once the context reached the terminal state, holding whether shutdown was requested
+		///
+		std::future<bool> schedule(std::shared_ptr<communication::IBeaconSendingContext> context);
+
+		///
+		/// Executes the given context as soon as possible, e.g. after shutdown was requested for it.
+		/// @param[in] context the previously scheduled context
+		///
+		void wakeUp(const std::shared_ptr<communication::IBeaconSendingContext>& context);
+
+		///
+		/// Returns the number of contexts which did not yet reach their terminal state.
+		///
+		size_t getNumberOfScheduledContexts() const;
+
+		///
+		/// Returns the executor running the beacon sending steps.
+		///
+		std::shared_ptr<util::TaskExecutor> getExecutor() const;
+
+	private:
+
+		///
+		/// A context together with its scheduling state.
+		///
+		struct ScheduledContext
+		{
+			///
+			/// Constructor
+			/// @param[in] scheduledContext the context to schedule
+			///
+			explicit ScheduledContext(std::shared_ptr<communication::IBeaconSendingContext> scheduledContext)
+				: context(scheduledContext)
+				, terminated()
+				, taskID(util::TaskExecutor::INVALID_TASK_ID)
+				, isPrepared(false)
+				, isRunning(false)
+				, isWakeUpRequested(false)
+			{
+			}
+
+			/// the scheduled context
+			std::shared_ptr<communication::IBeaconSendingContext> context;
+
+			/// promise fulfilled once the context reached the terminal state
+			std::promise<bool> terminated;
+
+			/// ID of the pending executor task
+			util::TaskExecutor::TaskID taskID;
+
+			/// flag indicating that the current state was prepared and waits for its execution
+			bool isPrepared;
+
+			/// flag indicating that a thread currently executes the context
+			bool isRunning;
+
+			/// flag indicating that the context shall be executed immediately after the running execution
+			bool isWakeUpRequested;
+		};
+
+		///
+		/// Executor task preparing or executing the current state of the given context.
+		///
+		void executeScheduledContext(std::shared_ptr<ScheduledContext> scheduledContext);
+
+		///
+		/// Prepares or executes the current state of the given context.
+		/// @return the delay in milliseconds after which the context is executed next
+		///
+		static int64_t executeStep(ScheduledContext& scheduledContext);
+
+		///
+		/// Updates the scheduling state after an execution, schedules the next step and removes terminated contexts.
+		/// @remarks Must be called while holding @ref mMutex.
+		///
+		void completeStep(const std::shared_ptr<ScheduledContext>& scheduledContext, int64_t delayMilliseconds);
+
+		///
+		/// Schedules the next step of the given context.
+		/// @remarks Must be called while holding @ref mMutex.
+		///
+		void scheduleStep(const std::shared_ptr<ScheduledContext>& scheduledContext, int64_t delayMilliseconds);
+
+		/// Logger to write traces to
+		std::shared_ptr<openkit::ILogger> mLogger;
+
+		/// the executor running the beacon sending steps
+		std::shared_ptr<util::TaskExecutor> mExecutor;
+
+		/// mutex guarding all members below
+		mutable std::mutex mMutex;
+
+		/// condition variable signaled when a step was completed
+		std::condition_variable mConditionVariable;
+
+		/// contexts which did not yet reach the terminal state
+		std::list<std::shared_ptr<ScheduledContext>> mScheduledContexts;
+
+		/// flag indicating that no more steps are scheduled
+		bool mStop;
+	};
+}
+
+#endif
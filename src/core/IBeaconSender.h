@@ -17,8 +17,11 @@
 #ifndef _CORE_IBEACONSENDER_H
 #define _CORE_IBEACONSENDER_H
 
+#include "OpenKit/ShutdownResult.h"
 #include "core/objects/SessionInternals.h"
 
+#include <chrono>
+
 namespace core
 {
 	class IBeaconSender
@@ -58,7 +61,11 @@ namespace core
 		///
 		/// Shutdown this instance of the BeaconSender
 		///
-		virtual void shutdown() = 0;
+		/// All sessions are sent until the given deadline expires, afterwards they are discarded.
+		/// @param[in] deadline the point in time until which the sessions must be sent
+		/// @return the number of records sent and discarded
+		///
+		virtual openkit::ShutdownResult shutdown(std::chrono::steady_clock::time_point deadline) = 0;
 
 		///
 		/// Returns the current serverID to be used for creating new sessions.
@@ -37,6 +37,35 @@ UTF8String::UTF8String(const char* stringData)
 	}
 }
 
+UTF8String::UTF8String(const char* stringData, size_t length)
+	: UTF8String()
+{
+	if (stringData == nullptr)
+	{
+		return;
+	}
+
+	auto isASCII = true;
+	for (size_t i = 0; i < length; i++)
+	{
+		if (static_cast<unsigned char>(stringData[i]) >= 0x80)
+		{
+			isASCII = false;
+			break;
+		}
+	}
+
+	if (isASCII)
+	{
+		mData.assign(stringData, length);
+		mStringLength = length;
+	}
+	else
+	{
+		validateBytes(stringData, length);
+	}
+}
+
 UTF8String::UTF8String(const std::string& stringData)
 	: UTF8String(stringData.c_str())
 {
@@ -147,14 +176,13 @@ size_t UTF8String::getByteWidthOfCharacter(const unsigned char character) const
 
 void UTF8String::validateString(const char* stringData)
 {
-	auto replacementCharacterASCII = "\xEF\xBF\xBD";
 	if (stringData == nullptr || stringData[0] == '\0')
 	{
 		mStringLength = 0;
 		return;
 	}
 
-	auto byteLength = 0;
+	size_t byteLength = 0;
 
 	while (!isStringTerminationCharacter(stringData, byteLength))
 	{
@@ -166,13 +194,20 @@ void UTF8String::validateString(const char* stringData)
 		return;
 	}
 
+	validateBytes(stringData, byteLength);
+}
+
+void UTF8String::validateBytes(const char* stringData, size_t byteLength)
+{
+	auto replacementCharacterASCII = "\xEF\xBF\xBD";
+
 	mData.clear();
 
 	auto multibyteSeqenceLength = -1;
 	auto multibyteSequencePosition = -1;
 
 	auto characterCount = 0; //number of characters, either UTF8 multibyte or ASCII single byte
-	for (auto i = 0; i < byteLength; i++)//omit \0 at the end of the array
+	for (auto i = 0; i < static_cast<int>(byteLength); i++)//omit \0 at the end of the array
 	{
 		auto byteWidthOfCurrentCharacter = getByteWidthOfCharacter(static_cast<unsigned char>(stringData[i]));
 
@@ -280,6 +315,27 @@ void UTF8String::concatenate(const char* string)
 	concatenate(concatenateString);
 }
 
+void UTF8String::concatenate(const char* data, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		auto character = static_cast<unsigned char>(data[i]);
+		if (character == '\0' || character >= 0x80)
+		{
+			concatenate(UTF8String(data, length));
+			return;
+		}
+	}
+
+	mData.append(data, length);
+	mStringLength += length;
+}
+
+void UTF8String::reserve(size_t numberOfBytes)
+{
+	mData.reserve(numberOfBytes);
+}
+
 //character can be multi-byte
 UTF8String::size_type UTF8String::getIndexOf(const char* comparisonCharacter, size_t offset) const
 {
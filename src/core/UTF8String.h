@@ -54,6 +54,19 @@ namespace core
 		///
 		UTF8String(const char* stringData);
 
+		///
+		/// Initialize this string using the given number of bytes from a user-provided char sequence, which does not need
+		/// to be terminated. Either UTF8 multibyte data or plain US-ASCII can be used to initialize strings.
+		///
+		/// @par
+		/// Exactly @c length bytes are used, the data is not scanned for a terminator. Pure US-ASCII data is taken
+		/// over as is, otherwise the bytes are validated like in @ref UTF8String(const char*).
+		///
+		/// @param[in] stringData the string data used to initialize this string
+		/// @param[in] length number of bytes of @c stringData to use
+		///
+		UTF8String(const char* stringData, size_t length);
+
 		///
 		/// Destructor
 		///
@@ -105,6 +118,23 @@ namespace core
 		///
 		void concatenate(const char* data);
 
+		///
+		/// Concatenate the given number of bytes to this string.
+		///
+		/// @par
+		/// Pure US-ASCII data is appended as is, otherwise the data is validated like in @ref UTF8String(const char*, size_t).
+		///
+		/// @param[in] data bytes to add to the current string
+		/// @param[in] length number of bytes to add
+		///
+		void concatenate(const char* data, size_t length);
+
+		///
+		/// Reserves memory for the given number of bytes, avoiding reallocations in subsequent concatenations.
+		/// @param[in] numberOfBytes number of bytes to reserve
+		///
+		void reserve(size_t numberOfBytes);
+
 		///
 		/// Find first occurence of character. Indices do not refer to bytes, instead they refer to actual
 		/// characters. The reason is that UTF8 characters can span multiple bytes.
@@ -180,6 +210,14 @@ namespace core
 		///
 		inline bool isStringTerminationCharacter(const char* stringData, size_t offset) const;
 
+		///
+		/// Replaces the content of this string with the given number of bytes, replacing invalid UTF8 codepoints.
+		///
+		/// @param[in] stringData the string data to validate
+		/// @param[in] byteLength number of bytes of @c stringData to validate
+		///
+		void validateBytes(const char* stringData, size_t byteLength);
+
 	private:
 
 		//internal storage with UTF8 compliant string
@@ -0,0 +1,136 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "AttachedBeaconCacheEvictor.h"
+#include "TimeEvictionStrategy.h"
+#include "SpaceEvictionStrategy.h"
+#include "core/configuration/SharedBeaconCacheConfiguration.h"
+
+using namespace core::caching;
+
+AttachedBeaconCacheEvictor::AttachedBeaconCacheEvictor
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<IBeaconCache> beaconCache,
+	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> configuration,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<SharedBeaconCacheEvictor> sharedEvictor
+)
+: AttachedBeaconCacheEvictor
+(
+	beaconCache,
+	{
+		std::make_shared<TimeEvictionStrategy>
+		(
+			logger,
+			beaconCache,
+			configuration,
+			timingProvider,
+			std::bind(&AttachedBeaconCacheEvictor::isAlive, this)
+		),
+		std::make_shared<SpaceEvictionStrategy>
+		(
+			logger,
+			beaconCache,
+			std::make_shared<core::configuration::SharedBeaconCacheConfiguration>(
+				configuration,
+				sharedEvictor->getGlobalConfiguration(),
+				std::bind(&SharedBeaconCacheEvictor::getNumberOfAttachedEvictors, sharedEvictor.get())
+			),
+			std::bind(&AttachedBeaconCacheEvictor::isAlive, this)
+		)
+	},
+	sharedEvictor
+)
+{
+}
+
+AttachedBeaconCacheEvictor::AttachedBeaconCacheEvictor
+(
+	std::shared_ptr<IBeaconCache> beaconCache,
+	std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+	std::shared_ptr<SharedBeaconCacheEvictor> sharedEvictor
+)
+	: mBeaconCache(beaconCache)
+	, mStrategies(strategies)
+	, mSharedEvictor(sharedEvictor)
+	, mIsObserverRegistered(false)
+	, mIsEvictionPending(false)
+{
+}
+
+AttachedBeaconCacheEvictor::~AttachedBeaconCacheEvictor()
+{
+	mSharedEvictor->detach(this);
+}
+
+bool AttachedBeaconCacheEvictor::start()
+{
+	if (!mSharedEvictor->attach(this))
+	{
+		return false;
+	}
+	mIsEvictionPending = false;
+
+	if (!mIsObserverRegistered)
+	{
+		mBeaconCache->addObserver(this);
+		mIsObserverRegistered = true;
+	}
+
+	return true;
+}
+
+bool AttachedBeaconCacheEvictor::stop()
+{
+	return mSharedEvictor->detach(this);
+}
+
+bool AttachedBeaconCacheEvictor::stop(std::chrono::milliseconds /* timeout */)
+{
+	return stop();
+}
+
+bool AttachedBeaconCacheEvictor::isAlive()
+{
+	return mSharedEvictor->isAttached(this);
+}
+
+void AttachedBeaconCacheEvictor::update()
+{
+	if (mIsEvictionPending.exchange(true))
+	{
+		// already notified, the shared evictor is only locked once per eviction
+		return;
+	}
+
+	if (!mSharedEvictor->notifyRecordAdded(this))
+	{
+		mIsEvictionPending = false;
+	}
+}
+
+void AttachedBeaconCacheEvictor::executeStrategies()
+{
+	// records added from now on need another eviction
+	mIsEvictionPending = false;
+
+	for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
+	{
+		it->get()->execute();
+	}
+}
@@ -0,0 +1,143 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_ATTACHEDBEACONCACHEEVICTOR_H
+#define _CORE_CACHING_ATTACHEDBEACONCACHEEVICTOR_H
+
+#include "OpenKit/ILogger.h"
+#include "IObserver.h"
+#include "IBeaconCache.h"
+#include "IBeaconCacheEvictor.h"
+#include "IBeaconCacheEvictionStrategy.h"
+#include "SharedBeaconCacheEvictor.h"
+#include "core/configuration/IBeaconCacheConfiguration.h"
+#include "providers/ITimingProvider.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Evictor of a single OpenKit instance's @ref BeaconCache, which is executed by a @ref SharedBeaconCacheEvictor.
+		///
+		/// Starting this evictor attaches it to the shared evictor, stopping it detaches it again.
+		///
+		class AttachedBeaconCacheEvictor
+			: public IBeaconCacheEvictor
+			, IObserver
+		{
+		public:
+
+			///
+			/// Constructor, initializing the evictor with the default @ref TimeEvictionStrategy and @ref SpaceEvictionStrategy strategies.
+			///
+			/// The space eviction strategy uses this instance's share of the shared evictor's global memory boundaries.
+			/// @param[in] logger to write traces to
+			/// @param[in] beaconCache The Beacon cache to check if entries need to be evicted
+			/// @param[in] configuration Beacon cache configuration of the OpenKit instance
+			/// @param[in] timingProvider Timing provider required for time retrieval
+			/// @param[in] sharedEvictor the evictor scheduling the evictions
+			///
+			AttachedBeaconCacheEvictor
+			(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<IBeaconCache> beaconCache,
+				std::shared_ptr<configuration::IBeaconCacheConfiguration> configuration,
+				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<SharedBeaconCacheEvictor> sharedEvictor
+			);
+
+			///
+			/// Internal testing constructor.
+			/// @param[in] beaconCache The Beacon cache to check if entries need to be evicted
+			/// @param[in] strategies Strategies executed by the shared evictor.
+			/// @param[in] sharedEvictor the evictor scheduling the evictions
+			///
+			AttachedBeaconCacheEvictor
+			(
+				std::shared_ptr<IBeaconCache> beaconCache,
+				std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+				std::shared_ptr<SharedBeaconCacheEvictor> sharedEvictor
+			);
+
+			///
+			/// Destructor detaching from the shared evictor.
+			///
+			~AttachedBeaconCacheEvictor() override;
+
+			///
+			/// Attaches this evictor to the shared evictor.
+			/// @return @c true if attached, @c false if this evictor was already attached.
+			///
+			bool start() override;
+
+			///
+			/// Detaches this evictor from the shared evictor.
+			/// @return @c true if detached, @c false if this evictor was not attached.
+			///
+			bool stop() override;
+
+			///
+			/// Detaches this evictor from the shared evictor.
+			///
+			/// The timeout is not used, as detaching only waits for the currently executed strategy, which checks @ref isAlive() regularly.
+			/// @return @c true if detached, @c false if this evictor was not attached.
+			///
+			bool stop(std::chrono::milliseconds timeout) override;
+
+			///
+			/// Checks if this evictor is attached to the shared evictor.
+			/// @return @c true if attached, @c false otherwise
+			///
+			bool isAlive() override;
+
+			///
+			/// Update function to be notified about a new record being added.
+			///
+			void update() override;
+
+			///
+			/// Executes all eviction strategies, called by the shared evictor.
+			///
+			void executeStrategies();
+
+		private:
+
+			/// The Beacon cache to check if entries need to be evicted
+			std::shared_ptr<IBeaconCache> mBeaconCache;
+
+			/// Eviction strategies executed in an eviction run
+			std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> mStrategies;
+
+			/// the evictor scheduling the evictions
+			std::shared_ptr<SharedBeaconCacheEvictor> mSharedEvictor;
+
+			/// Flag indicating that this evictor was registered as observer of the beacon cache
+			bool mIsObserverRegistered;
+
+			/// Flag indicating that the shared evictor was notified and did not yet execute the strategies
+			std::atomic<bool> mIsEvictionPending;
+		};
+	}
+}
+
+#endif
@@ -22,11 +22,18 @@
 using namespace core::caching;
 
 BeaconCache::BeaconCache(std::shared_ptr<openkit::ILogger> logger)
+	: BeaconCache(logger, nullptr)
+{
+}
+
+BeaconCache::BeaconCache(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<core::util::MetricsRegistry> metricsRegistry)
 	: mLogger(logger)
 	, observers()
 	, mGlobalCacheLock()
 	, mBeacons()
+	, mBeaconIDs(std::make_shared<const std::vector<int32_t>>())
 	, mCacheSizeInBytes(0)
+	, mMetricsRegistry(metricsRegistry)
 {
 
 }
@@ -57,6 +64,45 @@ void BeaconCache::addEventData(int32_t beaconID, int64_t timestamp, const core::
 
 	// update cache stats
 	mCacheSizeInBytes += record.getDataSizeInBytes();
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getEventRecordsAdded().increment();
+	}
+
+	// notify observers
+	onDataAdded();
+}
+
+void BeaconCache::addEventData(int32_t beaconID, const std::vector<BeaconCacheRecord>& records)
+{
+	if (records.empty())
+	{
+		return;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconCache addEventData(sn=%d, numberOfRecords=%zu)", beaconID, records.size());
+	}
+
+	// get a reference to the cache entry
+	auto entry = getCachedEntryOrInsert(beaconID);
+
+	int64_t numberOfBytes = 0;
+	std::unique_lock<std::mutex> lock(entry->getLock());
+	for (const auto& record : records)
+	{
+		entry->addEventData(record);
+		numberOfBytes += record.getDataSizeInBytes();
+	}
+	lock.unlock();
+
+	// update cache stats
+	mCacheSizeInBytes += numberOfBytes;
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getEventRecordsAdded().add(static_cast<int64_t>(records.size()));
+	}
 
 	// notify observers
 	onDataAdded();
@@ -79,11 +125,31 @@ void BeaconCache::addActionData(int32_t beaconID, int64_t timestamp, const core:
 
 	// update cache stats
 	mCacheSizeInBytes += record.getDataSizeInBytes();
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getActionRecordsAdded().increment();
+	}
 
 	// notify observers
 	onDataAdded();
 }
 
+void BeaconCache::addBeacon(
+	int32_t /* beaconID */,
+	int64_t /* sessionStartTime */,
+	int32_t /* sessionNumber */,
+	const core::UTF8String& /* clientIPAddress */,
+	const core::UTF8String& /* immutableBeaconData */
+)
+{
+	// the cache entry is created when the first record is added
+}
+
+void BeaconCache::endBeacon(int32_t /* beaconID */)
+{
+	// the cache entry is deleted by the beacon sending thread, after all data has been sent
+}
+
 void BeaconCache::deleteCacheEntry(int32_t beaconID)
 {
 	core::util::ScopedWriteLock lock(mGlobalCacheLock);
@@ -97,6 +163,7 @@ void BeaconCache::deleteCacheEntry(int32_t beaconID)
 	{
 		mCacheSizeInBytes -= it->second->getTotalNumberOfBytes();
 		mBeacons.erase(it);
+		publishBeaconIDs();
 	}
 
 	lock.unlock();
@@ -125,7 +192,13 @@ const core::UTF8String BeaconCache::getNextBeaconChunk(int32_t beaconID, const c
 	}
 
 	// data for chunking is available
-	return entry->getChunk(chunkPrefix, maxSize, delimiter);
+	auto chunk = entry->getChunk(chunkPrefix, maxSize, delimiter);
+	if (mMetricsRegistry != nullptr && !chunk.empty())
+	{
+		mMetricsRegistry->getBeaconChunkSize().record(static_cast<int64_t>(chunk.getStringData().size()));
+	}
+
+	return chunk;
 }
 
 void BeaconCache::removeChunkedData(int32_t beaconID)
@@ -163,6 +236,19 @@ void BeaconCache::resetChunkedData(int32_t beaconID)
 	onDataAdded();
 }
 
+bool BeaconCache::hasMoreChunks(int32_t beaconID)
+{
+	auto entry = getCachedEntry(beaconID);
+	if (entry == nullptr)
+	{
+		// a cache entry for the given beaconID does not exist
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(entry->getLock());
+	return entry->hasMoreChunks();
+}
+
 std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntryOrInsert(int beaconID)
 {
 	auto entry = getCachedEntry(beaconID);
@@ -177,6 +263,7 @@ std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntryOrInsert(int beacon
 		{
 			entry = std::make_shared<BeaconCacheEntry>();
 			mBeacons.insert(std::make_pair(beaconID, entry));
+			publishBeaconIDs();
 		}
 		else
 		{
@@ -191,17 +278,11 @@ std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntryOrInsert(int beacon
 
 const std::vector<core::UTF8String> BeaconCache::getEvents(int32_t beaconID)
 {
-	auto entry = getCachedEntry(beaconID);
-	if (entry == nullptr)
-	{
-		// entry not found
-		return {};
-	}
-
 	std::vector<core::UTF8String> events;
-	std::unique_lock<std::mutex> lock(entry->getLock());
-	events = extractData(entry->getEventData());
-	lock.unlock();
+	visitEventData(beaconID, [&events](const BeaconCacheRecord& record)
+	{
+		events.push_back(record.getData());
+	});
 	return events;
 }
 
@@ -219,17 +300,11 @@ const std::list<BeaconCacheRecord> BeaconCache::getEventsBeingSent(int32_t beaco
 
 const std::vector<core::UTF8String> BeaconCache::getActions(int32_t beaconID)
 {
-	auto entry = getCachedEntry(beaconID);
-	if (entry == nullptr)
-	{
-		// entry not found
-		return {};
-	}
-
 	std::vector<core::UTF8String> actions;
-	std::unique_lock<std::mutex> lock(entry->getLock());
-	actions = extractData(entry->getActionData());
-	lock.unlock();
+	visitActionData(beaconID, [&actions](const BeaconCacheRecord& record)
+	{
+		actions.push_back(record.getData());
+	});
 	return actions;
 }
 
@@ -245,16 +320,6 @@ const std::list<BeaconCacheRecord> BeaconCache::getActionsBeingSent(int32_t beac
 	return entry->getActionDataBeingSent();
 }
 
-std::vector<core::UTF8String> BeaconCache::extractData(const std::list<BeaconCacheRecord>& eventData)
-{
-	std::vector<core::UTF8String> result;
-	for (auto const& value : eventData)
-	{
-		result.push_back(value.getData());
-	}
-	return result;
-}
-
 std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntry(int32_t beaconID)
 {
 	std::shared_ptr<BeaconCacheEntry> entry = nullptr;
@@ -271,18 +336,49 @@ std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntry(int32_t beaconID)
 	return entry;
 }
 
-const std::unordered_set<int32_t> BeaconCache::getBeaconIDs()
+BeaconCache::BeaconIDSnapshot BeaconCache::getBeaconIDs()
 {
-	std::unordered_set<int32_t> result;
+	return std::atomic_load(&mBeaconIDs);
+}
 
-	core::util::ScopedReadLock lock(mGlobalCacheLock);
+void BeaconCache::publishBeaconIDs()
+{
+	auto beaconIDs = std::make_shared<std::vector<int32_t>>();
+	beaconIDs->reserve(mBeacons.size());
 	for (auto const& beacon : mBeacons)
 	{
-		result.insert(beacon.first);
+		beaconIDs->push_back(beacon.first);
+	}
+
+	std::atomic_store(&mBeaconIDs, BeaconIDSnapshot(beaconIDs));
+}
+
+void BeaconCache::visitEventData(int32_t beaconID, const RecordVisitor& visitor)
+{
+	auto entry = getCachedEntry(beaconID);
+	if (entry == nullptr)
+	{
+		// entry not found
+		return;
 	}
+
+	std::unique_lock<std::mutex> lock(entry->getLock());
+	entry->visitEventData(visitor);
 	lock.unlock();
+}
 
-	return result;
+void BeaconCache::visitActionData(int32_t beaconID, const RecordVisitor& visitor)
+{
+	auto entry = getCachedEntry(beaconID);
+	if (entry == nullptr)
+	{
+		// entry not found
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(entry->getLock());
+	entry->visitActionData(visitor);
+	lock.unlock();
 }
 
 uint32_t BeaconCache::evictRecordsByAge(int32_t beaconID, int64_t minTimestamp)
@@ -298,6 +394,11 @@ uint32_t BeaconCache::evictRecordsByAge(int32_t beaconID, int64_t minTimestamp)
 	uint32_t numRecordsRemoved = entry->removeRecordsOlderThan(minTimestamp);
 	lock.unlock();
 
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getRecordsEvictedByAge().add(numRecordsRemoved);
+	}
+
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache evictRecordsByAge(sn=%d, minTimestamp=%" PRId64 ") has evicted %u records", beaconID, minTimestamp, numRecordsRemoved);
@@ -319,6 +420,11 @@ uint32_t BeaconCache::evictRecordsByNumber(int32_t beaconID, uint32_t numRecords
 	uint32_t numRecordsRemoved = entry->removeOldestRecords(numRecords);
 	lock.unlock();
 
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getRecordsEvictedBySpace().add(numRecordsRemoved);
+	}
+
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache evictRecordsByNumber(sn=%d, numRecords=%u) has evicted %u records", beaconID, numRecords, numRecordsRemoved);
@@ -354,4 +460,17 @@ bool BeaconCache::isEmpty(int32_t beaconID)
 	lock.unlock();
 
 	return isEmpty;
+}
+
+size_t BeaconCache::getNumberOfRecords(int32_t beaconID)
+{
+	auto entry = getCachedEntry(beaconID);
+	if (entry == nullptr)
+	{
+		// already removed
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(entry->getLock());
+	return entry->getNumberOfRecords();
 }
\ No newline at end of file
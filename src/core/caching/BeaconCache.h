@@ -20,11 +20,11 @@
 #include "OpenKit/ILogger.h"
 #include "IObserver.h"
 #include "IBeaconCache.h"
+#include "core/util/MetricsRegistry.h"
 #include "core/util/ScopedReadLock.h"
 #include "core/util/ScopedWriteLock.h"
 #include "BeaconCacheEntry.h"
 
-#include <unordered_set>
 #include <unordered_map>
 #include <vector>
 #include <atomic>
@@ -48,6 +48,13 @@ namespace core
 			///
 			BeaconCache(std::shared_ptr<openkit::ILogger> logger);
 
+			///
+			/// Constructor recording self-monitoring metrics
+			/// @param[in] logger to write traces to
+			/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+			///
+			BeaconCache(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<core::util::MetricsRegistry> metricsRegistry);
+
 			///
 			/// destructor
 			///
@@ -67,8 +74,20 @@ namespace core
 
 			void addEventData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) override;
 
+			void addEventData(int32_t beaconID, const std::vector<BeaconCacheRecord>& records) override;
+
 			void addActionData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) override;
 
+			void addBeacon(
+				int32_t beaconID,
+				int64_t sessionStartTime,
+				int32_t sessionNumber,
+				const core::UTF8String& clientIPAddress,
+				const core::UTF8String& immutableBeaconData
+			) override;
+
+			void endBeacon(int32_t beaconID) override;
+
 			void deleteCacheEntry(int32_t beaconID) override;
 
 			const core::UTF8String getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) override;
@@ -77,6 +96,8 @@ namespace core
 
 			void resetChunkedData(int32_t beaconID) override;
 
+			bool hasMoreChunks(int32_t beaconID) override;
+
 			///
 			/// Get a deep copy of events collected so far.
 			///
@@ -117,7 +138,11 @@ namespace core
 			///
 			const std::list<BeaconCacheRecord> getActionsBeingSent(int32_t beaconID);
 
-			const std::unordered_set<int32_t> getBeaconIDs() override;
+			BeaconIDSnapshot getBeaconIDs() override;
+
+			void visitEventData(int32_t beaconID, const RecordVisitor& visitor) override;
+
+			void visitActionData(int32_t beaconID, const RecordVisitor& visitor) override;
 
 			uint32_t evictRecordsByAge(int32_t beaconID, int64_t minTimestamp) override;
 
@@ -127,6 +152,8 @@ namespace core
 
 			bool isEmpty(int32_t beaconID) override;
 
+			size_t getNumberOfRecords(int32_t beaconID) override;
+
 		private:
 			///
 			/// Get cached @ref BeaconCacheEntry or insert new one if nothing exists for given @c beaconID.
@@ -143,11 +170,11 @@ namespace core
 			std::shared_ptr<BeaconCacheEntry> getCachedEntry(int32_t beaconID);
 
 			///
-			/// Helper method to extract the data from the provided records.
-			/// @param[in] eventData the records from which to extract the data
-			/// @return the extracted data
+			/// Publish a new snapshot of the beacon ids currently stored in @ref mBeacons.
 			///
-			static std::vector<core::UTF8String> extractData(const std::list<BeaconCacheRecord>& eventData);
+			/// The caller must hold the write lock of @ref mGlobalCacheLock.
+			///
+			void publishBeaconIDs();
 
 			///
 			/// Call this method when something was added (size of cache increased).
@@ -167,8 +194,16 @@ namespace core
 			/// The central part of the cache are the beacons (key=beaconID, value=
 			std::unordered_map<int32_t, std::shared_ptr<BeaconCacheEntry>> mBeacons;
 
+			/// Snapshot of the keys in @ref mBeacons, replaced (never modified) whenever a beacon is inserted or deleted
+			BeaconIDSnapshot mBeaconIDs;
+
 			/// Sum of all record's data size estimation.
 			std::atomic<int64_t> mCacheSizeInBytes;
+
+			///
+			/// Registry to record metrics in, @c nullptr if statistics are disabled.
+			///
+			const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
 		};
 	}
 }
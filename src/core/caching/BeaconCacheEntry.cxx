@@ -25,6 +25,8 @@ BeaconCacheEntry::BeaconCacheEntry()
 	, mEventDataBeingSent()
 	, mActionDataBeingSent()
 	, mTotalNumBytes(0)
+	, mNumBytesBeingSent(0)
+	, mChunkedRecords()
 {
 
 }
@@ -57,6 +59,7 @@ void BeaconCacheEntry::copyDataForChunking()
 	mActionDataBeingSent.splice(mActionDataBeingSent.begin(), mActionData);
 	mEventDataBeingSent.splice(mEventDataBeingSent.begin(), mEventData);
 
+	mNumBytesBeingSent = mTotalNumBytes;
 	mTotalNumBytes = 0;
 }
 
@@ -67,11 +70,25 @@ const core::UTF8String BeaconCacheEntry::getChunk(const core::UTF8String& chunkP
 		// nothing to send - reset lists, so next time lists get copied again
 		mEventDataBeingSent.clear();
 		mActionDataBeingSent.clear();
+		mChunkedRecords.clear();
+		mNumBytesBeingSent = 0;
 		return core::UTF8String();
 	}
 	return getNextChunk(chunkPrefix, maxSize, delimiter);
 }
 
+bool BeaconCacheEntry::hasMoreChunks() const
+{
+	if (mChunkedRecords.empty())
+	{
+		return hasDataToSend();
+	}
+
+	const auto& lastChunkedRecords = mChunkedRecords.back();
+	return lastChunkedRecords.eventsEnd != mEventDataBeingSent.end()
+		|| lastChunkedRecords.actionsEnd != mActionDataBeingSent.end();
+}
+
 bool BeaconCacheEntry::hasDataToSend() const
 {
 	return !mEventDataBeingSent.empty() || !mActionDataBeingSent.empty();
@@ -84,67 +101,77 @@ const core::UTF8String BeaconCacheEntry::getNextChunk(const core::UTF8String& ch
 	// append the chunk prefix
 	chunk.concatenate(chunkPrefix);
 
+	// the next chunk starts right after the previously retrieved chunk
+	ChunkedRecords chunkedRecords = {
+		mChunkedRecords.empty() ? mEventDataBeingSent.begin() : mChunkedRecords.back().eventsEnd,
+		mChunkedRecords.empty() ? mActionDataBeingSent.begin() : mChunkedRecords.back().actionsEnd,
+		0,
+		0
+	};
+
 	// append data from both lists
 	// note the order is currently important -> event data goes first, then action data
-	chunkifyDataList(chunk, mEventDataBeingSent, maxSize, delimiter);
-	chunkifyDataList(chunk, mActionDataBeingSent, maxSize, delimiter);
+	auto eventsEnd = mEventDataBeingSent.end();
+	if (!chunkifyDataList(chunk, chunkedRecords.eventsEnd, eventsEnd, maxSize, delimiter, chunkedRecords))
+	{
+		auto actionsEnd = mActionDataBeingSent.end();
+		chunkifyDataList(chunk, chunkedRecords.actionsEnd, actionsEnd, maxSize, delimiter, chunkedRecords);
+	}
+
+	if (chunkedRecords.numRecords == 0)
+	{
+		// all data is already part of a previously retrieved chunk
+		return core::UTF8String();
+	}
+
+	mChunkedRecords.push_back(chunkedRecords);
 
 	return chunk;
 }
 
-void BeaconCacheEntry::chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter)
+bool BeaconCacheEntry::chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>::iterator& next,
+	const std::list<BeaconCacheRecord>::iterator& end, size_t maxSize, const core::UTF8String& delimiter,
+	ChunkedRecords& chunkedRecords)
 {
-	auto it = dataBeingSent.begin();
-	while (it != dataBeingSent.end() && chunk.getStringLength() <= maxSize)
+	const auto delimiterSizeInBytes = delimiter.getStringData().size();
+	auto chunkSizeInBytes = chunk.getStringData().size();
+
+	for (; next != end; ++next)
 	{
-		// mark the record for sending
-		it->markForSending();
+		const auto recordSizeInBytes = delimiterSizeInBytes + next->getData().getStringData().size();
+		if (chunkedRecords.numRecords > 0 && chunkSizeInBytes + recordSizeInBytes > maxSize)
+		{
+			// record does not fit into this chunk any more
+			return true;
+		}
 
 		// append delimiter & data
 		chunk.concatenate(delimiter);
-		chunk.concatenate(it->getData());
+		chunk.concatenate(next->getData());
 
-		it++;
+		chunkSizeInBytes += recordSizeInBytes;
+		chunkedRecords.numRecords++;
+		chunkedRecords.numBytes += next->getDataSizeInBytes();
 	}
+
+	return false;
 }
 
 void BeaconCacheEntry::removeDataMarkedForSending()
 {
-	if (!hasDataToSend())
+	if (!hasDataToSend() || mChunkedRecords.empty())
 	{
-		// data has not been copied yet
+		// data has not been copied or chunked yet
 		return;
 	}
 
-	auto it = mEventDataBeingSent.begin();
-	while (it != mEventDataBeingSent.end())
-	{
-		if (it->isMarkedForSending())
-		{
-			it = mEventDataBeingSent.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
+	// records are chunked in list order, therefore the oldest chunk's records are at the front of both lists
+	const auto& chunkedRecords = mChunkedRecords.front();
+	mEventDataBeingSent.erase(mEventDataBeingSent.begin(), chunkedRecords.eventsEnd);
+	mActionDataBeingSent.erase(mActionDataBeingSent.begin(), chunkedRecords.actionsEnd);
+	mNumBytesBeingSent -= chunkedRecords.numBytes;
 
-	if (it == mEventDataBeingSent.end())
-	{
-		// only check action data, if all event data has been traversed, otherwise it's just waste of cpu time
-		it = mActionDataBeingSent.begin();
-		while (it != mActionDataBeingSent.end())
-		{
-			if (it->isMarkedForSending())
-			{
-				it = mActionDataBeingSent.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-	}
+	mChunkedRecords.pop_front();
 }
 
 void BeaconCacheEntry::resetDataMarkedForSending()
@@ -155,25 +182,13 @@ void BeaconCacheEntry::resetDataMarkedForSending()
 		return;
 	}
 
-	// reset the "sending marks" and in the same traversal count the bytes which are added back
-	int64_t numBytes = 0;
-	for (auto it = mEventDataBeingSent.begin(); it != mEventDataBeingSent.end(); ++it)
-	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
-	}
-
-	for (auto it = mActionDataBeingSent.begin(); it != mActionDataBeingSent.end(); ++it)
-	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
-	}
-
 	// merge data
 	mEventData.splice(mEventData.begin(), mEventDataBeingSent);
 	mActionData.splice(mActionData.begin(), mActionDataBeingSent);
+	mChunkedRecords.clear();
 
-	mTotalNumBytes += numBytes;
+	mTotalNumBytes += mNumBytesBeingSent;
+	mNumBytesBeingSent = 0;
 }
 
 int64_t BeaconCacheEntry::getTotalNumberOfBytes() const
@@ -181,6 +196,11 @@ int64_t BeaconCacheEntry::getTotalNumberOfBytes() const
 	return mTotalNumBytes;
 }
 
+size_t BeaconCacheEntry::getNumberOfRecords() const
+{
+	return mEventData.size() + mActionData.size() + mEventDataBeingSent.size() + mActionDataBeingSent.size();
+}
+
 int32_t BeaconCacheEntry::removeRecordsOlderThan(int64_t minTimestamp)
 {
 	int32_t numRecordsRemoved = removeRecordsOlderThan(mEventData, minTimestamp);
@@ -250,6 +270,22 @@ int32_t BeaconCacheEntry::removeOldestRecords(int32_t numRecords)
 	return numRecordsRemoved;
 }
 
+void BeaconCacheEntry::visitEventData(const std::function<void(const BeaconCacheRecord&)>& visitor) const
+{
+	for (const auto& record : mEventData)
+	{
+		visitor(record);
+	}
+}
+
+void BeaconCacheEntry::visitActionData(const std::function<void(const BeaconCacheRecord&)>& visitor) const
+{
+	for (const auto& record : mActionData)
+	{
+		visitor(record);
+	}
+}
+
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventData() const
 {
 	std::list<BeaconCacheRecord> result = mEventData;
@@ -264,10 +300,34 @@ const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionData() const
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventDataBeingSent() const
 {
-	return mEventDataBeingSent;
+	return copyDataBeingSent(mEventDataBeingSent,
+		mChunkedRecords.empty() ? mEventDataBeingSent.cbegin() : mChunkedRecords.back().eventsEnd);
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionDataBeingSent() const
 {
-	return mActionDataBeingSent;
+	return copyDataBeingSent(mActionDataBeingSent,
+		mChunkedRecords.empty() ? mActionDataBeingSent.cbegin() : mChunkedRecords.back().actionsEnd);
+}
+
+std::list<BeaconCacheRecord> BeaconCacheEntry::copyDataBeingSent(const std::list<BeaconCacheRecord>& dataBeingSent,
+	std::list<BeaconCacheRecord>::const_iterator chunkedEnd)
+{
+	std::list<BeaconCacheRecord> result;
+	bool isChunked = true;
+	for (auto it = dataBeingSent.cbegin(); it != dataBeingSent.cend(); ++it)
+	{
+		if (it == chunkedEnd)
+		{
+			isChunked = false;
+		}
+
+		result.push_back(*it);
+		if (isChunked)
+		{
+			result.back().markForSending();
+		}
+	}
+
+	return result;
 }
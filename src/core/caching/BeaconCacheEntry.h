@@ -24,6 +24,8 @@
 #include <vector>
 #include <memory>
 #include <list>
+#include <deque>
+#include <functional>
 #include <mutex>
 
 namespace core
@@ -81,21 +83,37 @@ namespace core
 			///
 			/// This method is called from beacon sending thread.
 			///
+			/// Multiple chunks might be retrieved before the first one is removed, in which case each chunk
+			/// continues with the first record not contained in any previous chunk.
+			///
 			/// @param[in] chunkPrefix The prefix to add to each chunk.
-			/// @param[in] maxSize     The maximum size in characters for one chunk.
+			/// @param[in] maxSize     The maximum size in bytes for one chunk, including the prefix.
+			///                        A chunk exceeds this size only if a single record does not fit into it.
 			/// @param[in] delimiter   The delimiter between data chunks.
-			/// @return The string to send or an empty string if there is no more data to send.
+			/// @return The string to send or an empty string if there is no more data to send, or if all remaining
+			///         data is already contained in previously retrieved chunks.
 			///
 			const core::UTF8String getChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
 
+			///
+			/// Tests whether data being sent remains, which is not part of a chunk retrieved so far.
+			///
+			/// @return @c true if @ref getChunk returns another chunk, @c false otherwise.
+			///
+			bool hasMoreChunks() const;
+
 			///
 			/// Remove data that was previously marked for sending when @ref getNextChunk was called.
 			///
+			/// If multiple chunks were retrieved, only the data of the oldest chunk is removed.
+			///
 			void removeDataMarkedForSending();
 
 			///
 			/// This method removes the marked for sending and prepends the copied data back to the data.
 			///
+			/// The data of all retrieved, but not yet removed, chunks is restored.
+			///
 			void resetDataMarkedForSending();
 
 			///
@@ -109,6 +127,16 @@ namespace core
 			///
 			int64_t getTotalNumberOfBytes() const;
 
+			///
+			/// Get total number of records stored in this entry.
+			///
+			/// In contrast to @ref getTotalNumberOfBytes records currently being sent are taken into account,
+			/// since they are lost as well if sending does not succeed.
+			///
+			/// @return Number of active records plus number of records being sent.
+			///
+			size_t getNumberOfRecords() const;
+
 			///
 			/// Remove all @ref BeaconCacheRecord from event and action data which are older than given minTimestamp
 			///
@@ -131,6 +159,20 @@ namespace core
 			///
 			int32_t removeOldestRecords(int32_t numRecords);
 
+			///
+			/// Invoke the given @c visitor for each event record, without copying the records.
+			///
+			/// @param[in] visitor Callback invoked for each event record.
+			///
+			void visitEventData(const std::function<void(const BeaconCacheRecord&)>& visitor) const;
+
+			///
+			/// Invoke the given @c visitor for each action record, without copying the records.
+			///
+			/// @param[in] visitor Callback invoked for each action record.
+			///
+			void visitActionData(const std::function<void(const BeaconCacheRecord&)>& visitor) const;
+
 			///
 			/// Get a deep copy of event data.
 			///
@@ -148,6 +190,7 @@ namespace core
 			///
 			/// Get a deep copy of event data being sent.
 			///
+			/// Records being part of a retrieved chunk are marked for sending in the copy.
 			/// This method shall only be used for testing purposes.
 			///
 			const std::list<BeaconCacheRecord> getEventDataBeingSent() const;
@@ -155,11 +198,30 @@ namespace core
 			///
 			/// Get a deep copy of action data being sent.
 			///
+			/// Records being part of a retrieved chunk are marked for sending in the copy.
 			/// This method shall only be used for testing purposes.
 			///
 			const std::list<BeaconCacheRecord> getActionDataBeingSent() const;
 
 		private:
+			///
+			/// Boundaries of a chunk retrieved via @ref getChunk.
+			///
+			/// Records are chunked in list order, so a chunk spans from the end of the previous chunk
+			/// (or the beginning of the list) to the stored end iterators.
+			///
+			struct ChunkedRecords
+			{
+				/// first event record not being part of the chunk
+				std::list<BeaconCacheRecord>::iterator eventsEnd;
+				/// first action record not being part of the chunk
+				std::list<BeaconCacheRecord>::iterator actionsEnd;
+				/// number of records in the chunk
+				size_t numRecords;
+				/// sum of the data size of all records in the chunk
+				int64_t numBytes;
+			};
+
 			///
 			/// Test if there is more data to send (to chunk).
 			///
@@ -170,20 +232,39 @@ namespace core
 			///
 			/// Get the next chunk.
 			/// @param[in] chunkPrefix The prefix to add to each chunk.
-			/// @param[in] maxSize     The maximum size in characters for one chunk.
+			/// @param[in] maxSize     The maximum size in bytes for one chunk, including the prefix.
 			/// @param[in] delimiter   The delimiter between data chunks.
 			/// @return The string to send or an empty string if there is no more data to send.
 			///
 			const core::UTF8String getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
 
 			///
-			/// Iterates (up to the @c maxSize) the provided @c dataBeingSent list and appends the data together with the @c delimiter to the provided @c chunk.
+			/// Appends the records from @c next up to @c end together with the @c delimiter to the provided @c chunk,
+			/// as long as the chunk's size in bytes does not exceed @c maxSize.
+			///
+			/// If the chunk does not contain any record yet, the first record is appended regardless of its size,
+			/// otherwise a single oversized record could never be sent.
+			///
 			/// param[in,out] chunk the chunk to which the data is appended
-			/// param[in] dataBeingSent the list of record containing the data to append
-			/// param[in] maxSize in characters for one chunk. Up to this size data (if available) is appended
+			/// param[in,out] next the first record to append, afterwards pointing to the first record not appended
+			/// param[in] end the end of the list of records being sent
+			/// param[in] maxSize in bytes for one chunk. Up to this size data (if available) is appended
 			/// param[in] delimiter the delimiter between data chunks
+			/// param[in,out] chunkedRecords number of records and bytes in the chunk, updated by this method
+			/// @return @c true if a record did not fit into the chunk any more, @c false otherwise
 			///
-			static void chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter);
+			static bool chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>::iterator& next,
+				const std::list<BeaconCacheRecord>::iterator& end, size_t maxSize, const core::UTF8String& delimiter,
+				ChunkedRecords& chunkedRecords);
+
+			///
+			/// Get a deep copy of the given records being sent, where all records being part of a chunk are marked for sending.
+			/// @param[in] dataBeingSent list of records being sent
+			/// @param[in] chunkedEnd the first record not being part of a chunk
+			/// @return deep copy of @c dataBeingSent
+			///
+			static std::list<BeaconCacheRecord> copyDataBeingSent(const std::list<BeaconCacheRecord>& dataBeingSent,
+				std::list<BeaconCacheRecord>::const_iterator chunkedEnd);
 
 			///
 			/// Remove all @ref BeaconCacheRecord from @c records.
@@ -212,6 +293,12 @@ namespace core
 
 			/// Sum of all record's data size estimation.
 			int64_t mTotalNumBytes;
+
+			/// Sum of the data size of all records being sent.
+			int64_t mNumBytesBeingSent;
+
+			/// Boundaries of all retrieved, but not yet removed, chunks - oldest chunk first.
+			std::deque<ChunkedRecords> mChunkedRecords;
 		};
 	}
 }
@@ -22,7 +22,7 @@
 
 using namespace core::caching;
 
-constexpr std::chrono::milliseconds EVICTION_THREAD_JOIN_TIMEOUT = std::chrono::seconds(2);
+constexpr std::chrono::milliseconds EVICTION_STOP_TIMEOUT = std::chrono::seconds(2);
 
 BeaconCacheEvictor::BeaconCacheEvictor
 (
@@ -31,6 +31,18 @@ BeaconCacheEvictor::BeaconCacheEvictor
 	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> configuration,
 	std::shared_ptr<providers::ITimingProvider> timingProvider
 )
+: BeaconCacheEvictor(logger, beaconCache, configuration, timingProvider, std::make_shared<core::util::TaskExecutor>(1))
+{
+}
+
+BeaconCacheEvictor::BeaconCacheEvictor
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<IBeaconCache> beaconCache,
+	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> configuration,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::util::TaskExecutor> executor
+)
 : BeaconCacheEvictor
 (
 	logger,
@@ -51,7 +63,8 @@ BeaconCacheEvictor::BeaconCacheEvictor
 			configuration,
 			std::bind(&BeaconCacheEvictor::isAlive, this)
 		)
-	}
+	},
+	executor
 )
 {
 }
@@ -61,111 +74,124 @@ BeaconCacheEvictor::BeaconCacheEvictor
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<IBeaconCache> beaconCache,
 	std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies
+)
+	: BeaconCacheEvictor(logger, beaconCache, strategies, std::make_shared<core::util::TaskExecutor>(1))
+{
+}
+
+BeaconCacheEvictor::BeaconCacheEvictor
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<IBeaconCache> beaconCache,
+	std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+	std::shared_ptr<core::util::TaskExecutor> executor
 )
 	: mLogger(logger)
 	, mBeaconCache(beaconCache)
 	, mStrategies(strategies)
-	, mEvictionThread(nullptr)
+	, mExecutor(executor)
+	, mEvictionTaskID(core::util::TaskExecutor::INVALID_TASK_ID)
 	, mRunning(false)
-	, mStop(false)
+	, mIsEvicting(false)
 	, mRecordAdded(false)
+	, mIsObserverRegistered(false)
 	, mMutex()
 	, mConditionVariable()
 {
 }
 
+BeaconCacheEvictor::~BeaconCacheEvictor()
+{
+	core::util::TaskExecutor::TaskID evictionTaskID;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		mRunning = false;
+		evictionTaskID = mEvictionTaskID;
+	}
+
+	// removes a pending eviction or waits until the running one returned
+	mExecutor->cancel(evictionTaskID);
+}
+
 bool BeaconCacheEvictor::start()
 {
-	if (isAlive())
-	{
-		// eviction thread already running
-		if (mLogger->isDebugEnabled())
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mRunning)
 		{
-			mLogger->debug("BeaconCacheEvictor start() - Not starting BeaconCacheEviction thread, since it's already running");
+			// evictor already running
+			if (mLogger->isDebugEnabled())
+			{
+				mLogger->debug("BeaconCacheEvictor start() - Not starting BeaconCacheEvictor, since it's already running");
+			}
+			return false;
 		}
-		return false;
-	}
 
-	std::unique_lock<std::mutex> lock(mMutex);
-	mEvictionThread = std::unique_ptr<std::thread>(new std::thread(&BeaconCacheEvictor::cacheEvictionLoopFunc, this));
-	while (!mRunning)
-	{
-		mConditionVariable.wait(lock);
+		mRunning = true;
+		mRecordAdded = false;
+		if (mIsObserverRegistered)
+		{
+			return true;
+		}
+		mIsObserverRegistered = true;
 	}
 
+	mBeaconCache->addObserver(this);
+
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("BeaconCacheEvictior start() - BeaconCacheEviction thread started.");
+		mLogger->debug("BeaconCacheEvictor start() - BeaconCacheEvictor started.");
 	}
 	return true;
 }
 
 bool BeaconCacheEvictor::stop()
 {
-	return stop(EVICTION_THREAD_JOIN_TIMEOUT);
+	return stop(EVICTION_STOP_TIMEOUT);
 }
 
 bool BeaconCacheEvictor::stop(std::chrono::milliseconds timeout)
 {
-	if (!isAlive())
+	std::unique_lock<std::mutex> lock(mMutex);
+	if (!mRunning)
 	{
-		// eviction thread not running, nothing to stop
+		// evictor not running, nothing to stop
 		if (mLogger->isDebugEnabled())
 		{
-			mLogger->debug("BeaconCacheEvictior stop() - Not stopping BeaconCacheEviction thread, since it's not alive");
+			mLogger->debug("BeaconCacheEvictor stop() - Not stopping BeaconCacheEvictor, since it's not alive");
 		}
 		return false;
 	}
 
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("BeaconCacheEvictior stop() - Stopping BeaconCacheEviction thread.");
-	}
-
-	{
-		std::unique_lock<std::mutex> lock(mMutex);
-		mStop = true;
-		mConditionVariable.notify_all();
+		mLogger->debug("BeaconCacheEvictor stop() - Stopping BeaconCacheEvictor.");
 	}
 
-	// Instead of join() (=waiting for the thread to terminate) we detach the thread and wait up to the timeout time
-	mEvictionThread->detach();
-	std::chrono::steady_clock clock;
-	auto t0 = clock.now();
-	auto t1 = t0 + timeout;
-
-	while (mRunning && clock.now() < t1)
-	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
-	}
-	mEvictionThread = nullptr;
-
-	if (isAlive())
+	// running strategies check isAlive() and return early
+	mRunning = false;
+	if (!mConditionVariable.wait_for(lock, timeout, [this] { return !mIsEvicting; }))
 	{
 		// not stopped in time
-		mLogger->warning("BeaconCacheEvictor stop() - BeaconCacheEviction thread was not stopped in time.");
+		mLogger->warning("BeaconCacheEvictor stop() - BeaconCacheEviction was not stopped in time.");
 		return false;
 	}
+
 	// stopped in time
 	return true;
 }
 
 bool BeaconCacheEvictor::stopAndJoin()
 {
-	if (!isAlive())
+	std::unique_lock<std::mutex> lock(mMutex);
+	if (!mRunning)
 	{
-		// eviction thread not running, nothing to stop
+		// evictor not running, nothing to stop
 		return false;
 	}
 
-	{
-		std::unique_lock<std::mutex> lock(mMutex);
-		mStop = true;
-		mConditionVariable.notify_all();
-	}
-
-	mEvictionThread->join();
-	mEvictionThread = nullptr;
+	mRunning = false;
+	mConditionVariable.wait(lock, [this] { return !mIsEvicting; });
 
 	return true;
 }
@@ -178,43 +204,33 @@ bool BeaconCacheEvictor::isAlive()
 
 void BeaconCacheEvictor::update()
 {
-	std::unique_lock<std::mutex> lock(mMutex);
-
-	mRecordAdded = true;
-	mConditionVariable.notify_all();
-}
-
-void BeaconCacheEvictor::cacheEvictionLoopFunc()
-{
+	if (mRecordAdded.exchange(true))
 	{
-		std::unique_lock<std::mutex> lock(mMutex);
-		mRunning = true;
-
-		// we've started up -> let the start() function return
-		mConditionVariable.notify_all();
+		// eviction already pending
+		return;
 	}
 
-	// first register ourselves
-	mBeaconCache->addObserver(this);
-
-	while (true)
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (!mRunning)
 	{
-		{
-			std::unique_lock<std::mutex> lock(mMutex);
-			while (!mRecordAdded && !mStop)
-			{
-				mConditionVariable.wait(lock);
-			}
+		mRecordAdded = false;
+		return;
+	}
 
-			if (mStop)
-			{
-				// exit the thread
-				break;
-			}
+	if (mEvictionTaskID == core::util::TaskExecutor::INVALID_TASK_ID)
+	{
+		mEvictionTaskID = mExecutor->schedule(std::bind(&BeaconCacheEvictor::executeEvictionTask, this));
+	}
+}
 
-			// reset the added flag
-			mRecordAdded = false;
-		}
+void BeaconCacheEvictor::executeEvictionTask()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	// reset the added flag, records added while executing the strategies set it again
+	while (mRunning && mRecordAdded.exchange(false))
+	{
+		mIsEvicting = true;
+		lock.unlock();
 
 		// a new record has been added to the cache
 		// run all eviction strategies, to perform cache cleanup
@@ -222,13 +238,11 @@ void BeaconCacheEvictor::cacheEvictionLoopFunc()
 		{
 			it->get()->execute();
 		}
-	}
-
-	std::unique_lock<std::mutex> lock(mMutex);
-	mRunning = false;
 
-	if (mLogger->isDebugEnabled())
-	{
-		mLogger->debug("BeaconCacheEvictor cacheEvictionLoopFunc() - BeaconCacheEviction thread is stopped.");
+		lock.lock();
+		mIsEvicting = false;
+		mConditionVariable.notify_all();
 	}
-}
\ No newline at end of file
+
+	mEvictionTaskID = core::util::TaskExecutor::INVALID_TASK_ID;
+}
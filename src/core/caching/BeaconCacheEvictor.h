@@ -23,23 +23,25 @@
 #include "IBeaconCacheEvictor.h"
 #include "IBeaconCacheEvictionStrategy.h"
 #include "core/configuration/IBeaconCacheConfiguration.h"
+#include "core/util/TaskExecutor.h"
 #include "providers/ITimingProvider.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <vector>
 #include <initializer_list>
-#include <thread>
 #include <mutex>
 #include <condition_variable>
-#include <atomic>
 
 namespace core
 {
 	namespace caching
 	{
 		///
-		/// Class responsible for handling an eviction thread, to ensure @ref BeaconCache stays in configured boundaries.
+		/// Class responsible for evicting records, to ensure @ref BeaconCache stays in configured boundaries.
+		///
+		/// Whenever a record is added to the cache, the eviction strategies are executed as a task of a @ref util::TaskExecutor.
 		///
 		class BeaconCacheEvictor
 			: public IBeaconCacheEvictor
@@ -48,7 +50,8 @@ namespace core
 		public:
 
 			///
-			/// Public constructor, initializing the eviction thread with the default @ref TimeEvictionStrategy and @ref SpaceEvictionStrategy strategies.
+			/// Public constructor, initializing the evictor with the default @ref TimeEvictionStrategy and @ref SpaceEvictionStrategy strategies
+			/// executed on an own single threaded executor.
 			/// @param[in] logger to write traces to
 			/// @param[in] beaconCache    The Beacon cache to check if entries need to be evicted
 			/// @param[in] configuration  Beacon cache configuration
@@ -62,6 +65,23 @@ namespace core
 				std::shared_ptr<providers::ITimingProvider> timingProvider
 			);
 
+			///
+			/// Public constructor, initializing the evictor with the default @ref TimeEvictionStrategy and @ref SpaceEvictionStrategy strategies.
+			/// @param[in] logger to write traces to
+			/// @param[in] beaconCache    The Beacon cache to check if entries need to be evicted
+			/// @param[in] configuration  Beacon cache configuration
+			/// @param[in] timingProvider Timing provider required for time retrieval
+			/// @param[in] executor       Executor running the eviction strategies
+			///
+			BeaconCacheEvictor
+			(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<IBeaconCache> beaconCache,
+				std::shared_ptr<configuration::IBeaconCacheConfiguration> configuration,
+				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<util::TaskExecutor> executor
+			);
+
 			///
 			/// Internal testing constructor.
 			/// @param[in] logger to write traces to
@@ -76,33 +96,63 @@ namespace core
 			);
 
 			///
-			/// Starts the eviction thread.
-			/// @return @c true if the eviction thread was started, @c false if the thread was already running.
+			/// Internal testing constructor.
+			/// @param[in] logger to write traces to
+			/// @param[in] beaconCache The Beacon cache to check if entries need to be evicted
+			/// @param[in] strategies  Strategies passed to the actual Runnable.
+			/// @param[in] executor    Executor running the eviction strategies
+			///
+			BeaconCacheEvictor
+			(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<IBeaconCache> beaconCache,
+				std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+				std::shared_ptr<util::TaskExecutor> executor
+			);
+
+			///
+			/// Destructor waiting until a running eviction is finished.
+			///
+			~BeaconCacheEvictor() override;
+
+			///
+			/// Delete the copy constructor
+			///
+			BeaconCacheEvictor(const BeaconCacheEvictor&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			BeaconCacheEvictor& operator = (const BeaconCacheEvictor&) = delete;
+
+			///
+			/// Starts evicting records whenever a record is added to the cache.
+			/// @return @c true if the evictor was started, @c false if it was already running.
 			///
 			bool start() override;
 
 			///
-			/// Stops the eviction thread with the default timeout of @ref EVICTION_THREAD_JOIN_TIMEOUT.
+			/// Stops the evictor with the default timeout of @ref EVICTION_STOP_TIMEOUT.
 			/// See also @ref stop(std::chrono::milliseconds)
 			///
 			bool stop() override;
 
 			///
-			/// Stops the eviction thread with the given @c timeout. If the timeout is reached the thread is terminated forcefully.
-			/// @param[in] timeout The number of milliseconds to join the thread.
-			/// @return @c true if stopping was successful, @c false if eviction thread is not running or could not be stopped in time.
+			/// Stops the evictor and waits up to the given @c timeout for a running eviction to finish.
+			/// @param[in] timeout The number of milliseconds to wait for a running eviction.
+			/// @return @c true if stopping was successful, @c false if the evictor is not running or the eviction did not finish in time.
 			///
 			bool stop(std::chrono::milliseconds timeout) override;
 
 			///
-			/// Stops the eviction thread and joins.
-			/// This function is indented for unit testing only as it potentially joins endlessly.
-			/// @return @c true if stopping was successful, @c false if eviction thread is not running.
+			/// Stops the evictor and waits for a running eviction to finish.
+			/// This function is indented for unit testing only as it potentially waits endlessly.
+			/// @return @c true if stopping was successful, @c false if the evictor is not running.
 			///
 			bool stopAndJoin();
 
 			///
-			/// Checks if the eviction thread is running or not.
+			/// Checks if the evictor is running or not.
 			/// @return @c true if running, @c false otherwise
 			///
 			bool isAlive() override;
@@ -112,12 +162,13 @@ namespace core
 			///
 			void update() override;
 
+		private:
+
+			///
+			/// The task executing the eviction strategies as long as records were added.
 			///
-			/// The thread function
-			////
-			void cacheEvictionLoopFunc();
+			void executeEvictionTask();
 
-		private:
 			/// Logger to write traces to
 			std::shared_ptr<openkit::ILogger> mLogger;
 
@@ -127,22 +178,31 @@ namespace core
 			/// Eviction strategies executed in an eviction run
 			std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> mStrategies;
 
-			/// Thread being responsible for evicting records from the cache, based on an eviction strategy
-			std::unique_ptr<std::thread> mEvictionThread;
+			/// Executor running the eviction task
+			std::shared_ptr<util::TaskExecutor> mExecutor;
+
+			/// ID of the scheduled or running eviction task
+			util::TaskExecutor::TaskID mEvictionTaskID;
 
-			/// Flag indicating if the eviction thread is currently running
+			/// Flag indicating if the evictor is running
 			bool mRunning;
 
-			/// Flag to stop the eviction thread
-			bool mStop;
+			/// Flag indicating that the eviction strategies are currently executed
+			bool mIsEvicting;
+
+			///
+			/// Flag, which indicates that a new record was added to the cache, thus we need to execute the eviction strategies.
+			/// Set without holding @ref mMutex, so adding records only locks when no eviction is pending.
+			///
+			std::atomic<bool> mRecordAdded;
 
-			/// Flag, which indicates that a new record was added to the cache, thus we need to execute the eviction strategies
-			bool mRecordAdded;
+			/// Flag indicating that this evictor was added as observer of the beacon cache
+			bool mIsObserverRegistered;
 
 			/// Mutex for condition variable
 			std::mutex mMutex;
 
-			/// To trigger thread operation
+			/// Signaled when an eviction run finished
 			std::condition_variable mConditionVariable;
 		};
 
@@ -18,11 +18,13 @@
 #define _CORE_CACHING_IBEACONCACHE_H
 
 #include "IObserver.h"
+#include "BeaconCacheRecord.h"
 #include "core/UTF8String.h"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
-#include <unordered_set>
+#include <vector>
 
 namespace core
 {
@@ -34,6 +36,16 @@ namespace core
 		class IBeaconCache
 		{
 		public:
+			///
+			/// Immutable snapshot of beacon ids, which can be shared between threads.
+			///
+			using BeaconIDSnapshot = std::shared_ptr<const std::vector<int32_t>>;
+
+			///
+			/// Callback invoked for each visited @ref BeaconCacheRecord.
+			///
+			using RecordVisitor = std::function<void(const BeaconCacheRecord&)>;
+
 			///
 			/// Destructor
 			///
@@ -56,6 +68,17 @@ namespace core
 			///
 			virtual void addEventData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) = 0;
 
+			///
+			/// Add several event data records for a given @c beaconID to this cache.
+			///
+			/// The cache entry is locked once for all records and the registered observers are notified once,
+			/// after all records have been added.
+			///
+			/// @param[in] beaconID The beacon's ID (aka Session ID) for which to add event data.
+			/// @param[in] records the records holding timestamp and serialized event data.
+			///
+			virtual void addEventData(int32_t beaconID, const std::vector<BeaconCacheRecord>& records) = 0;
+
 			///
 			/// Add action data for a given @c beaconID to this cache.
 			///
@@ -65,6 +88,36 @@ namespace core
 			///
 			virtual void addActionData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) = 0;
 
+			///
+			/// Announce a new beacon, before any event or action data is added for it.
+			///
+			/// A cache sending its data in this process ignores the announcement, since the basic beacon data
+			/// is passed as prefix to @ref getNextBeaconChunk. A cache forwarding its data to another process,
+			/// which sends it on behalf of this one, needs the basic beacon data to do so.
+			///
+			/// @param[in] beaconID The beacon's ID (aka Session ID).
+			/// @param[in] sessionStartTime The start time of the beacon's session.
+			/// @param[in] sessionNumber The session number sent with the beacon.
+			/// @param[in] clientIPAddress The client IP address sent with the beacon, empty if determined by the server.
+			/// @param[in] immutableBeaconData The serialized basic beacon data, equal for all chunks of this beacon.
+			///
+			virtual void addBeacon(
+				int32_t beaconID,
+				int64_t sessionStartTime,
+				int32_t sessionNumber,
+				const core::UTF8String& clientIPAddress,
+				const core::UTF8String& immutableBeaconData
+			) = 0;
+
+			///
+			/// Announce that no more data is added for a given @c beaconID, because its session has ended.
+			///
+			/// The data cached so far still has to be sent, see @ref addBeacon.
+			///
+			/// @param[in] beaconID The beacon's ID (aka Session ID).
+			///
+			virtual void endBeacon(int32_t beaconID) = 0;
+
 			///
 			/// Delete a cache entry for a given @c beaconID.
 			/// @param[in] beaconID The beacon's ID (aka Session ID) which to delete.
@@ -76,19 +129,23 @@ namespace core
 			///
 			/// Note: This method must only be invoked from the beacon sending thread.
 			///
+			/// The next chunk might be retrieved before the previous one was removed via @ref removeChunkedData.
+			/// In this case the next chunk continues with the data following the previous chunk.
+			///
 			/// @param[in] beaconID The beacon id for which to get the next chunk.
 			/// @param[in] chunkPrefix Prefix to append to the beginning of the chunk.
-			/// @param[in] maxSize Maximum chunk size. As soon as chunk's size is greater than or equal to maxSize result is returned.
+			/// @param[in] maxSize Maximum chunk size in bytes, including the prefix. Records are appended as long as they fit,
+			///                    only a chunk consisting of a single oversized record may exceed this size.
 			/// @param[in] delimiter Delimiter between consecutive chunks.
 			/// @return the next chunk to send or an empty string, if either the given @c beaconID does not exist or if there is no more data to send.
 			///
 			virtual const core::UTF8String getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) = 0;
 
 			///
-			/// Remove all data that was previously included in chunks.
+			/// Remove all data that was previously included in the oldest chunk not removed so far.
 			///
 			/// This method must be called, when data retrieved via @ref getNextBeaconChunk was successfully sent to the backend,
-			/// otherwise subsequent calls to @ref getNextBeaconChunk will retrieve the same data again and again.
+			/// otherwise the data is sent again after the chunks are reset via @ref resetChunkedData.
 			///
 			/// Note: This method must only be invoked from the beacon sending thread.
 			///
@@ -97,7 +154,7 @@ namespace core
 			virtual void removeChunkedData(int32_t beaconID) = 0;
 
 			///
-			/// Reset all data that was previously included in chunks.
+			/// Reset all data that was previously included in chunks, which were not removed so far.
 			///
 			/// Note: This method must only be invoked from the beacon sending thread.
 			///
@@ -106,14 +163,48 @@ namespace core
 			virtual void resetChunkedData(int32_t beaconID) = 0;
 
 			///
-			/// Get a Set of currently inserted Beacon ids.
+			/// Tests whether data remains, which is not part of a chunk retrieved so far.
+			///
+			/// Note: This method must only be invoked from the beacon sending thread.
+			///
+			/// @param[in] beaconID The beacon id to check.
+			/// @return @c true if @ref getNextBeaconChunk returns another chunk before the retrieved chunks are removed,
+			///         @c false otherwise.
+			///
+			virtual bool hasMoreChunks(int32_t beaconID) = 0;
+
 			///
-			/// The return value is a snapshot of currently inserted beacon ids.
-			/// All changes made after this call are not reflected in the returned Set.
+			/// Get a snapshot of currently inserted Beacon ids.
+			///
+			/// The returned snapshot is immutable and shared with other callers, therefore obtaining it
+			/// does neither copy the beacon ids nor acquire the global cache lock.
+			/// All changes made after this call are not reflected in the returned snapshot.
 			///
 			/// @return Snapshot of all beacon ids in the cache.
 			///
-			virtual const std::unordered_set<int32_t> getBeaconIDs() = 0;
+			virtual BeaconIDSnapshot getBeaconIDs() = 0;
+
+			///
+			/// Visit all event records of the given beacon without copying them.
+			///
+			/// The @c visitor is invoked for each record while the beacon's cache entry is locked,
+			/// therefore it must neither block nor call back into the cache.
+			///
+			/// @param[in] beaconID The beacon id for which to visit the events.
+			/// @param[in] visitor Callback invoked for each event record.
+			///
+			virtual void visitEventData(int32_t beaconID, const RecordVisitor& visitor) = 0;
+
+			///
+			/// Visit all action records of the given beacon without copying them.
+			///
+			/// The @c visitor is invoked for each record while the beacon's cache entry is locked,
+			/// therefore it must neither block nor call back into the cache.
+			///
+			/// @param[in] beaconID The beacon id for which to visit the actions.
+			/// @param[in] visitor Callback invoked for each action record.
+			///
+			virtual void visitActionData(int32_t beaconID, const RecordVisitor& visitor) = 0;
 
 			///
 			/// Evict @ref BeaconCacheRecord by age for a given beacon.
@@ -147,6 +238,14 @@ namespace core
 			/// @return @c true if the cached entry is empty, @c false otherwise.
 			///
 			virtual bool isEmpty(int32_t beaconID) = 0;
+
+			///
+			/// Get the number of records cached for @c beaconID, including records currently being sent.
+			///
+			/// @param[in] beaconID The beacon's identifier.
+			/// @return The number of cached records or @c 0 if no entry for @c beaconID exists.
+			///
+			virtual size_t getNumberOfRecords(int32_t beaconID) = 0;
 		};
 	}
 }
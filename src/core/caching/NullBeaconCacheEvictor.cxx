@@ -0,0 +1,40 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "NullBeaconCacheEvictor.h"
+
+using namespace core::caching;
+
+bool NullBeaconCacheEvictor::isAlive()
+{
+	return false;
+}
+
+bool NullBeaconCacheEvictor::start()
+{
+	return false;
+}
+
+bool NullBeaconCacheEvictor::stop()
+{
+	return false;
+}
+
+bool NullBeaconCacheEvictor::stop(std::chrono::milliseconds /* timeout */)
+{
+	return false;
+}
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_NULLBEACONCACHEEVICTOR_H
+#define _CORE_CACHING_NULLBEACONCACHEEVICTOR_H
+
+#include "IBeaconCacheEvictor.h"
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Beacon cache evictor which never evicts anything.
+		///
+		/// Used for caches which do not hold any data, like the cache of a worker process in sidecar mode.
+		///
+		class NullBeaconCacheEvictor : public IBeaconCacheEvictor
+		{
+		public:
+			~NullBeaconCacheEvictor() override = default;
+
+			bool isAlive() override;
+
+			bool start() override;
+
+			bool stop() override;
+
+			bool stop(std::chrono::milliseconds timeout) override;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SharedBeaconCacheEvictor.h"
+#include "AttachedBeaconCacheEvictor.h"
+
+#include <algorithm>
+
+using namespace core::caching;
+
+SharedBeaconCacheEvictor::SharedBeaconCacheEvictor(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> globalConfiguration,
+	std::shared_ptr<core::util::TaskExecutor> executor
+)
+	: mLogger(logger)
+	, mGlobalConfiguration(globalConfiguration)
+	, mExecutor(executor)
+	, mMutex()
+	, mConditionVariable()
+	, mAttachedEvictors()
+	, mPendingEvictors()
+	, mExecutingEvictor(nullptr)
+	, mEvictionTaskID(core::util::TaskExecutor::INVALID_TASK_ID)
+	, mStop(false)
+{
+}
+
+SharedBeaconCacheEvictor::~SharedBeaconCacheEvictor()
+{
+	core::util::TaskExecutor::TaskID evictionTaskID;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+		evictionTaskID = mEvictionTaskID;
+	}
+
+	// removes a pending eviction or waits until the running one returned
+	mExecutor->cancel(evictionTaskID);
+}
+
+bool SharedBeaconCacheEvictor::attach(AttachedBeaconCacheEvictor* evictor)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (std::find(mAttachedEvictors.begin(), mAttachedEvictors.end(), evictor) != mAttachedEvictors.end())
+	{
+		return false;
+	}
+
+	mAttachedEvictors.push_back(evictor);
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("SharedBeaconCacheEvictor attach() - %zu beacon caches attached", mAttachedEvictors.size());
+	}
+
+	return true;
+}
+
+bool SharedBeaconCacheEvictor::detach(AttachedBeaconCacheEvictor* evictor)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	auto it = std::find(mAttachedEvictors.begin(), mAttachedEvictors.end(), evictor);
+	if (it == mAttachedEvictors.end())
+	{
+		return false;
+	}
+
+	mAttachedEvictors.erase(it);
+	mPendingEvictors.remove(evictor);
+
+	// strategies check whether the evictor is still attached, therefore they stop soon
+	mConditionVariable.wait(lock, [this, evictor] { return mExecutingEvictor != evictor; });
+
+	return true;
+}
+
+bool SharedBeaconCacheEvictor::isAttached(const AttachedBeaconCacheEvictor* evictor) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return std::find(mAttachedEvictors.begin(), mAttachedEvictors.end(), evictor) != mAttachedEvictors.end();
+}
+
+bool SharedBeaconCacheEvictor::notifyRecordAdded(AttachedBeaconCacheEvictor* evictor)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (std::find(mAttachedEvictors.begin(), mAttachedEvictors.end(), evictor) == mAttachedEvictors.end())
+	{
+		// not attached
+		return false;
+	}
+
+	if (std::find(mPendingEvictors.begin(), mPendingEvictors.end(), evictor) != mPendingEvictors.end())
+	{
+		// eviction already pending
+		return true;
+	}
+
+	mPendingEvictors.push_back(evictor);
+	if (mEvictionTaskID == core::util::TaskExecutor::INVALID_TASK_ID && !mStop)
+	{
+		mEvictionTaskID = mExecutor->schedule(std::bind(&SharedBeaconCacheEvictor::executeEvictionTask, this));
+	}
+
+	return true;
+}
+
+int64_t SharedBeaconCacheEvictor::getNumberOfAttachedEvictors() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return static_cast<int64_t>(mAttachedEvictors.size());
+}
+
+std::shared_ptr<core::configuration::IBeaconCacheConfiguration> SharedBeaconCacheEvictor::getGlobalConfiguration() const
+{
+	return mGlobalConfiguration;
+}
+
+void SharedBeaconCacheEvictor::executeEvictionTask()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (!mStop && !mPendingEvictors.empty())
+	{
+		auto evictor = mPendingEvictors.front();
+		mPendingEvictors.pop_front();
+		mExecutingEvictor = evictor;
+
+		// a new record has been added to the evictor's cache
+		// run all its eviction strategies, to perform cache cleanup
+		lock.unlock();
+		evictor->executeStrategies();
+		lock.lock();
+
+		mExecutingEvictor = nullptr;
+		mConditionVariable.notify_all();
+	}
+
+	mEvictionTaskID = core::util::TaskExecutor::INVALID_TASK_ID;
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_SHAREDBEACONCACHEEVICTOR_H
+#define _CORE_CACHING_SHAREDBEACONCACHEEVICTOR_H
+
+#include "OpenKit/ILogger.h"
+#include "core/configuration/IBeaconCacheConfiguration.h"
+#include "core/util/TaskExecutor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace core
+{
+	namespace caching
+	{
+		class AttachedBeaconCacheEvictor;
+
+		///
+		/// Evicts records from the beacon caches of all OpenKit instances attached to a shared runtime.
+		///
+		/// Evictions are executed one after another by a single task of an own @ref util::TaskExecutor, so they are not delayed
+		/// by blocking beacon requests.
+		///
+		/// Each OpenKit instance uses an @ref AttachedBeaconCacheEvictor, which registers itself here when started.
+		/// The global memory boundaries are split equally across all attached evictors.
+		///
+		class SharedBeaconCacheEvictor
+		{
+		public:
+
+			///
+			/// Constructor
+			/// @param[in] logger to write traces to
+			/// @param[in] globalConfiguration configuration holding the memory boundaries shared by all attached caches
+			/// @param[in] executor executor running the eviction task
+			///
+			SharedBeaconCacheEvictor(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<configuration::IBeaconCacheConfiguration> globalConfiguration,
+				std::shared_ptr<util::TaskExecutor> executor
+			);
+
+			///
+			/// Destructor cancelling the eviction task.
+			///
+			~SharedBeaconCacheEvictor();
+
+			///
+			/// Delete the copy constructor
+			///
+			SharedBeaconCacheEvictor(const SharedBeaconCacheEvictor&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			SharedBeaconCacheEvictor& operator = (const SharedBeaconCacheEvictor&) = delete;
+
+			///
+			/// Attaches the given evictor.
+			/// @param[in] evictor the evictor to attach
+			/// @return @c true if the evictor was attached, @c false if it was already attached
+			///
+			bool attach(AttachedBeaconCacheEvictor* evictor);
+
+			///
+			/// Detaches the given evictor and waits until its strategies are no longer executed.
+			/// @param[in] evictor the evictor to detach
+			/// @return @c true if the evictor was detached, @c false if it was not attached
+			///
+			bool detach(AttachedBeaconCacheEvictor* evictor);
+
+			///
+			/// Returns whether the given evictor is currently attached.
+			///
+			bool isAttached(const AttachedBeaconCacheEvictor* evictor) const;
+
+			///
+			/// Schedules the eviction of the given evictor's cache, since a record was added to it.
+			/// @return @c true if the eviction is pending, @c false if the evictor is not attached
+			///
+			bool notifyRecordAdded(AttachedBeaconCacheEvictor* evictor);
+
+			///
+			/// Returns the number of currently attached evictors.
+			///
+			int64_t getNumberOfAttachedEvictors() const;
+
+			///
+			/// Returns the configuration holding the global memory boundaries.
+			///
+			std::shared_ptr<configuration::IBeaconCacheConfiguration> getGlobalConfiguration() const;
+
+		private:
+
+			///
+			/// The task executing the strategies of all pending evictors.
+			///
+			void executeEvictionTask();
+
+			/// Logger to write traces to
+			std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// configuration holding the global memory boundaries
+			std::shared_ptr<configuration::IBeaconCacheConfiguration> mGlobalConfiguration;
+
+			/// executor running the eviction task
+			std::shared_ptr<util::TaskExecutor> mExecutor;
+
+			/// Mutex guarding all members below
+			mutable std::mutex mMutex;
+
+			/// Signaled when an evictor's strategies were executed
+			std::condition_variable mConditionVariable;
+
+			/// all attached evictors
+			std::vector<AttachedBeaconCacheEvictor*> mAttachedEvictors;
+
+			/// attached evictors whose cache got new records, in the order of notification
+			std::list<AttachedBeaconCacheEvictor*> mPendingEvictors;
+
+			/// evictor whose strategies are currently executed
+			AttachedBeaconCacheEvictor* mExecutingEvictor;
+
+			/// ID of the scheduled or running eviction task
+			util::TaskExecutor::TaskID mEvictionTaskID;
+
+			/// Flag to stop evicting
+			bool mStop;
+		};
+	}
+}
+
+#endif
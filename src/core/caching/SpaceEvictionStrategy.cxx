@@ -73,8 +73,8 @@ void SpaceEvictionStrategy::doExecute()
 	while (mIsAliveFunction() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
 	{
 		auto beaconIDs = mBeaconCache->getBeaconIDs();
-		auto it = beaconIDs.begin();
-		while (mIsAliveFunction() && it != beaconIDs.end() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
+		auto it = beaconIDs->begin();
+		while (mIsAliveFunction() && it != beaconIDs->end() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
 		{
 			auto beaconID = *it;
 
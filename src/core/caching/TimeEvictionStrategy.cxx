@@ -89,7 +89,7 @@ void TimeEvictionStrategy::setLastRunTimestamp(int64_t lastRunTimestamp)
 void TimeEvictionStrategy::doExecute()
 {
 	auto beaconIDs = mBeaconCache->getBeaconIDs();
-	if (beaconIDs.empty())
+	if (beaconIDs->empty())
 	{
 		// no beacons - set last run timestamp and return immediately
 		setLastRunTimestamp(mTimingProvider->provideTimestampInMilliseconds());
@@ -101,8 +101,8 @@ void TimeEvictionStrategy::doExecute()
 	int64_t smallestAllowedBeaconTimestamp = currentTimestamp - mConfiguration->getMaxRecordAge();
 
 	// iterate over the previously obtained set and evict for each beacon
-	auto it = beaconIDs.begin();
-	while (mIsAliveFunction() && it != beaconIDs.end())
+	auto it = beaconIDs->begin();
+	while (mIsAliveFunction() && it != beaconIDs->end())
 	{
 		auto beaconID = *it;
 
@@ -34,6 +34,31 @@ void AbstractBeaconSendingState::execute(IBeaconSendingContext& context)
 	}
 }
 
+int64_t AbstractBeaconSendingState::prepareExecution(IBeaconSendingContext& context)
+{
+	return doPrepareExecution(context);
+}
+
+void AbstractBeaconSendingState::executePrepared(IBeaconSendingContext& context)
+{
+	doExecutePrepared(context);
+
+	if (context.isShutdownRequested())
+	{
+		context.setNextState(getShutdownState());
+	}
+}
+
+int64_t AbstractBeaconSendingState::doPrepareExecution(IBeaconSendingContext& /* context */)
+{
+	return 0;
+}
+
+void AbstractBeaconSendingState::doExecutePrepared(IBeaconSendingContext& context)
+{
+	doExecute(context);
+}
+
 AbstractBeaconSendingState::StateType AbstractBeaconSendingState::getStateType() const
 {
 	return mStateType;
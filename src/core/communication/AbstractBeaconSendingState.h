@@ -56,6 +56,10 @@ namespace core
 			///
 			void execute(IBeaconSendingContext& context) override;
 
+			int64_t prepareExecution(IBeaconSendingContext& context) override;
+
+			void executePrepared(IBeaconSendingContext& context) override;
+
 			///
 			/// Get an instance of the {@ref AbstractBeaconSendingState} to which a transition is made upon shutdown request.
 			/// @returns the follow-up state taking care of the shutdown
@@ -87,6 +91,23 @@ namespace core
 			///
 			virtual void doExecute(IBeaconSendingContext& context) = 0;
 
+			///
+			/// Prepares the state execution and returns the delay before @ref doExecutePrepared(IBeaconSendingContext&) is called.
+			///
+			/// The default implementation does not delay the execution.
+			/// @param context the @see BeaconSendingContext that takes care of state transitions
+			/// @returns the number of milliseconds to wait, @c 0 for no delay
+			///
+			virtual int64_t doPrepareExecution(IBeaconSendingContext& context);
+
+			///
+			/// Execute the state after it was prepared.
+			///
+			/// The default implementation calls @ref doExecute(IBeaconSendingContext&).
+			/// @param context the @see BeaconSendingContext that takes care of state transitions
+			///
+			virtual void doExecutePrepared(IBeaconSendingContext& context);
+
 		private:
 			/// state type
 			StateType mStateType;
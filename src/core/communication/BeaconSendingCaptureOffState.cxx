@@ -44,6 +44,8 @@ BeaconSendingCaptureOffState::BeaconSendingCaptureOffState()
 BeaconSendingCaptureOffState::BeaconSendingCaptureOffState(int64_t sleepTimeInMilliseconds)
 	: AbstractBeaconSendingState(IBeaconSendingState::StateType::BEACON_SENDING_CAPTURE_OFF_STATE)
 	, mSleepTimeInMilliseconds(sleepTimeInMilliseconds)
+	, mPreparedTimestamp(0)
+	, mPreparedDelay(0)
 {
 }
 
@@ -53,10 +55,7 @@ void BeaconSendingCaptureOffState::doExecute(IBeaconSendingContext& context)
 	context.disableCaptureAndClear();
 
 	auto currentTime = context.getCurrentTimestamp();
-
-	auto delta = mSleepTimeInMilliseconds > int64_t(0)
-		? mSleepTimeInMilliseconds
-		: STATUS_CHECK_INTERVAL - (currentTime - context.getLastStatusCheckTime());
+	auto delta = getDelayUntilStatusRequest(context, currentTime);
 	if (delta > 0 && !context.isShutdownRequested())
 	{
 		context.sleep(delta);
@@ -66,6 +65,41 @@ void BeaconSendingCaptureOffState::doExecute(IBeaconSendingContext& context)
 			return;
 		}
 	}
+
+	sendStatusRequest(context, currentTime);
+}
+
+int64_t BeaconSendingCaptureOffState::doPrepareExecution(IBeaconSendingContext& context)
+{
+	// disable capturing - avoid collecting further data
+	context.disableCaptureAndClear();
+
+	mPreparedTimestamp = context.getCurrentTimestamp();
+	mPreparedDelay = getDelayUntilStatusRequest(context, mPreparedTimestamp);
+
+	return std::max(mPreparedDelay, int64_t(0));
+}
+
+void BeaconSendingCaptureOffState::doExecutePrepared(IBeaconSendingContext& context)
+{
+	if (mPreparedDelay > 0 && context.isShutdownRequested())
+	{
+		// shutdown was requested while waiting - do not send any status request
+		return;
+	}
+
+	sendStatusRequest(context, mPreparedTimestamp);
+}
+
+int64_t BeaconSendingCaptureOffState::getDelayUntilStatusRequest(IBeaconSendingContext& context, int64_t currentTime) const
+{
+	return mSleepTimeInMilliseconds > int64_t(0)
+		? mSleepTimeInMilliseconds
+		: STATUS_CHECK_INTERVAL - (currentTime - context.getLastStatusCheckTime());
+}
+
+void BeaconSendingCaptureOffState::sendStatusRequest(IBeaconSendingContext& context, int64_t currentTime)
+{
 	auto statusResponse = BeaconSendingRequestUtil::sendStatusRequest(
 		context,
 		STATUS_REQUEST_RETRIES,
@@ -59,6 +59,10 @@ namespace core
 
 			void doExecute(IBeaconSendingContext& context) override;
 
+			int64_t doPrepareExecution(IBeaconSendingContext& context) override;
+
+			void doExecutePrepared(IBeaconSendingContext& context) override;
+
 			std::shared_ptr<IBeaconSendingState> getShutdownState() override;
 
 			const char* getStateName() const override;
@@ -74,11 +78,31 @@ namespace core
 			int64_t getSleepTimeInMilliseconds() const;
 
 		private:
+			///
+			/// Returns the time to wait until the next status request is sent.
+			/// @param[in] context the state context
+			/// @param[in] currentTime the current timestamp in milliseconds
+			///
+			int64_t getDelayUntilStatusRequest(IBeaconSendingContext& context, int64_t currentTime) const;
+
+			///
+			/// Sends the status request and handles its response.
+			/// @param[in] context the state context
+			/// @param[in] currentTime the timestamp stored as last status check time
+			///
+			static void sendStatusRequest(IBeaconSendingContext& context, int64_t currentTime);
+
 			/// Handle the status response received from the server and transition the states accordingly
 			static void handleStatusResponse(IBeaconSendingContext& context, std::shared_ptr<protocol::IStatusResponse> statusResponse);
 
 			/// Sleep time in milliseconds
 			int64_t mSleepTimeInMilliseconds;
+
+			/// timestamp taken in @ref doPrepareExecution(IBeaconSendingContext&)
+			int64_t mPreparedTimestamp;
+
+			/// delay returned by @ref doPrepareExecution(IBeaconSendingContext&)
+			int64_t mPreparedDelay;
 		};
 	}
 }
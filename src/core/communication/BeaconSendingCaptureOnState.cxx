@@ -46,6 +46,28 @@ void BeaconSendingCaptureOnState::doExecute(IBeaconSendingContext& context)
 		return;
 	}
 
+	sendSessions(context);
+}
+
+int64_t BeaconSendingCaptureOnState::doPrepareExecution(IBeaconSendingContext& /* context */)
+{
+	return BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.count();
+}
+
+void BeaconSendingCaptureOnState::doExecutePrepared(IBeaconSendingContext& context)
+{
+	if (context.isShutdownRequested())
+	{
+		// shutdown was requested while waiting
+		// return and let the base class handle this
+		return;
+	}
+
+	sendSessions(context);
+}
+
+void BeaconSendingCaptureOnState::sendSessions(IBeaconSendingContext& context)
+{
 	// sned new session request for all sessions that are new
 	auto newSessionsResponse = sendNewSessionRequests(context);
 	if (BeaconSendingResponseUtil::isTooManyRequestsResponse(newSessionsResponse))
@@ -52,11 +52,21 @@ namespace core
 
 			void doExecute(IBeaconSendingContext& context) override;
 
+			int64_t doPrepareExecution(IBeaconSendingContext& context) override;
+
+			void doExecutePrepared(IBeaconSendingContext& context) override;
+
 			std::shared_ptr<IBeaconSendingState> getShutdownState() override;
 
 			const char* getStateName() const override;
 
 		private:
+			///
+			/// Send new session requests, finished and open sessions and handle the last status response.
+			/// @param[in] context the state context
+			///
+			void sendSessions(IBeaconSendingContext& context);
+
 			///
 			/// Send all sessions which have been finished previously.
 			/// @param[in] context the state context
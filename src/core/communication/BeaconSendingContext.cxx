@@ -28,11 +28,23 @@ using namespace core::communication;
 
 const std::chrono::milliseconds BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS(std::chrono::seconds(1));
 
+namespace
+{
+	std::shared_ptr<protocol::IResponseAttributes> loadResponseAttributes(
+		std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore
+	)
+	{
+		return responseAttributesStore != nullptr ? responseAttributesStore->load() : nullptr;
+	}
+}
+
 BeaconSendingContext::BeaconSendingContext(
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfig,
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
 	std::unique_ptr<IBeaconSendingState> initialState
 )
 	: mLogger(logger)
@@ -40,6 +52,12 @@ BeaconSendingContext::BeaconSendingContext(
 	, mNextState(nullptr)
 	, mShutdown(false)
 	, mShutdownMutex()
+	, mShutdownDeadline(std::chrono::steady_clock::time_point::max())
+	, mNumFlushedRecords(0)
+	, mNumDroppedRecords(0)
+	, mIsFlushFinished(false)
+	, mFlushMutex()
+	, mTaskExecutor(nullptr)
 	, mSleepConditionVariable()
 	, mInitSucceeded(false)
 	, mServerConfiguration(core::configuration::ServerConfiguration::DEFAULT)
@@ -49,9 +67,30 @@ BeaconSendingContext::BeaconSendingContext(
 	, mLastStatusCheckTime(0)
 	, mLastOpenSessionBeaconSendTime(0)
 	, mLastResponseAttributes(protocol::ResponseAttributes::withUndefinedDefaults().build())
+	, mResponseAttributesStore(responseAttributesStore)
+	, mWarmStartServerConfiguration(nullptr)
+	, mIsWarmStartActive(false)
+	, mWarmStartMutex()
+	, mMetricsRegistry(metricsRegistry)
 	, mInitCountdownLatch(1)
 	, mSessions()
 {
+	auto storedAttributes = loadResponseAttributes(responseAttributesStore);
+	if (storedAttributes != nullptr)
+	{
+		if (mLogger->isInfoEnabled())
+		{
+			mLogger->info("BeaconSendingContext - warm start with stored server configuration");
+		}
+
+		mLastResponseAttributes = mLastResponseAttributes->merge(storedAttributes);
+		mWarmStartServerConfiguration = core::configuration::ServerConfiguration::Builder(mLastResponseAttributes).build();
+		mServerConfiguration = mWarmStartServerConfiguration;
+		mIsWarmStartActive = true;
+		mHTTPClientConfiguration = core::configuration::HTTPClientConfiguration::Builder(mHTTPClientConfiguration)
+			.withServerID(mServerConfiguration->getServerId())
+			.build();
+	}
 }
 
 BeaconSendingContext::BeaconSendingContext
@@ -59,13 +98,17 @@ BeaconSendingContext::BeaconSendingContext
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfig,
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
-	std::shared_ptr<providers::ITimingProvider> timingProvider
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 )
 : BeaconSendingContext(
 	logger,
 	httpClientConfig,
 	httpClientProvider,
 	timingProvider,
+	responseAttributesStore,
+	metricsRegistry,
 	std::unique_ptr<IBeaconSendingState>(new BeaconSendingInitialState())
 )
 {
@@ -73,9 +116,61 @@ BeaconSendingContext::BeaconSendingContext
 
 void BeaconSendingContext::executeCurrentState()
 {
+	auto startTime = mMetricsRegistry != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
 	mNextState = nullptr;
 	mCurrentState->execute(*this);
 
+	recordTimeInState(mCurrentState->getStateType(), startTime);
+	switchToNextState();
+}
+
+int64_t BeaconSendingContext::prepareCurrentState()
+{
+	return mCurrentState->prepareExecution(*this);
+}
+
+void BeaconSendingContext::executePreparedState()
+{
+	auto startTime = mMetricsRegistry != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+	mNextState = nullptr;
+	mCurrentState->executePrepared(*this);
+
+	recordTimeInState(mCurrentState->getStateType(), startTime);
+	switchToNextState();
+}
+
+void BeaconSendingContext::recordTimeInState(IBeaconSendingState::StateType stateType, std::chrono::steady_clock::time_point startTime)
+{
+	if (mMetricsRegistry == nullptr)
+	{
+		return;
+	}
+
+	auto elapsedMillis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+	switch (stateType)
+	{
+	case IBeaconSendingState::StateType::BEACON_SENDING_INIT_STATE:
+		mMetricsRegistry->getTimeInInitialState().add(elapsedMillis);
+		break;
+	case IBeaconSendingState::StateType::BEACON_SENDING_CAPTURE_ON_STATE:
+		mMetricsRegistry->getTimeInCaptureOnState().add(elapsedMillis);
+		break;
+	case IBeaconSendingState::StateType::BEACON_SENDING_CAPTURE_OFF_STATE:
+		mMetricsRegistry->getTimeInCaptureOffState().add(elapsedMillis);
+		break;
+	case IBeaconSendingState::StateType::BEACON_SENDING_FLUSH_SESSIONS_STATE:
+		mMetricsRegistry->getTimeInFlushSessionsState().add(elapsedMillis);
+		break;
+	default:
+		// the terminal state does not do any work
+		break;
+	}
+}
+
+void BeaconSendingContext::switchToNextState()
+{
 	if (mNextState != nullptr && mNextState != mCurrentState)// mCcurrentState->execute(...) can trigger state changes
 	{
 		if (mLogger->isInfoEnabled())
@@ -99,6 +194,61 @@ bool BeaconSendingContext::isShutdownRequested() const
 	return mShutdown;
 }
 
+void BeaconSendingContext::setShutdownDeadline(std::chrono::steady_clock::time_point deadline)
+{
+	{ // synchronized scope
+		std::unique_lock<std::mutex> lock(mShutdownMutex);
+		mShutdownDeadline = deadline;
+	}
+
+	mHTTPClientProvider->setRequestDeadline(deadline);
+}
+
+std::chrono::steady_clock::time_point BeaconSendingContext::getShutdownDeadline() const
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	return mShutdownDeadline;
+}
+
+void BeaconSendingContext::completeSessionFlush(
+	std::shared_ptr<core::objects::SessionInternals> session,
+	size_t numFlushedRecords,
+	size_t numDroppedRecords
+)
+{
+	std::lock_guard<std::mutex> lock(mFlushMutex);
+	if (!mIsFlushFinished)
+	{
+		mNumFlushedRecords += static_cast<int64_t>(numFlushedRecords);
+		mNumDroppedRecords += static_cast<int64_t>(numDroppedRecords);
+	}
+	removeSession(session);
+}
+
+openkit::ShutdownResult BeaconSendingContext::finishFlush(bool isCompleted)
+{
+	std::lock_guard<std::mutex> lock(mFlushMutex);
+	mIsFlushFinished = true;
+
+	// sessions still known to the context were either never flushed or are about to be discarded
+	openkit::ShutdownResult result;
+	result.isCompleted = isCompleted;
+	result.numberOfFlushedRecords = mNumFlushedRecords;
+	result.numberOfDroppedRecords = mNumDroppedRecords + static_cast<int64_t>(getNumberOfUnsentRecords());
+
+	return result;
+}
+
+void BeaconSendingContext::setTaskExecutor(core::util::TaskExecutor* taskExecutor)
+{
+	mTaskExecutor = taskExecutor;
+}
+
+core::util::TaskExecutor* BeaconSendingContext::getTaskExecutor() const
+{
+	return mTaskExecutor;
+}
+
 bool BeaconSendingContext::waitForInit()
 {
 	mInitCountdownLatch.await();
@@ -222,6 +372,10 @@ void BeaconSendingContext::handleStatusResponse(std::shared_ptr<protocol::IStatu
 
 	auto updatedAttributes = updateLastResponseAttributesFrom(response);
 	mServerConfiguration = core::configuration::ServerConfiguration::Builder(updatedAttributes).build();
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mWarmStartMutex);
+		mIsWarmStartActive = false;
+	}
 	if (!isCaptureOn())
 	{
 		// capturing was turned off
@@ -242,6 +396,10 @@ std::shared_ptr<protocol::IResponseAttributes> BeaconSendingContext::updateLastR
 	if (BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
 	{
 		mLastResponseAttributes = mLastResponseAttributes->merge(statusResponse->getResponseAttributes());
+		if (mResponseAttributesStore != nullptr)
+		{
+			mResponseAttributesStore->store(mLastResponseAttributes);
+		}
 	}
 
 	return mLastResponseAttributes;
@@ -260,7 +418,7 @@ void BeaconSendingContext::clearAllSessionData()
 		session->clearCapturedData();
 		if (session->isFinished())
 		{
-			mSessions.remove(session);
+			removeSession(session);
 		}
 	}
 }
@@ -314,6 +472,17 @@ size_t BeaconSendingContext::getSessionCount()
 	return mSessions.size();
 }
 
+size_t BeaconSendingContext::getNumberOfUnsentRecords()
+{
+	size_t numRecords = 0;
+	for (auto session : mSessions.toStdVector())
+	{
+		numRecords += session->getNumberOfRecords();
+	}
+
+	return numRecords;
+}
+
 int32_t BeaconSendingContext::getCurrentServerID() const
 {
 	return mHTTPClientConfiguration->getServerID();
@@ -321,12 +490,30 @@ int32_t BeaconSendingContext::getCurrentServerID() const
 
 void BeaconSendingContext::addSession(std::shared_ptr<core::objects::SessionInternals> session)
 {
-	mSessions.put(session);
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mWarmStartMutex);
+		if (mIsWarmStartActive)
+		{
+			// capture right away with the stored configuration instead of waiting for the new session request
+			session->updateServerConfiguration(mWarmStartServerConfiguration);
+		}
+		mSessions.put(session);
+	}
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getSendingSessions().add(1);
+	}
 }
 
 bool BeaconSendingContext::removeSession(std::shared_ptr<core::objects::SessionInternals> sessionWrapper)
 {
-	return mSessions.remove(sessionWrapper);
+	auto isRemoved = mSessions.remove(sessionWrapper);
+	if (isRemoved && mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getSendingSessions().add(-1);
+	}
+
+	return isRemoved;
 }
 
 IBeaconSendingState::StateType BeaconSendingContext::getCurrentStateType() const
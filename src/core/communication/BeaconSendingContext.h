@@ -21,8 +21,11 @@
 #include "IBeaconSendingState.h"
 #include "OpenKit/ILogger.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
+#include "core/configuration/IResponseAttributesStore.h"
+#include "core/configuration/IServerConfiguration.h"
 #include "core/objects/SessionInternals.h"
 #include "core/util/CountDownLatch.h"
+#include "core/util/MetricsRegistry.h"
 #include "core/util/SynchronizedQueue.h"
 #include "protocol/IStatusResponse.h"
 #include "providers/IHTTPClientProvider.h"
@@ -51,12 +54,16 @@ namespace core
 			/// @param[in] httpClientConfiguration HTTP related configuration details
 			/// @param[in] httpClientProvider provider for HTTPClient objects
 			/// @param[in] timingProvider utility class for timing related stuff
+			/// @param[in] responseAttributesStore store persisting the server configuration, @c nullptr if not persisted
+			/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
 			///
 			BeaconSendingContext(
 				std::shared_ptr<openkit::ILogger> logger,
 				std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 				std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
-				std::shared_ptr<providers::ITimingProvider> timingProvider
+				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+				std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 			);
 
 			///
@@ -65,6 +72,8 @@ namespace core
 			/// @param[in] httpClientConfiguration HTTP related configuration details
 			/// @param[in] httpClientProvider provider for HTTPClient objects
 			/// @param[in] timingProvider utility class for timing related stuff
+			/// @param[in] responseAttributesStore store persisting the server configuration, @c nullptr if not persisted
+			/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
 			/// @param[in] initialState the initial state
 			///
 			BeaconSendingContext(
@@ -72,11 +81,23 @@ namespace core
 				std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 				std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore,
+				std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
 				std::unique_ptr<IBeaconSendingState> initialState
 			);
 
 			~BeaconSendingContext() override = default;
 
+			///
+			/// Delete the copy constructor
+			///
+			BeaconSendingContext(const BeaconSendingContext&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			BeaconSendingContext& operator = (const BeaconSendingContext&) = delete;
+
 			///
 			/// Default sleep time in milliseconds (used by @ref sleep()).
 			///
@@ -84,10 +105,30 @@ namespace core
 
 			void executeCurrentState() override;
 
+			int64_t prepareCurrentState() override;
+
+			void executePreparedState() override;
+
 			void requestShutdown() override;
 
 			bool isShutdownRequested() const override;
 
+			void setShutdownDeadline(std::chrono::steady_clock::time_point deadline) override;
+
+			std::chrono::steady_clock::time_point getShutdownDeadline() const override;
+
+			void completeSessionFlush(
+				std::shared_ptr<core::objects::SessionInternals> session,
+				size_t numFlushedRecords,
+				size_t numDroppedRecords
+			) override;
+
+			openkit::ShutdownResult finishFlush(bool isCompleted) override;
+
+			void setTaskExecutor(core::util::TaskExecutor* taskExecutor) override;
+
+			core::util::TaskExecutor* getTaskExecutor() const override;
+
 			bool waitForInit() override ;
 
 			bool waitForInit(int64_t timeoutMillis) override ;
@@ -142,6 +183,8 @@ namespace core
 
 			size_t getSessionCount() override;
 
+			size_t getNumberOfUnsentRecords() override;
+
 			int32_t getCurrentServerID() const override;
 
 			void addSession(std::shared_ptr<core::objects::SessionInternals> session) override;
@@ -153,6 +196,16 @@ namespace core
 
 		private:
 
+			///
+			/// Performs the state transition requested while executing the current state.
+			///
+			void switchToNextState();
+
+			///
+			/// Records the time spent executing a state of the given type since the given start time.
+			///
+			void recordTimeInState(IBeaconSendingState::StateType stateType, std::chrono::steady_clock::time_point startTime);
+
 			///
 			/// Disable data capturing.
 			///
@@ -175,9 +228,27 @@ namespace core
 			/// Boolean indicating shutdown flag.
 			bool mShutdown;
 
-			/// mutex used for synchronisation access to mShutdown
+			/// mutex used for synchronisation access to mShutdown and mShutdownDeadline
 			mutable std::mutex mShutdownMutex;
 
+			/// point in time until which all sessions must be flushed on shutdown
+			std::chrono::steady_clock::time_point mShutdownDeadline;
+
+			/// number of records sent when flushing the sessions on shutdown
+			int64_t mNumFlushedRecords;
+
+			/// number of records discarded when flushing the sessions on shutdown
+			int64_t mNumDroppedRecords;
+
+			/// flag indicating whether @ref finishFlush was called
+			bool mIsFlushFinished;
+
+			/// mutex protecting the flush accounting, so that no session is counted twice or not at all
+			std::mutex mFlushMutex;
+
+			/// executor running the states of this context, not owned by this context
+			core::util::TaskExecutor* mTaskExecutor;
+
 			/// condition variable used to wait on when calling sleep.
 			std::condition_variable mSleepConditionVariable;
 
@@ -223,6 +294,34 @@ namespace core
 			///
 			std::shared_ptr<protocol::IResponseAttributes> mLastResponseAttributes;
 
+			/// store persisting the last response attributes, @c nullptr if they are not persisted
+			std::shared_ptr<core::configuration::IResponseAttributesStore> mResponseAttributesStore;
+
+			///
+			/// Server configuration loaded from the response attributes store, used to configure new sessions
+			/// before the first status response is received. @c nullptr if nothing was loaded.
+			///
+			/// @remarks
+			/// This field is only modified in the constructor.
+			///
+			std::shared_ptr<core::configuration::IServerConfiguration> mWarmStartServerConfiguration;
+
+			/// flag indicating whether new sessions are still configured with the warm start configuration
+			bool mIsWarmStartActive;
+
+			///
+			/// mutex protecting @ref mIsWarmStartActive
+			///
+			/// @remarks
+			/// Sessions are added to @ref mSessions while holding this mutex, so that a session is either configured
+			/// with the warm start configuration and already known when the first status response is handled,
+			/// or not configured with it at all.
+			///
+			std::mutex mWarmStartMutex;
+
+			/// registry to record metrics in, @c nullptr if statistics are disabled
+			const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+
 			/// countdown latch used for wait-on-initialization
 			core::util::CountDownLatch mInitCountdownLatch;
 
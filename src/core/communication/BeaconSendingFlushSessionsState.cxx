@@ -27,6 +27,8 @@
 
 using namespace core::communication;
 
+constexpr size_t BeaconSendingFlushSessionsState::MAX_FLUSH_THREADS;
+
 BeaconSendingFlushSessionsState::BeaconSendingFlushSessionsState()
 	: AbstractBeaconSendingState(IBeaconSendingState::StateType::BEACON_SENDING_FLUSH_SESSIONS_STATE)
 {
@@ -46,20 +48,35 @@ void BeaconSendingFlushSessionsState::doExecute(IBeaconSendingContext& context)
 		openSession->end();
 	}
 
-	// flush already finished (and previously ended) sessions
-	auto tooManyRequestsReceived = false;
-	for (auto finishedSession : context.getAllFinishedAndConfiguredSessions())
+	// flush already finished (and previously ended) sessions - most important ones first
+	auto finishedSessions = context.getAllFinishedAndConfiguredSessions();
+	std::stable_sort(finishedSessions.begin(), finishedSessions.end(), hasHigherFlushPriority);
+
+	FlushProgress progress(finishedSessions);
+
+	// the most important session is sent alone, to not send further requests after a "too many requests" response
+	flushNextSession(context, progress);
+
+	// idle threads of the executor help sending the remaining sessions
+	// (a single threaded executor is busy executing this state and would never start them)
+	auto taskExecutor = context.getTaskExecutor();
+	auto numRemainingSessions = finishedSessions.empty() ? 0 : finishedSessions.size() - 1;
+	auto numFlushTasks = std::min(MAX_FLUSH_THREADS, numRemainingSessions);
+	if (taskExecutor == nullptr || taskExecutor->getNumberOfThreads() == 1)
 	{
-		if (!tooManyRequestsReceived && finishedSession->isDataSendingAllowed())
-		{
-			auto response = finishedSession->sendBeacon(context.getHTTPClientProvider());
-			if (BeaconSendingResponseUtil::isTooManyRequestsResponse(response))
-			{
-				tooManyRequestsReceived = true;
-			}
-		}
-		finishedSession->clearCapturedData();
-		context.removeSession(finishedSession);
+		numFlushTasks = 0;
+	}
+	std::vector<core::util::TaskExecutor::TaskID> flushTasks;
+	for (size_t i = 1; i < numFlushTasks; i++)
+	{
+		flushTasks.push_back(taskExecutor->schedule([&context, &progress]() { flushSessions(context, progress); }));
+	}
+	flushSessions(context, progress);
+
+	// all sessions are taken, tasks not started yet are discarded, running ones are waited for
+	for (auto flushTask : flushTasks)
+	{
+		taskExecutor->cancel(flushTask);
 	}
 
 	// make last state transition to terminal state
@@ -67,6 +84,60 @@ void BeaconSendingFlushSessionsState::doExecute(IBeaconSendingContext& context)
 	context.setNextState(initState);
 }
 
+bool BeaconSendingFlushSessionsState::hasHigherFlushPriority(
+	const std::shared_ptr<core::objects::SessionInternals>& first,
+	const std::shared_ptr<core::objects::SessionInternals>& second
+)
+{
+	auto firstHasFailures = first->hasReportedFailures();
+	if (firstHasFailures != second->hasReportedFailures())
+	{
+		// sessions containing errors or crashes go first
+		return firstHasFailures;
+	}
+
+	// the oldest data is evicted first from the cache, therefore it is sent first
+	return first->getStartTime() < second->getStartTime();
+}
+
+void BeaconSendingFlushSessionsState::flushSessions(IBeaconSendingContext& context, FlushProgress& progress)
+{
+	while (flushNextSession(context, progress))
+	{
+		// continue with the next session
+	}
+}
+
+bool BeaconSendingFlushSessionsState::flushNextSession(IBeaconSendingContext& context, FlushProgress& progress)
+{
+	auto index = progress.nextSessionIndex++;
+	if (index >= progress.sessions.size())
+	{
+		return false;
+	}
+
+	auto session = progress.sessions[index];
+	auto numRecords = session->getNumberOfRecords();
+
+	if (!progress.tooManyRequestsReceived
+		&& session->isDataSendingAllowed()
+		&& std::chrono::steady_clock::now() < context.getShutdownDeadline())
+	{
+		auto response = session->sendBeacon(context.getHTTPClientProvider());
+		if (BeaconSendingResponseUtil::isTooManyRequestsResponse(response))
+		{
+			progress.tooManyRequestsReceived = true;
+		}
+	}
+
+	// everything not sent so far is lost when clearing the session
+	auto numRecordsNotSent = std::min(session->getNumberOfRecords(), numRecords);
+	context.completeSessionFlush(session, numRecords - numRecordsNotSent, numRecordsNotSent);
+	session->clearCapturedData();
+
+	return true;
+}
+
 std::shared_ptr<IBeaconSendingState> BeaconSendingFlushSessionsState::getShutdownState()
 {
 	return std::make_shared<BeaconSendingTerminalState>();
@@ -20,6 +20,7 @@
 #include "AbstractBeaconSendingState.h"
 #include "IBeaconSendingContext.h"
 
+#include <atomic>
 #include <vector>
 #include <chrono>
 
@@ -30,6 +31,11 @@ namespace core
 		///
 		/// In this state open sessions are finished. After that all sessions are sent to the server.
 		///
+		/// Sessions containing errors or crashes are sent first, older sessions before newer ones. The most important
+		/// session is sent alone, the remaining ones in parallel by up to @ref MAX_FLUSH_THREADS threads of the context's
+		/// task executor.
+		/// Sessions which cannot be sent before the shutdown deadline of the context expires are discarded.
+		///
 		/// Transition to:
 		///   - @ref BeaconSendingTerminalState
 		///
@@ -53,6 +59,55 @@ namespace core
 			std::shared_ptr<IBeaconSendingState> getShutdownState() override;
 
 			const char* getStateName() const override;
+
+			/// maximum number of threads sending sessions in parallel, including the thread executing this state
+			static constexpr size_t MAX_FLUSH_THREADS = 4;
+
+		private:
+
+			///
+			/// Progress of flushing the sessions, shared by all threads sending sessions.
+			///
+			struct FlushProgress
+			{
+				explicit FlushProgress(const std::vector<std::shared_ptr<core::objects::SessionInternals>>& allSessions)
+					: sessions(allSessions)
+					, nextSessionIndex(0)
+					, tooManyRequestsReceived(false)
+				{
+				}
+
+				/// all sessions to send, sorted by priority
+				const std::vector<std::shared_ptr<core::objects::SessionInternals>>& sessions;
+				/// index of the next session to send
+				std::atomic<size_t> nextSessionIndex;
+				/// flag indicating if any thread received a "too many requests" response
+				std::atomic<bool> tooManyRequestsReceived;
+			};
+
+			///
+			/// Compares sessions by their flush priority.
+			/// @returns @c true if @c first has to be sent before @c second
+			///
+			static bool hasHigherFlushPriority(
+				const std::shared_ptr<core::objects::SessionInternals>& first,
+				const std::shared_ptr<core::objects::SessionInternals>& second
+			);
+
+			///
+			/// Sends and removes sessions until all sessions are taken by any thread.
+			/// @param[in] context the beacon sending context
+			/// @param[in,out] progress the progress shared by all threads sending sessions
+			///
+			static void flushSessions(IBeaconSendingContext& context, FlushProgress& progress);
+
+			///
+			/// Sends and removes the next session not taken by any other thread.
+			/// @param[in] context the beacon sending context
+			/// @param[in,out] progress the progress shared by all threads sending sessions
+			/// @returns @c true if a session was taken, @c false if all sessions were already taken
+			///
+			static bool flushNextSession(IBeaconSendingContext& context, FlushProgress& progress);
 		};
 	}
 }
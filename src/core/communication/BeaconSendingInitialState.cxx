@@ -47,6 +47,7 @@ const std::chrono::milliseconds BeaconSendingInitialState::INITIAL_RETRY_SLEEP_T
 BeaconSendingInitialState::BeaconSendingInitialState()
 	: AbstractBeaconSendingState(IBeaconSendingState::StateType::BEACON_SENDING_INIT_STATE)
 	, mReinitializeDelayIndex(0)
+	, mReinitializeDelay(0)
 {
 }
 
@@ -54,6 +55,38 @@ void BeaconSendingInitialState::doExecute(IBeaconSendingContext& context)
 {
 	/// execute the status request until we get a response
 	auto statusResponse = executeStatusRequest(context);
+	completeInitialization(context, statusResponse);
+}
+
+int64_t BeaconSendingInitialState::doPrepareExecution(IBeaconSendingContext& /* context */)
+{
+	return mReinitializeDelay;
+}
+
+void BeaconSendingInitialState::doExecutePrepared(IBeaconSendingContext& context)
+{
+	mReinitializeDelay = 0;
+
+	std::shared_ptr<protocol::IStatusResponse> statusResponse = nullptr;
+	if (!context.isShutdownRequested())
+	{
+		statusResponse = sendStatusRequest(context);
+		if (!BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse) && !context.isShutdownRequested())
+		{
+			// status request needs to be sent again after some delay
+			mReinitializeDelay = getReinitializeDelay(context, statusResponse);
+			return;
+		}
+	}
+
+	completeInitialization(context, statusResponse);
+}
+
+void BeaconSendingInitialState::completeInitialization(
+	IBeaconSendingContext& context,
+	std::shared_ptr<protocol::IStatusResponse> statusResponse
+)
+{
 	if (context.isShutdownRequested())
 	{
 		// shutdown was requested -> abort init with failure
@@ -94,39 +127,52 @@ std::shared_ptr<protocol::IStatusResponse> BeaconSendingInitialState::executeSta
 	std::shared_ptr<protocol::IStatusResponse> statusResponse = nullptr;
 	while (!context.isShutdownRequested())
 	{
-		auto currentTimestamp = context.getCurrentTimestamp();
-		context.setLastOpenSessionBeaconSendTime(currentTimestamp);
-		context.setLastStatusCheckTime(currentTimestamp);
-
-		statusResponse = BeaconSendingRequestUtil::sendStatusRequest(
-			context,
-			MAX_INITIAL_STATUS_REQUEST_RETRIES,
-			INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count()
-		);
+		statusResponse = sendStatusRequest(context);
 		if (BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
 		{
 			// successful status response was received
 			break;
 		}
 
-		int64_t sleepTime = REINIT_DELAY_MILLISECONDS[mReinitializeDelayIndex].count();
-		if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
-		{
-			// in case of too many requests the server might send us a retry-after
-			sleepTime = statusResponse->getRetryAfterInMilliseconds();
+		// status request needs to be sent again after some delay
+		context.sleep(getReinitializeDelay(context, statusResponse));
+	}
 
-			// also temporarily disable capturing to avoid further server overloading
-			context.disableCaptureAndClear();
-		}
+	return statusResponse;
+}
 
-		// status request needs to be sent again after some delay
-		context.sleep(sleepTime);
+std::shared_ptr<protocol::IStatusResponse> BeaconSendingInitialState::sendStatusRequest(IBeaconSendingContext& context)
+{
+	auto currentTimestamp = context.getCurrentTimestamp();
+	context.setLastOpenSessionBeaconSendTime(currentTimestamp);
+	context.setLastStatusCheckTime(currentTimestamp);
+
+	return BeaconSendingRequestUtil::sendStatusRequest(
+		context,
+		MAX_INITIAL_STATUS_REQUEST_RETRIES,
+		INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count()
+	);
+}
+
+int64_t BeaconSendingInitialState::getReinitializeDelay(
+	IBeaconSendingContext& context,
+	std::shared_ptr<protocol::IStatusResponse> statusResponse
+)
+{
+	int64_t sleepTime = REINIT_DELAY_MILLISECONDS[mReinitializeDelayIndex].count();
+	if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
+	{
+		// in case of too many requests the server might send us a retry-after
+		sleepTime = statusResponse->getRetryAfterInMilliseconds();
 
-		mReinitializeDelayIndex = std::min(
-			mReinitializeDelayIndex + 1,
-			uint32_t(REINIT_DELAY_MILLISECONDS.size() - 1)
-		); // ensure no out of bounds
+		// also temporarily disable capturing to avoid further server overloading
+		context.disableCaptureAndClear();
 	}
 
-	return statusResponse;
+	mReinitializeDelayIndex = std::min(
+		mReinitializeDelayIndex + 1,
+		uint32_t(REINIT_DELAY_MILLISECONDS.size() - 1)
+	); // ensure no out of bounds
+
+	return sleepTime;
 }
@@ -54,6 +54,10 @@ namespace core
 
 			void doExecute(IBeaconSendingContext& context) override;
 
+			int64_t doPrepareExecution(IBeaconSendingContext& context) override;
+
+			void doExecutePrepared(IBeaconSendingContext& context) override;
+
 			std::shared_ptr<IBeaconSendingState> getShutdownState() override;
 
 			const char* getStateName() const override;
@@ -73,10 +77,36 @@ namespace core
 			///
 			std::shared_ptr<protocol::IStatusResponse> executeStatusRequest(IBeaconSendingContext& context);
 
+			///
+			/// Execute a single status request including its retries.
+			/// @param context The state's context
+			/// @return The received status response
+			///
+			static std::shared_ptr<protocol::IStatusResponse> sendStatusRequest(IBeaconSendingContext& context);
+
+			///
+			/// Returns the delay before the next status request after an unsuccessful one and advances the re-initialize delays.
+			/// @param context The state's context
+			/// @param statusResponse The unsuccessful status response
+			///
+			int64_t getReinitializeDelay(IBeaconSendingContext& context, std::shared_ptr<protocol::IStatusResponse> statusResponse);
+
+			///
+			/// Completes the initialization after a successful status response or a shutdown request.
+			/// @param context The state's context
+			/// @param statusResponse The last received status response
+			///
+			static void completeInitialization(IBeaconSendingContext& context, std::shared_ptr<protocol::IStatusResponse> statusResponse);
+
 			///
 			/// Index to re-initialize delays
 			///
 			uint32_t mReinitializeDelayIndex;
+
+			///
+			/// Delay returned by @ref doPrepareExecution(IBeaconSendingContext&) after an unsuccessful status request
+			///
+			int64_t mReinitializeDelay;
 		};
 	}
 }
@@ -18,12 +18,15 @@
 #define _CORE_COMMUNICATION_IBEACONSENDINGCONTEXT_H
 
 #include "IBeaconSendingState.h"
+#include "OpenKit/ShutdownResult.h"
 #include "core/objects/SessionInternals.h"
+#include "core/util/TaskExecutor.h"
 #include "protocol/IHTTPClient.h"
 #include "protocol/IStatusResponse.h"
 #include "protocol/IResponseAttributes.h"
 #include "providers/IHTTPClientProvider.h"
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 
@@ -42,6 +45,18 @@ namespace core
 			///
 			virtual void executeCurrentState() = 0;
 
+			///
+			/// Prepares the execution of the current state without blocking.
+			///
+			/// @returns the number of milliseconds to wait before @ref executePreparedState() shall be called
+			///
+			virtual int64_t prepareCurrentState() = 0;
+
+			///
+			/// Executes the current state, which was previously prepared by @ref prepareCurrentState()
+			///
+			virtual void executePreparedState() = 0;
+
 			///
 			/// Request shutdown
 			///
@@ -53,6 +68,62 @@ namespace core
 			///
 			virtual bool isShutdownRequested() const = 0;
 
+			///
+			/// Sets the point in time until which sending the remaining data has to be finished on shutdown.
+			///
+			/// The deadline also bounds all HTTP requests, which are sent after calling this method.
+			/// @param[in] deadline the point in time until which all sessions must be flushed
+			///
+			virtual void setShutdownDeadline(std::chrono::steady_clock::time_point deadline) = 0;
+
+			///
+			/// Returns the deadline set via @ref setShutdownDeadline.
+			/// @returns the shutdown deadline or @c std::chrono::steady_clock::time_point::max() if none was set
+			///
+			virtual std::chrono::steady_clock::time_point getShutdownDeadline() const = 0;
+
+			///
+			/// Accounts the records of a session flushed on shutdown and removes the session from this context.
+			///
+			/// @remarks
+			/// Records of sessions completed after @ref finishFlush was called are not accounted anymore.
+			///
+			/// @param[in] session the flushed session
+			/// @param[in] numFlushedRecords number of records sent successfully
+			/// @param[in] numDroppedRecords number of records which could not be sent
+			///
+			virtual void completeSessionFlush(
+				std::shared_ptr<core::objects::SessionInternals> session,
+				size_t numFlushedRecords,
+				size_t numDroppedRecords
+			) = 0;
+
+			///
+			/// Ends the accounting of the records flushed on shutdown.
+			///
+			/// This method is called once the flush has completed or, if the shutdown deadline expired, is abandoned.
+			/// The records of all sessions which are not completely flushed at that point are counted as dropped.
+			///
+			/// @param[in] isCompleted flag indicating whether the flush has completed
+			/// @returns the number of records flushed and dropped on shutdown
+			///
+			virtual openkit::ShutdownResult finishFlush(bool isCompleted) = 0;
+
+			///
+			/// Sets the executor running the beacon sending states of this context.
+			///
+			/// @remarks
+			/// The executor is not owned by this context. It outlives the execution of every state, since it executes them.
+			///
+			/// @param[in] taskExecutor the executor running the states
+			///
+			virtual void setTaskExecutor(core::util::TaskExecutor* taskExecutor) = 0;
+
+			///
+			/// Returns the executor set via @ref setTaskExecutor, @c nullptr if none was set.
+			///
+			virtual core::util::TaskExecutor* getTaskExecutor() const = 0;
+
 			///
 			/// Blocking method waiting until initialization finished
 			/// @return @c true if initialization succeeded, @c false if initialization failed
@@ -227,6 +298,11 @@ namespace core
 			///
 			virtual size_t getSessionCount() = 0;
 
+			///
+			/// Returns the number of records of all sessions currently known to this context, which are not sent yet.
+			///
+			virtual size_t getNumberOfUnsentRecords() = 0;
+
 			///
 			/// Returns the current server ID to be used for creating new sessions.
 			///
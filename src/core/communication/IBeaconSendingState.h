@@ -17,6 +17,7 @@
 #ifndef _CORE_COMMUNICATION_IBEACONSENDINGSTATE_H
 #define _CORE_COMMUNICATION_IBEACONSENDINGSTATE_H
 
+#include <cstdint>
 #include <memory>
 
 namespace core
@@ -49,6 +50,25 @@ namespace core
 			///
 			virtual void execute(IBeaconSendingContext& context) = 0;
 
+			///
+			/// Prepares the execution of the current state without blocking the calling thread.
+			///
+			/// Instead of sleeping inside @ref execute(IBeaconSendingContext&) the state returns the time it wants to
+			/// wait before its actual work is done. The caller is responsible for waiting and calling
+			/// @ref executePrepared(IBeaconSendingContext&) afterwards, or earlier if shutdown was requested.
+			/// @param[in] context the @ref BeaconSendingContext that takes care of state transitions
+			/// @returns the number of milliseconds to wait before executing the prepared state, @c 0 for no delay
+			///
+			virtual int64_t prepareExecution(IBeaconSendingContext& context) = 0;
+
+			///
+			/// Executes the current state after it was prepared by @ref prepareExecution(IBeaconSendingContext&).
+			///
+			/// In case shutdown was requested, a state transition is performed by this method to the @ref AbstractBeaconSendingState returned by @ref AbstractBeaconSendingState::getShutdownState().
+			/// @param[in] context the @ref BeaconSendingContext that takes care of state transitions
+			///
+			virtual void executePrepared(IBeaconSendingContext& context) = 0;
+
 			///
 			/// Get an instance of the {@ref AbstractBeaconSendingState} to which a transition is made upon shutdown request.
 			/// @returns the follow-up state taking care of the shutdown
@@ -25,6 +25,13 @@ BeaconCacheConfiguration::BeaconCacheConfiguration(openkit::IOpenKitBuilder& bui
 {
 }
 
+BeaconCacheConfiguration::BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound)
+	: mMaxRecordAge(maxRecordAge)
+	, mCacheSizeLowerBound(cacheSizeLowerBound)
+	, mCacheSizeUpperBound(cacheSizeUpperBound)
+{
+}
+
 std::shared_ptr<IBeaconCacheConfiguration> BeaconCacheConfiguration::from(
 		openkit::IOpenKitBuilder& builder)
 {
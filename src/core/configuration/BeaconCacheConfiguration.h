@@ -39,6 +39,14 @@ namespace core
 			///
 			BeaconCacheConfiguration(openkit::IOpenKitBuilder& builder);
 
+			///
+			/// Constructor
+			/// @param[in] maxRecordAge maximum record age in milliseconds
+			/// @param[in] cacheSizeLowerBound lower memory limit for the cache in bytes
+			/// @param[in] cacheSizeUpperBound upper memory limit for the cache in bytes
+			///
+			BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound);
+
 			///
 			/// Creates a beacon cache configuration from the given OpenKit builder.
 			///
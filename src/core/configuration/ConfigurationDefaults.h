@@ -64,6 +64,26 @@ namespace core
 		/// Specifies the default multiplicity.
 		///
 		static constexpr int32_t DEFAULT_MULTIPLICITY = 1;
+
+		///
+		/// By default reported events are serialized directly on the reporting thread.
+		///
+		static constexpr bool DEFAULT_DEFERRED_SERIALIZATION_ENABLED = false;
+
+		///
+		/// By default no statistics about OpenKit's own processing are collected.
+		///
+		static constexpr bool DEFAULT_STATISTICS_ENABLED = false;
+
+		///
+		/// Default number of threads sending beacon data of all OpenKit instances attached to a shared runtime.
+		///
+		static constexpr int32_t DEFAULT_NUMBER_OF_SENDING_THREADS = 2;
+
+		///
+		/// Default capacity of the ring buffer passing the data of a worker process to the agent process in sidecar mode.
+		///
+		static constexpr int64_t DEFAULT_SIDECAR_RING_CAPACITY_IN_BYTES = 1024 * 1024;						// 1MiB
 	}
 }
 
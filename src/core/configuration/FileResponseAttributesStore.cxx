@@ -0,0 +1,132 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FileResponseAttributesStore.h"
+#include "protocol/JsonResponseParser.h"
+#include "protocol/JsonResponseWriter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+using namespace core::configuration;
+
+namespace
+{
+	///
+	/// Returns a temporary file path next to the given file, unique among all processes storing into the same file
+	///
+	std::string createTemporaryFilePath(const std::string& filePath)
+	{
+		std::random_device randomDevice;
+		std::ostringstream temporaryFilePath;
+		temporaryFilePath << filePath << ".tmp." << std::hex << randomDevice() << randomDevice();
+		return temporaryFilePath.str();
+	}
+}
+
+FileResponseAttributesStore::FileResponseAttributesStore(std::shared_ptr<openkit::ILogger> logger, const std::string& filePath)
+	: mLogger(logger)
+	, mFilePath(filePath)
+	, mMutex()
+	, mLastJson()
+{
+}
+
+std::shared_ptr<protocol::IResponseAttributes> FileResponseAttributesStore::load()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	try
+	{
+		std::ifstream file(mFilePath, std::ios::in | std::ios::binary);
+		if (!file.is_open())
+		{
+			if (mLogger->isDebugEnabled())
+			{
+				mLogger->debug("FileResponseAttributesStore load() - no server configuration stored in '%s'", mFilePath.c_str());
+			}
+			return nullptr;
+		}
+
+		std::ostringstream content;
+		content << file.rdbuf();
+		auto json = content.str();
+
+		auto attributes = protocol::JsonResponseParser::parse(core::UTF8String(json));
+		mLastJson = json;
+		return attributes;
+	}
+	catch (const std::exception& exception)
+	{
+		// a broken file must never prevent OpenKit from starting with the default configuration
+		mLogger->warning("FileResponseAttributesStore load() - ignoring invalid server configuration in '%s': %s",
+			mFilePath.c_str(), exception.what());
+		return nullptr;
+	}
+	catch (...)
+	{
+		mLogger->warning("FileResponseAttributesStore load() - ignoring unreadable server configuration in '%s'",
+			mFilePath.c_str());
+		return nullptr;
+	}
+}
+
+bool FileResponseAttributesStore::store(std::shared_ptr<protocol::IResponseAttributes> attributes)
+{
+	if (attributes == nullptr)
+	{
+		return false;
+	}
+
+	auto json = protocol::JsonResponseWriter::write(*attributes).getStringData();
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (json == mLastJson)
+	{
+		return true;
+	}
+
+	auto temporaryFilePath = createTemporaryFilePath(mFilePath);
+	{
+		std::ofstream file(temporaryFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+		file << json;
+		file.flush();
+		if (!file.good())
+		{
+			mLogger->warning("FileResponseAttributesStore store() - failed to write '%s'", temporaryFilePath.c_str());
+			std::remove(temporaryFilePath.c_str());
+			return false;
+		}
+	}
+
+	if (std::rename(temporaryFilePath.c_str(), mFilePath.c_str()) != 0)
+	{
+		// some platforms do not replace an existing file when renaming
+		std::remove(mFilePath.c_str());
+		if (std::rename(temporaryFilePath.c_str(), mFilePath.c_str()) != 0)
+		{
+			mLogger->warning("FileResponseAttributesStore store() - failed to replace '%s'", mFilePath.c_str());
+			std::remove(temporaryFilePath.c_str());
+			return false;
+		}
+	}
+
+	mLastJson = json;
+	return true;
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CONFIGURATION_FILERESPONSEATTRIBUTESSTORE_H
+#define _CORE_CONFIGURATION_FILERESPONSEATTRIBUTESSTORE_H
+
+#include "IResponseAttributesStore.h"
+#include "OpenKit/ILogger.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace core
+{
+	namespace configuration
+	{
+		///
+		/// Response attributes store keeping the attributes as JSON in a local file.
+		///
+		/// @par
+		/// The file is replaced atomically by writing a temporary file first and renaming it afterwards,
+		/// so that a crash while storing never leaves a truncated file behind. The temporary file name is unique, so that
+		/// several processes storing into the same file do not write into the same temporary file.
+		///
+		class FileResponseAttributesStore : public IResponseAttributesStore
+		{
+		public:
+
+			///
+			/// Constructor
+			///
+			/// @param[in] logger to write traces to
+			/// @param[in] filePath path of the file the response attributes are stored in
+			///
+			FileResponseAttributesStore(std::shared_ptr<openkit::ILogger> logger, const std::string& filePath);
+
+			std::shared_ptr<protocol::IResponseAttributes> load() override;
+
+			bool store(std::shared_ptr<protocol::IResponseAttributes> attributes) override;
+
+		private:
+
+			/// logger to write traces to
+			std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// path of the file the response attributes are stored in
+			const std::string mFilePath;
+
+			/// serializes loading and storing
+			std::mutex mMutex;
+
+			/// JSON last loaded or stored, used to skip writing unchanged attributes
+			std::string mLastJson;
+		};
+	}
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include "core/UTF8String.h"
 
 #include <memory>
+#include <string>
 
 namespace core
 {
@@ -96,6 +97,21 @@ namespace core
 			/// Returns the SSL trust manager
 			///
 			virtual std::shared_ptr<openkit::ISSLTrustManager> getTrustManager() const = 0;
+
+			///
+			/// Returns whether reported events are serialized on the beacon sending thread instead of the reporting thread.
+			///
+			virtual bool isDeferredSerializationEnabled() const = 0;
+
+			///
+			/// Returns whether statistics about OpenKit's own processing are collected.
+			///
+			virtual bool isStatisticsEnabled() const = 0;
+
+			///
+			/// Returns the path of the file the server configuration is persisted in, empty if it is not persisted.
+			///
+			virtual const std::string& getServerConfigurationFile() const = 0;
 		};
 	}
 }
@@ -0,0 +1,56 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CONFIGURATION_IRESPONSEATTRIBUTESSTORE_H
+#define _CORE_CONFIGURATION_IRESPONSEATTRIBUTESSTORE_H
+
+#include "protocol/IResponseAttributes.h"
+
+#include <memory>
+
+namespace core
+{
+	namespace configuration
+	{
+		///
+		/// Keeps the last response attributes received from the server across OpenKit restarts.
+		///
+		class IResponseAttributesStore
+		{
+		public:
+
+			virtual ~IResponseAttributesStore() = default;
+
+			///
+			/// Loads the previously stored response attributes.
+			///
+			/// @return the stored response attributes or @c nullptr if nothing (valid) was stored
+			///
+			virtual std::shared_ptr<protocol::IResponseAttributes> load() = 0;
+
+			///
+			/// Stores the given response attributes, replacing the previously stored ones.
+			///
+			/// @param[in] attributes the response attributes to store
+			/// @return @c true if the attributes are stored, @c false otherwise
+			///
+			virtual bool store(std::shared_ptr<protocol::IResponseAttributes> attributes) = 0;
+		};
+	}
+}
+
+#endif
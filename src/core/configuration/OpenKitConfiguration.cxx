@@ -33,6 +33,10 @@ OpenKitConfiguration::OpenKitConfiguration(openkit::IOpenKitBuilder& builder)
 	, mModelId(builder.getModelID())
 	, mDefaultServerId(builder.getDefaultServerID())
 	, mTrustManager(builder.getTrustManager())
+	// in sidecar mode there is no beacon sending thread, which could serialize the deferred events
+	, mIsDeferredSerializationEnabled(builder.isDeferredSerializationEnabled() && builder.getSidecarDirectory().empty())
+	, mIsStatisticsEnabled(builder.isStatisticsEnabled())
+	, mServerConfigurationFile(builder.getServerConfigurationFile())
 {
 }
 
@@ -106,4 +110,19 @@ int32_t OpenKitConfiguration::getDefaultServerId() const
 std::shared_ptr<openkit::ISSLTrustManager> OpenKitConfiguration::getTrustManager() const
 {
 	return mTrustManager;
-}
\ No newline at end of file
+}
+
+bool OpenKitConfiguration::isDeferredSerializationEnabled() const
+{
+	return mIsDeferredSerializationEnabled;
+}
+
+bool OpenKitConfiguration::isStatisticsEnabled() const
+{
+	return mIsStatisticsEnabled;
+}
+
+const std::string& OpenKitConfiguration::getServerConfigurationFile() const
+{
+	return mServerConfigurationFile;
+}
@@ -79,6 +79,12 @@ namespace core
 
 			std::shared_ptr<openkit::ISSLTrustManager> getTrustManager() const override;
 
+			bool isDeferredSerializationEnabled() const override;
+
+			bool isStatisticsEnabled() const override;
+
+			const std::string& getServerConfigurationFile() const override;
+
 		private:
 
 			/// endpoint URL to send data to
@@ -119,6 +125,15 @@ namespace core
 
 			/// configured SSL trust manager
 			const std::shared_ptr<openkit::ISSLTrustManager> mTrustManager;
+
+			/// flag indicating whether reported events are serialized on the beacon sending thread
+			const bool mIsDeferredSerializationEnabled;
+
+			/// flag indicating whether statistics about OpenKit's own processing are collected
+			const bool mIsStatisticsEnabled;
+
+			/// file the server configuration is persisted in, empty if not persisted
+			const std::string mServerConfigurationFile;
 		};
 	}
 }
@@ -18,6 +18,18 @@
 
 using namespace core::configuration;
 
+namespace
+{
+	protocol::ResponseAttributes::Values readValues(const protocol::IResponseAttributes& responseAttributes)
+	{
+		protocol::ResponseAttributes::AttributeSet setAttributes;
+		protocol::ResponseAttributes::Values values = {};
+		protocol::ResponseAttributes::read(responseAttributes, setAttributes, values);
+
+		return values;
+	}
+}
+
 const std::shared_ptr<IServerConfiguration> ServerConfiguration::DEFAULT = ServerConfiguration::Builder().build();
 
 ServerConfiguration::ServerConfiguration(Builder& builder)
@@ -150,17 +162,22 @@ ServerConfiguration::Builder::Builder()
 }
 
 ServerConfiguration::Builder::Builder(std::shared_ptr<protocol::IResponseAttributes> responseAttributes)
-	: mIsCaptureEnabled(responseAttributes->isCapture())
-	, mIsCrashReportingEnabled(responseAttributes->isCaptureCrashes())
-	, mIsErrorReportingEnabled(responseAttributes->isCaptureErrors())
-	, mSendIntervalInMilliseconds(responseAttributes->getSendIntervalInMilliseconds())
-	, mServerId(responseAttributes->getServerId())
-	, mBeaconSizeInBytes(responseAttributes->getMaxBeaconSizeInBytes())
-	, mMultiplicity(responseAttributes->getMultiplicity())
-	, mMaxSessionDurationInMilliseconds(responseAttributes->getMaxSessionDurationInMilliseconds())
-	, mMaxEventsPerSession(responseAttributes->getMaxEventsPerSession())
-	, mSessionIdleTimeout(responseAttributes->getSessionTimeoutInMilliseconds())
-	, mVisitStoreVersion(responseAttributes->getVisitStoreVersion())
+	: Builder(readValues(*responseAttributes))
+{
+}
+
+ServerConfiguration::Builder::Builder(const protocol::ResponseAttributes::Values& values)
+	: mIsCaptureEnabled(values.isCapture)
+	, mIsCrashReportingEnabled(values.isCaptureCrashes)
+	, mIsErrorReportingEnabled(values.isCaptureErrors)
+	, mSendIntervalInMilliseconds(values.sendIntervalInMilliseconds)
+	, mServerId(values.serverId)
+	, mBeaconSizeInBytes(values.maxBeaconSizeInBytes)
+	, mMultiplicity(values.multiplicity)
+	, mMaxSessionDurationInMilliseconds(values.maxSessionDurationInMilliseconds)
+	, mMaxEventsPerSession(values.maxEventsPerSession)
+	, mSessionIdleTimeout(values.sessionTimeoutInMilliseconds)
+	, mVisitStoreVersion(values.visitStoreVersion)
 {
 }
 
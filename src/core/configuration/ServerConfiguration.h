@@ -19,6 +19,7 @@
 
 #include "core/configuration/IServerConfiguration.h"
 #include "protocol/IResponseAttributes.h"
+#include "protocol/ResponseAttributes.h"
 
 namespace core
 {
@@ -164,6 +165,13 @@ namespace core
 
 			private:
 
+				///
+				/// Creates a new builder instance with pre-initialized fields from the given response attribute values.
+				///
+				/// @param values the response attribute values used for initializing this builder
+				///
+				Builder(const protocol::ResponseAttributes::Values& values);
+
 				bool mIsCaptureEnabled;
 				bool mIsCrashReportingEnabled;
 				bool mIsErrorReportingEnabled;
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SharedBeaconCacheConfiguration.h"
+
+#include <algorithm>
+
+using namespace core::configuration;
+
+SharedBeaconCacheConfiguration::SharedBeaconCacheConfiguration(
+	std::shared_ptr<IBeaconCacheConfiguration> instanceConfiguration,
+	std::shared_ptr<IBeaconCacheConfiguration> globalConfiguration,
+	std::function<int64_t()> numberOfShares
+)
+	: mInstanceConfiguration(instanceConfiguration)
+	, mGlobalConfiguration(globalConfiguration)
+	, mNumberOfShares(numberOfShares)
+{
+}
+
+int64_t SharedBeaconCacheConfiguration::getMaxRecordAge() const
+{
+	return mInstanceConfiguration->getMaxRecordAge();
+}
+
+int64_t SharedBeaconCacheConfiguration::getCacheSizeLowerBound() const
+{
+	return getShare(mGlobalConfiguration->getCacheSizeLowerBound());
+}
+
+int64_t SharedBeaconCacheConfiguration::getCacheSizeUpperBound() const
+{
+	return getShare(mGlobalConfiguration->getCacheSizeUpperBound());
+}
+
+int64_t SharedBeaconCacheConfiguration::getShare(int64_t globalBoundary) const
+{
+	auto numberOfShares = mNumberOfShares();
+	if (numberOfShares <= 1 || globalBoundary <= 0)
+	{
+		return globalBoundary;
+	}
+
+	// never hand out a zero boundary, as this would disable the space eviction strategy
+	return std::max(globalBoundary / numberOfShares, int64_t(1));
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CONFIGURATION_SHAREDBEACONCACHECONFIGURATION_H
+#define _CORE_CONFIGURATION_SHAREDBEACONCACHECONFIGURATION_H
+
+#include "IBeaconCacheConfiguration.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace core
+{
+	namespace configuration
+	{
+		///
+		/// Beacon cache configuration of a single OpenKit instance attached to a shared runtime.
+		///
+		/// The memory boundaries of the runtime are split equally across all attached instances, whereas the
+		/// maximum record age is taken from the instance's own configuration.
+		///
+		class SharedBeaconCacheConfiguration
+			: public IBeaconCacheConfiguration
+		{
+		public:
+			///
+			/// Constructor
+			/// @param[in] instanceConfiguration beacon cache configuration of the OpenKit instance
+			/// @param[in] globalConfiguration configuration holding the memory boundaries of the shared runtime
+			/// @param[in] numberOfShares function returning the number of instances sharing the memory boundaries
+			///
+			SharedBeaconCacheConfiguration(
+				std::shared_ptr<IBeaconCacheConfiguration> instanceConfiguration,
+				std::shared_ptr<IBeaconCacheConfiguration> globalConfiguration,
+				std::function<int64_t()> numberOfShares
+			);
+
+			///
+			/// Get maximum record age of the instance.
+			///
+			int64_t getMaxRecordAge() const override;
+
+			///
+			/// Get the instance's share of the global lower memory limit.
+			///
+			int64_t getCacheSizeLowerBound() const override;
+
+			///
+			/// Get the instance's share of the global upper memory limit.
+			///
+			int64_t getCacheSizeUpperBound() const override;
+
+		private:
+			///
+			/// Divides the given global boundary by the current number of shares.
+			///
+			int64_t getShare(int64_t globalBoundary) const;
+
+			/// beacon cache configuration of the OpenKit instance
+			std::shared_ptr<IBeaconCacheConfiguration> mInstanceConfiguration;
+
+			/// configuration holding the global memory boundaries
+			std::shared_ptr<IBeaconCacheConfiguration> mGlobalConfiguration;
+
+			/// function returning the number of instances sharing the memory boundaries
+			std::function<int64_t()> mNumberOfShares;
+		};
+	}
+}
+
+#endif
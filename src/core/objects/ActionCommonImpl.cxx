@@ -18,8 +18,10 @@
 #include "protocol/IBeacon.h"
 #include "core/objects/LeafAction.h"
 #include "core/objects/WebRequestTracer.h"
+#include "core/util/PoolAllocator.h"
 
 #include <sstream>
+#include <vector>
 
 using namespace core::objects;
 
@@ -53,7 +55,25 @@ std::shared_ptr<openkit::IAction> ActionCommonImpl::enterAction
 	const char* actionName
 )
 {
-	core::UTF8String actionNameString(actionName);
+	return enterActionInternal(rootAction, core::UTF8String(actionName));
+}
+
+std::shared_ptr<openkit::IAction> ActionCommonImpl::enterAction
+(
+	std::shared_ptr<openkit::IRootAction> rootAction,
+	const char* actionName,
+	size_t actionNameLength
+)
+{
+	return enterActionInternal(rootAction, core::UTF8String(actionName, actionNameLength));
+}
+
+std::shared_ptr<openkit::IAction> ActionCommonImpl::enterActionInternal
+(
+	const std::shared_ptr<openkit::IRootAction>& rootAction,
+	const core::UTF8String& actionNameString
+)
+{
 	if (actionNameString.empty())
 	{
 		mLogger->warning("%s enterAction: actionName must not be null or empty", toString().c_str());
@@ -71,7 +91,7 @@ std::shared_ptr<openkit::IAction> ActionCommonImpl::enterAction
 
 		if (!isActionLeft())
 		{
-			auto leafActionImpl = std::make_shared<ActionCommonImpl>(
+			auto leafActionImpl = core::util::allocateShared<ActionCommonImpl>(
 				mLogger,
 				mBeacon,
 				shared_from_this(),
@@ -80,7 +100,7 @@ std::shared_ptr<openkit::IAction> ActionCommonImpl::enterAction
 			);
 			storeChildInList(leafActionImpl);
 
-			auto childAction = std::make_shared<LeafAction>(leafActionImpl, rootAction);
+			auto childAction = core::util::allocateShared<LeafAction>(leafActionImpl, rootAction);
 			return childAction;
 		}
 	}
@@ -90,7 +110,16 @@ std::shared_ptr<openkit::IAction> ActionCommonImpl::enterAction
 
 void ActionCommonImpl::reportEvent(const char* eventName)
 {
-	UTF8String eventNameString(eventName);
+	reportEventInternal(UTF8String(eventName));
+}
+
+void ActionCommonImpl::reportEvent(const char* eventName, size_t eventNameLength)
+{
+	reportEventInternal(UTF8String(eventName, eventNameLength));
+}
+
+void ActionCommonImpl::reportEventInternal(const UTF8String& eventNameString)
+{
 	if (eventNameString.empty())
 	{
 		mLogger->warning("%s reportEvent: eventName must not be null or empty", toString().c_str());
@@ -114,7 +143,16 @@ void ActionCommonImpl::reportEvent(const char* eventName)
 
 void ActionCommonImpl::reportValue(const char* valueName, int32_t value)
 {
-	UTF8String valueNameString(valueName);
+	reportValueInternal(UTF8String(valueName), value);
+}
+
+void ActionCommonImpl::reportValue(const char* valueName, size_t valueNameLength, int32_t value)
+{
+	reportValueInternal(UTF8String(valueName, valueNameLength), value);
+}
+
+void ActionCommonImpl::reportValueInternal(const UTF8String& valueNameString, int32_t value)
+{
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (int): valueName must not be null or empty", toString().c_str());
@@ -143,7 +181,16 @@ void ActionCommonImpl::reportValue(const char* valueName, int32_t value)
 
 void ActionCommonImpl::reportValue(const char* valueName, double value)
 {
-	UTF8String valueNameString(valueName);
+	reportValueInternal(UTF8String(valueName), value);
+}
+
+void ActionCommonImpl::reportValue(const char* valueName, size_t valueNameLength, double value)
+{
+	reportValueInternal(UTF8String(valueName, valueNameLength), value);
+}
+
+void ActionCommonImpl::reportValueInternal(const UTF8String& valueNameString, double value)
+{
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (double): valueName must not be null or empty", toString().c_str());
@@ -171,7 +218,16 @@ void ActionCommonImpl::reportValue(const char* valueName, double value)
 
 void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 {
-	UTF8String valueNameString(valueName);
+	reportValueInternal(UTF8String(valueName), UTF8String(value));
+}
+
+void ActionCommonImpl::reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+{
+	reportValueInternal(UTF8String(valueName, valueNameLength), UTF8String(value, valueLength));
+}
+
+void ActionCommonImpl::reportValueInternal(const UTF8String& valueNameString, const UTF8String& valueString)
+{
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (string): valueName must not be null or empty", toString().c_str());
@@ -179,11 +235,10 @@ void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		UTF8String valueString(value);
 		mLogger->debug("%s reportValue (string) (%s, %s)",
 			toString().c_str(),
 			valueNameString.getStringData().c_str(),
-			(value != nullptr ? valueString.getStringData().c_str() : "null")
+			valueString.getStringData().c_str()
 		);
 	}
 
@@ -193,7 +248,7 @@ void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 
 		if (!isActionLeft())
 		{
-			mBeacon->reportValue(mActionID, valueNameString, value);
+			mBeacon->reportValue(mActionID, valueNameString, valueString);
 		}
 	}
 }
@@ -201,8 +256,16 @@ void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 
 void ActionCommonImpl::reportError(const char* errorName, int32_t errorCode, const char* reason)
 {
-	UTF8String errorNameString(errorName);
-	UTF8String reasonString(reason);
+	reportErrorInternal(UTF8String(errorName), errorCode, UTF8String(reason));
+}
+
+void ActionCommonImpl::reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+{
+	reportErrorInternal(UTF8String(errorName, errorNameLength), errorCode, UTF8String(reason, reasonLength));
+}
+
+void ActionCommonImpl::reportErrorInternal(const UTF8String& errorNameString, int32_t errorCode, const UTF8String& reasonString)
+{
 	if (errorNameString.empty())
 	{
 		mLogger->warning("%s reportError: errorName must not be null or empty", toString().c_str());
@@ -213,7 +276,7 @@ void ActionCommonImpl::reportError(const char* errorName, int32_t errorCode, con
 		mLogger->debug("%s reportError(%s, %d, %s)",
 			toString().c_str(),
 			errorNameString.getStringData().c_str(), errorCode,
-			(reason != nullptr ? reasonString.getStringData().c_str() : "null")
+			reasonString.getStringData().c_str()
 		);
 	}
 
@@ -228,15 +291,102 @@ void ActionCommonImpl::reportError(const char* errorName, int32_t errorCode, con
 	}
 }
 
+namespace
+{
+	bool toEventType(openkit::EventDescriptorType descriptorType, protocol::EventType& eventType)
+	{
+		switch (descriptorType)
+		{
+		case openkit::EventDescriptorType::NAMED_EVENT:
+			eventType = protocol::EventType::NAMED_EVENT;
+			return true;
+		case openkit::EventDescriptorType::VALUE_INT:
+			eventType = protocol::EventType::VALUE_INT;
+			return true;
+		case openkit::EventDescriptorType::VALUE_DOUBLE:
+			eventType = protocol::EventType::VALUE_DOUBLE;
+			return true;
+		case openkit::EventDescriptorType::VALUE_STRING:
+			eventType = protocol::EventType::VALUE_STRING;
+			return true;
+		case openkit::EventDescriptorType::FAILURE_ERROR:
+			eventType = protocol::EventType::FAILURE_ERROR;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+void ActionCommonImpl::reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents)
+{
+	if (events == nullptr || numberOfEvents == 0)
+	{
+		return;
+	}
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s reportEvents(%zu)", toString().c_str(), numberOfEvents);
+	}
+
+	// convert and validate the events before entering the synchronized scope
+	std::vector<protocol::ReportedEvent> reportedEvents;
+	reportedEvents.reserve(numberOfEvents);
+	for (size_t i = 0; i < numberOfEvents; i++)
+	{
+		const auto& event = events[i];
+
+		protocol::EventType eventType;
+		if (!toEventType(event.type, eventType))
+		{
+			mLogger->warning("%s reportEvents: unknown type of event at index %zu", toString().c_str(), i);
+			continue;
+		}
+
+		core::UTF8String name(event.name, event.nameLength);
+		if (name.empty())
+		{
+			mLogger->warning("%s reportEvents: name of event at index %zu must not be null or empty", toString().c_str(), i);
+			continue;
+		}
+
+		protocol::ReportedEvent reportedEvent(eventType, name);
+		reportedEvent.intValue = event.intValue;
+		reportedEvent.doubleValue = event.doubleValue;
+		reportedEvent.stringValue = core::UTF8String(event.stringValue, event.stringValueLength);
+		reportedEvents.push_back(std::move(reportedEvent));
+	}
+
+	// synchronized scope
+	{
+		std::lock_guard<Mutex_t> lock(mMutex);
+
+		if (!isActionLeft())
+		{
+			mBeacon->reportEvents(mActionID, reportedEvents);
+		}
+	}
+}
+
 std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequest(const char* url)
 {
-	core::UTF8String urlString(url);
+	return traceWebRequestInternal(core::UTF8String(url));
+}
+
+std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequest(const char* url, size_t urlLength)
+{
+	return traceWebRequestInternal(core::UTF8String(url, urlLength));
+}
+
+std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequestInternal(const core::UTF8String& urlString)
+{
 	if (urlString.empty())
 	{
 		mLogger->warning("%s traceWebRequest (string): url must not be null or empty", toString().c_str());
 		return NullWebRequestTracer::INSTANCE;
 	}
-	if (!WebRequestTracer::isValidURLScheme(urlString))
+	auto urlLengthWithoutQuery = WebRequestTracer::getLengthWithoutQuery(urlString);
+	if (urlLengthWithoutQuery == std::string::npos)
 	{
 		mLogger->warning("%s traceWebRequest (string): url \"%s\" does not have a valid scheme",
 			toString().c_str(),
@@ -255,7 +405,13 @@ std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequest(co
 
 		if (!isActionLeft())
 		{
-			auto tracer = std::make_shared<core::objects::WebRequestTracer>(mLogger, shared_from_this(), mBeacon, urlString);
+			auto tracer = core::util::allocateShared<core::objects::WebRequestTracer>(
+				mLogger,
+				shared_from_this(),
+				mBeacon,
+				urlString,
+				urlLengthWithoutQuery
+			);
 			storeChildInList(tracer);
 
 			return tracer;
@@ -287,11 +443,7 @@ bool ActionCommonImpl::leaveAction()
 	// close all child objects
 	// Note: at this point it's save to do any further operations outside a mutual exclusive scope
 	// after the action was left, no further child objects must be added
-	auto childObjects = getCopyOfChildObjects();
-	for (auto childObject : childObjects)
-	{
-		childObject->close();
-	}
+	closeChildObjects(mMutex);
 
 	mEndTime = mBeacon->getCurrentTimestamp();
 	mEndSequenceNumber = mBeacon->createSequenceNumber();
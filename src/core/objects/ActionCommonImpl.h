@@ -76,18 +76,39 @@ namespace core
 				const char* actionName
 			) override;
 
+			std::shared_ptr<openkit::IAction> enterAction
+			(
+				std::shared_ptr<openkit::IRootAction>,
+				const char* actionName,
+				size_t actionNameLength
+			) override;
+
 			void reportEvent(const char* eventName) override;
 
+			void reportEvent(const char* eventName, size_t eventNameLength) override;
+
 			void reportValue(const char* valueName, int32_t value) override;
 
+			void reportValue(const char* valueName, size_t valueNameLength, int32_t value) override;
+
 			void reportValue(const char* valueName, double value) override;
 
+			void reportValue(const char* valueName, size_t valueNameLength, double value) override;
+
 			void reportValue(const char* valueName, const char* value) override;
 
+			void reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) override;
+
 			void reportError(const char* errorName, int32_t errorCode, const char* reason) override;
 
+			void reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) override;
+
+			void reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) override;
+
 			bool leaveAction() override;
 
 			bool isActionLeft() const override;
@@ -117,6 +138,24 @@ namespace core
 		private:
 			using Mutex_t = std::mutex;
 
+			std::shared_ptr<openkit::IAction> enterActionInternal
+			(
+				const std::shared_ptr<openkit::IRootAction>& rootAction,
+				const core::UTF8String& actionNameString
+			);
+
+			void reportEventInternal(const core::UTF8String& eventNameString);
+
+			void reportValueInternal(const core::UTF8String& valueNameString, int32_t value);
+
+			void reportValueInternal(const core::UTF8String& valueNameString, double value);
+
+			void reportValueInternal(const core::UTF8String& valueNameString, const core::UTF8String& valueString);
+
+			void reportErrorInternal(const core::UTF8String& errorNameString, int32_t errorCode, const core::UTF8String& reasonString);
+
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequestInternal(const core::UTF8String& urlString);
+
 			/// logger instance
 			std::shared_ptr<openkit::ILogger> mLogger;
 
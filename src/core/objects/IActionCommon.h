@@ -52,6 +52,19 @@ namespace core
 				const char* actionName
 			) = 0;
 
+			///
+			/// Enters an action with the given name of the given length in bytes (only relevant for root actions)
+			///
+			/// @param actionName the action's name
+			/// @param actionNameLength number of bytes of @c actionName
+			/// @return the created / entered action
+			virtual std::shared_ptr<openkit::IAction> enterAction
+			(
+				std::shared_ptr<openkit::IRootAction> rootAction,
+				const char* actionName,
+				size_t actionNameLength
+			) = 0;
+
 			///
 			/// Reports a named event (without any value)
 			///
@@ -63,6 +76,14 @@ namespace core
 			///
 			virtual void reportEvent(const char* eventName) = 0;
 
+			///
+			/// Reports a named event (without any value) whose name is given together with its length in bytes
+			///
+			/// @param eventName the name of the event to report
+			/// @param eventNameLength number of bytes of @c eventName
+			///
+			virtual void reportEvent(const char* eventName, size_t eventNameLength) = 0;
+
 			///
 			/// Adds a key-value pair to the beacon.
 			///
@@ -87,6 +108,34 @@ namespace core
 			///
 			virtual void reportValue(const char* valueName, const char* value) = 0;
 
+			///
+			/// Adds a key-value pair to the beacon, where the name is given together with its length in bytes.
+			///
+			/// @param valueName the name of the reported value
+			/// @param valueNameLength number of bytes of @c valueName
+			/// @param value  the reported value
+			///
+			virtual void reportValue(const char* valueName, size_t valueNameLength, int32_t value) = 0;
+
+			///
+			/// Adds a key-value pair to the beacon, where the name is given together with its length in bytes.
+			///
+			/// @param valueName the name of the reported value
+			/// @param valueNameLength number of bytes of @c valueName
+			/// @param value  the reported value
+			///
+			virtual void reportValue(const char* valueName, size_t valueNameLength, double value) = 0;
+
+			///
+			/// Adds a key-value pair to the beacon, where name and value are given together with their length in bytes.
+			///
+			/// @param valueName the name of the reported value
+			/// @param valueNameLength number of bytes of @c valueName
+			/// @param value  the reported value
+			/// @param valueLength number of bytes of @c value
+			///
+			virtual void reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) = 0;
+
 			///
 			/// Adds an error to the beacon.
 			///
@@ -96,6 +145,25 @@ namespace core
 			///
 			virtual void reportError(const char* errorName, int32_t errorCode, const char* reason) = 0;
 
+			///
+			/// Adds an error to the beacon, where name and reason are given together with their length in bytes.
+			///
+			/// @param errorName the name of the reported error.
+			/// @param errorNameLength number of bytes of @c errorName
+			/// @param errorCode the reported error code.
+			/// @param reason the reason for the error
+			/// @param reasonLength number of bytes of @c reason
+			///
+			virtual void reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) = 0;
+
+			///
+			/// Adds several events, values and errors to the beacon under a single lock of this action.
+			///
+			/// @param events the events to report
+			/// @param numberOfEvents the number of elements in @c events
+			///
+			virtual void reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents) = 0;
+
 			///
 			/// Adds a web request to the beacon.
 			///
@@ -104,6 +172,14 @@ namespace core
 			///
 			virtual std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) = 0;
 
+			///
+			/// Adds a web request to the beacon, where the url is given together with its length in bytes.
+			///
+			/// @param url the url used by the WebRequestTracer
+			/// @param urlLength number of bytes of @c url
+			///
+			virtual std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) = 0;
+
 			///
 			/// Leaves this action.
 			///
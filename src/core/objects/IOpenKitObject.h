@@ -17,26 +17,55 @@
 #ifndef _CORE_OBJECTS_IOPENKITOBJECT_H
 #define _CORE_OBJECTS_IOPENKITOBJECT_H
 
+#include <memory>
+
 namespace core
 {
 	namespace objects
 	{
+		class OpenKitComposite;
+
 		///
 		/// Base interface for all OpenKit related objects.
 		///
+		/// @par
+		/// Each object carries the hook which links it into the child registry of its parent
+		/// @ref OpenKitComposite, so that adding and removing a child does not need any lookup or allocation.
+		///
 		class IOpenKitObject
 		{
 		public:
 
+			///
+			/// Default constructor
+			///
+			IOpenKitObject() = default;
+
 			///
 			/// Destructor
 			///
 			virtual ~IOpenKitObject() = default;
 
+			IOpenKitObject(const IOpenKitObject&) = delete;
+			IOpenKitObject& operator=(const IOpenKitObject&) = delete;
+
 			///
 			/// Closes and finishes up this @ref IOpenKitObject
 			///
 			virtual void close() = 0;
+
+		private:
+
+			friend class OpenKitComposite;
+
+			/// composite in whose child registry this object is linked, @c nullptr if not linked
+			const OpenKitComposite* mRegistryOwner = nullptr;
+
+			/// previous sibling in the child registry
+			IOpenKitObject* mPreviousSibling = nullptr;
+
+			/// next sibling in the child registry, owned by the registry
+			std::shared_ptr<IOpenKitObject> mNextSibling = nullptr;
 		};
 	}
 }
@@ -43,35 +43,135 @@ std::shared_ptr<openkit::IAction> LeafAction::reportEvent(const char* eventName)
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IAction> LeafAction::reportEvent(const char* eventName, size_t eventNameLength)
+{
+	mActionImpl->reportEvent(eventName, eventNameLength);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, int32_t value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, size_t valueNameLength, int32_t value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, double value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, size_t valueNameLength, double value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, const char* value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IAction> LeafAction::reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value, valueLength);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IAction> LeafAction::reportError(const char* errorName, int32_t errorCode, const char* reason)
 {
 	mActionImpl->reportError(errorName, errorCode, reason);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IAction> LeafAction::reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+{
+	mActionImpl->reportError(errorName, errorNameLength, errorCode, reason, reasonLength);
+	return shared_from_this();
+}
+
+openkit::IAction& LeafAction::reportEventRef(const char* eventName)
+{
+	mActionImpl->reportEvent(eventName);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, int32_t value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, double value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, const char* value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportErrorRef(const char* errorName, int32_t errorCode, const char* reason)
+{
+	mActionImpl->reportError(errorName, errorCode, reason);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportEventRef(const char* eventName, size_t eventNameLength)
+{
+	mActionImpl->reportEvent(eventName, eventNameLength);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, size_t valueNameLength, int32_t value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, size_t valueNameLength, double value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportValueRef(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value, valueLength);
+	return *this;
+}
+
+openkit::IAction& LeafAction::reportErrorRef(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+{
+	mActionImpl->reportError(errorName, errorNameLength, errorCode, reason, reasonLength);
+	return *this;
+}
+
+void LeafAction::reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents)
+{
+	mActionImpl->reportEvents(events, numberOfEvents);
+}
+
 std::shared_ptr<openkit::IWebRequestTracer> LeafAction::traceWebRequest(const char* url)
 {
 	return mActionImpl->traceWebRequest(url);
 }
 
+std::shared_ptr<openkit::IWebRequestTracer> LeafAction::traceWebRequest(const char* url, size_t urlLength)
+{
+	return mActionImpl->traceWebRequest(url, urlLength);
+}
+
 std::shared_ptr<openkit::IRootAction> LeafAction::leaveAction()
 {
 	mActionImpl->leaveAction();
@@ -79,16 +79,50 @@ namespace core
 
 			std::shared_ptr<IAction> reportEvent(const char* eventName) override;
 
+			std::shared_ptr<IAction> reportEvent(const char* eventName, size_t eventNameLength) override;
+
 			std::shared_ptr<IAction> reportValue(const char* valueName, int32_t value) override;
 
+			std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, int32_t value) override;
+
 			std::shared_ptr<IAction> reportValue(const char* valueName, double value) override;
 
+			std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, double value) override;
+
 			std::shared_ptr<IAction> reportValue(const char* valueName, const char* value) override;
 
+			std::shared_ptr<IAction> reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) override;
+
 			std::shared_ptr<IAction> reportError(const char* errorName, int32_t errorCode, const char* reason) override;
 
+			std::shared_ptr<IAction> reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) override;
+
+			IAction& reportEventRef(const char* eventName) override;
+
+			IAction& reportValueRef(const char* valueName, int32_t value) override;
+
+			IAction& reportValueRef(const char* valueName, double value) override;
+
+			IAction& reportValueRef(const char* valueName, const char* value) override;
+
+			IAction& reportErrorRef(const char* errorName, int32_t errorCode, const char* reason) override;
+
+			IAction& reportEventRef(const char* eventName, size_t eventNameLength) override;
+
+			IAction& reportValueRef(const char* valueName, size_t valueNameLength, int32_t value) override;
+
+			IAction& reportValueRef(const char* valueName, size_t valueNameLength, double value) override;
+
+			IAction& reportValueRef(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) override;
+
+			IAction& reportErrorRef(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) override;
+
+			void reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) override;
+
 			std::shared_ptr<openkit::IRootAction> leaveAction() override;
 
 			///
@@ -51,31 +51,141 @@ namespace core
 				return shared_from_this();
 			}
 
+			std::shared_ptr<IAction> reportEvent(const char* /*eventName*/, size_t /*eventNameLength*/) override
+			{
+				return shared_from_this();
+			}
+
 			std::shared_ptr<IAction> reportValue(const char* /*valueName*/, int32_t /*value*/) override
 			{
 				return shared_from_this();
 			}
 
+			std::shared_ptr<IAction> reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/) override
+			{
+				return shared_from_this();
+			}
+
 			std::shared_ptr<IAction> reportValue(const char* /*valueName*/, double /*value*/) override
 			{
 				return shared_from_this();
 			}
 
+			std::shared_ptr<IAction> reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/) override
+			{
+				return shared_from_this();
+			}
+
 			std::shared_ptr<IAction> reportValue(const char* /*valueName*/, const char* /*value*/) override
 			{
 				return shared_from_this();
 			}
 
+			std::shared_ptr<IAction> reportValue
+			(
+				const char* /*valueName*/,
+				size_t /*valueNameLength*/,
+				const char* /*value*/,
+				size_t /*valueLength*/
+			) override
+			{
+				return shared_from_this();
+			}
+
 			std::shared_ptr<IAction> reportError(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/) override
 			{
 				return shared_from_this();
 			}
 
+			std::shared_ptr<IAction> reportError
+			(
+				const char* /*errorName*/,
+				size_t /*errorNameLength*/,
+				int32_t /*errorCode*/,
+				const char* /*reason*/,
+				size_t /*reasonLength*/
+			) override
+			{
+				return shared_from_this();
+			}
+
+			IAction& reportEventRef(const char* /*eventName*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef(const char* /*valueName*/, int32_t /*value*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef(const char* /*valueName*/, double /*value*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef(const char* /*valueName*/, const char* /*value*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportErrorRef(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportEventRef(const char* /*eventName*/, size_t /*eventNameLength*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/) override
+			{
+				return *this;
+			}
+
+			IAction& reportValueRef
+			(
+				const char* /*valueName*/,
+				size_t /*valueNameLength*/,
+				const char* /*value*/,
+				size_t /*valueLength*/
+			) override
+			{
+				return *this;
+			}
+
+			IAction& reportErrorRef
+			(
+				const char* /*errorName*/,
+				size_t /*errorNameLength*/,
+				int32_t /*errorCode*/,
+				const char* /*reason*/,
+				size_t /*reasonLength*/
+			) override
+			{
+				return *this;
+			}
+
+			void reportEvents(const openkit::EventDescriptor* /*events*/, size_t /*numberOfEvents*/) override
+			{
+			}
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/) override
 			{
 				return NullWebRequestTracer::INSTANCE;
 			}
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/, size_t /*urlLength*/) override
+			{
+				return NullWebRequestTracer::INSTANCE;
+			}
+
 			std::shared_ptr<openkit::IRootAction> leaveAction() override
 			{
 				return mParentAction;
@@ -20,42 +20,137 @@
 using namespace core::objects;
 
 const std::shared_ptr<NullRootAction> NullRootAction::INSTANCE = std::make_shared<NullRootAction>();
+const std::shared_ptr<NullAction> NullRootAction::CHILD_ACTION = std::make_shared<NullAction>(NullRootAction::INSTANCE);
 
 std::shared_ptr<openkit::IAction> NullRootAction::enterAction(const char* /*actionName*/)
 {
+	if (this == INSTANCE.get())
+	{
+		return CHILD_ACTION;
+	}
+
 	return std::make_shared<NullAction>(shared_from_this());
 }
 
+std::shared_ptr<openkit::IAction> NullRootAction::enterAction(const char* actionName, size_t /*actionNameLength*/)
+{
+	return enterAction(actionName);
+}
+
 std::shared_ptr<openkit::IRootAction> NullRootAction::reportEvent(const char* /*eventName*/)
 {
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> NullRootAction::reportEvent(const char* /*eventName*/, size_t /*eventNameLength*/)
+{
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, int32_t /*value*/)
 {
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/)
+{
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, double /*value*/)
 {
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/)
+{
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, const char* /*value*/)
 {
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> NullRootAction::reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, const char* /*value*/, size_t /*valueLength*/)
+{
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> NullRootAction::reportError(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/)
 {
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> NullRootAction::reportError(const char* /*errorName*/, size_t /*errorNameLength*/, int32_t /*errorCode*/, const char* /*reason*/, size_t /*reasonLength*/)
+{
+	return shared_from_this();
+}
+
+openkit::IRootAction& NullRootAction::reportEventRef(const char* /*eventName*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, int32_t /*value*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, double /*value*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, const char* /*value*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportErrorRef(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportEventRef(const char* /*eventName*/, size_t /*eventNameLength*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, const char* /*value*/, size_t /*valueLength*/)
+{
+	return *this;
+}
+
+openkit::IRootAction& NullRootAction::reportErrorRef(const char* /*errorName*/, size_t /*errorNameLength*/, int32_t /*errorCode*/, const char* /*reason*/, size_t /*reasonLength*/)
+{
+	return *this;
+}
+
+void NullRootAction::reportEvents(const openkit::EventDescriptor* /*events*/, size_t /*numberOfEvents*/)
+{
+}
+
 std::shared_ptr<openkit::IWebRequestTracer> NullRootAction::traceWebRequest(const char* /*url*/)
 {
 	return NullWebRequestTracer::INSTANCE;
 }
 
+std::shared_ptr<openkit::IWebRequestTracer> NullRootAction::traceWebRequest(const char* /*url*/, size_t /*urlLength*/)
+{
+	return NullWebRequestTracer::INSTANCE;
+}
+
 void NullRootAction::leaveAction()
 {
 	// intentionally left empty, due to NullObject pattern
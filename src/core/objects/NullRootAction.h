@@ -32,6 +32,8 @@ namespace core
 {
 	namespace objects
 	{
+		class NullAction;
+
 		///
 		/// This class is returned as RootAction by @ref openkit::IOpenKit::createSession(const char*) when the
 		/// @ref openkit::IOpenKit::shutdown() has been called before.
@@ -44,20 +46,65 @@ namespace core
 
 			static const std::shared_ptr<NullRootAction> INSTANCE;
 
+			///
+			/// Child action returned by @ref enterAction(const char*) of @ref INSTANCE.
+			///
+			/// @par
+			/// Sharing a single instance avoids allocating a new NullAction for every action entered
+			/// after OpenKit has been shut down.
+			///
+			static const std::shared_ptr<NullAction> CHILD_ACTION;
+
 			std::shared_ptr<openkit::IAction> enterAction(const char* /*actionName*/) override;
 
+			std::shared_ptr<openkit::IAction> enterAction(const char* actionName, size_t /*actionNameLength*/) override;
+
 			std::shared_ptr<openkit::IRootAction> reportEvent(const char* /*eventName*/) override;
 
+			std::shared_ptr<openkit::IRootAction> reportEvent(const char* /*eventName*/, size_t /*eventNameLength*/) override;
+
 			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, int32_t /*value*/) override;
 
+			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/) override;
+
 			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, double /*value*/) override;
 
+			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/) override;
+
 			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, const char* /*value*/) override;
 
+			std::shared_ptr<openkit::IRootAction> reportValue(const char* /*valueName*/, size_t /*valueNameLength*/, const char* /*value*/, size_t /*valueLength*/) override;
+
 			std::shared_ptr<openkit::IRootAction> reportError(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/) override;
 
+			std::shared_ptr<openkit::IRootAction> reportError(const char* /*errorName*/, size_t /*errorNameLength*/, int32_t /*errorCode*/, const char* /*reason*/, size_t /*reasonLength*/) override;
+
+			IRootAction& reportEventRef(const char* /*eventName*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, int32_t /*value*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, double /*value*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, const char* /*value*/) override;
+
+			IRootAction& reportErrorRef(const char* /*errorName*/, int32_t /*errorCode*/, const char* /*reason*/) override;
+
+			IRootAction& reportEventRef(const char* /*eventName*/, size_t /*eventNameLength*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, int32_t /*value*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, double /*value*/) override;
+
+			IRootAction& reportValueRef(const char* /*valueName*/, size_t /*valueNameLength*/, const char* /*value*/, size_t /*valueLength*/) override;
+
+			IRootAction& reportErrorRef(const char* /*errorName*/, size_t /*errorNameLength*/, int32_t /*errorCode*/, const char* /*reason*/, size_t /*reasonLength*/) override;
+
+			void reportEvents(const openkit::EventDescriptor* /*events*/, size_t /*numberOfEvents*/) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/, size_t /*urlLength*/) override;
+
 			void leaveAction() override;
 		};
 	}
@@ -27,21 +27,42 @@ std::shared_ptr<openkit::IRootAction> NullSession::enterAction(const char* /*act
 	return NullRootAction::INSTANCE;
 }
 
+std::shared_ptr<openkit::IRootAction> NullSession::enterAction(const char* /*actionName*/, size_t /*actionNameLength*/)
+{
+	return NullRootAction::INSTANCE;
+}
+
 void NullSession::identifyUser(const char* /*userTag*/)
 {
 	// intentionally left empty, due to NullObject pattern
 }
 
+void NullSession::identifyUser(const char* /*userTag*/, size_t /*userTagLength*/)
+{
+	// intentionally left empty, due to NullObject pattern
+}
+
 void NullSession::reportCrash(const char* /*errorName*/, const char* /*reason*/, const char* /*stacktrace*/)
 {
 	// intentionally left empty, due to NullObject pattern
 }
 
+void NullSession::reportCrash(const char* /*errorName*/, size_t /*errorNameLength*/, const char* /*reason*/, size_t /*reasonLength*/,
+	const char* /*stacktrace*/, size_t /*stacktraceLength*/)
+{
+	// intentionally left empty, due to NullObject pattern
+}
+
 std::shared_ptr<openkit::IWebRequestTracer> NullSession::traceWebRequest(const char* /*url*/)
 {
 	return NullWebRequestTracer::INSTANCE;
 }
 
+std::shared_ptr<openkit::IWebRequestTracer> NullSession::traceWebRequest(const char* /*url*/, size_t /*urlLength*/)
+{
+	return NullWebRequestTracer::INSTANCE;
+}
+
 void NullSession::end()
 {
 	// intentionally left empty, due to NullObject pattern
@@ -39,12 +39,21 @@ namespace core
 
 			std::shared_ptr<openkit::IRootAction> enterAction(const char* /*actionName*/) override;
 
+			std::shared_ptr<openkit::IRootAction> enterAction(const char* /*actionName*/, size_t /*actionNameLength*/) override;
+
 			void identifyUser(const char* /*userTag*/) override;
 
+			void identifyUser(const char* /*userTag*/, size_t /*userTagLength*/) override;
+
 			void reportCrash(const char* /*errorName*/, const char* /*reason*/, const char* /*stacktrace*/) override;
 
+			void reportCrash(const char* /*errorName*/, size_t /*errorNameLength*/, const char* /*reason*/, size_t /*reasonLength*/,
+				const char* /*stacktrace*/, size_t /*stacktraceLength*/) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* /*url*/, size_t /*urlLength*/) override;
+
 			void end() override;
 		};
 	}
@@ -18,23 +18,195 @@
 #include "protocol/Beacon.h"
 #include "protocol/HTTPClient.h"
 #include "providers/DefaultHTTPClientProvider.h"
+#include "providers/DefaultPRNGenerator.h"
 #include "providers/DefaultSessionIDProvider.h"
 #include "providers/DefaultTimingProvider.h"
 #include "providers/DefaultThreadIDProvider.h"
 #include "core/BeaconSender.h"
 #include "core/caching/BeaconCache.h"
+#include "core/caching/AttachedBeaconCacheEvictor.h"
 #include "core/caching/BeaconCacheEvictor.h"
+#include "core/caching/NullBeaconCacheEvictor.h"
+#include "core/communication/BeaconSendingFlushSessionsState.h"
 #include "core/configuration/BeaconCacheConfiguration.h"
 #include "core/configuration/BeaconConfiguration.h"
+#include "core/configuration/FileResponseAttributesStore.h"
 #include "core/configuration/HTTPClientConfiguration.h"
 #include "core/configuration/PrivacyConfiguration.h"
 #include "core/configuration/OpenKitConfiguration.h"
 #include "core/objects/NullSession.h"
+#include "core/sidecar/SidecarBeaconCache.h"
+#include "core/sidecar/SidecarBeaconSender.h"
 
+#include <algorithm>
+#include <chrono>
 #include <inttypes.h> // for PRId64 macro
 
 using namespace core::objects;
 
+/// overall time to wait for the beacon sending and cache eviction to finish, unless given explicitly
+constexpr std::chrono::milliseconds SHUTDOWN_TIMEOUT = std::chrono::seconds(10);
+
+namespace
+{
+	std::shared_ptr<core::sidecar::SharedMemoryRing> createSidecarRing(openkit::IOpenKitBuilder& builder)
+	{
+		if (builder.getSidecarDirectory().empty())
+		{
+			return nullptr;
+		}
+
+		auto path = core::sidecar::SharedMemoryRing::createRingFilePath(builder.getSidecarDirectory());
+		auto ring = core::sidecar::SharedMemoryRing::create(path, static_cast<uint64_t>(builder.getSidecarRingCapacity()));
+		if (ring == nullptr)
+		{
+			auto logger = builder.getLogger();
+			if (logger->isWarningEnabled())
+			{
+				logger->warning("OpenKit() - sidecar ring %s could not be created, data is sent without agent", path.c_str());
+			}
+		}
+
+		return ring;
+	}
+
+	std::shared_ptr<core::util::TaskExecutor> createTaskExecutor(
+		std::shared_ptr<OpenKitRuntime> sharedRuntime,
+		std::shared_ptr<core::sidecar::SharedMemoryRing> sidecarRing
+	)
+	{
+		if (sidecarRing != nullptr)
+		{
+			// the agent process sends beacon data and evicts cached records
+			return nullptr;
+		}
+
+		if (sharedRuntime == nullptr)
+		{
+			// a single thread sends beacon data, the others wait idle until they help flushing sessions on shutdown
+			return std::make_shared<core::util::TaskExecutor>(
+				core::communication::BeaconSendingFlushSessionsState::MAX_FLUSH_THREADS);
+		}
+
+		return sharedRuntime->getTaskExecutor();
+	}
+
+	std::shared_ptr<core::caching::IBeaconCache> createBeaconCache(
+		std::shared_ptr<openkit::ILogger> logger,
+		std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+		std::shared_ptr<core::sidecar::SharedMemoryRing> sidecarRing
+	)
+	{
+		if (sidecarRing != nullptr)
+		{
+			return std::make_shared<core::sidecar::SidecarBeaconCache>(logger, sidecarRing, metricsRegistry);
+		}
+
+		return std::make_shared<core::caching::BeaconCache>(logger, metricsRegistry);
+	}
+
+	std::shared_ptr<core::IBeaconSender> createBeaconSender(
+		std::shared_ptr<openkit::ILogger> logger,
+		std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration,
+		std::shared_ptr<providers::ITimingProvider> timingProvider,
+		std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+		std::shared_ptr<OpenKitRuntime> sharedRuntime,
+		std::shared_ptr<core::sidecar::SharedMemoryRing> sidecarRing,
+		std::shared_ptr<core::util::TaskExecutor> taskExecutor
+	)
+	{
+		if (sidecarRing != nullptr)
+		{
+			return std::make_shared<core::sidecar::SidecarBeaconSender>(
+				logger,
+				sidecarRing,
+				openKitConfiguration->getDefaultServerId()
+			);
+		}
+
+		auto httpClientConfiguration = core::configuration::HTTPClientConfiguration::from(openKitConfiguration);
+		std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore = nullptr;
+		if (!openKitConfiguration->getServerConfigurationFile().empty())
+		{
+			responseAttributesStore = std::make_shared<core::configuration::FileResponseAttributesStore>(
+				logger,
+				openKitConfiguration->getServerConfigurationFile()
+			);
+		}
+
+		if (sharedRuntime == nullptr)
+		{
+			return std::make_shared<core::BeaconSender>(
+				logger,
+				httpClientConfiguration,
+				std::make_shared<providers::DefaultHTTPClientProvider>(nullptr, metricsRegistry),
+				timingProvider,
+				responseAttributesStore,
+				metricsRegistry,
+				std::make_shared<core::BeaconSendingScheduler>(logger, taskExecutor)
+			);
+		}
+
+		return std::make_shared<core::BeaconSender>(
+			logger,
+			httpClientConfiguration,
+			std::make_shared<providers::DefaultHTTPClientProvider>(sharedRuntime->getConnectionPool(), metricsRegistry),
+			timingProvider,
+			responseAttributesStore,
+			metricsRegistry,
+			sharedRuntime->getBeaconSendingScheduler()
+		);
+	}
+
+	std::shared_ptr<core::util::MetricsRegistry> createMetricsRegistry(
+		std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration
+	)
+	{
+		if (!openKitConfiguration->isStatisticsEnabled())
+		{
+			// without a registry the instrumented code skips collecting the statistics
+			return nullptr;
+		}
+
+		return std::make_shared<core::util::MetricsRegistry>();
+	}
+
+	std::shared_ptr<core::caching::IBeaconCacheEvictor> createBeaconCacheEvictor(
+		std::shared_ptr<openkit::ILogger> logger,
+		std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+		openkit::IOpenKitBuilder& builder,
+		std::shared_ptr<providers::ITimingProvider> timingProvider,
+		std::shared_ptr<OpenKitRuntime> sharedRuntime,
+		std::shared_ptr<core::sidecar::SharedMemoryRing> sidecarRing
+	)
+	{
+		if (sidecarRing != nullptr)
+		{
+			// nothing is cached in this process
+			return std::make_shared<core::caching::NullBeaconCacheEvictor>();
+		}
+
+		if (sharedRuntime == nullptr)
+		{
+			// eviction runs on an own thread, so it is not delayed by blocking requests
+			return std::make_shared<core::caching::BeaconCacheEvictor>(
+				logger,
+				beaconCache,
+				core::configuration::BeaconCacheConfiguration::from(builder),
+				timingProvider
+			);
+		}
+
+		return std::make_shared<core::caching::AttachedBeaconCacheEvictor>(
+			logger,
+			beaconCache,
+			core::configuration::BeaconCacheConfiguration::from(builder),
+			timingProvider,
+			sharedRuntime->getBeaconCacheEvictor()
+		);
+	}
+}
+
 // initialize global instance count with 0.
 int32_t OpenKit::gInstanceCount = 0;
 std::mutex OpenKit::gInitLock;
@@ -42,29 +214,19 @@ std::mutex OpenKit::gInitLock;
 OpenKit::OpenKit(
 	openkit::IOpenKitBuilder& builder
 )
-	: mLogger(builder.getLogger())
+	: mSharedRuntime(std::dynamic_pointer_cast<OpenKitRuntime>(builder.getSharedRuntime()))
+	, mSidecarRing(createSidecarRing(builder))
+	, mTaskExecutor(createTaskExecutor(mSharedRuntime, mSidecarRing))
+	, mLogger(builder.getLogger())
 	, mPrivacyConfiguration(core::configuration::PrivacyConfiguration::from(builder))
 	, mOpenKitConfiguration(core::configuration::OpenKitConfiguration::from(builder))
 	, mTimingProvider(std::make_shared<providers::DefaultTimingProvider>())
 	, mThreadIDProvider(std::make_shared<providers::DefaultThreadIDProvider>())
 	, mSessionIDProvider(std::make_shared<providers::DefaultSessionIDProvider>())
-	, mBeaconCache(std::make_shared<core::caching::BeaconCache>(mLogger))
-	, mBeaconSender(
-		std::make_shared<core::BeaconSender>(
-			mLogger,
-			core::configuration::HTTPClientConfiguration::from(mOpenKitConfiguration),
-			std::make_shared<providers::DefaultHTTPClientProvider>(),
-			mTimingProvider
-		)
-	)
-	, mBeaconCacheEvictor(
-		std::make_shared<core::caching::BeaconCacheEvictor>(
-			mLogger,
-			mBeaconCache,
-			core::configuration::BeaconCacheConfiguration::from(builder),
-			mTimingProvider
-		)
-	)
+	, mMetricsRegistry(createMetricsRegistry(mOpenKitConfiguration))
+	, mBeaconCache(createBeaconCache(mLogger, mMetricsRegistry, mSidecarRing))
+	, mBeaconSender(createBeaconSender(mLogger, mOpenKitConfiguration, mTimingProvider, mMetricsRegistry, mSharedRuntime, mSidecarRing, mTaskExecutor))
+	, mBeaconCacheEvictor(createBeaconCacheEvictor(mLogger, mBeaconCache, builder, mTimingProvider, mSharedRuntime, mSidecarRing))
 	, mMutex()
 	, mIsShutdown(0)
 {
@@ -81,14 +243,19 @@ OpenKit::OpenKit(
 	std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
 	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
 	std::shared_ptr<core::IBeaconSender> beaconSender,
-	std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor
+	std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 )
-	: mLogger(logger)
+	: mSharedRuntime(nullptr)
+	, mSidecarRing(nullptr)
+	, mTaskExecutor(nullptr)
+	, mLogger(logger)
 	, mPrivacyConfiguration(privacyConfiguration)
 	, mOpenKitConfiguration(openKitConfiguration)
 	, mTimingProvider(timingProvider)
 	, mThreadIDProvider(threadIDProvider)
 	, mSessionIDProvider(sessionIDProvider)
+	, mMetricsRegistry(metricsRegistry)
 	, mBeaconCache(beaconCache)
 	, mBeaconSender(beaconSender)
 	, mBeaconCacheEvictor(beaconCacheEvictor)
@@ -102,6 +269,11 @@ OpenKit::OpenKit(
 
 OpenKit::~OpenKit()
 {
+	// join the sending and eviction threads and release all curl handles before the global destruction
+	mBeaconCacheEvictor = nullptr;
+	mBeaconSender = nullptr;
+	mTaskExecutor = nullptr;
+
 	globalShutdown();
 }
 
@@ -176,7 +348,9 @@ std::shared_ptr<openkit::ISession> OpenKit::createSession(const char* clientIPAd
 					clientIPAddress,
 					mSessionIDProvider,
 					mThreadIDProvider,
-					mTimingProvider
+					mTimingProvider,
+					std::make_shared<providers::DefaultPRNGenerator>(),
+					mMetricsRegistry
 			);
 			auto newSession = std::make_shared<core::objects::Session>(
 				mLogger,
@@ -201,32 +375,86 @@ std::shared_ptr<openkit::ISession> OpenKit::createSession()
 }
 
 void OpenKit::shutdown()
+{
+	shutdown(SHUTDOWN_TIMEOUT.count());
+}
+
+openkit::ShutdownResult OpenKit::shutdown(int64_t timeoutMillis)
 {
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("OpenKit shutdown requested");
+		mLogger->debug("OpenKit shutdown requested (timeout=%" PRId64 "ms)", timeoutMillis);
 	}
 
+	openkit::ShutdownResult result;
+	result.isCompleted = true;
+	result.numberOfFlushedRecords = 0;
+	result.numberOfDroppedRecords = 0;
+
 	{ // synchronized scope
 		std::lock_guard<std::mutex> lock(mMutex);
 
 		if(mIsShutdown)
 		{
-			return;
+			return result;
 		}
 
 		mIsShutdown = true;
 	}
 
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMillis, int64_t(0)));
+	auto getRemainingTime = [deadline]()
+	{
+		auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+		return std::max(remaining, std::chrono::milliseconds::zero());
+	};
+
 	// close all child objects
-	auto childObjects = getCopyOfChildObjects();
-	for (auto childObject : childObjects)
+	closeChildObjects(mMutex);
+
+	mBeaconCacheEvictor->stop(getRemainingTime());
+	result = mBeaconSender->shutdown(deadline);
+
+	if (mSharedRuntime == nullptr && mTaskExecutor != nullptr)
+	{
+		// the own executor is not needed any more, a shared one is stopped by the runtime
+		if (!mTaskExecutor->shutdown(getRemainingTime()))
+		{
+			mLogger->warning("OpenKit shutdown() - beacon sending and cache eviction not finished in time");
+			result.isCompleted = false;
+		}
+	}
+
+	if (mLogger->isInfoEnabled())
+	{
+		mLogger->info("OpenKit shutdown finished - flushed %" PRId64 " records, dropped %" PRId64 " records",
+			result.numberOfFlushedRecords, result.numberOfDroppedRecords);
+	}
+
+	return result;
+}
+
+openkit::Statistics OpenKit::getStatistics()
+{
+	if (mMetricsRegistry == nullptr)
+	{
+		openkit::Statistics statistics = {};
+		statistics.isEnabled = false;
+		return statistics;
+	}
+
+	auto statistics = mMetricsRegistry->getSnapshot();
+
+	// the cache state is sampled from the cache itself instead of being tracked on every change
+	auto beaconIDs = mBeaconCache->getBeaconIDs();
+	statistics.beaconCacheSizeInBytes = mBeaconCache->getNumBytesInCache();
+	statistics.numberOfCachedSessions = static_cast<int64_t>(beaconIDs->size());
+	for (auto beaconID : *beaconIDs)
 	{
-		childObject->close();
+		statistics.numberOfCachedRecords += static_cast<int64_t>(mBeaconCache->getNumberOfRecords(beaconID));
 	}
 
-	mBeaconCacheEvictor->stop();
-	mBeaconSender->shutdown();
+	return statistics;
 }
 
 void OpenKit::globalInit()
@@ -242,6 +470,7 @@ void OpenKit::globalInit()
 	}
 
 	protocol::HTTPClient::globalInit();
+	protocol::Beacon::globalInit();
 }
 
 void OpenKit::globalShutdown()
@@ -256,6 +485,7 @@ void OpenKit::globalShutdown()
 		return;
 	}
 
+	protocol::Beacon::globalDestroy();
 	protocol::HTTPClient::globalDestroy();
 }
 
@@ -29,12 +29,16 @@
 #include "OpenKit/ILogger.h"
 #include "core/objects/IOpenKitObject.h"
 #include "core/objects/OpenKitComposite.h"
+#include "core/objects/OpenKitRuntime.h"
+#include "core/util/MetricsRegistry.h"
+#include "core/util/TaskExecutor.h"
 #include "providers/ISessionIDProvider.h"
 #include "providers/ITimingProvider.h"
 #include "providers/IThreadIDProvider.h"
 #include "core/caching/IBeaconCache.h"
 #include "core/caching/IBeaconCacheEvictor.h"
 #include "core/IBeaconSender.h"
+#include "core/sidecar/SharedMemoryRing.h"
 
 #include <atomic>
 #include <mutex>
@@ -73,6 +77,7 @@ namespace core
 			/// @param[in] beaconCache cache where beacon data is stored.
 			/// @param[in] beaconSender responsible for sending beacon related data.
 			/// @param[in] beaconCacheEvictor evictor to prevent memory over-consumption due to full cache
+			/// @param[in] metricsRegistry registry collecting statistics, @c nullptr if statistics are disabled
 			///
 			OpenKit(
 				std::shared_ptr<openkit::ILogger> logger,
@@ -83,7 +88,8 @@ namespace core
 				std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
 				std::shared_ptr<core::caching::IBeaconCache> beaconCache,
 				std::shared_ptr<core::IBeaconSender> beaconSender,
-				std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor
+				std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor,
+				std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 			);
 
 			~OpenKit() override;
@@ -107,23 +113,28 @@ namespace core
 
 			void shutdown() override;
 
+			openkit::ShutdownResult shutdown(int64_t timeoutMillis) override;
+
+			openkit::Statistics getStatistics() override;
+
 			void onChildClosed(std::shared_ptr<core::objects::IOpenKitObject> childObject) override;
 
 			void close() override;
 
-		private:
-
 			///
 			/// Method called by the the constructor to perform global initialization.
-			/// @remarks This method does check if global init is necessary.
+			/// @remarks This method does check if global init is necessary. A shared runtime calls it as well,
+			/// since its connection pool has to be released before global destruction.
 			///
-			void globalInit();
+			static void globalInit();
 
 			///
 			/// Method called by the destructor to perform global destruction.
 			/// @remarks This method does check if global destruction is necessary.
 			///
-			void globalShutdown();
+			static void globalShutdown();
+
+		private:
 
 			///
 			/// Helper function to write a message upon instance creation.
@@ -138,6 +149,16 @@ namespace core
 
 		private:
 
+			/// runtime shared with other OpenKit instances, @c nullptr if this instance runs its own thread
+			const std::shared_ptr<OpenKitRuntime> mSharedRuntime;
+
+			/// ring passing all data to the OpenKit agent process, @c nullptr if this instance is not in sidecar mode
+			const std::shared_ptr<core::sidecar::SharedMemoryRing> mSidecarRing;
+
+			/// executor running beacon sending, either the shared runtime's or an own single threaded one,
+			/// @c nullptr in sidecar mode
+			std::shared_ptr<core::util::TaskExecutor> mTaskExecutor;
+
 			/// logging context
 			const std::shared_ptr<openkit::ILogger> mLogger;
 
@@ -156,14 +177,17 @@ namespace core
 			/// session ID provider
 			const std::shared_ptr<providers::ISessionIDProvider> mSessionIDProvider;
 
+			/// registry collecting statistics, @c nullptr if statistics are disabled
+			const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+
 			/// the beacon cache
 			const std::shared_ptr<caching::IBeaconCache> mBeaconCache;
 
 			/// Beacon sender
-			const std::shared_ptr<core::IBeaconSender> mBeaconSender;
+			std::shared_ptr<core::IBeaconSender> mBeaconSender;
 
 			/// beacon cache evictor
-			const std::shared_ptr<caching::IBeaconCacheEvictor> mBeaconCacheEvictor;
+			std::shared_ptr<caching::IBeaconCacheEvictor> mBeaconCacheEvictor;
 
 			std::mutex mMutex;
 
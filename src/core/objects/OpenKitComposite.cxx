@@ -18,22 +18,130 @@
 
 using namespace core::objects;
 
+OpenKitComposite::~OpenKitComposite()
+{
+	// unlink iteratively, releasing the chain recursively might exhaust the stack
+	auto childObject = std::move(mFirstChild);
+	while (childObject != nullptr)
+	{
+		auto nextChildObject = std::move(childObject->mNextSibling);
+		childObject->mPreviousSibling = nullptr;
+		childObject->mRegistryOwner = nullptr;
+		childObject = std::move(nextChildObject);
+	}
+}
+
 std::list<std::shared_ptr<IOpenKitObject>> OpenKitComposite::getCopyOfChildObjects()
 {
-	return mChildren;
+	std::list<std::shared_ptr<IOpenKitObject>> childObjects;
+	for (auto childObject = mFirstChild; childObject != nullptr; childObject = childObject->mNextSibling)
+	{
+		childObjects.push_back(childObject);
+	}
+
+	return childObjects;
+}
+
+size_t OpenKitComposite::getNumberOfChildObjects() const
+{
+	return mNumberOfChildren;
 }
 
 void OpenKitComposite::storeChildInList(std::shared_ptr<IOpenKitObject> childObject)
 {
-	mChildren.push_back(childObject);
+	if (childObject == nullptr || childObject->mRegistryOwner != nullptr)
+	{
+		return;
+	}
+
+	childObject->mRegistryOwner = this;
+	childObject->mPreviousSibling = mLastChild;
+
+	auto newLastChild = childObject.get();
+	if (mLastChild == nullptr)
+	{
+		mFirstChild = std::move(childObject);
+	}
+	else
+	{
+		mLastChild->mNextSibling = std::move(childObject);
+	}
+
+	mLastChild = newLastChild;
+	mNumberOfChildren++;
 }
 
 void OpenKitComposite::removeChildFromList(std::shared_ptr<IOpenKitObject> childObject)
 {
-	mChildren.remove(childObject);
+	if (childObject == nullptr || childObject->mRegistryOwner != this)
+	{
+		return;
+	}
+
+	unlinkChild(*childObject);
+}
+
+std::shared_ptr<IOpenKitObject> OpenKitComposite::removeFirstChildFromList()
+{
+	auto childObject = mFirstChild;
+	if (childObject != nullptr)
+	{
+		unlinkChild(*childObject);
+	}
+
+	return childObject;
+}
+
+void OpenKitComposite::closeChildObjects(std::mutex& mutex)
+{
+	while (true)
+	{
+		std::shared_ptr<IOpenKitObject> childObject;
+		{ // synchronized scope
+			std::lock_guard<std::mutex> lock(mutex);
+
+			childObject = removeFirstChildFromList();
+		}
+
+		if (childObject == nullptr)
+		{
+			return;
+		}
+
+		childObject->close();
+	}
+}
+
+void OpenKitComposite::unlinkChild(IOpenKitObject& childObject)
+{
+	auto previousChild = childObject.mPreviousSibling;
+	auto nextChild = std::move(childObject.mNextSibling);
+
+	if (nextChild != nullptr)
+	{
+		nextChild->mPreviousSibling = previousChild;
+	}
+	else
+	{
+		mLastChild = previousChild;
+	}
+
+	childObject.mPreviousSibling = nullptr;
+	childObject.mRegistryOwner = nullptr;
+	mNumberOfChildren--;
+
+	// caller holds a reference to the child, so it is not released here
+	if (previousChild != nullptr)
+	{
+		previousChild->mNextSibling = std::move(nextChild);
+	}
+	else
+	{
+		mFirstChild = std::move(nextChild);
+	}
 }
 
 int32_t OpenKitComposite::getActionId() const
 {
 	return DEFAULT_ACTION_ID;
-}
\ No newline at end of file
+}
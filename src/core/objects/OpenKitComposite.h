@@ -19,8 +19,10 @@
 
 #include "IOpenKitComposite.h"
 
+#include <cstddef>
 #include <list>
 #include <memory>
+#include <mutex>
 
 namespace core
 {
@@ -30,8 +32,10 @@ namespace core
 		/// A composite base class for OpenKit objects.
 		///
 		/// @par
-		/// It features a container to store child objects.
-		/// The container is not thread safe, thus, synchronization must be taken care of by the implementing class.
+		/// It features a registry to store child objects. The registry is an intrusive doubly linked list using the
+		/// hook embedded in each @ref IOpenKitObject, therefore adding and removing a child is a constant time
+		/// operation. An object can be registered in at most one composite at a time.
+		/// The registry is not thread safe, thus, synchronization must be taken care of by the implementing class.
 		///
 		class OpenKitComposite
 			: public IOpenKitComposite
@@ -43,17 +47,25 @@ namespace core
 			/// Default constructor
 			///
 			OpenKitComposite()
-				: mChildren()
+				: mFirstChild()
+				, mLastChild(nullptr)
+				, mNumberOfChildren(0)
 			{
 			}
 
 			///
-			/// Destructor
+			/// Destructor unlinking all remaining children
 			///
-			~OpenKitComposite() override = default;
+			~OpenKitComposite() override;
 
+			OpenKitComposite(const OpenKitComposite&) = delete;
+			OpenKitComposite& operator=(const OpenKitComposite&) = delete;
+
+			///
+			/// Adds the given child object to the end of the list of children.
 			///
-			/// Adds the given child object to the list of children.
+			/// @par
+			/// If the child object is already registered in a composite, this method has no effect.
 			///
 			/// @param[in] childObject the child object to add.
 			///
@@ -62,6 +74,9 @@ namespace core
 			///
 			/// Removes the given child object from the list of children.
 			///
+			/// @par
+			/// If the child object is not registered in this composite, this method has no effect.
+			///
 			/// @param[in] childObject the child object to remove.
 			///
 			void removeChildFromList(std::shared_ptr<IOpenKitObject> childObject) override;
@@ -71,6 +86,11 @@ namespace core
 			///
 			std::list<std::shared_ptr<IOpenKitObject>> getCopyOfChildObjects() override;
 
+			///
+			/// Returns the number of child objects.
+			///
+			size_t getNumberOfChildObjects() const;
+
 			///
 			/// Abstract method to notify the composite about closing/ending of a child object.
 			///
@@ -93,6 +113,34 @@ namespace core
 
 			void close() override = 0;
 
+		protected: // functions
+
+			///
+			/// Removes the first child object from the list of children and returns it.
+			///
+			/// @return the first child object or @c nullptr if there are no children.
+			///
+			std::shared_ptr<IOpenKitObject> removeFirstChildFromList();
+
+			///
+			/// Closes all child objects in the order they were added.
+			///
+			/// @par
+			/// Each child is removed from the list of children while holding the given mutex and closed afterwards
+			/// without holding it, so that the child can notify this composite via @ref onChildClosed.
+			/// The implementing class must ensure that no further children are added, once this method is invoked.
+			///
+			/// @param[in] mutex the mutex synchronizing access to the list of children
+			///
+			void closeChildObjects(std::mutex& mutex);
+
+		private: // functions
+
+			///
+			/// Unlinks the given child object, which must be registered in this composite.
+			///
+			void unlinkChild(IOpenKitObject& childObject);
+
 		private: // members
 
 			///
@@ -101,9 +149,19 @@ namespace core
 			static constexpr int32_t DEFAULT_ACTION_ID = 0;
 
 			///
-			/// Container for storing the children of this composite.
+			/// First child object, owning the remaining children via their hooks.
+			///
+			std::shared_ptr<IOpenKitObject> mFirstChild;
+
+			///
+			/// Last child object
+			///
+			IOpenKitObject* mLastChild;
+
+			///
+			/// Number of child objects
 			///
-			std::list<std::shared_ptr<IOpenKitObject>> mChildren;
+			size_t mNumberOfChildren;
 		};
 
 	}
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "OpenKitRuntime.h"
+#include "OpenKit.h"
+#include "core/configuration/BeaconCacheConfiguration.h"
+#include "core/configuration/ConfigurationDefaults.h"
+
+using namespace core::objects;
+
+OpenKitRuntime::OpenKitRuntime(const openkit::OpenKitRuntimeBuilder& builder)
+	: OpenKitRuntime(
+		builder.getLogger(),
+		std::make_shared<core::configuration::BeaconCacheConfiguration>(
+			core::configuration::DEFAULT_MAX_RECORD_AGE_IN_MILLIS.count(),
+			builder.getBeaconCacheLowerMemoryBoundary(),
+			builder.getBeaconCacheUpperMemoryBoundary()
+		),
+		builder.getNumberOfSendingThreads()
+	)
+{
+}
+
+OpenKitRuntime::OpenKitRuntime(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> globalCacheConfiguration,
+	int32_t numberOfSendingThreads
+)
+	: mLogger(logger)
+	, mConnectionPool(std::make_shared<protocol::HTTPConnectionPool>())
+	, mTaskExecutor(std::make_shared<core::util::TaskExecutor>(numberOfSendingThreads))
+	, mBeaconSendingScheduler(std::make_shared<core::BeaconSendingScheduler>(logger, mTaskExecutor))
+	, mBeaconCacheEvictor(std::make_shared<core::caching::SharedBeaconCacheEvictor>(
+		logger,
+		globalCacheConfiguration,
+		std::make_shared<core::util::TaskExecutor>(1)
+	))
+{
+	OpenKit::globalInit();
+
+	if (mLogger->isInfoEnabled())
+	{
+		mLogger->info("OpenKitRuntime() - shared runtime with %zu sending threads instantiated",
+			mTaskExecutor->getNumberOfThreads());
+	}
+}
+
+OpenKitRuntime::~OpenKitRuntime()
+{
+	// release all curl handles before the global destruction
+	mBeaconSendingScheduler = nullptr;
+	mBeaconCacheEvictor = nullptr;
+	mTaskExecutor = nullptr;
+	mConnectionPool = nullptr;
+
+	OpenKit::globalShutdown();
+}
+
+int32_t OpenKitRuntime::getNumberOfAttachedInstances() const
+{
+	return static_cast<int32_t>(mBeaconCacheEvictor->getNumberOfAttachedEvictors());
+}
+
+std::shared_ptr<core::BeaconSendingScheduler> OpenKitRuntime::getBeaconSendingScheduler() const
+{
+	return mBeaconSendingScheduler;
+}
+
+std::shared_ptr<core::caching::SharedBeaconCacheEvictor> OpenKitRuntime::getBeaconCacheEvictor() const
+{
+	return mBeaconCacheEvictor;
+}
+
+std::shared_ptr<core::util::TaskExecutor> OpenKitRuntime::getTaskExecutor() const
+{
+	return mTaskExecutor;
+}
+
+std::shared_ptr<protocol::HTTPConnectionPool> OpenKitRuntime::getConnectionPool() const
+{
+	return mConnectionPool;
+}
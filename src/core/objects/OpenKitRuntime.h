@@ -0,0 +1,120 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_OBJECTS_OPENKITRUNTIME_H
+#define _CORE_OBJECTS_OPENKITRUNTIME_H
+
+#include "OpenKit/ILogger.h"
+#include "OpenKit/IOpenKitRuntime.h"
+#include "OpenKit/OpenKitRuntimeBuilder.h"
+#include "core/BeaconSendingScheduler.h"
+#include "core/caching/SharedBeaconCacheEvictor.h"
+#include "core/configuration/IBeaconCacheConfiguration.h"
+#include "core/util/TaskExecutor.h"
+#include "protocol/HTTPConnectionPool.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace core
+{
+	namespace objects
+	{
+		///
+		/// Implementation of the IOpenKitRuntime interface, holding the components shared by the attached OpenKit instances.
+		///
+		class OpenKitRuntime
+			: public openkit::IOpenKitRuntime
+		{
+		public:
+
+			///
+			/// Constructor
+			/// @param[in] builder builder providing the runtime's configuration
+			///
+			explicit OpenKitRuntime(const openkit::OpenKitRuntimeBuilder& builder);
+
+			///
+			/// Constructor
+			/// @param[in] logger to write traces to
+			/// @param[in] globalCacheConfiguration configuration holding the memory boundaries of all beacon caches
+			/// @param[in] numberOfSendingThreads number of threads sending beacon data
+			///
+			OpenKitRuntime(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<core::configuration::IBeaconCacheConfiguration> globalCacheConfiguration,
+				int32_t numberOfSendingThreads
+			);
+
+			///
+			/// Destructor stopping the shared executor.
+			///
+			~OpenKitRuntime() override;
+
+			///
+			/// Delete the copy constructor
+			///
+			OpenKitRuntime(const OpenKitRuntime&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			OpenKitRuntime& operator = (const OpenKitRuntime&) = delete;
+
+			int32_t getNumberOfAttachedInstances() const override;
+
+			///
+			/// Returns the scheduler executing the beacon sending states of all attached instances.
+			///
+			std::shared_ptr<core::BeaconSendingScheduler> getBeaconSendingScheduler() const;
+
+			///
+			/// Returns the evictor evicting records from all attached beacon caches.
+			///
+			std::shared_ptr<core::caching::SharedBeaconCacheEvictor> getBeaconCacheEvictor() const;
+
+			///
+			/// Returns the executor running the beacon sending and cache eviction tasks of all attached instances.
+			///
+			std::shared_ptr<core::util::TaskExecutor> getTaskExecutor() const;
+
+			///
+			/// Returns the pool of HTTP connections shared by all attached instances.
+			///
+			std::shared_ptr<protocol::HTTPConnectionPool> getConnectionPool() const;
+
+		private:
+
+			/// logging context
+			std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// pool of HTTP connections
+			std::shared_ptr<protocol::HTTPConnectionPool> mConnectionPool;
+
+			/// executor running the beacon sending tasks
+			std::shared_ptr<core::util::TaskExecutor> mTaskExecutor;
+
+			/// scheduler executing the beacon sending states
+			std::shared_ptr<core::BeaconSendingScheduler> mBeaconSendingScheduler;
+
+			/// evictor evicting records from all attached beacon caches
+			std::shared_ptr<core::caching::SharedBeaconCacheEvictor> mBeaconCacheEvictor;
+		};
+	}
+}
+
+#endif
@@ -36,41 +36,146 @@ std::shared_ptr<openkit::IAction> RootAction::enterAction(const char* actionName
 	return mActionImpl->enterAction(shared_from_this(), actionName);
 }
 
+std::shared_ptr<openkit::IAction> RootAction::enterAction(const char* actionName, size_t actionNameLength)
+{
+	return mActionImpl->enterAction(shared_from_this(), actionName, actionNameLength);
+}
+
 std::shared_ptr<openkit::IRootAction> RootAction::reportEvent(const char* eventName)
 {
 	mActionImpl->reportEvent(eventName);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> RootAction::reportEvent(const char* eventName, size_t eventNameLength)
+{
+	mActionImpl->reportEvent(eventName, eventNameLength);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, int32_t value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, size_t valueNameLength, int32_t value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, double value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, size_t valueNameLength, double value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, const char* value)
 {
 	mActionImpl->reportValue(valueName, value);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> RootAction::reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value, valueLength);
+	return shared_from_this();
+}
+
 std::shared_ptr<openkit::IRootAction> RootAction::reportError(const char* errorName, int32_t errorCode, const char* reason)
 {
 	mActionImpl->reportError(errorName, errorCode, reason);
 	return shared_from_this();
 }
 
+std::shared_ptr<openkit::IRootAction> RootAction::reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+{
+	mActionImpl->reportError(errorName, errorNameLength, errorCode, reason, reasonLength);
+	return shared_from_this();
+}
+
+openkit::IRootAction& RootAction::reportEventRef(const char* eventName)
+{
+	mActionImpl->reportEvent(eventName);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, int32_t value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, double value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, const char* value)
+{
+	mActionImpl->reportValue(valueName, value);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportErrorRef(const char* errorName, int32_t errorCode, const char* reason)
+{
+	mActionImpl->reportError(errorName, errorCode, reason);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportEventRef(const char* eventName, size_t eventNameLength)
+{
+	mActionImpl->reportEvent(eventName, eventNameLength);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, size_t valueNameLength, int32_t value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, size_t valueNameLength, double value)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportValueRef(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength)
+{
+	mActionImpl->reportValue(valueName, valueNameLength, value, valueLength);
+	return *this;
+}
+
+openkit::IRootAction& RootAction::reportErrorRef(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength)
+{
+	mActionImpl->reportError(errorName, errorNameLength, errorCode, reason, reasonLength);
+	return *this;
+}
+
+void RootAction::reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents)
+{
+	mActionImpl->reportEvents(events, numberOfEvents);
+}
+
 std::shared_ptr<openkit::IWebRequestTracer> RootAction::traceWebRequest(const char* url)
 {
 	return mActionImpl->traceWebRequest(url);
 }
 
+std::shared_ptr<openkit::IWebRequestTracer> RootAction::traceWebRequest(const char* url, size_t urlLength)
+{
+	return mActionImpl->traceWebRequest(url, urlLength);
+}
+
 void RootAction::leaveAction()
 {
 	mActionImpl->leaveAction();
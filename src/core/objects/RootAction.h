@@ -80,18 +80,54 @@ namespace core
 
 			std::shared_ptr<openkit::IAction> enterAction(const char* actionName) override;
 
+			std::shared_ptr<openkit::IAction> enterAction(const char* actionName, size_t actionNameLength) override;
+
 			std::shared_ptr<IRootAction> reportEvent(const char* eventName) override;
 
+			std::shared_ptr<IRootAction> reportEvent(const char* eventName, size_t eventNameLength) override;
+
 			std::shared_ptr<IRootAction> reportValue(const char* valueName, int32_t value) override;
 
+			std::shared_ptr<IRootAction> reportValue(const char* valueName, size_t valueNameLength, int32_t value) override;
+
 			std::shared_ptr<IRootAction> reportValue(const char* valueName, double value) override;
 
+			std::shared_ptr<IRootAction> reportValue(const char* valueName, size_t valueNameLength, double value) override;
+
 			std::shared_ptr<IRootAction> reportValue(const char* valueName, const char* value) override;
 
+			std::shared_ptr<IRootAction> reportValue(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) override;
+
 			std::shared_ptr<IRootAction> reportError(const char* errorName, int32_t errorCode, const char* reason) override;
 
+			std::shared_ptr<IRootAction> reportError(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) override;
+
+			IRootAction& reportEventRef(const char* eventName) override;
+
+			IRootAction& reportValueRef(const char* valueName, int32_t value) override;
+
+			IRootAction& reportValueRef(const char* valueName, double value) override;
+
+			IRootAction& reportValueRef(const char* valueName, const char* value) override;
+
+			IRootAction& reportErrorRef(const char* errorName, int32_t errorCode, const char* reason) override;
+
+			IRootAction& reportEventRef(const char* eventName, size_t eventNameLength) override;
+
+			IRootAction& reportValueRef(const char* valueName, size_t valueNameLength, int32_t value) override;
+
+			IRootAction& reportValueRef(const char* valueName, size_t valueNameLength, double value) override;
+
+			IRootAction& reportValueRef(const char* valueName, size_t valueNameLength, const char* value, size_t valueLength) override;
+
+			IRootAction& reportErrorRef(const char* errorName, size_t errorNameLength, int32_t errorCode, const char* reason, size_t reasonLength) override;
+
+			void reportEvents(const openkit::EventDescriptor* events, size_t numberOfEvents) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) override;
+
 			void leaveAction() override;
 
 			std::shared_ptr<IActionCommon> getActionImpl();
@@ -18,6 +18,7 @@
 #include "RootAction.h"
 #include "WebRequestTracer.h"
 #include "core/IBeaconSender.h"
+#include "core/util/PoolAllocator.h"
 #include "protocol/IBeacon.h"
 
 #include <sstream>
@@ -46,7 +47,16 @@ void Session::startSession()
 
 std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionName)
 {
-	UTF8String actionNameString(actionName);
+	return enterActionInternal(UTF8String(actionName));
+}
+
+std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionName, size_t actionNameLength)
+{
+	return enterActionInternal(UTF8String(actionName, actionNameLength));
+}
+
+std::shared_ptr<openkit::IRootAction> Session::enterActionInternal(const UTF8String& actionNameString)
+{
 	if (actionNameString.empty())
 	{
 		mLogger->warning("%s enterAction: actionName must not be null or empty", toString().c_str());
@@ -54,7 +64,7 @@ std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionNam
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("%s enterAction(%s)", toString().c_str(), actionName);
+		mLogger->debug("%s enterAction(%s)", toString().c_str(), actionNameString.getStringData().c_str());
 	}
 
 	{ // synchronized scope
@@ -62,7 +72,7 @@ std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionNam
 
 		if (!isFinishingOrFinished())
 		{
-			auto rootActionImpl = std::make_shared<ActionCommonImpl>(
+			auto rootActionImpl = core::util::allocateShared<ActionCommonImpl>(
 				mLogger,
 				mBeacon,
 				shared_from_this(),
@@ -71,7 +81,7 @@ std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionNam
 			);
 			storeChildInList(rootActionImpl);
 
-			auto rootAction = std::make_shared<RootAction>(rootActionImpl);
+			auto rootAction = core::util::allocateShared<RootAction>(rootActionImpl);
 			return rootAction;
 		}
 	}
@@ -81,16 +91,24 @@ std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionNam
 
 void Session::identifyUser(const char* userTag)
 {
-	UTF8String userTagString(userTag);
+	identifyUserInternal(UTF8String(userTag));
+}
+
+void Session::identifyUser(const char* userTag, size_t userTagLength)
+{
+	identifyUserInternal(UTF8String(userTag, userTagLength));
+}
 
-	if (userTag == nullptr || userTagString.empty())
+void Session::identifyUserInternal(const UTF8String& userTagString)
+{
+	if (userTagString.empty())
 	{
 		mLogger->warning("%s identifyUser: userTag must not be null or empty", toString().c_str());
 		return;
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("%s identifyUser(%s)", toString().c_str(), userTag);
+		mLogger->debug("%s identifyUser(%s)", toString().c_str(), userTagString.getStringData().c_str());
 	}
 
 	{ // synchronized scope
@@ -105,21 +123,33 @@ void Session::identifyUser(const char* userTag)
 
 void Session::reportCrash(const char* errorName, const char* reason, const char* stacktrace)
 {
-	UTF8String errorNameString(errorName);
+	reportCrashInternal(UTF8String(errorName), UTF8String(reason), UTF8String(stacktrace));
+}
 
-	if (errorName == nullptr || errorNameString.empty())
+void Session::reportCrash(const char* errorName, size_t errorNameLength, const char* reason, size_t reasonLength,
+	const char* stacktrace, size_t stacktraceLength)
+{
+	reportCrashInternal(
+		UTF8String(errorName, errorNameLength),
+		UTF8String(reason, reasonLength),
+		UTF8String(stacktrace, stacktraceLength)
+	);
+}
+
+void Session::reportCrashInternal(const UTF8String& errorNameString, const UTF8String& reasonString,
+	const UTF8String& stacktraceString)
+{
+	if (errorNameString.empty())
 	{
 		mLogger->warning("%s reportCrash: errorName must not be null or empty", toString().c_str());
 		return;
 	}
 
-	UTF8String reasonString(reason);
-	UTF8String stacktraceString(stacktrace);
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("%s reportCrash(%s, %s, %s)", toString().c_str(), errorNameString.getStringData().c_str(),
-				(reason != nullptr ? reasonString.getStringData().c_str() : "null"),
-				(stacktrace != nullptr ? stacktraceString.getStringData().c_str() : "null"));
+				reasonString.getStringData().c_str(),
+				stacktraceString.getStringData().c_str());
 	}
 
 	{ // synchronized scope
@@ -134,13 +164,23 @@ void Session::reportCrash(const char* errorName, const char* reason, const char*
 
 std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char* url)
 {
-	core::UTF8String urlString(url);
+	return traceWebRequestInternal(core::UTF8String(url));
+}
+
+std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char* url, size_t urlLength)
+{
+	return traceWebRequestInternal(core::UTF8String(url, urlLength));
+}
+
+std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequestInternal(const core::UTF8String& urlString)
+{
 	if (urlString.empty())
 	{
 		mLogger->warning("%s traceWebRequest: url must not be null or empty", toString().c_str());
 		return NullWebRequestTracer::INSTANCE;
 	}
-	if (!WebRequestTracer::isValidURLScheme(urlString))
+	auto urlLengthWithoutQuery = WebRequestTracer::getLengthWithoutQuery(urlString);
+	if (urlLengthWithoutQuery == std::string::npos)
 	{
 		mLogger->warning("%s traceWebRequest: url \"%s\" does not have a valid scheme", toString().c_str(), urlString.getStringData().c_str());
 		return NullWebRequestTracer::INSTANCE;
@@ -155,11 +195,12 @@ std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char*
 
 		if(!isFinishingOrFinished())
 		{
-			auto tracer =  std::make_shared<core::objects::WebRequestTracer>(
+			auto tracer = core::util::allocateShared<core::objects::WebRequestTracer>(
 				mLogger,
 				shared_from_this(),
 				mBeacon,
-				urlString
+				urlString,
+				urlLengthWithoutQuery
 			);
 			storeChildInList(tracer);
 
@@ -187,11 +228,7 @@ void Session::end()
 	}
 
 	// leave all Root-Actions for sanity reasons
-	auto childObjects = getCopyOfChildObjects();
-	for (auto childObject : childObjects)
-	{
-		childObject->close();
-	}
+	closeChildObjects(mMutex);
 
 	mBeacon->endSession();
 
@@ -202,7 +239,11 @@ void Session::end()
 	}
 
 	// last but not least update parent relation
-	mParent->onChildClosed(shared_from_this());
+	auto parent = mParent.lock();
+	if (parent != nullptr)
+	{
+		parent->onChildClosed(shared_from_this());
+	}
 }
 
 void Session::close()
@@ -220,6 +261,21 @@ bool Session::isEmpty() const
 	return mBeacon->isEmpty();
 }
 
+size_t Session::getNumberOfRecords() const
+{
+	return mBeacon->getNumberOfRecords();
+}
+
+bool Session::hasReportedFailures() const
+{
+	return mBeacon->hasReportedFailures();
+}
+
+int64_t Session::getStartTime() const
+{
+	return mBeacon->getSessionStartTime();
+}
+
 void Session::clearCapturedData()
 {
 	mBeacon->clearData();
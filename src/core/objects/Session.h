@@ -87,12 +87,21 @@ namespace core
 
 			std::shared_ptr<openkit::IRootAction> enterAction(const char* actionName) override;
 
+			std::shared_ptr<openkit::IRootAction> enterAction(const char* actionName, size_t actionNameLength) override;
+
 			void identifyUser(const char* userTag) override;
 
+			void identifyUser(const char* userTag, size_t userTagLength) override;
+
 			void reportCrash(const char* errorName, const char* reason, const char* stacktrace) override;
 
+			void reportCrash(const char* errorName, size_t errorNameLength, const char* reason, size_t reasonLength,
+				const char* stacktrace, size_t stacktraceLength) override;
+
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url, size_t urlLength) override;
+
 			void end() override;
 
 			void startSession() override;
@@ -103,6 +112,12 @@ namespace core
 
 			bool isEmpty() const override;
 
+			size_t getNumberOfRecords() const override;
+
+			bool hasReportedFailures() const override;
+
+			int64_t getStartTime() const override;
+
 
 
 			void clearCapturedData() override;
@@ -142,6 +157,15 @@ namespace core
 
 		private:
 
+			std::shared_ptr<openkit::IRootAction> enterActionInternal(const core::UTF8String& actionNameString);
+
+			void identifyUserInternal(const core::UTF8String& userTagString);
+
+			void reportCrashInternal(const core::UTF8String& errorNameString, const core::UTF8String& reasonString,
+				const core::UTF8String& stacktraceString);
+
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequestInternal(const core::UTF8String& urlString);
+
 			///
 			/// Marks that the session is about to be finished.
 			///
@@ -168,8 +192,13 @@ namespace core
 			/// Logger to write traces to
 			const std::shared_ptr<openkit::ILogger> mLogger;
 
-			// parent object of this session
-			const std::shared_ptr<core::objects::IOpenKitComposite> mParent;
+			///
+			/// parent object of this session
+			///
+			/// Held weakly, since the parent keeps its children and the beacon sending context keeps the session,
+			/// so a strong reference would keep OpenKit alive from within the beacon sending thread.
+			///
+			const std::weak_ptr<core::objects::IOpenKitComposite> mParent;
 
 			/// beacon used for serialization
 			const std::shared_ptr<protocol::IBeacon> mBeacon;
@@ -72,6 +72,24 @@ namespace core
 			///
 			virtual bool isEmpty() const = 0;
 
+			///
+			/// Returns the number of records collected for this session and not yet sent.
+			///
+			virtual size_t getNumberOfRecords() const = 0;
+
+			///
+			/// Tests if an error or a crash has been reported in this session.
+			///
+			/// Such sessions are sent first, if not all sessions can be sent before the shutdown deadline.
+			/// @returns @c true if at least one error or crash has been reported, @c false otherwise
+			///
+			virtual bool hasReportedFailures() const = 0;
+
+			///
+			/// Returns the timestamp when this session has been started.
+			///
+			virtual int64_t getStartTime() const = 0;
+
 			///
 			/// Clears data that has been captured so far.
 			///
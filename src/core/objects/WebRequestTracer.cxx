@@ -19,11 +19,76 @@
 #include "protocol/IBeacon.h"
 
 #include <sstream>
-#include <regex>
 
 using namespace core::objects;
 
-static const std::regex SCHEMA_VALIDATION_PATTERN("^[a-zA-Z][a-zA-Z0-9+\\-.]*://.+$", std::regex::optimize | std::regex::ECMAScript);
+namespace
+{
+	bool isSchemeStartCharacter(char character)
+	{
+		return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+	}
+
+	bool isSchemeCharacter(char character)
+	{
+		return isSchemeStartCharacter(character)
+			|| (character >= '0' && character <= '9')
+			|| character == '+'
+			|| character == '-'
+			|| character == '.';
+	}
+
+	///
+	/// Scans the given URL once and returns the number of bytes preceding the query part.
+	///
+	/// @par
+	/// The URL is valid if it matches the pattern @c ^[a-zA-Z][a-zA-Z0-9+\-.]*://.+$ (ECMAScript syntax), where
+	/// the trailing @c . does not match line terminators.
+	///
+	/// @param[in] url the URL to scan
+	/// @return length of the URL up to the first @c ? or the whole length, @c std::string::npos if the URL is invalid
+	///
+	size_t scanLengthWithoutQuery(const std::string& url)
+	{
+		const auto length = url.size();
+		if (length == 0 || !isSchemeStartCharacter(url[0]))
+		{
+			return std::string::npos;
+		}
+
+		size_t index = 1;
+		while (index < length && isSchemeCharacter(url[index]))
+		{
+			index++;
+		}
+
+		if (url.compare(index, 3, "://") != 0)
+		{
+			return std::string::npos;
+		}
+		index += 3;
+		if (index == length)
+		{
+			return std::string::npos;
+		}
+
+		auto lengthWithoutQuery = std::string::npos;
+		for (; index < length; index++)
+		{
+			const auto character = url[index];
+			if (character == '\n' || character == '\r')
+			{
+				return std::string::npos;
+			}
+			if (character == '?' && lengthWithoutQuery == std::string::npos)
+			{
+				lengthWithoutQuery = index;
+			}
+		}
+
+		return lengthWithoutQuery == std::string::npos ? length : lengthWithoutQuery;
+	}
+}
 
 const std::string WebRequestTracer::UNKNOWN_URL = "<unknown>";
 
@@ -32,14 +97,15 @@ WebRequestTracer::WebRequestTracer
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<IOpenKitComposite> parent,
 	std::shared_ptr<protocol::IBeacon> beacon,
-	const core::UTF8String& url
+	const core::UTF8String& url,
+	size_t urlLengthWithoutQuery
 )
 	: mLogger(logger)
 	, mParent(parent)
 	, mMutex()
 	, mBeacon(beacon)
 	, mParentActionID(parent->getActionId())
-	, mURL(calculateUrlFrom(url))
+	, mURL(removeQuery(url, urlLengthWithoutQuery))
 	, mResponseCode(-1)
 	, mBytesSent(-1)
 	, mBytesReceived(-1)
@@ -53,24 +119,34 @@ WebRequestTracer::WebRequestTracer
 
 bool WebRequestTracer::isValidURLScheme(const core::UTF8String& url)
 {
-	return std::regex_match(url.getStringData(), SCHEMA_VALIDATION_PATTERN);
+	return scanLengthWithoutQuery(url.getStringData()) != std::string::npos;
+}
+
+size_t WebRequestTracer::getLengthWithoutQuery(const core::UTF8String& url)
+{
+	return scanLengthWithoutQuery(url.getStringData());
 }
 
 core::UTF8String WebRequestTracer::calculateUrlFrom(const core::UTF8String& url)
 {
-	if (!isValidURLScheme(url))
+	return removeQuery(url, getLengthWithoutQuery(url));
+}
+
+core::UTF8String WebRequestTracer::removeQuery(const core::UTF8String& url, size_t lengthWithoutQuery)
+{
+	const auto& urlData = url.getStringData();
+	if (lengthWithoutQuery == std::string::npos)
 	{
 		return UNKNOWN_URL;
 	}
 
-	auto indexOfQuestionMark = url.getIndexOf("?");
-
-	if (indexOfQuestionMark == std::string::npos)
+	if (lengthWithoutQuery == urlData.size())
 	{
 		return url;
 	}
 
-	return url.substring(0, indexOfQuestionMark);
+	// '?' is a single byte character, therefore the prefix is a complete UTF-8 string
+	return core::UTF8String(urlData.substr(0, lengthWithoutQuery));
 }
 
 const char* WebRequestTracer::getTag() const
@@ -56,12 +56,16 @@ namespace core
 			/// @param[in] logger to write traces to
 			/// @param[in] parent the parent object, to which this web request belongs
 			/// @param[in] beacon @ref protocol::Beacon used to serialize the @ref WebRequestTracer
+			/// @param[in] url the URL of the traced web request
+			/// @param[in] urlLengthWithoutQuery the result of @ref getLengthWithoutQuery for @c url,
+			///   @ref UNKNOWN_URL is used if it is @c std::string::npos
 			///
 			WebRequestTracer(
 				std::shared_ptr<openkit::ILogger> logger,
 				std::shared_ptr<IOpenKitComposite> parent,
 				std::shared_ptr<protocol::IBeacon> beacon,
-				const core::UTF8String& url
+				const core::UTF8String& url,
+				size_t urlLengthWithoutQuery
 			);
 
 			static const std::string UNKNOWN_URL;
@@ -73,6 +77,15 @@ namespace core
 			///
 			static bool isValidURLScheme(const core::UTF8String& url);
 
+			///
+			/// Validates the given @c url like @ref isValidURLScheme and returns the number of bytes preceding the query
+			/// part. The URL is scanned only once.
+			/// @param[in] url the URL to scan
+			/// @return length of the URL up to the first @c ? or the whole length,
+			///   @c std::string::npos if the URL is invalid
+			///
+			static size_t getLengthWithoutQuery(const core::UTF8String& url);
+
 			///
 			/// Checks if the given @c url is valid and returns the URL excluding possible parameters.
 			/// In case the url is invalid @ref UNKNOWN_URL is returned.
@@ -171,6 +184,14 @@ namespace core
 			///
 			const std::string toString() const;
 
+			///
+			/// Returns the given @c url without its query part.
+			/// @param[in] url the URL
+			/// @param[in] lengthWithoutQuery the result of @ref getLengthWithoutQuery for @c url
+			/// @return the URL without its query part or @ref UNKNOWN_URL if @c lengthWithoutQuery is @c std::string::npos
+			///
+			static core::UTF8String removeQuery(const core::UTF8String& url, size_t lengthWithoutQuery);
+
 			/// Logger to write traces to
 			const std::shared_ptr<openkit::ILogger> mLogger;
 
@@ -0,0 +1,452 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SharedMemoryRing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <sstream>
+
+#if !defined(_WIN32) && !defined(WIN32)
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+using namespace core::sidecar;
+
+namespace
+{
+	/// marks a completely initialized ring file ("OKSR")
+	constexpr uint32_t RING_MAGIC = 0x4F4B5352;
+
+	/// version of the ring file layout
+	constexpr uint32_t RING_VERSION = 1;
+
+	/// alignment of records in the ring's buffer
+	constexpr uint64_t RECORD_ALIGNMENT = 8;
+
+	/// minimum space reserved for control records
+	constexpr uint64_t MIN_CONTROL_RESERVE = 512;
+
+	/// prefix of all ring file names
+	const std::string RING_FILE_PREFIX = "openkit-";
+
+	/// suffix of all ring file names
+	const std::string RING_FILE_SUFFIX = ".ring";
+
+	///
+	/// Header of a single record in the ring's buffer, directly followed by the record's payload.
+	///
+	struct RecordHeader
+	{
+		uint32_t payloadSize;
+		uint16_t type;
+		uint16_t reserved;
+		int32_t beaconID;
+		int32_t value;
+		int64_t timestamp;
+	};
+
+	constexpr uint64_t alignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	bool isControlRecord(SidecarRecordType type)
+	{
+		return type != SidecarRecordType::EVENT_DATA && type != SidecarRecordType::ACTION_DATA;
+	}
+
+	bool endsWith(const std::string& s, const std::string& suffix)
+	{
+		return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+	}
+}
+
+struct SharedMemoryRing::RingHeader
+{
+	/// set to @ref RING_MAGIC after the ring has been initialized completely
+	std::atomic<uint32_t> magic;
+
+	/// version of the ring file layout
+	uint32_t version;
+
+	/// capacity of the ring's buffer in bytes
+	uint64_t capacity;
+
+	/// process ID of the producer
+	int64_t producerProcessID;
+
+	/// non-zero if the producer closed the ring
+	std::atomic<uint32_t> isClosed;
+
+	/// server ID published by the consumer
+	std::atomic<int32_t> serverID;
+
+	// producer owned fields, on their own cache line
+	alignas(64) std::atomic<uint64_t> writePosition;
+	std::atomic<uint64_t> numberOfWrittenRecords;
+	std::atomic<uint64_t> numberOfDroppedRecords;
+	std::atomic<uint64_t> numberOfDroppedBytes;
+
+	// consumer owned fields, on their own cache line
+	alignas(64) std::atomic<uint64_t> readPosition;
+};
+
+constexpr uint64_t SharedMemoryRing::MIN_CAPACITY;
+const uint64_t SharedMemoryRing::BUFFER_OFFSET = alignUp(sizeof(SharedMemoryRing::RingHeader), 64);
+
+SharedMemoryRing::SharedMemoryRing(const std::string& path, void* mapping, size_t mappingSize)
+	: mPath(path)
+	, mMapping(mapping)
+	, mMappingSize(mappingSize)
+	, mHeader(static_cast<RingHeader*>(mapping))
+	, mBuffer(static_cast<char*>(mapping) + BUFFER_OFFSET)
+	, mCapacity(mappingSize - BUFFER_OFFSET)
+	, mControlReserve(alignUp(std::max(MIN_CONTROL_RESERVE, (mappingSize - BUFFER_OFFSET) / 16), RECORD_ALIGNMENT))
+{
+}
+
+#if !defined(_WIN32) && !defined(WIN32)
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::create(const std::string& path, uint64_t capacity)
+{
+	capacity = alignUp(std::max(capacity, MIN_CAPACITY), RECORD_ALIGNMENT);
+	auto mappingSize = static_cast<size_t>(BUFFER_OFFSET + capacity);
+
+	auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd < 0)
+	{
+		return nullptr;
+	}
+
+	if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0)
+	{
+		::close(fd);
+		::unlink(path.c_str());
+		return nullptr;
+	}
+
+	auto mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		::unlink(path.c_str());
+		return nullptr;
+	}
+
+	auto header = new (mapping) RingHeader();
+	if (!header->writePosition.is_lock_free() || !header->serverID.is_lock_free())
+	{
+		// the atomics must not rely on process local locks
+		munmap(mapping, mappingSize);
+		::unlink(path.c_str());
+		return nullptr;
+	}
+
+	header->version = RING_VERSION;
+	header->capacity = capacity;
+	header->producerProcessID = static_cast<int64_t>(getpid());
+	header->isClosed.store(0, std::memory_order_relaxed);
+	header->serverID.store(-1, std::memory_order_relaxed);
+	header->writePosition.store(0, std::memory_order_relaxed);
+	header->numberOfWrittenRecords.store(0, std::memory_order_relaxed);
+	header->numberOfDroppedRecords.store(0, std::memory_order_relaxed);
+	header->numberOfDroppedBytes.store(0, std::memory_order_relaxed);
+	header->readPosition.store(0, std::memory_order_relaxed);
+
+	// publish the initialized ring to consumers
+	header->magic.store(RING_MAGIC, std::memory_order_release);
+
+	return std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing(path, mapping, mappingSize));
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::open(const std::string& path)
+{
+	auto fd = ::open(path.c_str(), O_RDWR);
+	if (fd < 0)
+	{
+		return nullptr;
+	}
+
+	struct stat fileStatus;
+	if (fstat(fd, &fileStatus) != 0 || static_cast<uint64_t>(fileStatus.st_size) < BUFFER_OFFSET + MIN_CAPACITY)
+	{
+		::close(fd);
+		return nullptr;
+	}
+
+	auto mappingSize = static_cast<size_t>(fileStatus.st_size);
+	auto mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return nullptr;
+	}
+
+	auto header = static_cast<RingHeader*>(mapping);
+	if (header->magic.load(std::memory_order_acquire) != RING_MAGIC
+		|| header->version != RING_VERSION
+		|| header->capacity + BUFFER_OFFSET != mappingSize)
+	{
+		// either not a ring file or the producer is still initializing it
+		munmap(mapping, mappingSize);
+		return nullptr;
+	}
+
+	return std::shared_ptr<SharedMemoryRing>(new SharedMemoryRing(path, mapping, mappingSize));
+}
+
+std::vector<std::string> SharedMemoryRing::listRingFiles(const std::string& directory)
+{
+	std::vector<std::string> paths;
+
+	auto dir = opendir(directory.c_str());
+	if (dir == nullptr)
+	{
+		return paths;
+	}
+
+	while (auto entry = readdir(dir))
+	{
+		std::string name(entry->d_name);
+		if (name.compare(0, RING_FILE_PREFIX.size(), RING_FILE_PREFIX) == 0 && endsWith(name, RING_FILE_SUFFIX))
+		{
+			paths.push_back(directory + "/" + name);
+		}
+	}
+	closedir(dir);
+
+	std::sort(paths.begin(), paths.end());
+	return paths;
+}
+
+std::string SharedMemoryRing::createRingFilePath(const std::string& directory)
+{
+	static std::atomic<uint32_t> sequenceNumber(0);
+
+	std::ostringstream path;
+	path << directory << "/" << RING_FILE_PREFIX << getpid() << "-" << sequenceNumber.fetch_add(1) << RING_FILE_SUFFIX;
+	return path.str();
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+	munmap(mMapping, mMappingSize);
+}
+
+bool SharedMemoryRing::isProducerAlive() const
+{
+	auto processID = static_cast<pid_t>(mHeader->producerProcessID);
+	return kill(processID, 0) == 0 || errno == EPERM;
+}
+
+void SharedMemoryRing::remove()
+{
+	::unlink(mPath.c_str());
+}
+
+#else
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::create(const std::string& /* path */, uint64_t /* capacity */)
+{
+	return nullptr;
+}
+
+std::shared_ptr<SharedMemoryRing> SharedMemoryRing::open(const std::string& /* path */)
+{
+	return nullptr;
+}
+
+std::vector<std::string> SharedMemoryRing::listRingFiles(const std::string& /* directory */)
+{
+	return std::vector<std::string>();
+}
+
+std::string SharedMemoryRing::createRingFilePath(const std::string& directory)
+{
+	return directory;
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+}
+
+bool SharedMemoryRing::isProducerAlive() const
+{
+	return false;
+}
+
+void SharedMemoryRing::remove()
+{
+}
+
+#endif
+
+bool SharedMemoryRing::write(SidecarRecordType type, int32_t beaconID, int64_t timestamp, int32_t value, const char* payload, size_t payloadSize)
+{
+	auto recordSize = alignUp(sizeof(RecordHeader) + payloadSize, RECORD_ALIGNMENT);
+
+	auto writePosition = mHeader->writePosition.load(std::memory_order_relaxed);
+	auto readPosition = mHeader->readPosition.load(std::memory_order_acquire);
+	auto freeSpace = mCapacity - (writePosition - readPosition);
+	auto reservedSpace = isControlRecord(type) ? 0 : mControlReserve;
+
+	// a record never wraps around, the remainder of the buffer is skipped instead
+	auto offset = writePosition % mCapacity;
+	auto tailSpace = mCapacity - offset;
+	auto requiredSpace = recordSize > tailSpace ? tailSpace + recordSize : recordSize;
+
+	if (payloadSize > UINT32_MAX || requiredSpace + reservedSpace > freeSpace)
+	{
+		mHeader->numberOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+		mHeader->numberOfDroppedBytes.fetch_add(payloadSize, std::memory_order_relaxed);
+		return false;
+	}
+
+	if (recordSize > tailSpace)
+	{
+		if (tailSpace >= sizeof(RecordHeader))
+		{
+			// the consumer skips the remainder of the buffer implicitly, if it cannot hold a record header
+			RecordHeader padding = { static_cast<uint32_t>(tailSpace - sizeof(RecordHeader)), static_cast<uint16_t>(SidecarRecordType::PADDING), 0, 0, 0, 0 };
+			std::memcpy(mBuffer + offset, &padding, sizeof(RecordHeader));
+		}
+		offset = 0;
+	}
+
+	RecordHeader header = { static_cast<uint32_t>(payloadSize), static_cast<uint16_t>(type), 0, beaconID, value, timestamp };
+	std::memcpy(mBuffer + offset, &header, sizeof(RecordHeader));
+	if (payloadSize > 0)
+	{
+		std::memcpy(mBuffer + offset + sizeof(RecordHeader), payload, payloadSize);
+	}
+
+	mHeader->numberOfWrittenRecords.fetch_add(1, std::memory_order_relaxed);
+	mHeader->writePosition.store(writePosition + requiredSpace, std::memory_order_release);
+
+	return true;
+}
+
+size_t SharedMemoryRing::read(const RecordVisitor& visitor, size_t maxRecords)
+{
+	auto readPosition = mHeader->readPosition.load(std::memory_order_relaxed);
+	auto writePosition = mHeader->writePosition.load(std::memory_order_acquire);
+
+	size_t numRecords = 0;
+	while (readPosition < writePosition && numRecords < maxRecords)
+	{
+		auto offset = readPosition % mCapacity;
+		auto tailSpace = mCapacity - offset;
+		if (tailSpace < sizeof(RecordHeader))
+		{
+			readPosition += tailSpace;
+			continue;
+		}
+
+		RecordHeader header;
+		std::memcpy(&header, mBuffer + offset, sizeof(RecordHeader));
+		if (header.payloadSize > tailSpace - sizeof(RecordHeader))
+		{
+			// corrupted record, skip everything written so far
+			readPosition = writePosition;
+			break;
+		}
+
+		auto type = static_cast<SidecarRecordType>(header.type);
+		if (type == SidecarRecordType::PADDING)
+		{
+			readPosition += tailSpace;
+			continue;
+		}
+
+		SidecarRecord record = {
+			type,
+			header.beaconID,
+			header.value,
+			header.timestamp,
+			mBuffer + offset + sizeof(RecordHeader),
+			header.payloadSize
+		};
+		visitor(record);
+
+		readPosition += alignUp(sizeof(RecordHeader) + header.payloadSize, RECORD_ALIGNMENT);
+		numRecords++;
+	}
+
+	// release the space of all visited records at once
+	mHeader->readPosition.store(readPosition, std::memory_order_release);
+
+	return numRecords;
+}
+
+void SharedMemoryRing::markClosed()
+{
+	mHeader->isClosed.store(1, std::memory_order_release);
+}
+
+bool SharedMemoryRing::isClosed() const
+{
+	return mHeader->isClosed.load(std::memory_order_acquire) != 0;
+}
+
+int32_t SharedMemoryRing::getServerID() const
+{
+	return mHeader->serverID.load(std::memory_order_relaxed);
+}
+
+void SharedMemoryRing::setServerID(int32_t serverID)
+{
+	mHeader->serverID.store(serverID, std::memory_order_relaxed);
+}
+
+uint64_t SharedMemoryRing::getNumberOfWrittenRecords() const
+{
+	return mHeader->numberOfWrittenRecords.load(std::memory_order_relaxed);
+}
+
+uint64_t SharedMemoryRing::getNumberOfDroppedRecords() const
+{
+	return mHeader->numberOfDroppedRecords.load(std::memory_order_relaxed);
+}
+
+uint64_t SharedMemoryRing::getNumberOfDroppedBytes() const
+{
+	return mHeader->numberOfDroppedBytes.load(std::memory_order_relaxed);
+}
+
+const std::string& SharedMemoryRing::getPath() const
+{
+	return mPath;
+}
+
+uint64_t SharedMemoryRing::getCapacity() const
+{
+	return mCapacity;
+}
+
+int64_t SharedMemoryRing::getProducerProcessID() const
+{
+	return mHeader->producerProcessID;
+}
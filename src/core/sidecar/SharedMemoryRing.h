@@ -0,0 +1,230 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_SIDECAR_SHAREDMEMORYRING_H
+#define _CORE_SIDECAR_SHAREDMEMORYRING_H
+
+#include "SidecarRecord.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace core
+{
+	namespace sidecar
+	{
+		///
+		/// Single producer/single consumer ring buffer of @ref SidecarRecord, shared between two processes.
+		///
+		/// The ring lives in a file mapped into both processes, which should be located on a memory backed
+		/// file system (e.g. /dev/shm). The producer is an OpenKit worker process, the consumer is the
+		/// OpenKit agent process. Neither side ever blocks on the other one: if the ring is full, the producer
+		/// drops the record and counts it in the ring's header, where the consumer can read the counters.
+		///
+		/// A part of the capacity is reserved for control records (beacon start/end and data deletion), so that
+		/// a flood of event and action data does not cause sessions to get lost.
+		///
+		/// The write methods must only be called by one thread at a time, the same applies to the read methods.
+		///
+		/// Shared memory rings are only supported on POSIX systems, on all other systems no ring can be created.
+		///
+		class SharedMemoryRing
+		{
+		public:
+			///
+			/// Callback invoked for each record read from the ring.
+			///
+			using RecordVisitor = std::function<void(const SidecarRecord&)>;
+
+			/// minimum capacity of a ring's buffer in bytes
+			static constexpr uint64_t MIN_CAPACITY = 4 * 1024;
+
+			///
+			/// Create a new ring file and map it as producer.
+			/// @param[in] path the ring file to create, which must not exist yet
+			/// @param[in] capacity the capacity of the ring's buffer in bytes, at least @ref MIN_CAPACITY
+			/// @return the created ring or @c nullptr if the file could not be created
+			///
+			static std::shared_ptr<SharedMemoryRing> create(const std::string& path, uint64_t capacity);
+
+			///
+			/// Map an existing ring file as consumer.
+			/// @param[in] path the ring file to open
+			/// @return the opened ring or @c nullptr if the file is not a (completely initialized) ring
+			///
+			static std::shared_ptr<SharedMemoryRing> open(const std::string& path);
+
+			///
+			/// Get the paths of all ring files in the given directory.
+			/// @param[in] directory the directory to scan
+			/// @return the sorted paths of all ring files
+			///
+			static std::vector<std::string> listRingFiles(const std::string& directory);
+
+			///
+			/// Get a path for a new ring file of the calling process.
+			/// @param[in] directory the directory in which to create the ring file
+			/// @return a path which is unique for the calling process
+			///
+			static std::string createRingFilePath(const std::string& directory);
+
+			///
+			/// Destructor, unmaps the ring but does not remove the ring file.
+			///
+			~SharedMemoryRing();
+
+			///
+			/// Delete the copy constructor
+			///
+			SharedMemoryRing(const SharedMemoryRing&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+			///
+			/// Append a record to the ring (producer side).
+			///
+			/// @param[in] type the record's type, which must not be @ref SidecarRecordType::PADDING
+			/// @param[in] beaconID the worker's beacon id
+			/// @param[in] timestamp the record's timestamp
+			/// @param[in] value type specific value
+			/// @param[in] payload the record's payload
+			/// @param[in] payloadSize size of the payload in bytes
+			/// @return @c true if the record was written, @c false if it was dropped due to insufficient space
+			///
+			bool write(SidecarRecordType type, int32_t beaconID, int64_t timestamp, int32_t value, const char* payload, size_t payloadSize);
+
+			///
+			/// Read the records written so far (consumer side).
+			///
+			/// The space of the visited records is released, after the last record has been visited.
+			///
+			/// @param[in] visitor callback invoked for each record
+			/// @param[in] maxRecords maximum number of records to read
+			/// @return number of records read
+			///
+			size_t read(const RecordVisitor& visitor, size_t maxRecords);
+
+			///
+			/// Mark the ring as closed, no more records are written (producer side).
+			///
+			void markClosed();
+
+			///
+			/// @return @c true if the producer closed the ring
+			///
+			bool isClosed() const;
+
+			///
+			/// @return @c true if the process which created the ring is still running
+			///
+			bool isProducerAlive() const;
+
+			///
+			/// @return the server ID published by the consumer, or @c -1 if not yet published
+			///
+			int32_t getServerID() const;
+
+			///
+			/// Publish the server ID to be used by the producer for tagging web requests (consumer side).
+			/// @param[in] serverID the server ID
+			///
+			void setServerID(int32_t serverID);
+
+			///
+			/// Remove the ring file, the mapping stays valid until this object is destroyed.
+			///
+			void remove();
+
+			///
+			/// @return the number of records written to the ring
+			///
+			uint64_t getNumberOfWrittenRecords() const;
+
+			///
+			/// @return the number of records dropped, because the ring was full
+			///
+			uint64_t getNumberOfDroppedRecords() const;
+
+			///
+			/// @return the number of payload bytes dropped, because the ring was full
+			///
+			uint64_t getNumberOfDroppedBytes() const;
+
+			///
+			/// @return the path of the ring file
+			///
+			const std::string& getPath() const;
+
+			///
+			/// @return the capacity of the ring's buffer in bytes
+			///
+			uint64_t getCapacity() const;
+
+			///
+			/// @return the process ID of the process which created the ring
+			///
+			int64_t getProducerProcessID() const;
+
+		private:
+			///
+			/// The header at the beginning of the ring file, holding positions, counters and flags.
+			///
+			struct RingHeader;
+
+			/// offset of the ring's buffer in the ring file
+			static const uint64_t BUFFER_OFFSET;
+
+			///
+			/// Constructor
+			/// @param[in] path the ring file's path
+			/// @param[in] mapping start of the mapped ring file
+			/// @param[in] mappingSize size of the mapped ring file
+			///
+			SharedMemoryRing(const std::string& path, void* mapping, size_t mappingSize);
+
+			/// the ring file's path
+			const std::string mPath;
+
+			/// start of the mapped ring file
+			void* const mMapping;
+
+			/// size of the mapped ring file
+			const size_t mMappingSize;
+
+			/// the ring's header, located at the beginning of the mapping
+			RingHeader* const mHeader;
+
+			/// the ring's buffer, following the header
+			char* const mBuffer;
+
+			/// the capacity of @ref mBuffer in bytes
+			const uint64_t mCapacity;
+
+			/// space which is only available for control records
+			const uint64_t mControlReserve;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,513 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SidecarAgent.h"
+#include "core/BeaconSender.h"
+#include "core/BeaconSendingScheduler.h"
+#include "core/caching/BeaconCache.h"
+#include "core/caching/BeaconCacheEvictor.h"
+#include "core/configuration/BeaconCacheConfiguration.h"
+#include "core/configuration/BeaconConfiguration.h"
+#include "core/configuration/FileResponseAttributesStore.h"
+#include "core/configuration/HTTPClientConfiguration.h"
+#include "core/configuration/OpenKitConfiguration.h"
+#include "core/configuration/PrivacyConfiguration.h"
+#include "core/objects/OpenKit.h"
+#include "providers/DefaultHTTPClientProvider.h"
+#include "providers/DefaultSessionIDProvider.h"
+#include "providers/DefaultTimingProvider.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <inttypes.h> // for PRId64 macro
+
+using namespace core::sidecar;
+
+/// overall time to wait for the beacon sending and cache eviction to finish, when closed
+constexpr std::chrono::milliseconds SHUTDOWN_TIMEOUT = std::chrono::seconds(10);
+
+namespace
+{
+	/// maximum number of records read from a single ring per poll, so that a busy worker cannot starve the others
+	constexpr size_t MAX_RECORDS_PER_POLL = 4096;
+
+	std::shared_ptr<core::util::MetricsRegistry> createMetricsRegistry(
+		std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration
+	)
+	{
+		if (!openKitConfiguration->isStatisticsEnabled())
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<core::util::MetricsRegistry>();
+	}
+
+	std::shared_ptr<core::IBeaconSender> createBeaconSender(
+		std::shared_ptr<openkit::ILogger> logger,
+		std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration,
+		std::shared_ptr<providers::ITimingProvider> timingProvider,
+		std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+		std::shared_ptr<core::util::TaskExecutor> taskExecutor
+	)
+	{
+		std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore = nullptr;
+		if (!openKitConfiguration->getServerConfigurationFile().empty())
+		{
+			responseAttributesStore = std::make_shared<core::configuration::FileResponseAttributesStore>(
+				logger,
+				openKitConfiguration->getServerConfigurationFile()
+			);
+		}
+
+		return std::make_shared<core::BeaconSender>(
+			logger,
+			core::configuration::HTTPClientConfiguration::from(openKitConfiguration),
+			std::make_shared<providers::DefaultHTTPClientProvider>(nullptr, metricsRegistry),
+			timingProvider,
+			responseAttributesStore,
+			metricsRegistry,
+			std::make_shared<core::BeaconSendingScheduler>(logger, taskExecutor)
+		);
+	}
+}
+
+SidecarAgent::SidecarAgent(openkit::IOpenKitBuilder& builder, const std::string& ringDirectory)
+	: mLogger(builder.getLogger())
+	, mPrivacyConfiguration(core::configuration::PrivacyConfiguration::from(builder))
+	, mOpenKitConfiguration(core::configuration::OpenKitConfiguration::from(builder))
+	, mTimingProvider(std::make_shared<providers::DefaultTimingProvider>())
+	, mSessionIDProvider(std::make_shared<providers::DefaultSessionIDProvider>())
+	, mMetricsRegistry(createMetricsRegistry(mOpenKitConfiguration))
+	, mTaskExecutor(std::make_shared<core::util::TaskExecutor>(1))
+	, mBeaconCache(std::make_shared<core::caching::BeaconCache>(mLogger, mMetricsRegistry))
+	, mBeaconSender(createBeaconSender(mLogger, mOpenKitConfiguration, mTimingProvider, mMetricsRegistry, mTaskExecutor))
+	, mBeaconCacheEvictor(std::make_shared<core::caching::BeaconCacheEvictor>(
+		mLogger,
+		mBeaconCache,
+		core::configuration::BeaconCacheConfiguration::from(builder),
+		mTimingProvider
+	))
+	, mRingDirectory(ringDirectory)
+	, mAttachedRings()
+	, mMutex()
+	, mNumberOfReadRecords(0)
+	, mNumberOfOrphanedRecords(0)
+	, mNumberOfDroppedRecordsOfDetachedRings(0)
+	, mNumberOfDroppedBytesOfDetachedRings(0)
+	, mIsShutdown(false)
+{
+	core::objects::OpenKit::globalInit();
+}
+
+SidecarAgent::SidecarAgent(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::configuration::IPrivacyConfiguration> privacyConfiguration,
+	std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+	std::shared_ptr<core::IBeaconSender> beaconSender,
+	std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+	const std::string& ringDirectory
+)
+	: mLogger(logger)
+	, mPrivacyConfiguration(privacyConfiguration)
+	, mOpenKitConfiguration(openKitConfiguration)
+	, mTimingProvider(timingProvider)
+	, mSessionIDProvider(sessionIDProvider)
+	, mMetricsRegistry(metricsRegistry)
+	, mTaskExecutor(nullptr)
+	, mBeaconCache(beaconCache)
+	, mBeaconSender(beaconSender)
+	, mBeaconCacheEvictor(beaconCacheEvictor)
+	, mRingDirectory(ringDirectory)
+	, mAttachedRings()
+	, mMutex()
+	, mNumberOfReadRecords(0)
+	, mNumberOfOrphanedRecords(0)
+	, mNumberOfDroppedRecordsOfDetachedRings(0)
+	, mNumberOfDroppedBytesOfDetachedRings(0)
+	, mIsShutdown(false)
+{
+	core::objects::OpenKit::globalInit();
+}
+
+SidecarAgent::~SidecarAgent()
+{
+	// join the sending and eviction threads before the global destruction
+	mBeaconCacheEvictor = nullptr;
+	mBeaconSender = nullptr;
+	mTaskExecutor = nullptr;
+
+	core::objects::OpenKit::globalShutdown();
+}
+
+void SidecarAgent::initialize()
+{
+	mBeaconCacheEvictor->start();
+	mBeaconSender->initialize();
+}
+
+size_t SidecarAgent::scanRingDirectory()
+{
+	size_t numberOfAttachedRings = 0;
+	for (const auto& path : SharedMemoryRing::listRingFiles(mRingDirectory))
+	{
+		if (mAttachedRings.find(path) != mAttachedRings.end())
+		{
+			continue;
+		}
+
+		auto ring = SharedMemoryRing::open(path);
+		if (ring == nullptr)
+		{
+			// either not fully initialized by the worker so far or not a ring at all, retried with the next scan
+			continue;
+		}
+
+		if (mLogger->isInfoEnabled())
+		{
+			mLogger->info("SidecarAgent - attached ring %s of process %" PRId64, path.c_str(), ring->getProducerProcessID());
+		}
+
+		mAttachedRings.emplace(path, AttachedRing(ring));
+		numberOfAttachedRings++;
+	}
+
+	// workers cannot receive the server configuration themselves
+	auto serverID = mBeaconSender->getCurrentServerID();
+	for (auto& entry : mAttachedRings)
+	{
+		entry.second.ring->setServerID(serverID);
+	}
+
+	return numberOfAttachedRings;
+}
+
+size_t SidecarAgent::pollRings()
+{
+	size_t numberOfRecords = 0;
+
+	auto it = mAttachedRings.begin();
+	while (it != mAttachedRings.end())
+	{
+		auto& attachedRing = it->second;
+
+		// checked before reading, so that no record written before the worker finished is lost
+		auto isFinished = attachedRing.ring->isClosed() || !attachedRing.ring->isProducerAlive();
+
+		numberOfRecords += readRing(attachedRing);
+		if (!isFinished)
+		{
+			++it;
+			continue;
+		}
+
+		while (auto numberOfDrainedRecords = readRing(attachedRing))
+		{
+			numberOfRecords += numberOfDrainedRecords;
+		}
+
+		detachRing(attachedRing);
+		it = mAttachedRings.erase(it);
+	}
+
+	return numberOfRecords;
+}
+
+size_t SidecarAgent::readRing(AttachedRing& attachedRing)
+{
+	auto numberOfRecords = attachedRing.ring->read(
+		[this, &attachedRing](const SidecarRecord& record)
+		{
+			handleRecord(attachedRing, record);
+		},
+		MAX_RECORDS_PER_POLL
+	);
+	mNumberOfReadRecords += static_cast<int64_t>(numberOfRecords);
+
+	return numberOfRecords;
+}
+
+void SidecarAgent::handleRecord(AttachedRing& attachedRing, const SidecarRecord& record)
+{
+	if (record.type == SidecarRecordType::BEACON_START)
+	{
+		startRemoteSession(attachedRing, record);
+		return;
+	}
+
+	auto it = attachedRing.sessions.find(record.beaconID);
+	if (it == attachedRing.sessions.end())
+	{
+		mNumberOfOrphanedRecords++;
+		return;
+	}
+
+	auto& remoteSession = it->second;
+	switch (record.type)
+	{
+	case SidecarRecordType::EVENT_DATA:
+		remoteSession.beacon->addEventData(record.timestamp, core::UTF8String(record.payload, record.payloadSize));
+		break;
+	case SidecarRecordType::ACTION_DATA:
+		remoteSession.beacon->addActionData(record.timestamp, core::UTF8String(record.payload, record.payloadSize));
+		break;
+	case SidecarRecordType::DELETE_DATA:
+		remoteSession.beacon->clearData();
+		break;
+	case SidecarRecordType::BEACON_END:
+		{
+			auto session = remoteSession.session;
+			attachedRing.sessions.erase(it);
+			session->end();
+		}
+		break;
+	default:
+		mNumberOfOrphanedRecords++;
+		break;
+	}
+}
+
+void SidecarAgent::startRemoteSession(AttachedRing& attachedRing, const SidecarRecord& record)
+{
+	// payload layout: [uint32_t length of client IP][client IP][immutable beacon data]
+	uint32_t clientIPAddressLength = 0;
+	if (record.payloadSize < sizeof(clientIPAddressLength))
+	{
+		mNumberOfOrphanedRecords++;
+		return;
+	}
+	std::memcpy(&clientIPAddressLength, record.payload, sizeof(clientIPAddressLength));
+	if (clientIPAddressLength > record.payloadSize - sizeof(clientIPAddressLength))
+	{
+		mNumberOfOrphanedRecords++;
+		return;
+	}
+
+	auto clientIPAddress = core::UTF8String(record.payload + sizeof(clientIPAddressLength), clientIPAddressLength);
+	auto immutableDataOffset = sizeof(clientIPAddressLength) + clientIPAddressLength;
+	auto immutableBeaconData = core::UTF8String(record.payload + immutableDataOffset, record.payloadSize - immutableDataOffset);
+
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if (mIsShutdown)
+		{
+			return;
+		}
+
+		auto beaconConfiguration = core::configuration::BeaconConfiguration::from(
+			mOpenKitConfiguration,
+			mPrivacyConfiguration,
+			mBeaconSender->getCurrentServerID()
+		);
+
+		auto beacon = std::make_shared<protocol::Beacon>(
+			mLogger,
+			mBeaconCache,
+			beaconConfiguration,
+			clientIPAddress,
+			record.value,
+			record.timestamp,
+			immutableBeaconData,
+			mSessionIDProvider,
+			mTimingProvider,
+			mMetricsRegistry
+		);
+		auto session = std::make_shared<core::objects::Session>(
+			mLogger,
+			shared_from_this(),
+			beacon
+		);
+		session->startSession();
+		mBeaconSender->addSession(session);
+
+		storeChildInList(session);
+
+		attachedRing.sessions.erase(record.beaconID);
+		attachedRing.sessions.emplace(record.beaconID, RemoteSession(beacon, session));
+	}
+}
+
+void SidecarAgent::detachRing(AttachedRing& attachedRing)
+{
+	// sessions not ended by the worker, e.g. because it crashed, are ended here to get their data sent
+	for (auto& entry : attachedRing.sessions)
+	{
+		entry.second.session->end();
+	}
+	attachedRing.sessions.clear();
+
+	mNumberOfDroppedRecordsOfDetachedRings += static_cast<int64_t>(attachedRing.ring->getNumberOfDroppedRecords());
+	mNumberOfDroppedBytesOfDetachedRings += static_cast<int64_t>(attachedRing.ring->getNumberOfDroppedBytes());
+
+	if (mLogger->isInfoEnabled())
+	{
+		mLogger->info("SidecarAgent - detached ring %s (written %" PRIu64 " records, dropped %" PRIu64 " records)",
+			attachedRing.ring->getPath().c_str(),
+			attachedRing.ring->getNumberOfWrittenRecords(),
+			attachedRing.ring->getNumberOfDroppedRecords());
+	}
+
+	attachedRing.ring->remove();
+}
+
+openkit::ShutdownResult SidecarAgent::shutdown(int64_t timeoutMillis)
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("SidecarAgent shutdown requested (timeout=%" PRId64 "ms)", timeoutMillis);
+	}
+
+	openkit::ShutdownResult result;
+	result.isCompleted = true;
+	result.numberOfFlushedRecords = 0;
+	result.numberOfDroppedRecords = 0;
+
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if (mIsShutdown)
+		{
+			return result;
+		}
+
+		mIsShutdown = true;
+	}
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMillis, int64_t(0)));
+	auto getRemainingTime = [deadline]()
+	{
+		auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+		return std::max(remaining, std::chrono::milliseconds::zero());
+	};
+
+	// end all sessions, the sessions of running workers are not continued
+	closeChildObjects(mMutex);
+	for (auto& entry : mAttachedRings)
+	{
+		entry.second.sessions.clear();
+	}
+
+	mBeaconCacheEvictor->stop(getRemainingTime());
+	result = mBeaconSender->shutdown(deadline);
+
+	if (mTaskExecutor != nullptr && !mTaskExecutor->shutdown(getRemainingTime()))
+	{
+		mLogger->warning("SidecarAgent shutdown() - beacon sending and cache eviction not finished in time");
+		result.isCompleted = false;
+	}
+
+	if (mLogger->isInfoEnabled())
+	{
+		mLogger->info("SidecarAgent shutdown finished - flushed %" PRId64 " records, dropped %" PRId64 " records",
+			result.numberOfFlushedRecords, result.numberOfDroppedRecords);
+	}
+
+	return result;
+}
+
+size_t SidecarAgent::getNumberOfAttachedRings() const
+{
+	return mAttachedRings.size();
+}
+
+size_t SidecarAgent::getNumberOfOpenSessions() const
+{
+	size_t numberOfSessions = 0;
+	for (const auto& entry : mAttachedRings)
+	{
+		numberOfSessions += entry.second.sessions.size();
+	}
+
+	return numberOfSessions;
+}
+
+int64_t SidecarAgent::getNumberOfReadRecords() const
+{
+	return mNumberOfReadRecords;
+}
+
+int64_t SidecarAgent::getNumberOfOrphanedRecords() const
+{
+	return mNumberOfOrphanedRecords;
+}
+
+int64_t SidecarAgent::getNumberOfDroppedRecords() const
+{
+	int64_t numberOfDroppedRecords = mNumberOfDroppedRecordsOfDetachedRings;
+	for (const auto& entry : mAttachedRings)
+	{
+		numberOfDroppedRecords += static_cast<int64_t>(entry.second.ring->getNumberOfDroppedRecords());
+	}
+
+	return numberOfDroppedRecords;
+}
+
+int64_t SidecarAgent::getNumberOfDroppedBytes() const
+{
+	int64_t numberOfDroppedBytes = mNumberOfDroppedBytesOfDetachedRings;
+	for (const auto& entry : mAttachedRings)
+	{
+		numberOfDroppedBytes += static_cast<int64_t>(entry.second.ring->getNumberOfDroppedBytes());
+	}
+
+	return numberOfDroppedBytes;
+}
+
+openkit::Statistics SidecarAgent::getStatistics() const
+{
+	if (mMetricsRegistry == nullptr)
+	{
+		openkit::Statistics statistics = {};
+		statistics.isEnabled = false;
+		return statistics;
+	}
+
+	auto statistics = mMetricsRegistry->getSnapshot();
+
+	auto beaconIDs = mBeaconCache->getBeaconIDs();
+	statistics.beaconCacheSizeInBytes = mBeaconCache->getNumBytesInCache();
+	statistics.numberOfCachedSessions = static_cast<int64_t>(beaconIDs->size());
+	for (auto beaconID : *beaconIDs)
+	{
+		statistics.numberOfCachedRecords += static_cast<int64_t>(mBeaconCache->getNumberOfRecords(beaconID));
+	}
+
+	// records dropped by the workers are counted in their rings
+	statistics.numberOfSidecarRecordsDropped = getNumberOfDroppedRecords();
+	statistics.numberOfSidecarBytesDropped = getNumberOfDroppedBytes();
+
+	return statistics;
+}
+
+void SidecarAgent::onChildClosed(std::shared_ptr<core::objects::IOpenKitObject> childObject)
+{
+	// synchronized scope
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	removeChildFromList(childObject);
+}
+
+void SidecarAgent::close()
+{
+	shutdown(SHUTDOWN_TIMEOUT.count());
+}
@@ -0,0 +1,294 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_SIDECAR_SIDECARAGENT_H
+#define _CORE_SIDECAR_SIDECARAGENT_H
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor" // enable_shared_from_this has a public non virtual destructor throwing a false positive in this code
+#endif
+
+#include "SharedMemoryRing.h"
+#include "OpenKit/ILogger.h"
+#include "OpenKit/IOpenKitBuilder.h"
+#include "OpenKit/ShutdownResult.h"
+#include "core/IBeaconSender.h"
+#include "core/caching/IBeaconCache.h"
+#include "core/caching/IBeaconCacheEvictor.h"
+#include "core/configuration/IOpenKitConfiguration.h"
+#include "core/configuration/IPrivacyConfiguration.h"
+#include "core/objects/OpenKitComposite.h"
+#include "core/objects/Session.h"
+#include "core/util/MetricsRegistry.h"
+#include "core/util/TaskExecutor.h"
+#include "protocol/Beacon.h"
+#include "providers/ISessionIDProvider.h"
+#include "providers/ITimingProvider.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace core
+{
+	namespace sidecar
+	{
+		///
+		/// The OpenKit agent, which caches and sends the data of all OpenKit worker processes running in sidecar mode.
+		///
+		/// Worker processes write their data to @ref SharedMemoryRing files in the ring directory. The agent attaches
+		/// to new rings via @ref scanRingDirectory and reads all rings via @ref pollRings. For each beacon started by
+		/// a worker, the agent creates a session with a beacon recorded remotely, adds the data read from the ring to
+		/// its own beacon cache and sends it like any other session. Rings are detached and removed, once they are
+		/// closed by the worker or the worker terminated, and all their data has been read.
+		///
+		/// @ref scanRingDirectory and @ref pollRings must be called from the same thread, the agent does not run
+		/// its own polling thread. Beacon sending and cache eviction run on a single own thread.
+		///
+		class SidecarAgent
+			: public core::objects::OpenKitComposite
+			, public std::enable_shared_from_this<SidecarAgent>
+		{
+		public:
+			///
+			/// Constructor taking the configuration from the given builder
+			/// @param[in] builder the builder holding the configuration of the agent
+			/// @param[in] ringDirectory the directory of the ring files
+			///
+			SidecarAgent(openkit::IOpenKitBuilder& builder, const std::string& ringDirectory);
+
+			///
+			/// Constructor not using defaults at all
+			/// @param[in] logger to write traces to
+			/// @param[in] privacyConfiguration the privacy configuration of created beacons
+			/// @param[in] openKitConfiguration the application configuration of created beacons
+			/// @param[in] timingProvider timing provider used to retrieve timestamps
+			/// @param[in] sessionIDProvider provider for the beacon ids used in the agent's beacon cache
+			/// @param[in] beaconCache the cache holding the data of all workers
+			/// @param[in] beaconSender the sender sending the data of all workers
+			/// @param[in] beaconCacheEvictor the evictor keeping the cache in its boundaries
+			/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+			/// @param[in] ringDirectory the directory of the ring files
+			///
+			SidecarAgent(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<core::configuration::IPrivacyConfiguration> privacyConfiguration,
+				std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration,
+				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+				std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+				std::shared_ptr<core::IBeaconSender> beaconSender,
+				std::shared_ptr<core::caching::IBeaconCacheEvictor> beaconCacheEvictor,
+				std::shared_ptr<core::util::MetricsRegistry> metricsRegistry,
+				const std::string& ringDirectory
+			);
+
+			///
+			/// Destructor
+			///
+			~SidecarAgent() override;
+
+			///
+			/// Starts beacon sending and cache eviction.
+			///
+			void initialize();
+
+			///
+			/// Attaches to all rings in the ring directory not attached so far
+			/// and publishes the current server ID to all attached rings.
+			/// @return the number of newly attached rings
+			///
+			size_t scanRingDirectory();
+
+			///
+			/// Reads the records of all attached rings and detaches the rings which are finished.
+			/// @return the number of records read
+			///
+			size_t pollRings();
+
+			///
+			/// Ends all sessions and sends their data until the given timeout expires.
+			///
+			/// Rings of running workers are kept, so that a restarted agent can continue reading them.
+			/// @param[in] timeoutMillis the maximum time to wait for sending all data
+			/// @return the number of records sent and discarded
+			///
+			openkit::ShutdownResult shutdown(int64_t timeoutMillis);
+
+			///
+			/// @return the number of currently attached rings
+			///
+			size_t getNumberOfAttachedRings() const;
+
+			///
+			/// @return the number of sessions started by workers, which are not ended so far
+			///
+			size_t getNumberOfOpenSessions() const;
+
+			///
+			/// @return the number of records read from all rings
+			///
+			int64_t getNumberOfReadRecords() const;
+
+			///
+			/// @return the number of records read for unknown beacons, e.g. because the agent was restarted
+			///
+			int64_t getNumberOfOrphanedRecords() const;
+
+			///
+			/// @return the number of records the workers dropped, because their ring was full
+			///
+			int64_t getNumberOfDroppedRecords() const;
+
+			///
+			/// @return the number of payload bytes the workers dropped, because their ring was full
+			///
+			int64_t getNumberOfDroppedBytes() const;
+
+			///
+			/// @return the agent's own statistics, which are only collected if enabled on the builder
+			///
+			openkit::Statistics getStatistics() const;
+
+			void onChildClosed(std::shared_ptr<core::objects::IOpenKitObject> childObject) override;
+
+			void close() override;
+
+		private:
+			///
+			/// A session started by a worker, together with its beacon.
+			///
+			struct RemoteSession
+			{
+				RemoteSession(std::shared_ptr<protocol::Beacon> beacon, std::shared_ptr<core::objects::Session> session)
+					: beacon(beacon)
+					, session(session)
+				{
+				}
+
+				/// the beacon the worker's data is added to
+				std::shared_ptr<protocol::Beacon> beacon;
+
+				/// the session sending the beacon
+				std::shared_ptr<core::objects::Session> session;
+			};
+
+			///
+			/// An attached ring and the sessions started by its worker, keyed by the worker's beacon ids.
+			///
+			struct AttachedRing
+			{
+				explicit AttachedRing(std::shared_ptr<SharedMemoryRing> ring)
+					: ring(ring)
+					, sessions()
+				{
+				}
+
+				/// the ring shared with the worker
+				std::shared_ptr<SharedMemoryRing> ring;
+
+				/// the worker's open sessions
+				std::unordered_map<int32_t, RemoteSession> sessions;
+			};
+
+			///
+			/// Handles a single record read from the given ring.
+			///
+			void handleRecord(AttachedRing& attachedRing, const SidecarRecord& record);
+
+			///
+			/// Creates the session for a beacon started by a worker.
+			///
+			void startRemoteSession(AttachedRing& attachedRing, const SidecarRecord& record);
+
+			///
+			/// Reads all records of the given ring.
+			/// @return the number of records read
+			///
+			size_t readRing(AttachedRing& attachedRing);
+
+			///
+			/// Ends all sessions of the given ring and removes its file.
+			///
+			void detachRing(AttachedRing& attachedRing);
+
+			/// Logger to write traces to
+			const std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// the privacy configuration of created beacons
+			const std::shared_ptr<core::configuration::IPrivacyConfiguration> mPrivacyConfiguration;
+
+			/// the application configuration of created beacons
+			const std::shared_ptr<core::configuration::IOpenKitConfiguration> mOpenKitConfiguration;
+
+			/// timing provider
+			const std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+
+			/// provider for the beacon ids used in the agent's beacon cache
+			const std::shared_ptr<providers::ISessionIDProvider> mSessionIDProvider;
+
+			/// registry collecting statistics, @c nullptr if statistics are disabled
+			const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+
+			/// executor running beacon sending, @c nullptr if sender and evictor were injected
+			std::shared_ptr<core::util::TaskExecutor> mTaskExecutor;
+
+			/// the cache holding the data of all workers
+			const std::shared_ptr<core::caching::IBeaconCache> mBeaconCache;
+
+			/// the sender sending the data of all workers
+			std::shared_ptr<core::IBeaconSender> mBeaconSender;
+
+			/// the evictor keeping the cache in its boundaries
+			std::shared_ptr<core::caching::IBeaconCacheEvictor> mBeaconCacheEvictor;
+
+			/// the directory of the ring files
+			const std::string mRingDirectory;
+
+			/// the attached rings, keyed by their path
+			std::map<std::string, AttachedRing> mAttachedRings;
+
+			/// mutex synchronizing the list of child objects
+			std::mutex mMutex;
+
+			/// number of records read from all rings
+			std::atomic<int64_t> mNumberOfReadRecords;
+
+			/// number of records read for unknown beacons
+			std::atomic<int64_t> mNumberOfOrphanedRecords;
+
+			/// number of records dropped by the workers of detached rings
+			std::atomic<int64_t> mNumberOfDroppedRecordsOfDetachedRings;
+
+			/// number of bytes dropped by the workers of detached rings
+			std::atomic<int64_t> mNumberOfDroppedBytesOfDetachedRings;
+
+			/// flag indicating whether the agent was shut down
+			bool mIsShutdown;
+		};
+	}
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+#endif
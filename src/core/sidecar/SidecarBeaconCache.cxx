@@ -0,0 +1,199 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SidecarBeaconCache.h"
+
+
+using namespace core::sidecar;
+
+SidecarBeaconCache::SidecarBeaconCache(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<SharedMemoryRing> ring,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+)
+	: mLogger(logger)
+	, mRing(ring)
+	, mMutex()
+	, mBeaconIDs(std::make_shared<const std::vector<int32_t>>())
+	, mMetricsRegistry(metricsRegistry)
+{
+}
+
+bool SidecarBeaconCache::write(SidecarRecordType type, int32_t beaconID, int64_t timestamp, int32_t value, const std::string& payload)
+{
+	if (mRing->write(type, beaconID, timestamp, value, payload.data(), payload.size()))
+	{
+		return true;
+	}
+
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getSidecarRecordsDropped().increment();
+		mMetricsRegistry->getSidecarBytesDropped().add(static_cast<int64_t>(payload.size()));
+	}
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("SidecarBeaconCache write(sn=%d) - ring is full, dropped record of %zu bytes", beaconID, payload.size());
+	}
+
+	return false;
+}
+
+void SidecarBeaconCache::addObserver(core::caching::IObserver* /* observer */)
+{
+	// nothing is cached in this process, therefore there is nothing to observe
+}
+
+void SidecarBeaconCache::addEventData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data)
+{
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		write(SidecarRecordType::EVENT_DATA, beaconID, timestamp, 0, data.getStringData());
+	}
+
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getEventRecordsAdded().increment();
+	}
+}
+
+void SidecarBeaconCache::addEventData(int32_t beaconID, const std::vector<core::caching::BeaconCacheRecord>& records)
+{
+	if (records.empty())
+	{
+		return;
+	}
+
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (const auto& record : records)
+		{
+			write(SidecarRecordType::EVENT_DATA, beaconID, record.getTimestamp(), 0, record.getData().getStringData());
+		}
+	}
+
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getEventRecordsAdded().add(static_cast<int64_t>(records.size()));
+	}
+}
+
+void SidecarBeaconCache::addActionData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data)
+{
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		write(SidecarRecordType::ACTION_DATA, beaconID, timestamp, 0, data.getStringData());
+	}
+
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getActionRecordsAdded().increment();
+	}
+}
+
+void SidecarBeaconCache::addBeacon(
+	int32_t beaconID,
+	int64_t sessionStartTime,
+	int32_t sessionNumber,
+	const core::UTF8String& clientIPAddress,
+	const core::UTF8String& immutableBeaconData
+)
+{
+	// payload: length of the client IP address, client IP address, basic beacon data
+	const auto& ipAddress = clientIPAddress.getStringData();
+	auto ipAddressLength = static_cast<uint32_t>(ipAddress.size());
+
+	std::string payload(reinterpret_cast<const char*>(&ipAddressLength), sizeof(ipAddressLength));
+	payload.append(ipAddress);
+	payload.append(immutableBeaconData.getStringData());
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	write(SidecarRecordType::BEACON_START, beaconID, sessionStartTime, sessionNumber, payload);
+}
+
+void SidecarBeaconCache::endBeacon(int32_t beaconID)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	write(SidecarRecordType::BEACON_END, beaconID, 0, 0, std::string());
+}
+
+void SidecarBeaconCache::deleteCacheEntry(int32_t beaconID)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	write(SidecarRecordType::DELETE_DATA, beaconID, 0, 0, std::string());
+}
+
+const core::UTF8String SidecarBeaconCache::getNextBeaconChunk(
+	int32_t /* beaconID */,
+	const core::UTF8String& /* chunkPrefix */,
+	int32_t /* maxSize */,
+	const core::UTF8String& /* delimiter */
+)
+{
+	return core::UTF8String();
+}
+
+void SidecarBeaconCache::removeChunkedData(int32_t /* beaconID */)
+{
+}
+
+void SidecarBeaconCache::resetChunkedData(int32_t /* beaconID */)
+{
+}
+
+bool SidecarBeaconCache::hasMoreChunks(int32_t /* beaconID */)
+{
+	return false;
+}
+
+core::caching::IBeaconCache::BeaconIDSnapshot SidecarBeaconCache::getBeaconIDs()
+{
+	return mBeaconIDs;
+}
+
+void SidecarBeaconCache::visitEventData(int32_t /* beaconID */, const RecordVisitor& /* visitor */)
+{
+}
+
+void SidecarBeaconCache::visitActionData(int32_t /* beaconID */, const RecordVisitor& /* visitor */)
+{
+}
+
+uint32_t SidecarBeaconCache::evictRecordsByAge(int32_t /* beaconID */, int64_t /* minTimestamp */)
+{
+	return 0;
+}
+
+uint32_t SidecarBeaconCache::evictRecordsByNumber(int32_t /* beaconID */, uint32_t /* numRecords */)
+{
+	return 0;
+}
+
+int64_t SidecarBeaconCache::getNumBytesInCache() const
+{
+	return 0;
+}
+
+bool SidecarBeaconCache::isEmpty(int32_t /* beaconID */)
+{
+	return true;
+}
+
+size_t SidecarBeaconCache::getNumberOfRecords(int32_t /* beaconID */)
+{
+	return 0;
+}
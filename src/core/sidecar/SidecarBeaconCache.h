@@ -0,0 +1,138 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_SIDECAR_SIDECARBEACONCACHE_H
+#define _CORE_SIDECAR_SIDECARBEACONCACHE_H
+
+#include "SharedMemoryRing.h"
+#include "OpenKit/ILogger.h"
+#include "core/caching/IBeaconCache.h"
+#include "core/util/MetricsRegistry.h"
+
+#include <memory>
+#include <mutex>
+
+namespace core
+{
+	namespace sidecar
+	{
+		///
+		/// Beacon cache of an OpenKit worker process in sidecar mode.
+		///
+		/// Instead of caching the data until it is sent, all data is immediately forwarded to the OpenKit agent
+		/// process via a @ref SharedMemoryRing. Caching, eviction and sending are performed by the agent process,
+		/// therefore this cache always appears to be empty.
+		///
+		/// If the ring is full, the data is dropped and counted in the ring and in the metrics registry.
+		///
+		class SidecarBeaconCache : public core::caching::IBeaconCache
+		{
+		public:
+			///
+			/// Constructor
+			/// @param[in] logger to write traces to
+			/// @param[in] ring the ring to forward all data to
+			/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+			///
+			SidecarBeaconCache(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<SharedMemoryRing> ring,
+				std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+			);
+
+			~SidecarBeaconCache() override = default;
+
+			///
+			/// Delete the copy constructor
+			///
+			SidecarBeaconCache(const SidecarBeaconCache&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			SidecarBeaconCache& operator=(const SidecarBeaconCache&) = delete;
+
+			void addObserver(core::caching::IObserver* observer) override;
+
+			void addEventData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) override;
+
+			void addEventData(int32_t beaconID, const std::vector<core::caching::BeaconCacheRecord>& records) override;
+
+			void addActionData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data) override;
+
+			void addBeacon(
+				int32_t beaconID,
+				int64_t sessionStartTime,
+				int32_t sessionNumber,
+				const core::UTF8String& clientIPAddress,
+				const core::UTF8String& immutableBeaconData
+			) override;
+
+			void endBeacon(int32_t beaconID) override;
+
+			void deleteCacheEntry(int32_t beaconID) override;
+
+			const core::UTF8String getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) override;
+
+			void removeChunkedData(int32_t beaconID) override;
+
+			void resetChunkedData(int32_t beaconID) override;
+
+			bool hasMoreChunks(int32_t beaconID) override;
+
+			BeaconIDSnapshot getBeaconIDs() override;
+
+			void visitEventData(int32_t beaconID, const RecordVisitor& visitor) override;
+
+			void visitActionData(int32_t beaconID, const RecordVisitor& visitor) override;
+
+			uint32_t evictRecordsByAge(int32_t beaconID, int64_t minTimestamp) override;
+
+			uint32_t evictRecordsByNumber(int32_t beaconID, uint32_t numRecords) override;
+
+			int64_t getNumBytesInCache() const override;
+
+			bool isEmpty(int32_t beaconID) override;
+
+			size_t getNumberOfRecords(int32_t beaconID) override;
+
+		private:
+			///
+			/// Write a record to the ring, the caller must hold @ref mMutex.
+			/// @return @c true if the record was written, @c false if it was dropped
+			///
+			bool write(SidecarRecordType type, int32_t beaconID, int64_t timestamp, int32_t value, const std::string& payload);
+
+			/// Logger to write traces to
+			const std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// the ring to forward all data to
+			const std::shared_ptr<SharedMemoryRing> mRing;
+
+			/// serializes all writers, since the ring supports a single producer only
+			std::mutex mMutex;
+
+			/// beacon ids of this cache, which is always empty
+			const BeaconIDSnapshot mBeaconIDs;
+
+			/// registry to record metrics in, @c nullptr if statistics are disabled
+			const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+		};
+	}
+}
+
+#endif
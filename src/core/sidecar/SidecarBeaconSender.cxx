@@ -0,0 +1,88 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SidecarBeaconSender.h"
+
+#include <cinttypes>
+
+using namespace core::sidecar;
+
+SidecarBeaconSender::SidecarBeaconSender(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<SharedMemoryRing> ring,
+	int32_t defaultServerID
+)
+	: mLogger(logger)
+	, mRing(ring)
+	, mDefaultServerID(defaultServerID)
+{
+}
+
+bool SidecarBeaconSender::initialize()
+{
+	if (mLogger->isInfoEnabled())
+	{
+		mLogger->info("SidecarBeaconSender initialize() - forwarding data to the agent via %s", mRing->getPath().c_str());
+	}
+
+	return true;
+}
+
+bool SidecarBeaconSender::waitForInit() const
+{
+	return true;
+}
+
+bool SidecarBeaconSender::waitForInit(int64_t /* timeoutMillis */) const
+{
+	return true;
+}
+
+bool SidecarBeaconSender::isInitialized() const
+{
+	return true;
+}
+
+openkit::ShutdownResult SidecarBeaconSender::shutdown(std::chrono::steady_clock::time_point /* deadline */)
+{
+	mRing->markClosed();
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("SidecarBeaconSender shutdown() - wrote %" PRIu64 " records, dropped %" PRIu64 " records",
+			mRing->getNumberOfWrittenRecords(), mRing->getNumberOfDroppedRecords());
+	}
+
+	// the records are sent by the agent, therefore they neither count as flushed nor as dropped
+	openkit::ShutdownResult result;
+	result.isCompleted = true;
+	result.numberOfFlushedRecords = 0;
+	result.numberOfDroppedRecords = 0;
+
+	return result;
+}
+
+int32_t SidecarBeaconSender::getCurrentServerID() const
+{
+	auto serverID = mRing->getServerID();
+	return serverID < 0 ? mDefaultServerID : serverID;
+}
+
+void SidecarBeaconSender::addSession(std::shared_ptr<core::objects::SessionInternals> /* session */)
+{
+	// the session's data is forwarded by its beacon, the agent takes care of sending it
+}
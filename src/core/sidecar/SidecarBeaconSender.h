@@ -0,0 +1,84 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_SIDECAR_SIDECARBEACONSENDER_H
+#define _CORE_SIDECAR_SIDECARBEACONSENDER_H
+
+#include "SharedMemoryRing.h"
+#include "OpenKit/ILogger.h"
+#include "core/IBeaconSender.h"
+
+#include <memory>
+
+namespace core
+{
+	namespace sidecar
+	{
+		///
+		/// Beacon sender of an OpenKit worker process in sidecar mode.
+		///
+		/// No data is sent by the worker process itself, the OpenKit agent process sends all data passed to it via
+		/// the @ref SharedMemoryRing. Therefore this sender does not start any thread and is initialized immediately.
+		///
+		class SidecarBeaconSender : public core::IBeaconSender
+		{
+		public:
+			///
+			/// Constructor
+			/// @param[in] logger to write traces to
+			/// @param[in] ring the ring shared with the agent process
+			/// @param[in] defaultServerID the server ID to use until the agent process published its current one
+			///
+			SidecarBeaconSender(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<SharedMemoryRing> ring,
+				int32_t defaultServerID
+			);
+
+			~SidecarBeaconSender() override = default;
+
+			bool initialize() override;
+
+			bool waitForInit() const override;
+
+			bool waitForInit(int64_t timeoutMillis) const override;
+
+			bool isInitialized() const override;
+
+			///
+			/// Marks the ring as closed, all data written so far is sent by the agent process.
+			///
+			openkit::ShutdownResult shutdown(std::chrono::steady_clock::time_point deadline) override;
+
+			int32_t getCurrentServerID() const override;
+
+			void addSession(std::shared_ptr<core::objects::SessionInternals> session) override;
+
+		private:
+			/// Logger to write traces to
+			const std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// the ring shared with the agent process
+			const std::shared_ptr<SharedMemoryRing> mRing;
+
+			/// the server ID to use until the agent process published its current one
+			const int32_t mDefaultServerID;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_SIDECAR_SIDECARRECORD_H
+#define _CORE_SIDECAR_SIDECARRECORD_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core
+{
+	namespace sidecar
+	{
+		///
+		/// Type of a record passed from an OpenKit worker process to the OpenKit agent process.
+		///
+		enum class SidecarRecordType : uint16_t
+		{
+			/// fills the end of the ring buffer, the next record starts at the beginning of the buffer
+			PADDING = 0,
+			/// a new beacon was started, the payload holds the client IP address and the basic beacon data
+			BEACON_START = 1,
+			/// serialized event data of a beacon
+			EVENT_DATA = 2,
+			/// serialized action data of a beacon
+			ACTION_DATA = 3,
+			/// all data cached so far for a beacon was cleared
+			DELETE_DATA = 4,
+			/// the beacon's session was ended, no more data follows
+			BEACON_END = 5
+		};
+
+		///
+		/// A record read from a @ref SharedMemoryRing.
+		///
+		/// The payload points into the ring buffer, therefore it is only valid while the record is visited.
+		///
+		struct SidecarRecord
+		{
+			/// the record's type
+			SidecarRecordType type;
+
+			/// the worker's beacon id the record belongs to
+			int32_t beaconID;
+
+			/// type specific value, the session number for @ref SidecarRecordType::BEACON_START
+			int32_t value;
+
+			/// the record's timestamp, the session start time for @ref SidecarRecordType::BEACON_START
+			int64_t timestamp;
+
+			/// the record's payload
+			const char* payload;
+
+			/// size of the payload in bytes
+			size_t payloadSize;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "MetricsRegistry.h"
+
+using namespace core::util;
+
+Histogram::Histogram()
+	: mCount(0)
+	, mSum(0)
+	, mBuckets()
+{
+	for (auto& bucket : mBuckets)
+	{
+		bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+void Histogram::record(int64_t value)
+{
+	if (value < 0)
+	{
+		value = 0;
+	}
+
+	mBuckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+	mSum.fetch_add(value, std::memory_order_relaxed);
+	mCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Histogram::recordMillisSince(std::chrono::steady_clock::time_point start)
+{
+	record(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+size_t Histogram::getBucketIndex(int64_t value)
+{
+	// the index is the number of significant bits, capped by the last bucket
+	size_t index = 0;
+	auto remaining = static_cast<uint64_t>(value < 0 ? 0 : value);
+	while (remaining != 0 && index < openkit::NUMBER_OF_HISTOGRAM_BUCKETS - 1)
+	{
+		remaining >>= 1;
+		index++;
+	}
+
+	return index;
+}
+
+openkit::HistogramStatistics Histogram::getSnapshot() const
+{
+	openkit::HistogramStatistics snapshot = {};
+	snapshot.count = mCount.load(std::memory_order_relaxed);
+	snapshot.sum = mSum.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < openkit::NUMBER_OF_HISTOGRAM_BUCKETS; i++)
+	{
+		snapshot.buckets[i] = mBuckets[i].load(std::memory_order_relaxed);
+	}
+
+	return snapshot;
+}
+
+MetricsRegistry::MetricsRegistry()
+	: mEventRecordsAdded()
+	, mActionRecordsAdded()
+	, mRecordsEvictedByAge()
+	, mRecordsEvictedBySpace()
+	, mBeaconChunkSize()
+	, mUncompressedBeaconBytes()
+	, mCompressedBeaconBytes()
+	, mBeaconSendDuration()
+	, mHTTPRequests()
+	, mHTTPRetries()
+	, mHTTPErrors()
+	, mHTTPTooManyRequestsResponses()
+	, mHTTPRequestDuration()
+	, mSendingSessions()
+	, mTimeInInitialState()
+	, mTimeInCaptureOnState()
+	, mTimeInCaptureOffState()
+	, mTimeInFlushSessionsState()
+	, mSidecarRecordsDropped()
+	, mSidecarBytesDropped()
+{
+}
+
+openkit::Statistics MetricsRegistry::getSnapshot() const
+{
+	openkit::Statistics snapshot = {};
+	snapshot.isEnabled = true;
+	snapshot.numberOfEventRecordsAdded = mEventRecordsAdded.getValue();
+	snapshot.numberOfActionRecordsAdded = mActionRecordsAdded.getValue();
+	snapshot.numberOfRecordsEvictedByAge = mRecordsEvictedByAge.getValue();
+	snapshot.numberOfRecordsEvictedBySpace = mRecordsEvictedBySpace.getValue();
+	snapshot.beaconChunkSizeInBytes = mBeaconChunkSize.getSnapshot();
+	snapshot.numberOfUncompressedBeaconBytes = mUncompressedBeaconBytes.getValue();
+	snapshot.numberOfCompressedBeaconBytes = mCompressedBeaconBytes.getValue();
+	snapshot.beaconSendDurationInMillis = mBeaconSendDuration.getSnapshot();
+	snapshot.numberOfHTTPRequests = mHTTPRequests.getValue();
+	snapshot.numberOfHTTPRetries = mHTTPRetries.getValue();
+	snapshot.numberOfHTTPErrors = mHTTPErrors.getValue();
+	snapshot.numberOfHTTPTooManyRequestsResponses = mHTTPTooManyRequestsResponses.getValue();
+	snapshot.httpRequestDurationInMillis = mHTTPRequestDuration.getSnapshot();
+	snapshot.numberOfSendingSessions = mSendingSessions.getValue();
+	snapshot.timeInInitialStateInMillis = mTimeInInitialState.getValue();
+	snapshot.timeInCaptureOnStateInMillis = mTimeInCaptureOnState.getValue();
+	snapshot.timeInCaptureOffStateInMillis = mTimeInCaptureOffState.getValue();
+	snapshot.timeInFlushSessionsStateInMillis = mTimeInFlushSessionsState.getValue();
+	snapshot.numberOfSidecarRecordsDropped = mSidecarRecordsDropped.getValue();
+	snapshot.numberOfSidecarBytesDropped = mSidecarBytesDropped.getValue();
+
+	return snapshot;
+}
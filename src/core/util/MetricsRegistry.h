@@ -0,0 +1,286 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_UTIL_METRICSREGISTRY_H
+#define _CORE_UTIL_METRICSREGISTRY_H
+
+#include "OpenKit/Statistics.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Monotonically increasing value, safe to be incremented concurrently without locking
+		///
+		class Counter
+		{
+		public:
+
+			Counter()
+				: mValue(0)
+			{
+			}
+
+			Counter(const Counter&) = delete;
+
+			Counter& operator=(const Counter&) = delete;
+
+			///
+			/// Adds the given amount to the counter
+			/// @param[in] amount the amount to add
+			///
+			void add(int64_t amount)
+			{
+				mValue.fetch_add(amount, std::memory_order_relaxed);
+			}
+
+			///
+			/// Increments the counter by one
+			///
+			void increment()
+			{
+				add(1);
+			}
+
+			///
+			/// Returns the current value of the counter
+			///
+			int64_t getValue() const
+			{
+				return mValue.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			/// the current value
+			std::atomic<int64_t> mValue;
+		};
+
+		///
+		/// Value which may go up and down, safe to be modified concurrently without locking
+		///
+		class Gauge
+		{
+		public:
+
+			Gauge()
+				: mValue(0)
+			{
+			}
+
+			Gauge(const Gauge&) = delete;
+
+			Gauge& operator=(const Gauge&) = delete;
+
+			///
+			/// Adds the given amount to the gauge, which may be negative
+			/// @param[in] amount the amount to add
+			///
+			void add(int64_t amount)
+			{
+				mValue.fetch_add(amount, std::memory_order_relaxed);
+			}
+
+			///
+			/// Sets the gauge to the given value
+			/// @param[in] value the new value
+			///
+			void set(int64_t value)
+			{
+				mValue.store(value, std::memory_order_relaxed);
+			}
+
+			///
+			/// Returns the current value of the gauge
+			///
+			int64_t getValue() const
+			{
+				return mValue.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			/// the current value
+			std::atomic<int64_t> mValue;
+		};
+
+		///
+		/// Distribution of values in @ref openkit::NUMBER_OF_HISTOGRAM_BUCKETS fixed buckets with exponentially
+		/// growing bounds, safe to be recorded concurrently without locking
+		///
+		class Histogram
+		{
+		public:
+
+			Histogram();
+
+			Histogram(const Histogram&) = delete;
+
+			Histogram& operator=(const Histogram&) = delete;
+
+			///
+			/// Records the given value
+			/// @param[in] value the value to record, negative values are counted as zero
+			///
+			void record(int64_t value);
+
+			///
+			/// Records the time elapsed since the given start time in milliseconds
+			/// @param[in] start the start time
+			///
+			void recordMillisSince(std::chrono::steady_clock::time_point start);
+
+			///
+			/// Returns the index of the bucket counting the given value
+			/// @param[in] value the value
+			///
+			static size_t getBucketIndex(int64_t value);
+
+			///
+			/// Returns a snapshot of the recorded values
+			///
+			openkit::HistogramStatistics getSnapshot() const;
+
+		private:
+
+			/// number of recorded values
+			std::atomic<int64_t> mCount;
+
+			/// sum of all recorded values
+			std::atomic<int64_t> mSum;
+
+			/// number of recorded values per bucket
+			std::atomic<int64_t> mBuckets[openkit::NUMBER_OF_HISTOGRAM_BUCKETS];
+		};
+
+		///
+		/// Self-monitoring metrics of a single OpenKit instance
+		///
+		/// @par
+		/// The registry only exists if statistics are enabled. Instrumented components hold a @c nullptr
+		/// otherwise, so that disabled statistics only cost a pointer comparison.
+		///
+		class MetricsRegistry
+		{
+		public:
+
+			MetricsRegistry();
+
+			MetricsRegistry(const MetricsRegistry&) = delete;
+
+			MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+			/// number of event records added to the beacon cache
+			Counter& getEventRecordsAdded() { return mEventRecordsAdded; }
+
+			/// number of action records added to the beacon cache
+			Counter& getActionRecordsAdded() { return mActionRecordsAdded; }
+
+			/// number of records evicted by the time eviction strategy
+			Counter& getRecordsEvictedByAge() { return mRecordsEvictedByAge; }
+
+			/// number of records evicted by the space eviction strategy
+			Counter& getRecordsEvictedBySpace() { return mRecordsEvictedBySpace; }
+
+			/// sizes of the beacon chunks taken from the beacon cache
+			Histogram& getBeaconChunkSize() { return mBeaconChunkSize; }
+
+			/// number of beacon chunk bytes before compression
+			Counter& getUncompressedBeaconBytes() { return mUncompressedBeaconBytes; }
+
+			/// number of beacon chunk bytes after compression
+			Counter& getCompressedBeaconBytes() { return mCompressedBeaconBytes; }
+
+			/// durations of sending all data of a session
+			Histogram& getBeaconSendDuration() { return mBeaconSendDuration; }
+
+			/// number of HTTP requests, including retries
+			Counter& getHTTPRequests() { return mHTTPRequests; }
+
+			/// number of retried HTTP requests
+			Counter& getHTTPRetries() { return mHTTPRetries; }
+
+			/// number of failed HTTP requests
+			Counter& getHTTPErrors() { return mHTTPErrors; }
+
+			/// number of HTTP responses with status code 429
+			Counter& getHTTPTooManyRequestsResponses() { return mHTTPTooManyRequestsResponses; }
+
+			/// durations of single HTTP requests
+			Histogram& getHTTPRequestDuration() { return mHTTPRequestDuration; }
+
+			/// number of sessions known by the beacon sender
+			Gauge& getSendingSessions() { return mSendingSessions; }
+
+			/// time spent in the initial state
+			Counter& getTimeInInitialState() { return mTimeInInitialState; }
+
+			/// time spent in the capture on state
+			Counter& getTimeInCaptureOnState() { return mTimeInCaptureOnState; }
+
+			/// time spent in the capture off state
+			Counter& getTimeInCaptureOffState() { return mTimeInCaptureOffState; }
+
+			/// time spent in the flush sessions state
+			Counter& getTimeInFlushSessionsState() { return mTimeInFlushSessionsState; }
+
+			/// number of records dropped, because the sidecar ring was full
+			Counter& getSidecarRecordsDropped() { return mSidecarRecordsDropped; }
+
+			/// number of payload bytes dropped, because the sidecar ring was full
+			Counter& getSidecarBytesDropped() { return mSidecarBytesDropped; }
+
+			///
+			/// Returns a snapshot of all metrics in this registry
+			///
+			/// @par
+			/// The beacon cache size values are not tracked by the registry and left zero.
+			///
+			openkit::Statistics getSnapshot() const;
+
+		private:
+
+			Counter mEventRecordsAdded;
+			Counter mActionRecordsAdded;
+			Counter mRecordsEvictedByAge;
+			Counter mRecordsEvictedBySpace;
+			Histogram mBeaconChunkSize;
+			Counter mUncompressedBeaconBytes;
+			Counter mCompressedBeaconBytes;
+			Histogram mBeaconSendDuration;
+			Counter mHTTPRequests;
+			Counter mHTTPRetries;
+			Counter mHTTPErrors;
+			Counter mHTTPTooManyRequestsResponses;
+			Histogram mHTTPRequestDuration;
+			Gauge mSendingSessions;
+			Counter mTimeInInitialState;
+			Counter mTimeInCaptureOnState;
+			Counter mTimeInCaptureOffState;
+			Counter mTimeInFlushSessionsState;
+			Counter mSidecarRecordsDropped;
+			Counter mSidecarBytesDropped;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ObjectPool.h"
+
+#include <algorithm>
+#include <new>
+
+using namespace core::util;
+
+namespace
+{
+	/// flag whether the pool of the current thread was already destroyed during thread exit;
+	/// trivially destructible and therefore still accessible while the remaining thread locals are destroyed
+	thread_local bool isThreadLocalPoolDestroyed = false;
+
+	///
+	/// Owner of the pool of a single thread, releasing its cached blocks on thread exit.
+	///
+	struct ThreadLocalPoolOwner
+	{
+		ThreadLocalPoolOwner()
+			: pool()
+		{
+		}
+
+		~ThreadLocalPoolOwner()
+		{
+			isThreadLocalPoolDestroyed = true;
+		}
+
+		/// the pool of the thread
+		ObjectPool pool;
+	};
+
+	thread_local ThreadLocalPoolOwner threadLocalPoolOwner;
+}
+
+constexpr size_t ObjectPool::DEFAULT_MAX_CACHED_BLOCKS_PER_SIZE;
+constexpr size_t ObjectPool::MAX_NUMBER_OF_BLOCK_SIZES;
+
+ObjectPool::ObjectPool()
+	: ObjectPool(DEFAULT_MAX_CACHED_BLOCKS_PER_SIZE)
+{
+}
+
+ObjectPool::ObjectPool(size_t maxCachedBlocksPerSize)
+	: mMaxCachedBlocksPerSize(maxCachedBlocksPerSize)
+	, mSizeClasses()
+	, mNumberOfSizeClasses(0)
+{
+}
+
+ObjectPool::~ObjectPool()
+{
+	for (size_t i = 0; i < mNumberOfSizeClasses; i++)
+	{
+		auto block = mSizeClasses[i].head;
+		while (block != nullptr)
+		{
+			auto next = block->next;
+			::operator delete(block);
+			block = next;
+		}
+	}
+}
+
+ObjectPool* ObjectPool::getThreadLocalPool()
+{
+	if (isThreadLocalPoolDestroyed)
+	{
+		return nullptr;
+	}
+
+	return &threadLocalPoolOwner.pool;
+}
+
+void* ObjectPool::allocate(size_t size)
+{
+	size = std::max(size, sizeof(FreeBlock));
+
+	auto sizeClass = findSizeClass(size);
+	if (sizeClass != nullptr && sizeClass->head != nullptr)
+	{
+		auto block = sizeClass->head;
+		sizeClass->head = block->next;
+		sizeClass->numberOfBlocks--;
+
+		return block;
+	}
+
+	return ::operator new(size);
+}
+
+void ObjectPool::deallocate(void* block, size_t size)
+{
+	if (block == nullptr)
+	{
+		return;
+	}
+
+	size = std::max(size, sizeof(FreeBlock));
+
+	auto sizeClass = findSizeClass(size);
+	if (sizeClass != nullptr && sizeClass->numberOfBlocks < mMaxCachedBlocksPerSize)
+	{
+		auto freeBlock = new (block) FreeBlock;
+		freeBlock->next = sizeClass->head;
+		sizeClass->head = freeBlock;
+		sizeClass->numberOfBlocks++;
+
+		return;
+	}
+
+	::operator delete(block);
+}
+
+size_t ObjectPool::getNumberOfCachedBlocks() const
+{
+	size_t numberOfBlocks = 0;
+	for (size_t i = 0; i < mNumberOfSizeClasses; i++)
+	{
+		numberOfBlocks += mSizeClasses[i].numberOfBlocks;
+	}
+
+	return numberOfBlocks;
+}
+
+ObjectPool::SizeClass* ObjectPool::findSizeClass(size_t size)
+{
+	for (size_t i = 0; i < mNumberOfSizeClasses; i++)
+	{
+		if (mSizeClasses[i].blockSize == size)
+		{
+			return &mSizeClasses[i];
+		}
+	}
+
+	if (mNumberOfSizeClasses == MAX_NUMBER_OF_BLOCK_SIZES)
+	{
+		// all slots taken - do not pool blocks of this size
+		return nullptr;
+	}
+
+	auto& sizeClass = mSizeClasses[mNumberOfSizeClasses++];
+	sizeClass.blockSize = size;
+	sizeClass.numberOfBlocks = 0;
+	sizeClass.head = nullptr;
+
+	return &sizeClass;
+}
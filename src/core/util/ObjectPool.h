@@ -0,0 +1,139 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_OBJECTPOOL_H
+#define _CORE_UTIL_OBJECTPOOL_H
+
+#include <cstddef>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Free list allocator for small, frequently created objects.
+		///
+		/// @par
+		/// Released memory blocks are kept in a free list per block size and are handed out again on the next
+		/// allocation of the same size. The free lists are intrusive, therefore allocating and releasing a block
+		/// never allocates memory itself. Only a small number of distinct block sizes is pooled, blocks of other
+		/// sizes are passed through to the global @c operator @c new.
+		///
+		/// @par
+		/// A pool instance is not thread safe. Each thread uses its own pool obtained via
+		/// @ref getThreadLocalPool, so neither allocating nor releasing a block requires any locking. Since all
+		/// blocks are obtained from the global @c operator @c new, a block might be released to the pool of
+		/// another thread than the one it was allocated on.
+		///
+		class ObjectPool
+		{
+		public:
+
+			///
+			/// Default number of blocks kept per block size
+			///
+			static constexpr size_t DEFAULT_MAX_CACHED_BLOCKS_PER_SIZE = 64;
+
+			///
+			/// Maximum number of distinct block sizes which are pooled
+			///
+			static constexpr size_t MAX_NUMBER_OF_BLOCK_SIZES = 8;
+
+			///
+			/// Constructor keeping at most @ref DEFAULT_MAX_CACHED_BLOCKS_PER_SIZE blocks per block size.
+			///
+			ObjectPool();
+
+			///
+			/// Constructor
+			/// @param[in] maxCachedBlocksPerSize maximum number of released blocks kept per block size
+			///
+			explicit ObjectPool(size_t maxCachedBlocksPerSize);
+
+			///
+			/// Destructor releasing all cached blocks.
+			///
+			~ObjectPool();
+
+			ObjectPool(const ObjectPool&) = delete;
+			ObjectPool& operator=(const ObjectPool&) = delete;
+
+			///
+			/// Returns the pool of the calling thread, which is created on first use and destroyed on thread exit.
+			/// @return the pool of the calling thread or @c nullptr if it was already destroyed during thread exit
+			///
+			static ObjectPool* getThreadLocalPool();
+
+			///
+			/// Allocates a memory block of the given size.
+			/// @param[in] size the size of the block in bytes
+			/// @return the allocated memory block
+			/// @throws std::bad_alloc if no memory could be allocated
+			///
+			void* allocate(size_t size);
+
+			///
+			/// Releases a memory block previously obtained from @ref allocate with the same size.
+			/// @param[in] block the memory block to release
+			/// @param[in] size the size the block was allocated with
+			///
+			void deallocate(void* block, size_t size);
+
+			///
+			/// Returns the number of released blocks currently kept for reuse.
+			///
+			size_t getNumberOfCachedBlocks() const;
+
+		private:
+
+			///
+			/// Intrusive free list node stored inside a released block
+			///
+			struct FreeBlock
+			{
+				FreeBlock* next;
+			};
+
+			///
+			/// Free list of blocks having the same size
+			///
+			struct SizeClass
+			{
+				size_t blockSize;
+				size_t numberOfBlocks;
+				FreeBlock* head;
+			};
+
+			///
+			/// Returns the size class for the given block size, registering a new one if there is a free slot.
+			/// @param[in] size the block size
+			/// @return the size class or @c nullptr if the size is not pooled
+			///
+			SizeClass* findSizeClass(size_t size);
+
+			/// maximum number of released blocks kept per block size
+			const size_t mMaxCachedBlocksPerSize;
+
+			/// free lists per block size
+			SizeClass mSizeClasses[MAX_NUMBER_OF_BLOCK_SIZES];
+
+			/// number of used entries in @ref mSizeClasses
+			size_t mNumberOfSizeClasses;
+		};
+	}
+}
+
+#endif
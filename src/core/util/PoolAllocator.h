@@ -0,0 +1,109 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_POOLALLOCATOR_H
+#define _CORE_UTIL_POOLALLOCATOR_H
+
+#include "ObjectPool.h"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Standard allocator obtaining its memory from the @ref ObjectPool of the calling thread.
+		///
+		/// @par
+		/// The allocator is stateless and all instances compare equal, therefore memory allocated on one thread
+		/// might be released on another one, where it is returned to that thread's pool.
+		///
+		template <typename T>
+		class PoolAllocator
+		{
+		public:
+
+			using value_type = T;
+
+			PoolAllocator() = default;
+
+			///
+			/// Rebinding copy constructor
+			///
+			template <typename U>
+			PoolAllocator(const PoolAllocator<U>& /* other */)
+			{
+			}
+
+			T* allocate(size_t n)
+			{
+				auto size = n * sizeof(T);
+				auto pool = ObjectPool::getThreadLocalPool();
+				if (pool == nullptr)
+				{
+					// thread is exiting and its pool is already gone
+					return static_cast<T*>(::operator new(size));
+				}
+
+				return static_cast<T*>(pool->allocate(size));
+			}
+
+			void deallocate(T* pointer, size_t n)
+			{
+				auto pool = ObjectPool::getThreadLocalPool();
+				if (pool == nullptr)
+				{
+					// thread is exiting and its pool is already gone
+					::operator delete(pointer);
+					return;
+				}
+
+				pool->deallocate(pointer, n * sizeof(T));
+			}
+
+			template <typename U>
+			bool operator==(const PoolAllocator<U>& /* other */) const
+			{
+				return true;
+			}
+
+			template <typename U>
+			bool operator!=(const PoolAllocator<U>& /* other */) const
+			{
+				return false;
+			}
+		};
+
+		///
+		/// Creates a shared object whose memory (including the control block) is obtained from the
+		/// @ref ObjectPool of the calling thread.
+		///
+		/// @param[in] args the arguments forwarded to the constructor of @c T
+		/// @return the newly created object
+		///
+		template <typename T, typename... Args>
+		std::shared_ptr<T> allocateShared(Args&&... args)
+		{
+			return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TaskExecutor.h"
+
+#include <algorithm>
+
+using namespace core::util;
+
+constexpr TaskExecutor::TaskID TaskExecutor::INVALID_TASK_ID;
+
+TaskExecutor::TaskExecutor(int32_t numberOfThreads)
+	: mMutex()
+	, mConditionVariable()
+	, mPendingTasks()
+	, mDueTimes()
+	, mRunningTasks()
+	, mNextTaskID(INVALID_TASK_ID + 1)
+	, mIsShutdown(false)
+	, mThreads()
+{
+	auto threads = std::max(numberOfThreads, int32_t(1));
+	for (int32_t i = 0; i < threads; i++)
+	{
+		mThreads.emplace_back(&TaskExecutor::workerLoop, this);
+	}
+}
+
+TaskExecutor::~TaskExecutor()
+{
+	{ // synchronized scope
+		std::unique_lock<std::mutex> lock(mMutex);
+		mIsShutdown = true;
+		mPendingTasks.clear();
+		mDueTimes.clear();
+		mConditionVariable.notify_all();
+	}
+
+	joinThreads();
+}
+
+TaskExecutor::TaskID TaskExecutor::schedule(Task task, std::chrono::milliseconds delay)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mIsShutdown)
+	{
+		return INVALID_TASK_ID;
+	}
+
+	auto taskID = mNextTaskID++;
+	auto dueTime = Clock::now() + delay;
+	mPendingTasks.emplace(PendingTaskKey(dueTime, taskID), std::move(task));
+	mDueTimes.emplace(taskID, dueTime);
+	mConditionVariable.notify_all();
+
+	return taskID;
+}
+
+bool TaskExecutor::reschedule(TaskID taskID, std::chrono::milliseconds delay)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto dueTime = mDueTimes.find(taskID);
+	if (dueTime == mDueTimes.end())
+	{
+		return false;
+	}
+
+	auto pendingTask = mPendingTasks.find(PendingTaskKey(dueTime->second, taskID));
+	auto task = std::move(pendingTask->second);
+	mPendingTasks.erase(pendingTask);
+
+	dueTime->second = Clock::now() + delay;
+	mPendingTasks.emplace(PendingTaskKey(dueTime->second, taskID), std::move(task));
+	mConditionVariable.notify_all();
+
+	return true;
+}
+
+bool TaskExecutor::cancel(TaskID taskID)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	auto dueTime = mDueTimes.find(taskID);
+	if (dueTime != mDueTimes.end())
+	{
+		mPendingTasks.erase(PendingTaskKey(dueTime->second, taskID));
+		mDueTimes.erase(dueTime);
+		return true;
+	}
+
+	auto runningTask = mRunningTasks.find(taskID);
+	if (runningTask != mRunningTasks.end() && runningTask->second != std::this_thread::get_id())
+	{
+		mConditionVariable.wait(lock, [this, taskID] { return mRunningTasks.find(taskID) == mRunningTasks.end(); });
+	}
+
+	return false;
+}
+
+bool TaskExecutor::shutdown(std::chrono::milliseconds timeout)
+{
+	{ // synchronized scope
+		std::unique_lock<std::mutex> lock(mMutex);
+		mIsShutdown = true;
+		mPendingTasks.clear();
+		mDueTimes.clear();
+		mConditionVariable.notify_all();
+
+		if (!mConditionVariable.wait_for(lock, timeout, [this] { return mRunningTasks.empty(); }))
+		{
+			// threads are joined by the destructor
+			return false;
+		}
+	}
+
+	joinThreads();
+	return true;
+}
+
+size_t TaskExecutor::getNumberOfThreads() const
+{
+	return mThreads.size();
+}
+
+size_t TaskExecutor::getNumberOfPendingTasks() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mPendingTasks.size();
+}
+
+void TaskExecutor::workerLoop()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (!mIsShutdown)
+	{
+		if (mPendingTasks.empty())
+		{
+			mConditionVariable.wait(lock);
+			continue;
+		}
+
+		auto nextTask = mPendingTasks.begin();
+		if (nextTask->first.first > Clock::now())
+		{
+			mConditionVariable.wait_until(lock, nextTask->first.first);
+			continue;
+		}
+
+		auto taskID = nextTask->first.second;
+		auto task = std::move(nextTask->second);
+		mPendingTasks.erase(nextTask);
+		mDueTimes.erase(taskID);
+		mRunningTasks.emplace(taskID, std::this_thread::get_id());
+
+		lock.unlock();
+		task();
+		// release captured objects without holding the lock, their destructors might cancel tasks
+		task = nullptr;
+		lock.lock();
+
+		mRunningTasks.erase(taskID);
+		mConditionVariable.notify_all();
+	}
+}
+
+void TaskExecutor::joinThreads()
+{
+	for (auto& thread : mThreads)
+	{
+		if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+		{
+			thread.join();
+		}
+	}
+}
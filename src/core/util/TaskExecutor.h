@@ -0,0 +1,162 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_TASKEXECUTOR_H
+#define _CORE_UTIL_TASKEXECUTOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Executes tasks on a fixed number of threads once their due time has been reached.
+		///
+		/// Idle threads wait until the earliest due time of all pending tasks, therefore no periodic wakeups
+		/// are needed. Tasks are identified by the ID returned when scheduling them, which allows moving their
+		/// due time or cancelling them.
+		///
+		class TaskExecutor
+		{
+		public:
+
+			/// task function type
+			using Task = std::function<void()>;
+
+			/// task identifier type
+			using TaskID = uint64_t;
+
+			/// ID which is never assigned to a task
+			static constexpr TaskID INVALID_TASK_ID = 0;
+
+			///
+			/// Constructor
+			/// @param[in] numberOfThreads the number of threads executing the tasks, at least one thread is started
+			///
+			explicit TaskExecutor(int32_t numberOfThreads);
+
+			///
+			/// Destructor discarding all pending tasks and waiting until the running tasks are finished.
+			/// @remarks Must not be called from within one of the executed tasks.
+			///
+			~TaskExecutor();
+
+			///
+			/// Delete the copy constructor
+			///
+			TaskExecutor(const TaskExecutor&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			TaskExecutor& operator = (const TaskExecutor&) = delete;
+
+			///
+			/// Schedules the given task for execution after the given delay.
+			/// @param[in] task the task to execute
+			/// @param[in] delay the time after which the task is executed
+			/// @return the ID of the scheduled task or @ref INVALID_TASK_ID if the executor was already shut down
+			///
+			TaskID schedule(Task task, std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+
+			///
+			/// Moves the due time of a pending task.
+			/// @param[in] taskID the ID of the task to reschedule
+			/// @param[in] delay the time after which the task is executed, relative to now
+			/// @return @c true if the task was still pending, @c false if it is running, finished or unknown
+			///
+			bool reschedule(TaskID taskID, std::chrono::milliseconds delay);
+
+			///
+			/// Removes a pending task. If the task is currently executed on another thread, waits until it is finished.
+			/// @param[in] taskID the ID of the task to cancel
+			/// @return @c true if the pending task was removed before it was executed, @c false otherwise
+			///
+			bool cancel(TaskID taskID);
+
+			///
+			/// Stops accepting new tasks, discards the pending ones and waits until the running tasks are finished.
+			/// @param[in] timeout the maximum time to wait for running tasks
+			/// @return @c true if all threads were stopped in time, @c false otherwise
+			///
+			bool shutdown(std::chrono::milliseconds timeout);
+
+			///
+			/// Returns the number of threads executing the tasks.
+			///
+			size_t getNumberOfThreads() const;
+
+			///
+			/// Returns the number of tasks waiting for their execution.
+			///
+			size_t getNumberOfPendingTasks() const;
+
+		private:
+
+			/// clock used for scheduling
+			using Clock = std::chrono::steady_clock;
+
+			/// key of a pending task, ordering tasks by due time and scheduling order
+			using PendingTaskKey = std::pair<Clock::time_point, TaskID>;
+
+			///
+			/// Function executed by the worker threads.
+			///
+			void workerLoop();
+
+			///
+			/// Joins all threads except the calling one.
+			///
+			void joinThreads();
+
+			/// mutex guarding all members below
+			mutable std::mutex mMutex;
+
+			/// condition variable to wake up the worker threads and threads waiting for running tasks
+			std::condition_variable mConditionVariable;
+
+			/// pending tasks ordered by their due time
+			std::map<PendingTaskKey, Task> mPendingTasks;
+
+			/// due time of each pending task
+			std::unordered_map<TaskID, Clock::time_point> mDueTimes;
+
+			/// running tasks and the threads executing them
+			std::unordered_map<TaskID, std::thread::id> mRunningTasks;
+
+			/// ID assigned to the next scheduled task
+			TaskID mNextTaskID;
+
+			/// flag indicating that no more tasks are executed
+			bool mIsShutdown;
+
+			/// the worker threads
+			std::vector<std::thread> mThreads;
+		};
+	}
+}
+
+#endif
@@ -17,14 +17,39 @@
 #include "Beacon.h"
 #include "ProtocolConstants.h"
 #include "BeaconProtocolConstants.h"
+#include "core/util/Compressor.h"
 #include "core/util/URLEncoding.h"
 #include "core/util/InetAddressValidator.h"
 #include "providers/DefaultPRNGenerator.h"
+#include "providers/DefaultThreadIDProvider.h"
+
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <iterator>
+#include <inttypes.h> // for PRId32 macro
 
 #include <random>
 
 using namespace protocol;
 
+namespace
+{
+	/// guards the chunk preparation executor
+	std::mutex gChunkPreparationMutex;
+
+	/// persistent thread preparing the next chunk while the previous one is sent, @c nullptr if not initialized
+	std::shared_ptr<core::util::TaskExecutor> gChunkPreparationExecutor;
+
+	std::shared_ptr<core::util::TaskExecutor> getChunkPreparationExecutor()
+	{
+		std::lock_guard<std::mutex> lock(gChunkPreparationMutex);
+		return gChunkPreparationExecutor;
+	}
+}
+
+const size_t Beacon::MAX_DEFERRED_EVENT_RECORDS = 1024;
+
 Beacon::Beacon(
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
@@ -56,6 +81,31 @@ Beacon::Beacon(
 	std::shared_ptr<providers::IThreadIDProvider> threadIDProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider,
 	std::shared_ptr<providers::IPRNGenerator> randomGenerator
+)
+: Beacon(
+	logger,
+	beaconCache,
+	configuration,
+	clientIPAddress,
+	sessionIDProvider,
+	threadIDProvider,
+	timingProvider,
+	randomGenerator,
+	nullptr
+)
+{
+}
+
+Beacon::Beacon(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+	std::shared_ptr<core::configuration::IBeaconConfiguration> configuration,
+	const char* clientIPAddress,
+	std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+	std::shared_ptr<providers::IThreadIDProvider> threadIDProvider,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<providers::IPRNGenerator> randomGenerator,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 )
 	: mLogger(logger)
 	, mBeaconCache(beaconCache)
@@ -70,8 +120,15 @@ Beacon::Beacon(
 	, mBeaconId(sessionIDProvider->getNextSessionID())
 	, mSessionNumber()
 	, mSessionStartTime(timingProvider->provideTimestampInMilliseconds())
+	, mHasReportedFailures(false)
 	, mImmutableBasicBeaconData()
-
+	, mWebRequestTagPrefix()
+	, mIsSerializationDeferred(configuration->getOpenKitConfiguration()->isDeferredSerializationEnabled())
+	, mDeferredEventRecords()
+	, mDeferredEventRecordsMutex()
+	, mDeferredSerializationMutex()
+	, mMetricsRegistry(metricsRegistry)
+	, mIsRecordedRemotely(false)
 {
 	core::UTF8String internalClientIPAddress(clientIPAddress);
 	if (clientIPAddress == nullptr)
@@ -103,6 +160,43 @@ Beacon::Beacon(
 	mImmutableBasicBeaconData = createImmutableBeaconData();
 }
 
+Beacon::Beacon(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+	std::shared_ptr<core::configuration::IBeaconConfiguration> configuration,
+	const core::UTF8String& clientIPAddress,
+	int32_t sessionNumber,
+	int64_t sessionStartTime,
+	const core::UTF8String& immutableBeaconData,
+	std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+)
+	: mLogger(logger)
+	, mBeaconCache(beaconCache)
+	, mBeaconConfiguration(configuration)
+	, mClientIPAddress(clientIPAddress)
+	, mThreadIDProvider(std::make_shared<providers::DefaultThreadIDProvider>())
+	, mTimingProvider(timingProvider)
+	, mRandomGenerator(std::make_shared<providers::DefaultPRNGenerator>())
+	, mDeviceID(0)
+	, mSequenceNumber(0)
+	, mID(0)
+	, mBeaconId(sessionIDProvider->getNextSessionID())
+	, mSessionNumber(sessionNumber)
+	, mSessionStartTime(sessionStartTime)
+	, mHasReportedFailures(false)
+	, mImmutableBasicBeaconData(immutableBeaconData)
+	, mWebRequestTagPrefix()
+	, mIsSerializationDeferred(false)
+	, mDeferredEventRecords()
+	, mDeferredEventRecordsMutex()
+	, mDeferredSerializationMutex()
+	, mMetricsRegistry(metricsRegistry)
+	, mIsRecordedRemotely(true)
+{
+}
+
 core::UTF8String Beacon::createImmutableBeaconData()
 {
 	core::UTF8String basicBeaconData;
@@ -137,6 +231,11 @@ core::UTF8String Beacon::createImmutableBeaconData()
 }
 
 core::UTF8String Beacon::createBasicEventData(protocol::EventType eventType, const core::UTF8String& eventName)
+{
+	return createBasicEventData(eventType, eventName, mThreadIDProvider->getThreadID());
+}
+
+core::UTF8String Beacon::createBasicEventData(protocol::EventType eventType, const core::UTF8String& eventName, int32_t threadID)
 {
 	core::UTF8String eventData;
 	addKeyValuePair(eventData, BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(eventType));
@@ -145,7 +244,7 @@ core::UTF8String Beacon::createBasicEventData(protocol::EventType eventType, con
 	{
 		addKeyValuePair(eventData, BEACON_KEY_NAME, truncate(eventName));
 	}
-	addKeyValuePair(eventData, BEACON_KEY_THREAD_ID, mThreadIDProvider->getThreadID());
+	addKeyValuePair(eventData, BEACON_KEY_THREAD_ID, threadID);
 	return eventData;
 }
 
@@ -158,18 +257,138 @@ core::UTF8String Beacon::createTimestampData()
 	return timestampData;
 }
 
-core::UTF8String Beacon::buildEvent(EventType eventType, const core::UTF8String& name, int32_t parentActionID, uint64_t& eventTimestamp)
+Beacon::EventRecord Beacon::createEventRecord(EventType eventType, const core::UTF8String& name, int32_t parentActionID)
+{
+	// note: the evaluation order of the braced initializer list is well defined (left to right)
+	EventRecord record = {
+		eventType,
+		name,
+		mThreadIDProvider->getThreadID(),
+		parentActionID,
+		mTimingProvider->provideTimestampInMilliseconds(),
+		createSequenceNumber(),
+		0,
+		0.0,
+		core::UTF8String()
+	};
+
+	return record;
+}
+
+void Beacon::addEventRecord(EventRecord&& record)
 {
-	core::UTF8String eventData = createBasicEventData(eventType, name);
+	if (!isCaptureEnabled())
+	{
+		return;
+	}
 
-	eventTimestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, parentActionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(eventTimestamp));
+	if (mIsSerializationDeferred)
+	{
+		bool isQueueFull = false;
+		{ // synchronized scope
+			std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+			mDeferredEventRecords.push_back(std::move(record));
+			isQueueFull = mDeferredEventRecords.size() >= MAX_DEFERRED_EVENT_RECORDS;
+		}
+		if (isQueueFull)
+		{
+			serializeDeferredEventRecords();
+		}
+		return;
+	}
+
+	addEventData(record.timestamp, serializeEventRecord(record));
+}
+
+void Beacon::addEventRecords(std::vector<EventRecord>&& records)
+{
+	if (records.empty() || !isCaptureEnabled())
+	{
+		return;
+	}
+
+	if (mIsSerializationDeferred)
+	{
+		bool isQueueFull = false;
+		{ // synchronized scope
+			std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+			mDeferredEventRecords.insert(mDeferredEventRecords.end(),
+				std::make_move_iterator(records.begin()), std::make_move_iterator(records.end()));
+			isQueueFull = mDeferredEventRecords.size() >= MAX_DEFERRED_EVENT_RECORDS;
+		}
+		if (isQueueFull)
+		{
+			serializeDeferredEventRecords();
+		}
+		return;
+	}
+
+	std::vector<core::caching::BeaconCacheRecord> cacheRecords;
+	cacheRecords.reserve(records.size());
+	for (const auto& record : records)
+	{
+		cacheRecords.emplace_back(record.timestamp, serializeEventRecord(record));
+	}
+
+	mBeaconCache->addEventData(mBeaconId, cacheRecords);
+}
+
+core::UTF8String Beacon::serializeEventRecord(const EventRecord& record)
+{
+	core::UTF8String eventData = createBasicEventData(record.eventType, record.name, record.threadID);
+
+	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, record.parentActionID);
+	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, record.sequenceNumber);
+	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(record.timestamp));
+
+	switch (record.eventType)
+	{
+	case EventType::VALUE_INT:
+		addKeyValuePair(eventData, BEACON_KEY_VALUE, record.intValue);
+		break;
+	case EventType::VALUE_DOUBLE:
+		addKeyValuePair(eventData, BEACON_KEY_VALUE, record.doubleValue);
+		break;
+	case EventType::VALUE_STRING:
+		addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_VALUE, record.stringValue);
+		break;
+	case EventType::FAILURE_ERROR:
+		addKeyValuePair(eventData, BEACON_KEY_ERROR_CODE, record.intValue);
+		addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_REASON, record.stringValue);
+		addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
+		break;
+	default:
+		break;
+	}
 
 	return eventData;
 }
 
+void Beacon::serializeDeferredEventRecords()
+{
+	std::lock_guard<std::mutex> serializationLock(mDeferredSerializationMutex);
+
+	std::vector<EventRecord> records;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+		records.swap(mDeferredEventRecords);
+	}
+
+	if (records.empty() || !isCaptureEnabled())
+	{
+		return;
+	}
+
+	std::vector<core::caching::BeaconCacheRecord> cacheRecords;
+	cacheRecords.reserve(records.size());
+	for (const auto& record : records)
+	{
+		cacheRecords.emplace_back(record.timestamp, serializeEventRecord(record));
+	}
+
+	mBeaconCache->addEventData(mBeaconId, cacheRecords);
+}
+
 void Beacon::appendKey(core::UTF8String& s, const core::UTF8String& key)
 {
 	if (!s.empty())
@@ -234,28 +453,46 @@ core::UTF8String Beacon::createTag(int32_t parentActionID, int32_t sequenceNumbe
 
 	auto serverId = mBeaconConfiguration->getServerConfiguration()->getServerId();
 
-	core::UTF8String webRequestTag(TAG_PREFIX);
-
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(PROTOCOL_VERSION));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(serverId));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(getDeviceID()));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(mSessionNumber));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(mBeaconConfiguration->getOpenKitConfiguration()->getApplicationIdPercentEncoded());
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(parentActionID));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(mThreadIDProvider->getThreadID()));
-	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(sequenceNumber));
+	// parent action ID, thread ID and sequence number, each preceded by a separator
+	char suffix[3 * (1 + 11) + 1];
+	auto suffixLength = std::snprintf(suffix, sizeof(suffix), "_%" PRId32 "_%" PRId32 "_%" PRId32,
+		parentActionID, mThreadIDProvider->getThreadID(), sequenceNumber);
+
+	auto webRequestTagPrefix = std::atomic_load(&mWebRequestTagPrefix);
+	if (webRequestTagPrefix == nullptr || webRequestTagPrefix->serverId != serverId)
+	{
+		// concurrent callers might create the same prefix, the last one published wins
+		webRequestTagPrefix = std::make_shared<const WebRequestTagPrefix>(
+			WebRequestTagPrefix{ serverId, createWebRequestTagPrefix(serverId) });
+		std::atomic_store(&mWebRequestTagPrefix, webRequestTagPrefix);
+	}
+
+	core::UTF8String webRequestTag;
+	webRequestTag.reserve(webRequestTagPrefix->prefix.getStringData().size() + suffixLength);
+	webRequestTag.concatenate(webRequestTagPrefix->prefix);
+	webRequestTag.concatenate(suffix, static_cast<size_t>(suffixLength));
 
 	return webRequestTag;
 }
 
+core::UTF8String Beacon::createWebRequestTagPrefix(int32_t serverId) const
+{
+	core::UTF8String prefix(TAG_PREFIX);
+
+	prefix.concatenate("_");
+	prefix.concatenate(std::to_string(PROTOCOL_VERSION));
+	prefix.concatenate("_");
+	prefix.concatenate(std::to_string(serverId));
+	prefix.concatenate("_");
+	prefix.concatenate(std::to_string(getDeviceID()));
+	prefix.concatenate("_");
+	prefix.concatenate(std::to_string(mSessionNumber));
+	prefix.concatenate("_");
+	prefix.concatenate(mBeaconConfiguration->getOpenKitConfiguration()->getApplicationIdPercentEncoded());
+
+	return prefix;
+}
+
 void Beacon::addAction(std::shared_ptr<core::objects::IActionCommon> action)
 {
 	if (!mBeaconConfiguration->getPrivacyConfiguration()->isActionReportingAllowed())
@@ -290,6 +527,14 @@ void Beacon::addActionData(int64_t timestamp, const core::UTF8String& actionData
 
 void Beacon::startSession()
 {
+	if (mIsRecordedRemotely)
+	{
+		// the session start event is part of the recorded data
+		return;
+	}
+
+	mBeaconCache->addBeacon(mBeaconId, mSessionStartTime, mSessionNumber, mClientIPAddress, mImmutableBasicBeaconData);
+
 	if (!isCaptureEnabled())
 	{
 		return;
@@ -306,24 +551,26 @@ void Beacon::startSession()
 
 void Beacon::endSession()
 {
-	if (!mBeaconConfiguration->getPrivacyConfiguration()->isSessionReportingAllowed())
+	if (mIsRecordedRemotely)
 	{
+		// the session end event is part of the recorded data
 		return;
 	}
 
-	if (!mBeaconConfiguration->getServerConfiguration()->isSendingDataAllowed())
+	if (mBeaconConfiguration->getPrivacyConfiguration()->isSessionReportingAllowed()
+		&& mBeaconConfiguration->getServerConfiguration()->isSendingDataAllowed())
 	{
-		return;
-	}
+		core::UTF8String eventData = createBasicEventData(EventType::SESSION_END, nullptr);
 
-	core::UTF8String eventData = createBasicEventData(EventType::SESSION_END, nullptr);
+		auto endTime = getCurrentTimestamp();
+		addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
+		addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+		addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(endTime));
 
-	auto endTime = getCurrentTimestamp();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(endTime));
+		addEventData(endTime, eventData);
+	}
 
-	addEventData(endTime, eventData);
+	mBeaconCache->endBeacon(mBeaconId);
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, int32_t value)
@@ -338,11 +585,10 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, in
 		return;
 	}
 
-	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_INT, valueName, actionID, eventTimestamp);
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	auto record = createEventRecord(EventType::VALUE_INT, valueName, actionID);
+	record.intValue = value;
 
-	addEventData(eventTimestamp, eventData);
+	addEventRecord(std::move(record));
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, double value)
@@ -357,12 +603,10 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, do
 		return;
 	}
 
-	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_DOUBLE, valueName, actionID, eventTimestamp);
-
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	auto record = createEventRecord(EventType::VALUE_DOUBLE, valueName, actionID);
+	record.doubleValue = value;
 
-	addEventData(eventTimestamp, eventData);
+	addEventRecord(std::move(record));
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, const core::UTF8String& value)
@@ -377,12 +621,10 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, co
 		return;
 	}
 
-	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_STRING, valueName, actionID, eventTimestamp);
-
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_VALUE, value);
+	auto record = createEventRecord(EventType::VALUE_STRING, valueName, actionID);
+	record.stringValue = value;
 
-	addEventData(eventTimestamp, eventData);
+	addEventRecord(std::move(record));
 }
 
 void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
@@ -397,10 +639,7 @@ void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
 		return;
 	}
 
-	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::NAMED_EVENT, eventName, actionID, eventTimestamp);
-
-	addEventData(eventTimestamp, eventData);
+	addEventRecord(createEventRecord(EventType::NAMED_EVENT, eventName, actionID));
 }
 
 void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, int32_t errorCode, const core::UTF8String& reason)
@@ -415,16 +654,74 @@ void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, in
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_ERROR, errorName);
-	uint64_t timestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, actionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_CODE, errorCode);
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_REASON, reason);
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
+	auto record = createEventRecord(EventType::FAILURE_ERROR, errorName, actionID);
+	record.intValue = errorCode;
+	record.stringValue = reason;
 
-	addEventData(timestamp, eventData);
+	mHasReportedFailures = true;
+	addEventRecord(std::move(record));
+}
+
+bool Beacon::isEventTypeReportingAllowed(EventType eventType)
+{
+	auto privacyConfiguration = mBeaconConfiguration->getPrivacyConfiguration();
+	auto serverConfiguration = mBeaconConfiguration->getServerConfiguration();
+
+	switch (eventType)
+	{
+	case EventType::NAMED_EVENT:
+		return privacyConfiguration->isEventReportingAllowed() && serverConfiguration->isSendingDataAllowed();
+	case EventType::VALUE_INT:
+	case EventType::VALUE_DOUBLE:
+	case EventType::VALUE_STRING:
+		return privacyConfiguration->isValueReportingAllowed() && serverConfiguration->isSendingDataAllowed();
+	case EventType::FAILURE_ERROR:
+		return privacyConfiguration->isErrorReportingAllowed() && serverConfiguration->isSendingErrorsAllowed();
+	default:
+		return false;
+	}
+}
+
+void Beacon::reportEvents(int32_t actionID, const std::vector<ReportedEvent>& events)
+{
+	if (events.empty() || !isCaptureEnabled())
+	{
+		return;
+	}
+
+	// the reporting thread and the point in time are the same for all events of the batch
+	auto threadID = mThreadIDProvider->getThreadID();
+	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
+
+	std::vector<EventRecord> records;
+	records.reserve(events.size());
+	for (const auto& event : events)
+	{
+		if (!isEventTypeReportingAllowed(event.type))
+		{
+			continue;
+		}
+
+		EventRecord record = {
+			event.type,
+			event.name,
+			threadID,
+			actionID,
+			timestamp,
+			createSequenceNumber(),
+			event.intValue,
+			event.doubleValue,
+			event.stringValue
+		};
+		records.push_back(std::move(record));
+
+		if (event.type == EventType::FAILURE_ERROR)
+		{
+			mHasReportedFailures = true;
+		}
+	}
+
+	addEventRecords(std::move(records));
 }
 
 void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8String& reason, const core::UTF8String& stacktrace)
@@ -450,6 +747,7 @@ void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8Stri
 	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_STACKTRACE, stacktrace);
 	addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
 
+	mHasReportedFailures = true;
 	addEventData(timestamp, eventData);
 }
 
@@ -544,48 +842,144 @@ core::UTF8String Beacon::getMutableBeaconData()
 
 std::shared_ptr<protocol::IStatusResponse> Beacon::send(std::shared_ptr<providers::IHTTPClientProvider> clientProvider)
 {
+	auto sendStartTime = mMetricsRegistry != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+	// serialize everything which was reported in the meantime, before the data gets chunked
+	serializeDeferredEventRecords();
+
 	auto httpClient = clientProvider->createClient(mLogger, mBeaconConfiguration->getHTTPClientConfiguration());
 
 	std::shared_ptr<protocol::IStatusResponse> response = nullptr;
 
-	while (true)
-	{
-		// prefix for this chunk - must be built up newly, due to changing timestamps
-		auto prefix = mImmutableBasicBeaconData;
-		prefix.concatenate( getMutableBeaconData());
+	auto chunkPreparationExecutor = getChunkPreparationExecutor();
 
-		auto chunk = mBeaconCache->getNextBeaconChunk(
-			mBeaconId,
-			prefix,
-			mBeaconConfiguration->getServerConfiguration()->getBeaconSizeInBytes() - 1024,
-			BEACON_DATA_DELIMITER
-		);
-		if (chunk == nullptr || chunk.empty())
+	auto chunk = prepareNextChunk();
+	while (!chunk.empty())
+	{
+		// a chunk holding all remaining data is the last one, therefore nothing needs to be prepared
+		auto hasMoreChunks = mBeaconCache->hasMoreChunks(mBeaconId);
+
+		// prepare the following chunk while the current one is sent
+		// note: only one chunk is prepared ahead, since chunks must be retrieved from the cache one after another
+		std::future<std::vector<unsigned char>> nextChunk;
+		auto nextChunkTaskID = core::util::TaskExecutor::INVALID_TASK_ID;
+		if (hasMoreChunks && chunkPreparationExecutor != nullptr)
 		{
-			return response;
+			auto nextChunkTask = std::make_shared<std::packaged_task<std::vector<unsigned char>()>>(
+				std::bind(&Beacon::prepareNextChunk, this)
+			);
+			nextChunk = nextChunkTask->get_future();
+			nextChunkTaskID = chunkPreparationExecutor->schedule([nextChunkTask]() { (*nextChunkTask)(); });
 		}
 
 		// send the request
-		response = httpClient->sendBeaconRequest(mClientIPAddress, chunk);
+		response = httpClient->sendCompressedBeaconRequest(mClientIPAddress, chunk);
+
+		// the chunked data must not be modified, while the next chunk is prepared
 		if (response == nullptr || response->isErroneousResponse())
 		{
+			if (nextChunkTaskID != core::util::TaskExecutor::INVALID_TASK_ID)
+			{
+				// discard the preparation if it did not start yet, otherwise wait until it is finished
+				chunkPreparationExecutor->cancel(nextChunkTaskID);
+			}
+
 			// error happened - but don't know what exactly
-			// reset the previously retrieved chunk (restore it in internal cache) & retry another time
+			// reset the previously retrieved chunks (restore them in internal cache) & retry another time
 			mBeaconCache->resetChunkedData(mBeaconId);
 			break;
 		}
+
+		if (!hasMoreChunks)
+		{
+			chunk.clear();
+		}
+		else if (nextChunkTaskID == core::util::TaskExecutor::INVALID_TASK_ID
+			|| chunkPreparationExecutor->cancel(nextChunkTaskID))
+		{
+			// not prepared ahead, or the preparation thread is still busy with another beacon
+			chunk = prepareNextChunk();
+		}
 		else
 		{
-			// worked -> remove previously retrieved chunk from cache
-			mBeaconCache->removeChunkedData(mBeaconId);
+			// cancel() returned after the preparation finished
+			chunk = nextChunk.get();
 		}
+
+		// worked -> remove the sent chunk from cache, the prepared one is kept
+		mBeaconCache->removeChunkedData(mBeaconId);
+	}
+
+	if (mMetricsRegistry != nullptr && response != nullptr)
+	{
+		// only sends which actually transmitted data are of interest
+		mMetricsRegistry->getBeaconSendDuration().recordMillisSince(sendStartTime);
 	}
 
 	return response;
 }
 
+void Beacon::globalInit()
+{
+	std::lock_guard<std::mutex> lock(gChunkPreparationMutex);
+	gChunkPreparationExecutor = std::make_shared<core::util::TaskExecutor>(1);
+}
+
+void Beacon::globalDestroy()
+{
+	std::shared_ptr<core::util::TaskExecutor> chunkPreparationExecutor;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(gChunkPreparationMutex);
+		chunkPreparationExecutor.swap(gChunkPreparationExecutor);
+	}
+
+	// joins the thread outside of the lock
+	chunkPreparationExecutor = nullptr;
+}
+
+std::vector<unsigned char> Beacon::prepareNextChunk()
+{
+	// prefix for this chunk - must be built up newly, due to changing timestamps
+	auto prefix = mImmutableBasicBeaconData;
+	prefix.concatenate(getMutableBeaconData());
+
+	// chunks are packed byte exact, therefore the whole beacon size can be used
+	auto chunk = mBeaconCache->getNextBeaconChunk(
+		mBeaconId,
+		prefix,
+		mBeaconConfiguration->getServerConfiguration()->getBeaconSizeInBytes(),
+		BEACON_DATA_DELIMITER
+	);
+
+	std::vector<unsigned char> compressedChunk;
+	if (chunk == nullptr || chunk.empty())
+	{
+		return compressedChunk;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("Beacon prepareNextChunk() - Beacon Payload: %s", chunk.getStringData().c_str());
+	}
+
+	base::util::Compressor::compressMemory(chunk.getStringData().c_str(), chunk.getStringData().size(), compressedChunk);
+	if (mMetricsRegistry != nullptr)
+	{
+		mMetricsRegistry->getUncompressedBeaconBytes().add(static_cast<int64_t>(chunk.getStringData().size()));
+		mMetricsRegistry->getCompressedBeaconBytes().add(static_cast<int64_t>(compressedChunk.size()));
+	}
+
+	return compressedChunk;
+}
+
 void Beacon::addEventData(int64_t timestamp, const core::UTF8String& eventData)
 {
+	if (mIsSerializationDeferred)
+	{
+		// events reported before this record are still queued, keep their order in the cache
+		serializeDeferredEventRecords();
+	}
+
 	if (isCaptureEnabled())
 	{
 		mBeaconCache->addEventData(mBeaconId, timestamp, eventData);
@@ -608,11 +1002,46 @@ int64_t Beacon::getTimeSinceSessionStartTime(int64_t timestamp)
 
 bool Beacon::isEmpty() const
 {
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+		if (!mDeferredEventRecords.empty())
+		{
+			return false;
+		}
+	}
+
 	return mBeaconCache->isEmpty(mBeaconId);
 }
 
+size_t Beacon::getNumberOfRecords() const
+{
+	size_t numDeferredRecords = 0;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+		numDeferredRecords = mDeferredEventRecords.size();
+	}
+
+	return numDeferredRecords + mBeaconCache->getNumberOfRecords(mBeaconId);
+}
+
+bool Beacon::hasReportedFailures() const
+{
+	return mHasReportedFailures;
+}
+
+int64_t Beacon::getSessionStartTime() const
+{
+	return mSessionStartTime;
+}
+
 void Beacon::clearData()
 {
+	// drop all event records not serialized so far
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mDeferredEventRecordsMutex);
+		mDeferredEventRecords.clear();
+	}
+
 	// remove all cached data for this Beacon from the cache
 	mBeaconCache->deleteCacheEntry(mBeaconId);
 }
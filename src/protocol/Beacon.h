@@ -31,11 +31,15 @@
 #include "core/objects/Session.h"
 #include "core/objects/IWebRequestTracerInternals.h"
 #include "core/caching/BeaconCache.h"
+#include "core/util/MetricsRegistry.h"
+#include "core/util/TaskExecutor.h"
 #include "protocol/IStatusResponse.h"
 #include "EventType.h"
 
 #include <memory>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace protocol
 {
@@ -47,6 +51,14 @@ namespace protocol
 	{
 	public:
 
+		///
+		/// Maximum number of event records queued for deferred serialization.
+		///
+		/// If this number is reached, the reporting thread serializes the queued records into the beacon cache, where they
+		/// are accounted for and subject to eviction.
+		///
+		static const size_t MAX_DEFERRED_EVENT_RECORDS;
+
 		///
 		/// Constructor for Beacon
 		/// @param[in] logger to write traces to
@@ -89,6 +101,61 @@ namespace protocol
 			std::shared_ptr<providers::IPRNGenerator> randomGenerator
 		);
 
+		///
+		/// Constructor for Beacon recording self-monitoring metrics
+		/// @param[in] logger to write traces to
+		/// @param[in] beaconCache Cache storing beacon related data.
+		/// @param[in] configuration Configuration object
+		/// @param[in] clientIPAddress IP Address of the client
+		/// @param[in] sessionIDProvider provider for retrieving a unique session number
+		/// @param[in] threadIDProvider provider for thread ids
+		/// @param[in] timingProvider timing provider used to retrieve timestamps
+		/// @param[in] randomGenerator random number generator
+		/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+		///
+		Beacon(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+			std::shared_ptr<core::configuration::IBeaconConfiguration> configuration,
+			const char* clientIPAddress,
+			std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+			std::shared_ptr<providers::IThreadIDProvider> threadIDProvider,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			std::shared_ptr<providers::IPRNGenerator> randomGenerator,
+			std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+		);
+
+		///
+		/// Constructor for a Beacon, whose data is recorded in another process.
+		///
+		/// The basic beacon data and the session start event are taken from the recording process,
+		/// therefore @ref startSession and @ref endSession do not add any data to this beacon.
+		/// The recorded data is added via @ref addEventData and @ref addActionData.
+		///
+		/// @param[in] logger to write traces to
+		/// @param[in] beaconCache Cache storing beacon related data.
+		/// @param[in] configuration Configuration object
+		/// @param[in] clientIPAddress IP Address of the client, as validated by the recording process
+		/// @param[in] sessionNumber the session number of the recorded beacon
+		/// @param[in] sessionStartTime the session start time of the recorded beacon
+		/// @param[in] immutableBeaconData the basic beacon data of the recorded beacon
+		/// @param[in] sessionIDProvider provider for retrieving a unique beacon id
+		/// @param[in] timingProvider timing provider used to retrieve timestamps
+		/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+		///
+		Beacon(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+			std::shared_ptr<core::configuration::IBeaconConfiguration> configuration,
+			const core::UTF8String& clientIPAddress,
+			int32_t sessionNumber,
+			int64_t sessionStartTime,
+			const core::UTF8String& immutableBeaconData,
+			std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+		);
+
 		///
 		/// Destructor
 		///
@@ -124,6 +191,8 @@ namespace protocol
 			const core::UTF8String& reason
 		) override;
 
+		void reportEvents(int32_t actionID, const std::vector<ReportedEvent>& events) override;
+
 		void reportCrash(
 			const core::UTF8String& errorName,
 			const core::UTF8String& reason,
@@ -144,6 +213,12 @@ namespace protocol
 
 		bool isEmpty() const override;
 
+		size_t getNumberOfRecords() const override;
+
+		bool hasReportedFailures() const override;
+
+		int64_t getSessionStartTime() const override;
+
 		void clearData() override;
 
 		int32_t getSessionNumber() const override;
@@ -162,13 +237,77 @@ namespace protocol
 
 		void disableCapture() override;
 
+		///
+		/// Add previously serialized action data to the beacon list
+		/// @param[in] timestamp The timestamp when the action data occurred.
+		/// @param[in] actionData Contains the serialized action data.
+		///
+		void addActionData(int64_t timestamp, const core::UTF8String& actionData);
+
+		///
+		/// Add previously serialized event data to the beacon list
+		///
+		/// If serialization is deferred, the queued event records are added first to keep the order of the records.
+		///
+		/// @param[in] timestamp The timestamp when the event data occurred.
+		/// @param[in] eventData Contains the serialized event data.
+		///
+		void addEventData(int64_t timestamp, const core::UTF8String& eventData);
+
+		///
+		/// Starts the thread preparing beacon chunks ahead, which is shared by all beacons.
+		/// @remarks Without this thread all chunks are prepared by the sending thread one after another.
+		///
+		static void globalInit();
+
+		///
+		/// Stops the thread preparing beacon chunks ahead.
+		/// @remarks This method expects to be called after the last beacon was sent.
+		///
+		static void globalDestroy();
+
 	private:
+		///
+		/// Raw arguments of an event reported via @ref reportValue, @ref reportEvent or @ref reportError.
+		///
+		/// Everything depending on the reporting thread or on the point in time is captured when the record
+		/// is created, whereas the serialization into the beacon protocol format might happen later.
+		///
+		struct EventRecord
+		{
+			/// the event's type
+			EventType eventType;
+			/// the (not yet truncated) event name
+			core::UTF8String name;
+			/// ID of the thread which reported the event
+			int32_t threadID;
+			/// ID of the action on which the event was reported
+			int32_t parentActionID;
+			/// timestamp when the event was reported
+			int64_t timestamp;
+			/// the event's sequence number
+			int32_t sequenceNumber;
+			/// integer value of @ref EventType::VALUE_INT or error code of @ref EventType::FAILURE_ERROR
+			int32_t intValue;
+			/// double value of @ref EventType::VALUE_DOUBLE
+			double doubleValue;
+			/// string value of @ref EventType::VALUE_STRING or reason of @ref EventType::FAILURE_ERROR
+			core::UTF8String stringValue;
+		};
+
 		///
 		/// Serialization helper method for creating basic beacon protocol data.
 		/// @returns Serialized data
 		///
 		core::UTF8String createImmutableBeaconData();
 
+		///
+		/// Creates the part of the web request tag which is equal for all tags of this beacon and the given server ID.
+		/// @param[in] serverId the server ID to include in the prefix
+		/// @returns the tag prefix, without a trailing separator
+		///
+		core::UTF8String createWebRequestTagPrefix(int32_t serverId) const;
+
 		///
 		/// Serialization helper method for creating basic event data
 		/// @returns Serialized data
@@ -182,19 +321,59 @@ namespace protocol
 		core::UTF8String createTimestampData();
 
 		///
-		/// Serialization helper for event data.
+		/// Serialization helper method for creating basic event data with a previously captured thread ID.
+		/// @param[in] eventType type of the event
+		/// @param[in] eventName name of the event
+		/// @param[in] threadID ID of the thread on which the event was reported
+		/// @returns Serialized data
+		///
+		core::UTF8String createBasicEventData(EventType eventType, const core::UTF8String& eventName, int32_t threadID);
+
+		///
+		/// Capture all data of an event which must be taken on the reporting thread.
+		///
+		/// This includes the thread ID, the event's timestamp and the sequence number.
 		/// @param[in] eventType The event's type.
 		/// @param[in] name Event name
 		/// @param[in] parentActionID The ID of the action on which this event was reported.
-		/// @param[inout] eventTimestamp uint64_t var that will be filled with the event timestamp
-		/// @returns The timestamp associated with the event(timestamp since session start time).
+		/// @returns a record, which can be serialized at any later point in time
 		///
-		core::UTF8String buildEvent(
-			EventType eventType,
-			const core::UTF8String& name,
-			int32_t parentActionID,
-			uint64_t& eventTimestamp
-		);
+		EventRecord createEventRecord(EventType eventType, const core::UTF8String& name, int32_t parentActionID);
+
+		///
+		/// Add an event record either by serializing it directly or by queueing it for deferred serialization.
+		/// @param[in] record the record to add
+		///
+		void addEventRecord(EventRecord&& record);
+
+		///
+		/// Add several event records either by serializing them directly and adding them to the beacon cache
+		/// in a single step, or by queueing them for deferred serialization.
+		/// @param[in] records the records to add
+		///
+		void addEventRecords(std::vector<EventRecord>&& records);
+
+		///
+		/// Checks whether an event of the given type may be reported according to the privacy and server settings.
+		/// @param[in] eventType one of the event types which can be reported via @ref reportEvents
+		/// @returns @c true if the event is reported, @c false if it is dropped
+		///
+		bool isEventTypeReportingAllowed(EventType eventType);
+
+		///
+		/// Serialization helper for event records.
+		/// @param[in] record the event record to serialize
+		/// @returns Serialized data
+		///
+		core::UTF8String serializeEventRecord(const EventRecord& record);
+
+		///
+		/// Serialize all event records queued for deferred serialization and add them to the beacon cache.
+		///
+		/// This method is called on the beacon sending thread, right before the data is chunked, and on the reporting
+		/// thread, if @ref MAX_DEFERRED_EVENT_RECORDS records are queued or a record which is not queued is added.
+		///
+		void serializeDeferredEventRecords();
 
 		///
 		/// Serialization helper method for appending a key.
@@ -262,20 +441,6 @@ namespace protocol
 		///
 		int64_t getTimeSinceSessionStartTime(int64_t timestamp);
 
-		///
-		/// Add previously serialized action data to the beacon list
-		/// @param[in] timestamp The timestamp when the action data occurred.
-		/// @param[in] actionData Contains the serialized action data.
-		///
-		void addActionData(int64_t timestamp, const core::UTF8String& actionData);
-
-		///
-		/// Add previously serialized event data to the beacon list
-		/// @param[in] timestamp The timestamp when the event data occurred.
-		/// @param[in] eventData Contains the serialized event data.
-		///
-		void addEventData(int64_t timestamp, const core::UTF8String& eventData);
-
 		///
 		/// Generate serialization for the mutable part of the beaon
 		/// e.g. multiplicity and timestamp
@@ -283,6 +448,14 @@ namespace protocol
 		///
 		core::UTF8String getMutableBeaconData();
 
+		///
+		/// Retrieve the next chunk from the beacon cache and compress it for sending.
+		///
+		/// This method might be called while the previous chunk is still being sent.
+		/// @returns the compressed chunk or an empty buffer if there is no more data to send
+		///
+		std::vector<unsigned char> prepareNextChunk();
+
 		///
 		/// Generate multiplicity data
 		/// @returns the multiplicity data
@@ -329,8 +502,45 @@ namespace protocol
 		/// session start time
 		int64_t mSessionStartTime;
 
+		/// flag indicating whether an error or a crash has been reported
+		std::atomic<bool> mHasReportedFailures;
+
 		/// basic beacon data
 		core::UTF8String mImmutableBasicBeaconData;
+
+		///
+		/// Web request tag prefix together with the server ID it has been created for
+		///
+		struct WebRequestTagPrefix
+		{
+			/// server ID the prefix has been created for
+			int32_t serverId;
+
+			/// result of @ref createWebRequestTagPrefix
+			core::UTF8String prefix;
+		};
+
+		/// cached web request tag prefix, @c nullptr if not yet created;
+		/// replaced (never modified) via @c std::atomic_store whenever the server ID changes
+		std::shared_ptr<const WebRequestTagPrefix> mWebRequestTagPrefix;
+
+		/// flag indicating whether serialization of reported events is deferred to the beacon sending thread
+		const bool mIsSerializationDeferred;
+
+		/// event records which are not yet serialized
+		std::vector<EventRecord> mDeferredEventRecords;
+
+		/// mutex protecting @ref mDeferredEventRecords
+		mutable std::mutex mDeferredEventRecordsMutex;
+
+		/// mutex serializing @ref serializeDeferredEventRecords, so that the records are added to the cache in order
+		std::mutex mDeferredSerializationMutex;
+
+		/// registry to record metrics in, @c nullptr if statistics are disabled
+		const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+
+		/// flag indicating whether the data of this beacon is recorded in another process
+		const bool mIsRecordedRemotely;
 	};
 }
 #endif
@@ -36,8 +36,8 @@
 // connection constants
 constexpr uint32_t MAX_SEND_RETRIES = 3; // max number of retries of the HTTP GET or POST operation
 constexpr uint32_t RETRY_SLEEP_TIME = 200; // retry sleep time in ms
-constexpr uint64_t CONNECT_TIMEOUT = 5; // Time-out connect operations after this amount of seconds
-constexpr uint64_t READ_TIMEOUT = 30; // Time-out the read operation after this amount of seconds
+constexpr int64_t CONNECT_TIMEOUT_MILLIS = 5 * 1000; // Time-out connect operations after this amount of milliseconds
+constexpr int64_t READ_TIMEOUT_MILLIS = 30 * 1000; // Time-out the read operation after this amount of milliseconds
 
 using namespace protocol;
 using namespace base::util;
@@ -46,15 +46,51 @@ HTTPClient::HTTPClient
 (
 	std::shared_ptr<openkit::ILogger> logger,
 	const std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
+)
+	: HTTPClient(logger, configuration, nullptr)
+{
+}
+
+HTTPClient::HTTPClient
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	const std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+	std::shared_ptr<HTTPConnectionPool> connectionPool
+)
+	: HTTPClient(logger, configuration, connectionPool, std::chrono::steady_clock::time_point::max())
+{
+}
+
+HTTPClient::HTTPClient
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	const std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+	std::shared_ptr<HTTPConnectionPool> connectionPool,
+	std::chrono::steady_clock::time_point requestDeadline
+)
+	: HTTPClient(logger, configuration, connectionPool, requestDeadline, nullptr)
+{
+}
+
+HTTPClient::HTTPClient
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	const std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+	std::shared_ptr<HTTPConnectionPool> connectionPool,
+	std::chrono::steady_clock::time_point requestDeadline,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
 )
 	: mLogger(logger)
 	, mCurl(nullptr)
 	, mServerID(configuration->getServerID())
 	, mMonitorURL()
-	, mReadBuffer()
+	, mReadBuffer(nullptr)
 	, mReadBufferPos(0)
 	, mSSLTrustManager(nullptr)
 	, mNewSessionURL()
+	, mConnectionPool(connectionPool)
+	, mRequestDeadline(requestDeadline)
+	, mMetricsRegistry(metricsRegistry)
 {
 	// build the beacon URLs
 	buildMonitorURL(mMonitorURL, configuration->getBaseURL(), configuration->getApplicationID(), mServerID);
@@ -74,7 +110,7 @@ HTTPClient::HTTPClient
 
 std::shared_ptr<IStatusResponse> HTTPClient::sendStatusRequest()
 {
-	auto response = sendRequestInternal(RequestType::STATUS, mMonitorURL, core::UTF8String(""), core::UTF8String(""), HttpMethod::GET);
+	auto response = sendRequestInternal(RequestType::STATUS, mMonitorURL, core::UTF8String(""), std::vector<unsigned char>(), HttpMethod::GET);
 	if (response == nullptr)
 	{
 		response = StatusResponse::createErrorResponse(mLogger, std::numeric_limits<int32_t>::max());
@@ -85,7 +121,23 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendStatusRequest()
 
 std::shared_ptr<IStatusResponse> HTTPClient::sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData)
 {
-	auto response = sendRequestInternal(RequestType::BEACON, mMonitorURL, clientIPAddress, beaconData, HttpMethod::POST);
+	std::vector<unsigned char> compressedBeaconData;
+	if (!beaconData.empty())
+	{
+		if (mLogger->isDebugEnabled())
+		{
+			mLogger->debug("HTTPClient sendBeaconRequest() - Beacon Payload: %s", beaconData.getStringData().c_str());
+		}
+
+		Compressor::compressMemory(beaconData.getStringData().c_str(), beaconData.getStringData().size(), compressedBeaconData);
+	}
+
+	return sendCompressedBeaconRequest(clientIPAddress, compressedBeaconData);
+}
+
+std::shared_ptr<IStatusResponse> HTTPClient::sendCompressedBeaconRequest(const core::UTF8String& clientIPAddress, const std::vector<unsigned char>& compressedBeaconData)
+{
+	auto response = sendRequestInternal(RequestType::BEACON, mMonitorURL, clientIPAddress, compressedBeaconData, HttpMethod::POST);
 	if (response == nullptr)
 	{
 		response = StatusResponse::createErrorResponse(mLogger, std::numeric_limits<int32_t>::max());
@@ -96,7 +148,7 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendBeaconRequest(const core::UTF8S
 
 std::shared_ptr<IStatusResponse> HTTPClient::sendNewSessionRequest()
 {
-	auto response = sendRequestInternal(RequestType::NEW_SESSION, mNewSessionURL, core::UTF8String(""), core::UTF8String(""), HttpMethod::GET);
+	auto response = sendRequestInternal(RequestType::NEW_SESSION, mNewSessionURL, core::UTF8String(""), std::vector<unsigned char>(), HttpMethod::GET);
 	if (response == nullptr)
 	{
 		response = StatusResponse::createErrorResponse(mLogger, std::numeric_limits<int32_t>::max());
@@ -129,12 +181,17 @@ size_t HTTPClient::readFunction(void *ptr, size_t elementSize, size_t numberOfEl
 	if (userPtr)
 	{
 		auto _this = (HTTPClient*)userPtr;
-		size_t available = (_this->mReadBuffer.size() - _this->mReadBufferPos);
+		if (_this->mReadBuffer == nullptr)
+		{
+			return 0;
+		}
+
+		size_t available = (_this->mReadBuffer->size() - _this->mReadBufferPos);
 
 		if (available > 0)
 		{
 			size_t written = std::min(elementSize * numberOfElements, available);
-			memcpy(ptr, ((char*)(_this->mReadBuffer.data())) + _this->mReadBufferPos, written);
+			memcpy(ptr, ((char*)(_this->mReadBuffer->data())) + _this->mReadBufferPos, written);
 			_this->mReadBufferPos += written;
 			return written;
 		}
@@ -179,7 +236,7 @@ static size_t headerFunction(char *buffer, size_t elementSize, size_t numberOfEl
 }
 
 //TODO: stefan.eberl - use the request type or rethink design
-std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HTTPClient::HttpMethod method)
+std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const std::vector<unsigned char>& compressedBeaconData, const HTTPClient::HttpMethod method)
 {
 	if (mLogger->isDebugEnabled())
 	{
@@ -211,16 +268,30 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 	uint32_t retryCount = 0;
 	do
 	{
+		// a request which would not finish before the deadline is not even started (zero disables the curl timeout)
+		auto readTimeoutMillis = getTimeoutUntilDeadline(READ_TIMEOUT_MILLIS);
+		if (readTimeoutMillis <= 0)
+		{
+			mLogger->warning("HTTPClient sendRequestInternal() - request deadline expired, not sending request to '%s'", url.getStringData().c_str());
+			break;
+		}
+
 		// Set the connection parameters (URL, timeouts, etc.)
 		curl_easy_setopt(mCurl, CURLOPT_URL, url.getStringData().c_str());
-		curl_easy_setopt(mCurl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
-		curl_easy_setopt(mCurl, CURLOPT_TIMEOUT, READ_TIMEOUT);
+		curl_easy_setopt(mCurl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(std::min(CONNECT_TIMEOUT_MILLIS, readTimeoutMillis)));
+		curl_easy_setopt(mCurl, CURLOPT_TIMEOUT_MS, static_cast<long>(readTimeoutMillis));
 		// allow servers to send compressed data
 		curl_easy_setopt(mCurl, CURLOPT_ACCEPT_ENCODING, "");
 		// SSL/TSL certificate handling
 		mSSLTrustManager->applyTrustManager(mCurl);
+		// reuse connections of other clients, if a pool is available
+		if (mConnectionPool != nullptr)
+		{
+			mConnectionPool->applyTo(mCurl);
+		}
 
-		HTTPResponseParser responseParser;
+		// all response headers are only recorded for debug logging
+		HTTPResponseParser responseParser(mLogger->isDebugEnabled());
 		// To retrieve the response headers
 		curl_easy_setopt(mCurl, CURLOPT_HEADERFUNCTION, headerFunction);
 		curl_easy_setopt(mCurl, CURLOPT_HEADERDATA, &responseParser);
@@ -243,19 +314,14 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 			// Do a regular HTTP post
 			curl_easy_setopt(mCurl, CURLOPT_POST, 1L);
 
-			if (!beaconData.empty())
+			if (!compressedBeaconData.empty())
 			{
-				if (mLogger->isDebugEnabled())
-				{
-					mLogger->debug("HTTPClient sendRequestInternal() - Beacon Payload: %s", beaconData.getStringData().c_str());
-				}
-
-				// Data to send is compressed => Compress the data
-				Compressor::compressMemory(beaconData.getStringData().c_str(), beaconData.getStringLength(), mReadBuffer);
+				// Data to send is already compressed
+				mReadBuffer = &compressedBeaconData;
 				mReadBufferPos = 0;
 				curl_easy_setopt(mCurl, CURLOPT_READFUNCTION, readFunction);
 				curl_easy_setopt(mCurl, CURLOPT_READDATA, this);
-				curl_easy_setopt(mCurl, CURLOPT_POSTFIELDSIZE, mReadBuffer.size());
+				curl_easy_setopt(mCurl, CURLOPT_POSTFIELDSIZE, mReadBuffer->size());
 				list = curl_slist_append(list, "Content-Encoding: gzip");
 			}
 		}
@@ -266,6 +332,7 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 		}
 
 		// Perform the request, res will get the return code
+		auto requestStartTime = mMetricsRegistry != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
 		CURLcode response = curl_easy_perform(mCurl);
 		if (response == CURLE_OK)
 		{
@@ -278,6 +345,11 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 			mLogger->error("HTTPClient sendRequestInternal() - curl_easy_perform() failed on '%s': ErrorCode '%u', [%s]", url.getStringData().c_str(), response, curl_easy_strerror(response));
 		}
 
+		if (mMetricsRegistry != nullptr)
+		{
+			recordRequestMetrics(requestStartTime, retryCount > 0, response == CURLE_OK ? httpCode : -1L);
+		}
+
 		// Cleanup
 		if (list != nullptr)
 		{
@@ -313,12 +385,49 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 	return HTTPClient::unknownErrorResponse(requestType);
 }
 
+void HTTPClient::recordRequestMetrics(std::chrono::steady_clock::time_point startTime, bool isRetry, long httpCode)
+{
+	mMetricsRegistry->getHTTPRequestDuration().recordMillisSince(startTime);
+	mMetricsRegistry->getHTTPRequests().increment();
+	if (isRetry)
+	{
+		mMetricsRegistry->getHTTPRetries().increment();
+	}
+	if (httpCode < 0 || httpCode >= 400)
+	{
+		mMetricsRegistry->getHTTPErrors().increment();
+	}
+	if (httpCode == 429)
+	{
+		mMetricsRegistry->getHTTPTooManyRequestsResponses().increment();
+	}
+}
+
+int64_t HTTPClient::getTimeoutUntilDeadline(int64_t timeoutMillis) const
+{
+	if (mRequestDeadline == std::chrono::steady_clock::time_point::max())
+	{
+		// no deadline set
+		return timeoutMillis;
+	}
+
+	auto remainingMillis = std::chrono::duration_cast<std::chrono::milliseconds>(mRequestDeadline - std::chrono::steady_clock::now()).count();
+	return std::min(timeoutMillis, static_cast<int64_t>(remainingMillis));
+}
+
 std::shared_ptr<IStatusResponse> HTTPClient::handleResponse(RequestType requestType, int32_t httpCode, const std::string& response, const IStatusResponse::ResponseHeaders& responseHeaders)
 {
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("HTTPClient handleResponse() - HTTP Response: %s", response.c_str());
 		mLogger->debug("HTTPClient handleResponse() - HTTP Response Code: %u", (uint32_t)httpCode);
+		for (const auto& header : responseHeaders)
+		{
+			for (const auto& value : header.second)
+			{
+				mLogger->debug("HTTPClient handleResponse() - HTTP Response Header: %s: %s", header.first.c_str(), value.c_str());
+			}
+		}
 	}
 
 	// check response code
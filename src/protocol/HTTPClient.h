@@ -20,10 +20,13 @@
 #include "OpenKit/ILogger.h"
 #include "OpenKit/ISSLTrustManager.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
+#include "core/util/MetricsRegistry.h"
+#include "protocol/HTTPConnectionPool.h"
 #include "protocol/IHTTPClient.h"
 
 #include "curl/curl.h"
 
+#include <chrono>
 #include <vector>
 #include <string.h>
 
@@ -67,6 +70,48 @@ namespace protocol
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 		);
 
+		///
+		/// Constructor using pooled connections
+		/// @param[in] logger to write traces to
+		/// @param[in] configuration configuration parameters for the HTTPClient
+		/// @param[in] connectionPool pool of connections shared with other clients, might be @c nullptr
+		///
+		HTTPClient(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+			std::shared_ptr<HTTPConnectionPool> connectionPool
+		);
+
+		///
+		/// Constructor using pooled connections, whose requests must be finished until the given deadline
+		/// @param[in] logger to write traces to
+		/// @param[in] configuration configuration parameters for the HTTPClient
+		/// @param[in] connectionPool pool of connections shared with other clients, might be @c nullptr
+		/// @param[in] requestDeadline point in time when all requests are aborted
+		///
+		HTTPClient(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+			std::shared_ptr<HTTPConnectionPool> connectionPool,
+			std::chrono::steady_clock::time_point requestDeadline
+		);
+
+		///
+		/// Constructor using pooled connections and recording self-monitoring metrics
+		/// @param[in] logger to write traces to
+		/// @param[in] configuration configuration parameters for the HTTPClient
+		/// @param[in] connectionPool pool of connections shared with other clients, might be @c nullptr
+		/// @param[in] requestDeadline point in time when all requests are aborted
+		/// @param[in] metricsRegistry registry to record metrics in, @c nullptr if statistics are disabled
+		///
+		HTTPClient(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
+			std::shared_ptr<HTTPConnectionPool> connectionPool,
+			std::chrono::steady_clock::time_point requestDeadline,
+			std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+		);
+
 		///
 		/// Destructor
 		///
@@ -89,6 +134,11 @@ namespace protocol
 			const core::UTF8String& beaconData
 		) override;
 
+		std::shared_ptr<IStatusResponse> sendCompressedBeaconRequest(
+			const core::UTF8String& clientIPAddress,
+			const std::vector<unsigned char>& compressedBeaconData
+		) override;
+
 		std::shared_ptr<IStatusResponse> sendNewSessionRequest() override;
 
 		///
@@ -110,11 +160,11 @@ namespace protocol
 		/// @param[in] requestType the type of request sent to the server
 		/// @param[in] url the url where to send the request to
 		/// @param[in] clientIPAddress optional the IP address of the client. If provided, this is sent in the custom HTTP header "X-Client-IP"
-		/// @param[in] beaconData optional data to send in the HTTP POST. Data will be gzip compressed.
+		/// @param[in] compressedBeaconData optional gzip compressed data to send in the HTTP POST.
 		/// @param[in] method the HTTP method to use. Currently either POST or GET
 		/// @returns a status response with the response data for the request or @c nullptr on error
 		///
-		std::shared_ptr<IStatusResponse> sendRequestInternal(RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HttpMethod method);
+		std::shared_ptr<IStatusResponse> sendRequestInternal(RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const std::vector<unsigned char>& compressedBeaconData, const HttpMethod method);
 
 		///
 		/// Build URL used for status check and beacon send requests
@@ -135,6 +185,21 @@ namespace protocol
 
 		std::shared_ptr<IStatusResponse> unknownErrorResponse(RequestType requestType);
 
+		///
+		/// Bounds the given timeout by the time left until the request deadline.
+		/// @param[in] timeoutMillis the timeout to apply if the deadline is far enough in the future
+		/// @returns the timeout in milliseconds, which is zero or negative if the deadline already expired
+		///
+		int64_t getTimeoutUntilDeadline(int64_t timeoutMillis) const;
+
+		///
+		/// Records the metrics of a single request attempt
+		/// @param[in] startTime point in time when the request was started
+		/// @param[in] isRetry @c true if the request is a retry of a failed request
+		/// @param[in] httpCode the HTTP response code or a negative value if no response was received
+		///
+		void recordRequestMetrics(std::chrono::steady_clock::time_point startTime, bool isRetry, long httpCode);
+
 	private:
 
 		/// Logger to write traces to
@@ -149,8 +214,8 @@ namespace protocol
 		/// URL used for status check and beacon send requests
 		core::UTF8String mMonitorURL;
 
-		/// buffer used for curl's read function
-		std::vector<unsigned char> mReadBuffer;
+		/// buffer used for curl's read function, pointing to the compressed beacon data of the current request
+		const std::vector<unsigned char>* mReadBuffer;
 
 		/// read position in the read buffer
 		size_t mReadBufferPos;
@@ -160,6 +225,15 @@ namespace protocol
 
 		/// URL for new session requests
 		core::UTF8String mNewSessionURL;
+
+		/// pool of connections shared with other clients, @c nullptr if every request uses its own connection
+		std::shared_ptr<HTTPConnectionPool> mConnectionPool;
+
+		/// point in time when all requests are aborted
+		const std::chrono::steady_clock::time_point mRequestDeadline;
+
+		/// registry to record metrics in, @c nullptr if statistics are disabled
+		const std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
 	};
 
 }
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "HTTPConnectionPool.h"
+
+using namespace protocol;
+
+HTTPConnectionPool::HTTPConnectionPool()
+	: mShareMutex()
+	, mShare(nullptr)
+	, mConnectionMutex()
+	, mDNSMutex()
+	, mSSLSessionMutex()
+	, mOtherMutex()
+{
+}
+
+HTTPConnectionPool::~HTTPConnectionPool()
+{
+	if (mShare != nullptr)
+	{
+		curl_share_cleanup(mShare);
+		mShare = nullptr;
+	}
+}
+
+bool HTTPConnectionPool::applyTo(CURL* curl)
+{
+	CURLSH* share = nullptr;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mShareMutex);
+		if (mShare == nullptr)
+		{
+			mShare = curl_share_init();
+			if (mShare == nullptr)
+			{
+				return false;
+			}
+
+			curl_share_setopt(mShare, CURLSHOPT_LOCKFUNC, lockFunction);
+			curl_share_setopt(mShare, CURLSHOPT_UNLOCKFUNC, unlockFunction);
+			curl_share_setopt(mShare, CURLSHOPT_USERDATA, this);
+			curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+			curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+			curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		}
+		share = mShare;
+	}
+
+	return curl_easy_setopt(curl, CURLOPT_SHARE, share) == CURLE_OK;
+}
+
+void HTTPConnectionPool::lockFunction(CURL* /* handle */, curl_lock_data data, curl_lock_access /* access */, void* userPtr)
+{
+	static_cast<HTTPConnectionPool*>(userPtr)->getMutex(data).lock();
+}
+
+void HTTPConnectionPool::unlockFunction(CURL* /* handle */, curl_lock_data data, void* userPtr)
+{
+	static_cast<HTTPConnectionPool*>(userPtr)->getMutex(data).unlock();
+}
+
+std::mutex& HTTPConnectionPool::getMutex(curl_lock_data data)
+{
+	switch (data)
+	{
+	case CURL_LOCK_DATA_CONNECT:
+		return mConnectionMutex;
+	case CURL_LOCK_DATA_DNS:
+		return mDNSMutex;
+	case CURL_LOCK_DATA_SSL_SESSION:
+		return mSSLSessionMutex;
+	default:
+		return mOtherMutex;
+	}
+}
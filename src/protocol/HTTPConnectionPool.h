@@ -0,0 +1,104 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _PROTOCOL_HTTPCONNECTIONPOOL_H
+#define _PROTOCOL_HTTPCONNECTIONPOOL_H
+
+#include "curl/curl.h"
+
+#include <mutex>
+
+namespace protocol
+{
+	///
+	/// Pool of HTTP connections shared by all @ref HTTPClient instances using it.
+	///
+	/// The pool wraps a curl share handle, sharing open connections, the DNS cache and SSL sessions
+	/// between the curl easy handles of several clients. Thus consecutive requests to the same
+	/// endpoint can reuse an already established (TLS) connection.
+	///
+	class HTTPConnectionPool
+	{
+	public:
+
+		///
+		/// Constructor
+		///
+		HTTPConnectionPool();
+
+		///
+		/// Destructor releasing the curl share handle.
+		///
+		~HTTPConnectionPool();
+
+		///
+		/// Delete the copy constructor
+		///
+		HTTPConnectionPool(const HTTPConnectionPool&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		HTTPConnectionPool& operator = (const HTTPConnectionPool&) = delete;
+
+		///
+		/// Attaches the given curl easy handle to this pool.
+		///
+		/// @remarks The curl share handle is created lazily on the first call, which is after curl's global initialization.
+		/// @param[in] curl the curl easy handle which shall use the pooled connections
+		/// @return @c true if the handle was attached, @c false if the share handle could not be created
+		///
+		bool applyTo(CURL* curl);
+
+	private:
+
+		///
+		/// Lock callback passed to curl.
+		///
+		static void lockFunction(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr);
+
+		///
+		/// Unlock callback passed to curl.
+		///
+		static void unlockFunction(CURL* handle, curl_lock_data data, void* userPtr);
+
+		///
+		/// Returns the mutex guarding the given kind of shared data.
+		///
+		std::mutex& getMutex(curl_lock_data data);
+
+		/// mutex guarding the lazy creation of the share handle
+		std::mutex mShareMutex;
+
+		/// the curl share handle, @c nullptr until first used
+		CURLSH* mShare;
+
+		/// mutex guarding the shared connection cache
+		std::mutex mConnectionMutex;
+
+		/// mutex guarding the shared DNS cache
+		std::mutex mDNSMutex;
+
+		/// mutex guarding the shared SSL session cache
+		std::mutex mSSLSessionMutex;
+
+		/// mutex guarding any other data curl shares between handles
+		std::mutex mOtherMutex;
+	};
+}
+
+#endif
@@ -18,50 +18,82 @@
 
 #include <cctype>
 #include <algorithm>
+#include <string>
 
 using namespace protocol;
 
 static constexpr char HTTP_HEADER_LINE_KEY_VALUE_SEPARATOR = ':';
-static constexpr char HTTP_HEADER_LINE_VALUE_SEPARATOR = ',';
+
+///
+/// Lower case names of the response headers evaluated by OpenKit.
+///
+static constexpr const char* RELEVANT_RESPONSE_HEADERS[] =
+{
+	"retry-after"
+};
 
 HTTPResponseParser::HTTPResponseParser()
-	: mResponseHeaders()
-	, mResponseBody()
+	: HTTPResponseParser(true)
 {
 }
 
+HTTPResponseParser::HTTPResponseParser(bool collectAllHeaders)
+	: mCollectAllHeaders(collectAllHeaders)
+	, mResponseHeaders()
+	, mResponseBody()
+{
+}
 
 size_t HTTPResponseParser::responseHeaderData(const char *buffer, size_t elementSize, size_t numberOfElements)
 {
-	// convert response line into STL string
-	auto responseLine = std::string(buffer, elementSize * numberOfElements);
+	auto numberOfBytes = elementSize * numberOfElements;
+	auto lineEnd = buffer + numberOfBytes;
 
 	// split up response header line
-	auto separatorPosition = responseLine.find(HTTP_HEADER_LINE_KEY_VALUE_SEPARATOR);
-	if (separatorPosition != std::string::npos)
+	auto separator = std::find(buffer, lineEnd, HTTP_HEADER_LINE_KEY_VALUE_SEPARATOR);
+	if (separator != lineEnd)
 	{
 		// found the separator - split into key and value
-		auto key = responseLine.substr(0, separatorPosition);
-		auto valueString = responseLine.substr(separatorPosition + 1);
+		auto keyLength = static_cast<size_t>(separator - buffer);
+		auto valueBegin = separator + 1;
+		auto valueEnd = lineEnd;
 
-		// strip optional whitespace character
-		HTTPResponseParser::stripWhitespaces(valueString);
+		if (mCollectAllHeaders)
+		{
+			// strip optional whitespace character
+			HTTPResponseParser::stripWhitespaces(valueBegin, valueEnd);
 
-		// key is case insensitive
-		std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-		auto responseKeyIterator = mResponseHeaders.find(key);
-		if (responseKeyIterator == mResponseHeaders.end())
+			// key is case insensitive
+			std::string key(buffer, keyLength);
+			std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			addHeaderValue(std::move(key), std::string(valueBegin, valueEnd));
+		}
+		else
 		{
-			// key not yet present
-			responseKeyIterator = mResponseHeaders.insert({ key, std::vector<std::string>() }).first;
+			auto relevantHeader = HTTPResponseParser::findRelevantHeader(buffer, keyLength);
+			if (relevantHeader != nullptr)
+			{
+				// strip optional whitespace character
+				HTTPResponseParser::stripWhitespaces(valueBegin, valueEnd);
+				addHeaderValue(relevantHeader, std::string(valueBegin, valueEnd));
+			}
 		}
-
-		// move over previously parsed values
-		responseKeyIterator->second.push_back(valueString);
 	}
 
 	// in any case return the number of bytes processed
-	return elementSize * numberOfElements;
+	return numberOfBytes;
+}
+
+void HTTPResponseParser::addHeaderValue(std::string key, std::string value)
+{
+	auto responseKeyIterator = mResponseHeaders.find(key);
+	if (responseKeyIterator == mResponseHeaders.end())
+	{
+		// key not yet present
+		responseKeyIterator = mResponseHeaders.insert({ std::move(key), std::vector<std::string>() }).first;
+	}
+
+	responseKeyIterator->second.push_back(std::move(value));
 }
 
 size_t HTTPResponseParser::responseBodyData(const char* buffer, size_t elementSize, size_t numberOfElements)
@@ -85,25 +117,39 @@ bool HTTPResponseParser::isWhitespace(char c)
 	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
 }
 
-void HTTPResponseParser::stripWhitespaces(std::string& str)
+void HTTPResponseParser::stripWhitespaces(const char*& begin, const char*& end)
 {
-	auto begin = str.cbegin();
-	auto end = str.cend();
-
 	// strip leading whitespace
 	while (begin < end && isWhitespace(*begin))
 	{
 		begin++;
 	}
 	// strip trailing whitespaces
-	end -= 1;
-	while (end > begin && isWhitespace(*end))
+	while (end > begin && isWhitespace(*(end - 1)))
 	{
 		end--;
 	}
+}
 
-	end += 1;
+const char* HTTPResponseParser::findRelevantHeader(const char* key, size_t keyLength)
+{
+	for (const auto header : RELEVANT_RESPONSE_HEADERS)
+	{
+		auto headerLength = std::char_traits<char>::length(header);
+		if (headerLength != keyLength)
+		{
+			continue;
+		}
+
+		auto matches = std::equal(key, key + keyLength, header, [](char lhs, char rhs)
+		{
+			return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+		});
+		if (matches)
+		{
+			return header;
+		}
+	}
 
-	// assign final result
-	str = end > begin ? std::string(begin, end) : std::string();
+	return nullptr;
 }
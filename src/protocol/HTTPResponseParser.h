@@ -33,10 +33,19 @@ namespace protocol
 	public:
 
 		///
-		/// Construct a HTTPResponseParser instance.
+		/// Construct a HTTPResponseParser instance collecting all response headers.
 		///
 		HTTPResponseParser();
 
+		///
+		/// Construct a HTTPResponseParser instance.
+		/// @remarks If @c collectAllHeaders is @c false, only the response headers evaluated by OpenKit
+		///          (see @ref findRelevantHeader) are recorded, and all other header lines are skipped
+		///          without copying them.
+		/// @param[in] collectAllHeaders @c true if all response headers shall be recorded, @c false otherwise.
+		///
+		explicit HTTPResponseParser(bool collectAllHeaders);
+
 		///
 		/// Method called when new header line is ready to be parsed.
 		/// @remarks The deprecated header folding (having one long header split up into multiple lines)
@@ -60,6 +69,7 @@ namespace protocol
 
 		///
 		/// Get the response headers.
+		/// @remarks Header names are given in lower case.
 		/// @return Response headers parsed so far.
 		///
 		const IStatusResponse::ResponseHeaders& getResponseHeaders() const;
@@ -83,10 +93,30 @@ namespace protocol
 		static bool isWhitespace(char c);
 
 		///
-		/// Strip leading and trailing whitespace characters from the string.
-		/// @param[in,out] The string to strip.
+		/// Strip leading and trailing whitespace characters from the given character range.
+		/// @param[in,out] begin The first character of the range, moved past leading whitespace.
+		/// @param[in,out] end The end of the range, moved before trailing whitespace.
+		///
+		static void stripWhitespaces(const char*& begin, const char*& end);
+
+		///
+		/// Gives the lower case name of the header evaluated by OpenKit which matches the given key.
+		/// @remarks The key is compared case insensitively and in place.
+		/// @param[in] key The first character of the header key.
+		/// @param[in] keyLength The length of the header key.
+		/// @return The lower case name of the matching header or @c nullptr if the header is not relevant.
+		///
+		static const char* findRelevantHeader(const char* key, size_t keyLength);
+
+		///
+		/// Appends the given value to the values of the header with the given lower case name.
+		/// @param[in] key The lower case header name.
+		/// @param[in] value The header value.
 		///
-		static void stripWhitespaces(std::string& str);
+		void addHeaderValue(std::string key, std::string value);
+
+		/// Flag indicating whether all response headers are recorded
+		const bool mCollectAllHeaders;
 
 		/// Response headers
 		IStatusResponse::ResponseHeaders mResponseHeaders;
@@ -18,6 +18,7 @@
 #define _PROTOCOL_IBEACON_H
 
 #include "IStatusResponse.h"
+#include "ReportedEvent.h"
 #include "core/UTF8String.h"
 #include "core/configuration/IBeaconConfiguration.h"
 #include "core/objects/LeafAction.h"
@@ -25,6 +26,7 @@
 #include "core/objects/Session.h"
 
 #include <memory>
+#include <vector>
 
 namespace core
 {
@@ -154,6 +156,19 @@ namespace protocol
 		///
 		virtual void reportError(int32_t actionID, const core::UTF8String& errorName, int32_t error, const core::UTF8String& reason) = 0;
 
+		///
+		/// Add several events, values and errors reported on the same action to Beacon.
+		///
+		/// The result equals calling @ref reportEvent, @ref reportValue and @ref reportError for each element,
+		/// but the data captured on the reporting thread is taken once and the serialized data is added to
+		/// @ref core::caching::BeaconCache in a single step.
+		///
+		/// @param actionID The id of the @ref core::objects::RootAction or @ref core::objects::LeafAction on which
+		///   the events were reported.
+		/// @param events The reported events.
+		///
+		virtual void reportEvents(int32_t actionID, const std::vector<ReportedEvent>& events) = 0;
+
 		///
 		/// Add crash to Beacon
 		/// The serialized data is added to @ref core::caching::BeaconCache
@@ -197,6 +212,25 @@ namespace protocol
 		///
 		virtual bool isEmpty() const = 0;
 
+		///
+		/// Returns the number of records collected for this Beacon and not yet sent.
+		///
+		/// This includes records which are not serialized yet and records which are currently being sent.
+		///
+		virtual size_t getNumberOfRecords() const = 0;
+
+		///
+		/// Tests if an error or a crash has been reported to this Beacon.
+		///
+		/// @returns @c true if at least one error or crash has been reported, @c false otherwise
+		///
+		virtual bool hasReportedFailures() const = 0;
+
+		///
+		/// Returns the timestamp when the session of this Beacon has been started.
+		///
+		virtual int64_t getSessionStartTime() const = 0;
+
 		///
 		/// Clears all previously collected data for this Beacon.
 		///
@@ -21,6 +21,7 @@
 #include "protocol/IStatusResponse.h"
 
 #include <memory>
+#include <vector>
 
 namespace protocol
 {
@@ -52,6 +53,14 @@ namespace protocol
 		///
 		virtual std::shared_ptr<IStatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData) = 0;
 
+		///
+		/// sends a beacon send request with already gzip compressed data and returns a status response
+		/// @param[in] clientIPAddress the client IP address
+		/// @param[in] compressedBeaconData the gzip compressed beacon payload
+		/// @returns a status response with the response data for the request or @c nullptr on error
+		///
+		virtual std::shared_ptr<IStatusResponse> sendCompressedBeaconRequest(const core::UTF8String& clientIPAddress, const std::vector<unsigned char>& compressedBeaconData) = 0;
+
 		///
 		/// sends a new session request and returns a status response
 		/// @returns a status response with the response data for the request or @c nullptr on error
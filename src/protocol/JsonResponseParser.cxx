@@ -15,318 +15,348 @@
  */
 
 #include "JsonResponseParser.h"
-#include "util/json/JsonParser.h"
-#include "util/json/objects/JsonNumberValue.h"
-#include "util/json/objects/JsonObjectValue.h"
+#include "ResponseAttributes.h"
+#include "util/json/JsonEventParser.h"
+#include "util/json/parser/IJsonEventHandler.h"
 
-using namespace protocol;
-
-const std::string JsonResponseParser::RESPONSE_KEY_AGENT_CONFIG = "mobileAgentConfig";
-const std::string JsonResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB = "maxBeaconSizeKb";
-const std::string JsonResponseParser::RESPONSE_KEY_MAX_SESSION_DURATION_IN_MIN = "maxSessionDurationInMins";
-const std::string JsonResponseParser::RESPONSE_KEY_MAX_EVENTS_PER_SESSION = "maxEventsPerSession";
-const std::string JsonResponseParser::RESPONSE_KEY_SESSION_TIMEOUT_IN_SEC = "sessionTimeoutSec";
-const std::string JsonResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC = "sendIntervalSec";
-const std::string JsonResponseParser::RESPONSE_KEY_VISIT_STORE_VERSION = "visitStoreVersion";
-
-const std::string JsonResponseParser::RESPONSE_KEY_APP_CONFIG = "appConfig";
-const std::string JsonResponseParser::RESPONSE_KEY_CAPTURE = "capture";
-const std::string JsonResponseParser::RESPONSE_KEY_REPORT_CRASHES = "reportCrashes";
-const std::string JsonResponseParser::RESPONSE_KEY_REPORT_ERRORS = "reportErrors";
-
-const std::string JsonResponseParser::RESPONSE_KEY_DYNAMIC_CONFIG = "dynamicConfig";
-const std::string JsonResponseParser::RESPONSE_KEY_MULTIPLICITY = "multiplicity";
-const std::string JsonResponseParser::RESPONSE_KEY_SERVER_ID = "serverId";
-
-const std::string JsonResponseParser::RESPONSE_KEY_TIMESTAMP_IN_MILLIS = "timestamp";
-
-std::shared_ptr<protocol::IResponseAttributes> JsonResponseParser::parse(const core::UTF8String& jsonResponse)
-{
-	auto jsonParser = util::json::JsonParser(jsonResponse.getStringData());
-
-	auto parsedValue = jsonParser.parse();
-	auto rootObject  = std::dynamic_pointer_cast<util::json::objects::JsonObjectValue>(parsedValue);
-
-	auto builder = ResponseAttributes::withJsonDefaults();
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
-	applyAgentConfiguration(builder, rootObject);
-	applyApplicationConfiguration(builder, rootObject);
-	applyDynamicConfiguration(builder, rootObject);
-	applyRootAttributes(builder, rootObject);
-
-	return builder.build();
-}
+using namespace protocol;
 
-std::shared_ptr<util::json::objects::JsonObjectValue> JsonResponseParser::getJsonObjectFrom(
-	std::shared_ptr<util::json::objects::JsonObjectValue> jsonObject,
-	const std::string& key
-)
+namespace
 {
-	auto entry = jsonObject->find(key);
-	if (entry == jsonObject->end())
+	constexpr char KEY_AGENT_CONFIG[] = "mobileAgentConfig";
+	constexpr char KEY_MAX_BEACON_SIZE_IN_KB[] = "maxBeaconSizeKb";
+	constexpr char KEY_MAX_SESSION_DURATION_IN_MIN[] = "maxSessionDurationInMins";
+	constexpr char KEY_MAX_EVENTS_PER_SESSION[] = "maxEventsPerSession";
+	constexpr char KEY_SESSION_TIMEOUT_IN_SEC[] = "sessionTimeoutSec";
+	constexpr char KEY_SEND_INTERVAL_IN_SEC[] = "sendIntervalSec";
+	constexpr char KEY_VISIT_STORE_VERSION[] = "visitStoreVersion";
+
+	constexpr char KEY_APP_CONFIG[] = "appConfig";
+	constexpr char KEY_CAPTURE[] = "capture";
+	constexpr char KEY_REPORT_CRASHES[] = "reportCrashes";
+	constexpr char KEY_REPORT_ERRORS[] = "reportErrors";
+
+	constexpr char KEY_DYNAMIC_CONFIG[] = "dynamicConfig";
+	constexpr char KEY_MULTIPLICITY[] = "multiplicity";
+	constexpr char KEY_SERVER_ID[] = "serverId";
+
+	constexpr char KEY_TIMESTAMP_IN_MILLIS[] = "timestamp";
+
+	///
+	/// JSON objects of the response containing known keys
+	///
+	enum class Section
 	{
-		return nullptr;
-	}
-
-	return std::dynamic_pointer_cast<util::json::objects::JsonObjectValue>(entry->second);
-}
-
-std::shared_ptr<util::json::objects::JsonNumberValue> JsonResponseParser::getJsonNumberFrom(
-	std::shared_ptr<util::json::objects::JsonObjectValue> jsonObject,
-	const std::string& key
-)
-{
-	auto entry = jsonObject->find(key);
-	if (entry == jsonObject->end())
+		NONE,
+		ROOT,
+		AGENT_CONFIG,
+		APP_CONFIG,
+		DYNAMIC_CONFIG
+	};
+
+	using ApplyFunction = void (*)(ResponseAttributes::Builder&, int64_t);
+
+	///
+	/// Entry of the table of known keys
+	///
+	struct KeyTableEntry
 	{
-		return nullptr;
+		/// object containing the key
+		Section section;
+		/// the key
+		const char* key;
+		/// length of the key
+		size_t keyLength;
+		/// the section which is started if the key's value is an object, @c NONE otherwise
+		Section startedSection;
+		/// function applying the key's number value to the builder, @c nullptr if no number is expected
+		ApplyFunction apply;
+	};
+
+	void applyBeaconSizeInKb(ResponseAttributes::Builder& builder, int64_t value)
+	{
+		builder.withMaxBeaconSizeInBytes(static_cast<int32_t>(value) * 1024);
 	}
 
-	return std::dynamic_pointer_cast<util::json::objects::JsonNumberValue>(entry->second);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Agent configuration
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void JsonResponseParser::applyAgentConfiguration(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-)
-{
-	auto agentConfigObject = getJsonObjectFrom(rootObject, JsonResponseParser::RESPONSE_KEY_AGENT_CONFIG);
-	if (agentConfigObject == nullptr)
+	void applyMaxSessionDurationInMin(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withMaxSessionDurationInMilliseconds(static_cast<int32_t>(value) * 60 * 1000);
 	}
 
-	applyBeaconSizeInKb(builder, agentConfigObject);
-	applyMaxSessionDurationInMin(builder, agentConfigObject);
-	applyMaxEventsPerSession(builder, agentConfigObject);
-	applySessionTimeoutInSec(builder, agentConfigObject);
-	applySendIntervalInSec(builder, agentConfigObject);
-	applyVisitStoreVersion(builder, agentConfigObject);
-}
-
-void JsonResponseParser::applyBeaconSizeInKb(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB);
-	if (numberValue == nullptr)
+	void applyMaxEventsPerSession(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withMaxEventsPerSession(static_cast<int32_t>(value));
 	}
 
-	auto beaconSizeInKb = numberValue->getInt32Value();
-	builder.withMaxBeaconSizeInBytes(beaconSizeInKb * 1024);
-}
-
-void JsonResponseParser::applyMaxSessionDurationInMin(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_MAX_SESSION_DURATION_IN_MIN);
-	if (numberValue == nullptr)
+	void applySessionTimeoutInSec(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withSessionTimeoutInMilliseconds(static_cast<int32_t>(value) * 1000);
 	}
 
-	auto sessionDurationMillis = numberValue->getInt32Value() * 60 * 1000;
-	builder.withMaxSessionDurationInMilliseconds(sessionDurationMillis);
-}
-
-void JsonResponseParser::applyMaxEventsPerSession(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_MAX_EVENTS_PER_SESSION);
-	if (numberValue == nullptr)
+	void applySendIntervalInSec(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withSendIntervalInMilliseconds(static_cast<int32_t>(value) * 1000);
 	}
 
-	auto maxEvents = numberValue->getInt32Value();
-	builder.withMaxEventsPerSession(maxEvents);
-}
-
-void JsonResponseParser::applySessionTimeoutInSec(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_SESSION_TIMEOUT_IN_SEC);
-	if (numberValue == nullptr)
+	void applyVisitStoreVersion(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withVisitStoreVersion(static_cast<int32_t>(value));
 	}
 
-	auto timeoutInMillis = numberValue->getInt32Value() * 1000;
-	builder.withSessionTimeoutInMilliseconds(timeoutInMillis);
-}
-
-void JsonResponseParser::applySendIntervalInSec(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC);
-	if (numberValue == nullptr)
+	void applyCapture(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withCapture(static_cast<int32_t>(value) == 1);
 	}
 
-	auto intervalInMillis = numberValue->getInt32Value() * 1000;
-	builder.withSendIntervalInMilliseconds(intervalInMillis);
-}
-
-void JsonResponseParser::applyVisitStoreVersion(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(agentConfigObject, JsonResponseParser::RESPONSE_KEY_VISIT_STORE_VERSION);
-	if (numberValue == nullptr)
+	void applyReportCrashes(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withCaptureCrashes(static_cast<int32_t>(value) != 0);
 	}
 
-	auto visitStoreVersion = numberValue->getInt32Value();
-	builder.withVisitStoreVersion(visitStoreVersion);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Application configuration
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void JsonResponseParser::applyApplicationConfiguration(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-)
-{
-	auto appConfigObject = getJsonObjectFrom(rootObject, JsonResponseParser::RESPONSE_KEY_APP_CONFIG);
-	if (appConfigObject == nullptr)
+	void applyReportErrors(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withCaptureErrors(static_cast<int32_t>(value) != 0);
 	}
 
-	applyCapture(builder, appConfigObject);
-	applyReportCrashes(builder, appConfigObject);
-	applyReportErrors(builder, appConfigObject);
-}
-
-void JsonResponseParser::applyCapture(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(appConfigObject, JsonResponseParser::RESPONSE_KEY_CAPTURE);
-	if (numberValue == nullptr)
+	void applyMultiplicity(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withMultiplicity(static_cast<int32_t>(value));
 	}
 
-	auto capture = numberValue->getInt32Value();
-	builder.withCapture(capture == 1);
-}
-
-void JsonResponseParser::applyReportCrashes(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(appConfigObject, JsonResponseParser::RESPONSE_KEY_REPORT_CRASHES);
-	if (numberValue == nullptr)
+	void applyServerId(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withServerId(static_cast<int32_t>(value));
 	}
 
-	auto reportCrashes = numberValue->getInt32Value();
-	builder.withCaptureCrashes(reportCrashes != 0);
-}
-
-void JsonResponseParser::applyReportErrors(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(appConfigObject, JsonResponseParser::RESPONSE_KEY_REPORT_ERRORS);
-	if (numberValue == nullptr)
+	void applyTimestampInMilliseconds(ResponseAttributes::Builder& builder, int64_t value)
 	{
-		return;
+		builder.withTimestampInMilliseconds(value);
 	}
 
-	auto reportErrors = numberValue->getInt32Value();
-	builder.withCaptureErrors(reportErrors != 0);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Dynamic configuration
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void JsonResponseParser::applyDynamicConfiguration(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-)
-{
-	auto dynConfigObject = getJsonObjectFrom(rootObject, JsonResponseParser::RESPONSE_KEY_DYNAMIC_CONFIG);
-	if (dynConfigObject == nullptr)
+	constexpr KeyTableEntry KEY_TABLE[] =
 	{
-		return;
-	}
+		{ Section::ROOT, KEY_AGENT_CONFIG, sizeof(KEY_AGENT_CONFIG) - 1, Section::AGENT_CONFIG, nullptr },
+		{ Section::ROOT, KEY_APP_CONFIG, sizeof(KEY_APP_CONFIG) - 1, Section::APP_CONFIG, nullptr },
+		{ Section::ROOT, KEY_DYNAMIC_CONFIG, sizeof(KEY_DYNAMIC_CONFIG) - 1, Section::DYNAMIC_CONFIG, nullptr },
+		{ Section::ROOT, KEY_TIMESTAMP_IN_MILLIS, sizeof(KEY_TIMESTAMP_IN_MILLIS) - 1, Section::NONE, &applyTimestampInMilliseconds },
+
+		{ Section::AGENT_CONFIG, KEY_MAX_BEACON_SIZE_IN_KB, sizeof(KEY_MAX_BEACON_SIZE_IN_KB) - 1, Section::NONE, &applyBeaconSizeInKb },
+		{ Section::AGENT_CONFIG, KEY_MAX_SESSION_DURATION_IN_MIN, sizeof(KEY_MAX_SESSION_DURATION_IN_MIN) - 1, Section::NONE, &applyMaxSessionDurationInMin },
+		{ Section::AGENT_CONFIG, KEY_MAX_EVENTS_PER_SESSION, sizeof(KEY_MAX_EVENTS_PER_SESSION) - 1, Section::NONE, &applyMaxEventsPerSession },
+		{ Section::AGENT_CONFIG, KEY_SESSION_TIMEOUT_IN_SEC, sizeof(KEY_SESSION_TIMEOUT_IN_SEC) - 1, Section::NONE, &applySessionTimeoutInSec },
+		{ Section::AGENT_CONFIG, KEY_SEND_INTERVAL_IN_SEC, sizeof(KEY_SEND_INTERVAL_IN_SEC) - 1, Section::NONE, &applySendIntervalInSec },
+		{ Section::AGENT_CONFIG, KEY_VISIT_STORE_VERSION, sizeof(KEY_VISIT_STORE_VERSION) - 1, Section::NONE, &applyVisitStoreVersion },
+
+		{ Section::APP_CONFIG, KEY_CAPTURE, sizeof(KEY_CAPTURE) - 1, Section::NONE, &applyCapture },
+		{ Section::APP_CONFIG, KEY_REPORT_CRASHES, sizeof(KEY_REPORT_CRASHES) - 1, Section::NONE, &applyReportCrashes },
+		{ Section::APP_CONFIG, KEY_REPORT_ERRORS, sizeof(KEY_REPORT_ERRORS) - 1, Section::NONE, &applyReportErrors },
+
+		{ Section::DYNAMIC_CONFIG, KEY_MULTIPLICITY, sizeof(KEY_MULTIPLICITY) - 1, Section::NONE, &applyMultiplicity },
+		{ Section::DYNAMIC_CONFIG, KEY_SERVER_ID, sizeof(KEY_SERVER_ID) - 1, Section::NONE, &applyServerId },
+	};
+
+	///
+	/// Looks up the given key in the @ref KEY_TABLE
+	///
+	/// @return the table entry or @c nullptr if the key is not known in the given section
+	///
+	const KeyTableEntry* findKey(Section section, const util::json::lexer::JsonTokenView& key)
+	{
+		if (section == Section::NONE)
+		{
+			return nullptr;
+		}
+
+		for (const auto& entry : KEY_TABLE)
+		{
+			if (entry.section == section
+				&& entry.keyLength == key.getLength()
+				&& std::memcmp(entry.key, key.getData(), entry.keyLength) == 0)
+			{
+				return &entry;
+			}
+		}
 
-	applyMultiplicity(builder, dynConfigObject);
-	applyServerId(builder, dynConfigObject);
-}
+		return nullptr;
+	}
 
-void JsonResponseParser::applyMultiplicity(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> dynConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(dynConfigObject, JsonResponseParser::RESPONSE_KEY_MULTIPLICITY);
-	if (numberValue == nullptr)
+	///
+	/// Converts a JSON number literal the same way as JsonNumberValue::getLongValue
+	///
+	/// @param[in] literal the number literal, which has already been validated by the lexer
+	/// @param[out] value the converted value
+	/// @return @c true if the number could be converted, @c false if it is out of range
+	///
+	bool tryParseNumber(const util::json::lexer::JsonTokenView& literal, int64_t& value)
 	{
-		return;
+		auto position = literal.getData();
+		auto end = position + literal.getLength();
+
+		if (std::find_if(position, end, [](char c) { return c == '.' || c == 'e' || c == 'E'; }) != end)
+		{
+			// floating point literals are rare, therefore allocating a null terminated copy is acceptable
+			errno = 0;
+			auto doubleValue = std::strtod(literal.getValue().c_str(), nullptr);
+			if (errno == ERANGE)
+			{
+				return false;
+			}
+
+			value = static_cast<int64_t>(doubleValue);
+			return true;
+		}
+
+		auto isNegative = *position == '-';
+		if (isNegative)
+		{
+			position++;
+		}
+
+		const uint64_t limit = isNegative ? static_cast<uint64_t>(INT64_MAX) + 1 : static_cast<uint64_t>(INT64_MAX);
+		uint64_t magnitude = 0;
+		for (; position != end; position++)
+		{
+			auto digit = static_cast<uint64_t>(*position - '0');
+			if (magnitude > (limit - digit) / 10)
+			{
+				return false;
+			}
+			magnitude = magnitude * 10 + digit;
+		}
+
+		value = isNegative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+		return true;
 	}
 
-	auto multiplicity = numberValue->getInt32Value();
-	builder.withMultiplicity(multiplicity);
+	///
+	/// Handler writing known keys of the JSON response directly into the builder
+	///
+	class ResponseAttributesEventHandler : public util::json::parser::IJsonEventHandler
+	{
+	public:
+
+		explicit ResponseAttributesEventHandler(ResponseAttributes::Builder& builder)
+			: mBuilder(builder)
+			, mDepth(0)
+			, mSection(Section::NONE)
+			, mPendingKey(nullptr)
+		{
+		}
+
+		ResponseAttributesEventHandler(const ResponseAttributesEventHandler&) = delete;
+
+		ResponseAttributesEventHandler& operator=(const ResponseAttributesEventHandler&) = delete;
+
+		void onObjectStart() override
+		{
+			mDepth++;
+			if (mDepth == 2 && mPendingKey != nullptr)
+			{
+				mSection = mPendingKey->startedSection;
+			}
+			mPendingKey = nullptr;
+		}
+
+		void onObjectEnd() override
+		{
+			if (mDepth == 2)
+			{
+				mSection = Section::NONE;
+			}
+			mDepth--;
+		}
+
+		void onArrayStart() override
+		{
+			mDepth++;
+			mPendingKey = nullptr;
+		}
+
+		void onArrayEnd() override
+		{
+			mDepth--;
+		}
+
+		void onKey(const util::json::lexer::JsonTokenView& key) override
+		{
+			auto section = mDepth == 1 ? Section::ROOT : (mDepth == 2 ? mSection : Section::NONE);
+			mPendingKey = findKey(section, key);
+		}
+
+		void onString(const util::json::lexer::JsonTokenView&) override
+		{
+			mPendingKey = nullptr;
+		}
+
+		void onNumber(const util::json::lexer::JsonTokenView& value) override
+		{
+			int64_t number = 0;
+			if (mPendingKey != nullptr && mPendingKey->apply != nullptr && tryParseNumber(value, number))
+			{
+				mPendingKey->apply(mBuilder, number);
+			}
+			mPendingKey = nullptr;
+		}
+
+		void onBoolean(bool) override
+		{
+			mPendingKey = nullptr;
+		}
+
+		void onNull() override
+		{
+			mPendingKey = nullptr;
+		}
+
+	private:
+
+		/// builder to write the known keys to
+		ResponseAttributes::Builder& mBuilder;
+
+		/// nesting depth of the current object or array, the root object has depth 1
+		int32_t mDepth;
+
+		/// section of the current object at depth 2, @c NONE if the object is not known
+		Section mSection;
+
+		/// known key whose value is expected next, @c nullptr if the next value is not of interest
+		const KeyTableEntry* mPendingKey;
+	};
 }
 
-void JsonResponseParser::applyServerId(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> dynConfigObject
-)
-{
-	auto numberValue = getJsonNumberFrom(dynConfigObject, JsonResponseParser::RESPONSE_KEY_SERVER_ID);
-	if (numberValue == nullptr)
-	{
-		return;
-	}
+const std::string JsonResponseParser::RESPONSE_KEY_AGENT_CONFIG = KEY_AGENT_CONFIG;
+const std::string JsonResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB = KEY_MAX_BEACON_SIZE_IN_KB;
+const std::string JsonResponseParser::RESPONSE_KEY_MAX_SESSION_DURATION_IN_MIN = KEY_MAX_SESSION_DURATION_IN_MIN;
+const std::string JsonResponseParser::RESPONSE_KEY_MAX_EVENTS_PER_SESSION = KEY_MAX_EVENTS_PER_SESSION;
+const std::string JsonResponseParser::RESPONSE_KEY_SESSION_TIMEOUT_IN_SEC = KEY_SESSION_TIMEOUT_IN_SEC;
+const std::string JsonResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC = KEY_SEND_INTERVAL_IN_SEC;
+const std::string JsonResponseParser::RESPONSE_KEY_VISIT_STORE_VERSION = KEY_VISIT_STORE_VERSION;
 
-	auto serverId = numberValue->getInt32Value();
-	builder.withServerId(serverId);
-}
+const std::string JsonResponseParser::RESPONSE_KEY_APP_CONFIG = KEY_APP_CONFIG;
+const std::string JsonResponseParser::RESPONSE_KEY_CAPTURE = KEY_CAPTURE;
+const std::string JsonResponseParser::RESPONSE_KEY_REPORT_CRASHES = KEY_REPORT_CRASHES;
+const std::string JsonResponseParser::RESPONSE_KEY_REPORT_ERRORS = KEY_REPORT_ERRORS;
+
+const std::string JsonResponseParser::RESPONSE_KEY_DYNAMIC_CONFIG = KEY_DYNAMIC_CONFIG;
+const std::string JsonResponseParser::RESPONSE_KEY_MULTIPLICITY = KEY_MULTIPLICITY;
+const std::string JsonResponseParser::RESPONSE_KEY_SERVER_ID = KEY_SERVER_ID;
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Root object configuration
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const std::string JsonResponseParser::RESPONSE_KEY_TIMESTAMP_IN_MILLIS = KEY_TIMESTAMP_IN_MILLIS;
 
-void JsonResponseParser::applyRootAttributes(
-	protocol::ResponseAttributes::Builder& builder,
-	std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-)
+std::shared_ptr<protocol::IResponseAttributes> JsonResponseParser::parse(const core::UTF8String& jsonResponse)
 {
-	auto numberValue = getJsonNumberFrom(rootObject, JsonResponseParser::RESPONSE_KEY_TIMESTAMP_IN_MILLIS);
-	if (numberValue == nullptr)
-	{
-		return;
-	}
+	auto& response = jsonResponse.getStringData();
+	auto builder = ResponseAttributes::withJsonDefaults();
+
+	ResponseAttributesEventHandler handler(builder);
+	util::json::JsonEventParser jsonParser(response.data(), response.size());
+	jsonParser.parse(handler);
 
-	auto timestamp = numberValue->getLongValue();
-	builder.withTimestampInMilliseconds(timestamp);
-}
\ No newline at end of file
+	return builder.build();
+}
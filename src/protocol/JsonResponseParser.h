@@ -19,10 +19,7 @@
 
 
 #include "IResponseAttributes.h"
-#include "ResponseAttributes.h"
 #include "core/UTF8String.h"
-#include "util/json/objects/JsonObjectValue.h"
-#include "util/json/objects/JsonNumberValue.h"
 
 #include <memory>
 
@@ -51,112 +48,23 @@ namespace protocol
 
 		static const std::string RESPONSE_KEY_TIMESTAMP_IN_MILLIS;
 
+		///
+		/// Parses the given JSON response into response attributes.
+		///
+		/// @par
+		/// The response is parsed in a streaming fashion, known keys are written directly into
+		/// a @ref ResponseAttributes::Builder and all other keys are skipped without being copied.
+		///
+		/// @param[in] jsonResponse the JSON response to parse
+		/// @return the parsed response attributes, having JSON defaults for attributes not present in the response
+		///
+		/// @throws util::json::parser::JsonParserException if the response is not valid JSON
+		///
 		static std::shared_ptr<protocol::IResponseAttributes> parse(const core::UTF8String& jsonResponse);
 
 	private:
 
 		JsonResponseParser() {}
-
-		static std::shared_ptr<util::json::objects::JsonObjectValue> getJsonObjectFrom(
-			std::shared_ptr<util::json::objects::JsonObjectValue> jsonObject,
-			const std::string& key
-		);
-
-		static std::shared_ptr<util::json::objects::JsonNumberValue> getJsonNumberFrom(
-			std::shared_ptr<util::json::objects::JsonObjectValue> jsonObject,
-			const std::string& key
-		);
-
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// Agent configuration
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-		static void applyAgentConfiguration(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-		);
-
-		static void applyBeaconSizeInKb(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		static void applyMaxSessionDurationInMin(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		static void applyMaxEventsPerSession(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		static void applySessionTimeoutInSec(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		static void applySendIntervalInSec(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		static void applyVisitStoreVersion(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> agentConfigObject
-		);
-
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// Application configuration
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-		static void applyApplicationConfiguration(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-		);
-
-		static void applyCapture(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-		);
-
-		static void applyReportCrashes(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-		);
-
-		static void applyReportErrors(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> appConfigObject
-		);
-
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// Dynamic configuration
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-		static void applyDynamicConfiguration(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-		);
-
-		static void applyMultiplicity(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> dynConfigObject
-		);
-
-		static void applyServerId(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> dynConfigObject
-		);
-
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// Root object configuration
-		////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-		static void applyRootAttributes(
-			protocol::ResponseAttributes::Builder& builder,
-			std::shared_ptr<util::json::objects::JsonObjectValue> rootObject
-		);
 	};
 }
 
@@ -0,0 +1,173 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "JsonResponseWriter.h"
+#include "JsonResponseParser.h"
+
+#include <sstream>
+#include <string>
+
+using namespace protocol;
+
+namespace
+{
+	///
+	/// Writes the members of a single JSON object, taking care of the separators between members.
+	///
+	class JsonObjectWriter
+	{
+	public:
+
+		explicit JsonObjectWriter(std::ostringstream& stream)
+			: mStream(stream)
+			, mIsEmpty(true)
+		{
+		}
+
+		void writeNumber(const std::string& key, int64_t value)
+		{
+			writeKey(key);
+			mStream << value;
+		}
+
+		void writeObject(const std::string& key, const std::string& object)
+		{
+			writeKey(key);
+			mStream << object;
+		}
+
+	private:
+
+		void writeKey(const std::string& key)
+		{
+			mStream << (mIsEmpty ? "" : ",") << '"' << key << "\":";
+			mIsEmpty = false;
+		}
+
+		std::ostringstream& mStream;
+		bool mIsEmpty;
+	};
+
+	std::string writeAgentConfig(const IResponseAttributes& attributes)
+	{
+		std::ostringstream stream;
+		stream << '{';
+		JsonObjectWriter writer(stream);
+		if (attributes.isAttributeSet(ResponseAttribute::MAX_BEACON_SIZE))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB,
+				attributes.getMaxBeaconSizeInBytes() / 1024);
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::MAX_SESSION_DURATION))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_MAX_SESSION_DURATION_IN_MIN,
+				attributes.getMaxSessionDurationInMilliseconds() / (60 * 1000));
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::MAX_EVENTS_PER_SESSION))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_MAX_EVENTS_PER_SESSION,
+				attributes.getMaxEventsPerSession());
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::SESSION_IDLE_TIMEOUT))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_SESSION_TIMEOUT_IN_SEC,
+				attributes.getSessionTimeoutInMilliseconds() / 1000);
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::SEND_INTERVAL))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC,
+				attributes.getSendIntervalInMilliseconds() / 1000);
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::VISIT_STORE_VERSION))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_VISIT_STORE_VERSION,
+				attributes.getVisitStoreVersion());
+		}
+		stream << '}';
+		return stream.str();
+	}
+
+	std::string writeAppConfig(const IResponseAttributes& attributes)
+	{
+		std::ostringstream stream;
+		stream << '{';
+		JsonObjectWriter writer(stream);
+		if (attributes.isAttributeSet(ResponseAttribute::IS_CAPTURE))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_CAPTURE, attributes.isCapture() ? 1 : 0);
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::IS_CAPTURE_CRASHES))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_REPORT_CRASHES, attributes.isCaptureCrashes() ? 1 : 0);
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::IS_CAPTURE_ERRORS))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_REPORT_ERRORS, attributes.isCaptureErrors() ? 1 : 0);
+		}
+		stream << '}';
+		return stream.str();
+	}
+
+	std::string writeDynamicConfig(const IResponseAttributes& attributes)
+	{
+		std::ostringstream stream;
+		stream << '{';
+		JsonObjectWriter writer(stream);
+		if (attributes.isAttributeSet(ResponseAttribute::MULTIPLICITY))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_MULTIPLICITY, attributes.getMultiplicity());
+		}
+		if (attributes.isAttributeSet(ResponseAttribute::SERVER_ID))
+		{
+			writer.writeNumber(JsonResponseParser::RESPONSE_KEY_SERVER_ID, attributes.getServerId());
+		}
+		stream << '}';
+		return stream.str();
+	}
+}
+
+core::UTF8String JsonResponseWriter::write(const IResponseAttributes& attributes)
+{
+	static const std::string EMPTY_OBJECT = "{}";
+
+	std::ostringstream stream;
+	stream << '{';
+	JsonObjectWriter writer(stream);
+
+	auto agentConfig = writeAgentConfig(attributes);
+	if (agentConfig != EMPTY_OBJECT)
+	{
+		writer.writeObject(JsonResponseParser::RESPONSE_KEY_AGENT_CONFIG, agentConfig);
+	}
+	auto appConfig = writeAppConfig(attributes);
+	if (appConfig != EMPTY_OBJECT)
+	{
+		writer.writeObject(JsonResponseParser::RESPONSE_KEY_APP_CONFIG, appConfig);
+	}
+	auto dynamicConfig = writeDynamicConfig(attributes);
+	if (dynamicConfig != EMPTY_OBJECT)
+	{
+		writer.writeObject(JsonResponseParser::RESPONSE_KEY_DYNAMIC_CONFIG, dynamicConfig);
+	}
+	if (attributes.isAttributeSet(ResponseAttribute::TIMESTAMP))
+	{
+		writer.writeNumber(JsonResponseParser::RESPONSE_KEY_TIMESTAMP_IN_MILLIS, attributes.getTimestampInMilliseconds());
+	}
+
+	stream << '}';
+	return core::UTF8String(stream.str());
+}
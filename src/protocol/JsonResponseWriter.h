@@ -0,0 +1,50 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _PROTOCOL_JSONRESPONSEWRITER_H
+#define _PROTOCOL_JSONRESPONSEWRITER_H
+
+#include "IResponseAttributes.h"
+#include "core/UTF8String.h"
+
+#include <memory>
+
+namespace protocol
+{
+	class JsonResponseWriter
+	{
+	public:
+
+		///
+		/// Writes the given response attributes as JSON response.
+		///
+		/// @par
+		/// Only attributes which are set are written, using the same keys and units the server uses,
+		/// so that @ref JsonResponseParser::parse yields the same attributes again.
+		///
+		/// @param[in] attributes the response attributes to write
+		/// @return the JSON representation of the given response attributes
+		///
+		static core::UTF8String write(const IResponseAttributes& attributes);
+
+	private:
+
+		JsonResponseWriter() {}
+	};
+}
+
+#endif
@@ -16,8 +16,31 @@
 
 #include "KeyValueResponseParser.h"
 
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
 using namespace protocol;
 
+namespace
+{
+	///
+	/// Returns a unique code for a key consisting of two characters
+	///
+	constexpr uint32_t keyCode(const char* key)
+	{
+		return (static_cast<uint32_t>(static_cast<unsigned char>(key[0])) << 8) | static_cast<unsigned char>(key[1]);
+	}
+
+	constexpr uint32_t MAX_BEACON_SIZE_IN_KB_BIT = 1 << 0;
+	constexpr uint32_t SEND_INTERVAL_IN_SEC_BIT = 1 << 1;
+	constexpr uint32_t CAPTURE_BIT = 1 << 2;
+	constexpr uint32_t REPORT_CRASHES_BIT = 1 << 3;
+	constexpr uint32_t REPORT_ERRORS_BIT = 1 << 4;
+	constexpr uint32_t SERVER_ID_BIT = 1 << 5;
+	constexpr uint32_t MULTIPLICITY_BIT = 1 << 6;
+}
+
 const std::string KeyValueResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB = "bl";
 const std::string KeyValueResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC = "si";
 
@@ -30,139 +53,139 @@ const std::string KeyValueResponseParser::RESPONSE_KEY_MULTIPLICITY = "mp";
 
 std::shared_ptr<IResponseAttributes> KeyValueResponseParser::parse(const core::UTF8String& keyValuePairResponse)
 {
-	auto keyValuePairs = std::unordered_map<std::string, std::string>();
-	for (auto const& part : keyValuePairResponse.split('&'))
-	{
-		auto found = part.getIndexOf("=");
-		if (found == std::string::npos)
-		{
-			continue;
-		}
+	auto builder = ResponseAttributes::withKeyValueDefaults();
 
-		auto key = part.substring(0, found);
-		auto value = part.substring(found + 1);
+	const auto& response = keyValuePairResponse.getStringData();
+	auto position = response.data();
+	auto end = position + response.size();
+	uint32_t appliedKeys = 0;
 
-		if (key.empty() || value.empty())
+	while (position != end)
+	{
+		auto partEnd = std::find(position, end, '&');
+		auto separator = std::find(position, partEnd, '=');
+		if (separator != partEnd)
 		{
-			continue;
+			auto keyLength = static_cast<size_t>(separator - position);
+			if (keyLength > 0 && separator + 1 != partEnd)
+			{
+				applyKeyValuePair(builder, position, keyLength, separator + 1, partEnd, appliedKeys);
+			}
 		}
 
-		keyValuePairs.insert({key.getStringData(), value.getStringData()});
+		position = partEnd == end ? end : partEnd + 1;
 	}
 
-	auto builder = ResponseAttributes::withKeyValueDefaults();
-	applyBeaconSizeInKb(builder, keyValuePairs);
-	applySendIntervalInSec(builder, keyValuePairs);
-	applyCapture(builder, keyValuePairs);
-	applyReportCrashes(builder, keyValuePairs);
-	applyReportErrors(builder, keyValuePairs);
-	applyServerId(builder, keyValuePairs);
-	applyMultiplicity(builder, keyValuePairs);
-
 	return builder.build();
 }
 
-void KeyValueResponseParser::applyBeaconSizeInKb(
+void KeyValueResponseParser::applyKeyValuePair(
 	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
+	const char* key,
+	size_t keyLength,
+	const char* value,
+	const char* valueEnd,
+	uint32_t& appliedKeys
 )
 {
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB);
-	if (entry == keyValuePairs.end())
+	if (keyLength != 2)
 	{
+		// all known keys consist of two characters
 		return;
 	}
 
-	auto beaconSizeInKb = std::stoi(entry->second);
-	builder.withMaxBeaconSizeInBytes(beaconSizeInKb * 1024);
-}
-
-void KeyValueResponseParser::applySendIntervalInSec(
-	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
-{
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_SEND_INTERVAL_IN_SEC);
-	if (entry == keyValuePairs.end())
+	uint32_t keyBit = 0;
+	switch (keyCode(key))
 	{
-		return;
+		case keyCode("bl"):
+			keyBit = MAX_BEACON_SIZE_IN_KB_BIT;
+			break;
+		case keyCode("si"):
+			keyBit = SEND_INTERVAL_IN_SEC_BIT;
+			break;
+		case keyCode("cp"):
+			keyBit = CAPTURE_BIT;
+			break;
+		case keyCode("cr"):
+			keyBit = REPORT_CRASHES_BIT;
+			break;
+		case keyCode("er"):
+			keyBit = REPORT_ERRORS_BIT;
+			break;
+		case keyCode("id"):
+			keyBit = SERVER_ID_BIT;
+			break;
+		case keyCode("mp"):
+			keyBit = MULTIPLICITY_BIT;
+			break;
+		default:
+			// unknown key
+			return;
 	}
 
-	auto sendIntervalInSec = std::stoi(entry->second);
-	builder.withSendIntervalInMilliseconds(sendIntervalInSec * 1000);
-}
-
-void KeyValueResponseParser::applyCapture(
-	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
-{
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_CAPTURE);
-	if (entry == keyValuePairs.end())
+	if ((appliedKeys & keyBit) != 0)
 	{
+		// only the first occurrence of a key is used
 		return;
 	}
+	appliedKeys |= keyBit;
 
-	auto capture = std::stoi(entry->second);
-	builder.withCapture(capture == 1);
-}
-
-void KeyValueResponseParser::applyReportCrashes(
-		protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
-{
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_REPORT_CRASHES);
-	if (entry == keyValuePairs.end())
+	auto number = parseInt32(value, valueEnd);
+	switch (keyBit)
 	{
-		return;
+		case MAX_BEACON_SIZE_IN_KB_BIT:
+			builder.withMaxBeaconSizeInBytes(number * 1024);
+			break;
+		case SEND_INTERVAL_IN_SEC_BIT:
+			builder.withSendIntervalInMilliseconds(number * 1000);
+			break;
+		case CAPTURE_BIT:
+			builder.withCapture(number == 1);
+			break;
+		case REPORT_CRASHES_BIT:
+			builder.withCaptureCrashes(number != 0);
+			break;
+		case REPORT_ERRORS_BIT:
+			builder.withCaptureErrors(number != 0);
+			break;
+		case SERVER_ID_BIT:
+			builder.withServerId(number);
+			break;
+		case MULTIPLICITY_BIT:
+			builder.withMultiplicity(number);
+			break;
 	}
-
-	auto reportCrashes = std::stoi(entry->second);
-	builder.withCaptureCrashes(reportCrashes != 0);
 }
 
-void KeyValueResponseParser::applyReportErrors(
-	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
+int32_t KeyValueResponseParser::parseInt32(const char* begin, const char* end)
 {
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_REPORT_ERRORS);
-	if (entry == keyValuePairs.end())
+	while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
 	{
-		return;
+		begin++;
 	}
 
-	auto reportErrors = std::stoi(entry->second);
-	builder.withCaptureErrors(reportErrors != 0);
-}
-
-void KeyValueResponseParser::applyServerId(
-	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
-{
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_SERVER_ID);
-	if (entry == keyValuePairs.end())
+	auto isNegative = false;
+	if (begin != end && (*begin == '+' || *begin == '-'))
 	{
-		return;
+		isNegative = *begin == '-';
+		begin++;
 	}
 
-	auto serverId = std::stoi(entry->second);
-	builder.withServerId(serverId);
-}
+	if (begin == end || *begin < '0' || *begin > '9')
+	{
+		throw std::invalid_argument("parseInt32");
+	}
 
-void KeyValueResponseParser::applyMultiplicity(
-	protocol::ResponseAttributes::Builder& builder,
-	std::unordered_map <std::string, std::string>& keyValuePairs
-)
-{
-	auto entry = keyValuePairs.find(KeyValueResponseParser::RESPONSE_KEY_MULTIPLICITY);
-	if (entry == keyValuePairs.end())
+	const int64_t limit = isNegative ? -static_cast<int64_t>(INT32_MIN) : static_cast<int64_t>(INT32_MAX);
+	int64_t magnitude = 0;
+	for (; begin != end && *begin >= '0' && *begin <= '9'; begin++)
 	{
-		return;
+		magnitude = magnitude * 10 + (*begin - '0');
+		if (magnitude > limit)
+		{
+			throw std::out_of_range("parseInt32");
+		}
 	}
 
-	auto multiplicity = std::stoi(entry->second);
-	builder.withMultiplicity(multiplicity);
-}
\ No newline at end of file
+	return static_cast<int32_t>(isNegative ? -magnitude : magnitude);
+}
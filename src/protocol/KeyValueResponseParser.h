@@ -21,8 +21,9 @@
 #include "ResponseAttributes.h"
 #include "core/UTF8String.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
 
 namespace protocol
 {
@@ -40,46 +41,58 @@ namespace protocol
 		static const std::string RESPONSE_KEY_SERVER_ID;
 		static const std::string RESPONSE_KEY_MULTIPLICITY;
 
+		///
+		/// Parses the given key-value pair response into response attributes.
+		///
+		/// @par
+		/// The response is tokenized in a single pass without copying keys or values. If a key occurs
+		/// more than once, only its first non-empty value is used.
+		///
+		/// @param[in] keyValuePairResponse the response to parse
+		/// @return the parsed response attributes, having key-value defaults for attributes not present in the response
+		///
+		/// @throws std::invalid_argument if a known key's value is not a number
+		/// @throws std::out_of_range if a known key's value does not fit into a 32-bit integer
+		///
 		static std::shared_ptr<IResponseAttributes> parse(const core::UTF8String& keyValuePairResponse);
 
 	private:
 
 		KeyValueResponseParser() {}
 
-		static void applyBeaconSizeInKb(
+		///
+		/// Applies a single key-value pair to the given builder, if the key is known and was not applied before.
+		///
+		/// @param[in] builder the builder to apply the value to
+		/// @param[in] key first character of the key
+		/// @param[in] keyLength length of the key
+		/// @param[in] value first character of the value
+		/// @param[in] valueEnd end of the value
+		/// @param[in,out] appliedKeys bit mask of keys that have already been applied
+		///
+		static void applyKeyValuePair(
 			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
+			const char* key,
+			size_t keyLength,
+			const char* value,
+			const char* valueEnd,
+			uint32_t& appliedKeys
 		);
 
-		static void applySendIntervalInSec(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
-
-		static void applyCapture(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
-
-		static void applyReportCrashes(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
-
-		static void applyReportErrors(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
-
-		static void applyServerId(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
-
-		static void applyMultiplicity(
-			protocol::ResponseAttributes::Builder& builder,
-			std::unordered_map<std::string, std::string>& keyValuePairs
-		);
+		///
+		/// Parses a decimal integer the same way as @c std::stoi, without copying the input.
+		///
+		/// @par
+		/// Leading whitespace is skipped, and parsing stops at the first character which is not a digit.
+		///
+		/// @param[in] begin first character to parse
+		/// @param[in] end end of the characters to parse
+		/// @return the parsed integer
+		///
+		/// @throws std::invalid_argument if no digits could be parsed
+		/// @throws std::out_of_range if the value does not fit into a 32-bit integer
+		///
+		static int32_t parseInt32(const char* begin, const char* end);
 	};
 }
 
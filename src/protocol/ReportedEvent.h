@@ -0,0 +1,60 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _PROTOCOL_REPORTEDEVENT_H
+#define _PROTOCOL_REPORTEDEVENT_H
+
+#include "EventType.h"
+#include "core/UTF8String.h"
+
+#include <cstdint>
+
+namespace protocol
+{
+	///
+	/// Event, value or error reported on an action as part of a batch via @ref IBeacon::reportEvents
+	///
+	struct ReportedEvent
+	{
+		///
+		/// Constructor
+		/// @param[in] eventType one of @ref EventType::NAMED_EVENT, @ref EventType::VALUE_INT,
+		///   @ref EventType::VALUE_DOUBLE, @ref EventType::VALUE_STRING or @ref EventType::FAILURE_ERROR
+		/// @param[in] eventName name of the event, value or error
+		///
+		ReportedEvent(EventType eventType, const core::UTF8String& eventName)
+			: type(eventType)
+			, name(eventName)
+			, intValue(0)
+			, doubleValue(0.0)
+			, stringValue()
+		{
+		}
+
+		/// the event's type
+		EventType type;
+		/// the event's name
+		core::UTF8String name;
+		/// integer value of @ref EventType::VALUE_INT or error code of @ref EventType::FAILURE_ERROR
+		int32_t intValue;
+		/// double value of @ref EventType::VALUE_DOUBLE
+		double doubleValue;
+		/// string value of @ref EventType::VALUE_STRING or reason of @ref EventType::FAILURE_ERROR
+		core::UTF8String stringValue;
+	};
+}
+
+#endif
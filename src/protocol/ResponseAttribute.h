@@ -17,7 +17,7 @@
 #ifndef _PROTOCOL_RESPONSEATTRIBUTE_H
 #define _PROTOCOL_RESPONSEATTRIBUTE_H
 
-
+#include <cstddef>
 
 namespace protocol
 {
@@ -105,6 +105,11 @@ namespace protocol
 		ResponseAttribute::SERVER_ID,
 		ResponseAttribute::TIMESTAMP
 	};
+
+	///
+	/// Number of literals in @ref ResponseAttribute
+	///
+	constexpr size_t NUMBER_OF_RESPONSE_ATTRIBUTES = sizeof(ALL_RESPONSE_ATTRIBUTES) / sizeof(ALL_RESPONSE_ATTRIBUTES[0]);
 }
 
 
@@ -19,20 +19,23 @@
 
 using namespace protocol;
 
+namespace
+{
+	inline size_t indexOf(ResponseAttribute attribute)
+	{
+		return static_cast<size_t>(attribute);
+	}
+}
+
 ResponseAttributes::ResponseAttributes(Builder& builder)
 	: mSetAttributes(builder.getSetAttributes())
-	, mMaxBeaconSizeInBytes(builder.getMaxBeaconSizeInBytes())
-	, mMaxSessionDurationInMilliseconds(builder.getMaxSessionDurationInMilliseconds())
-	, mMaxEventsPerSession(builder.getMaxEventsPerSession())
-	, mSessionTimeoutInMilliseconds(builder.getSessionTimeoutInMilliseconds())
-	, mSendIntervalInMilliseconds(builder.getSendIntervalInMilliseconds())
-	, mVisitStoreVersion(builder.getVisitStoreVersion())
-	, mIsCapture(builder.isCapture())
-	, mIsCaptureCrashes(builder.isCaptureCrashes())
-	, mIsCaptureErrors(builder.isCaptureErrors())
-	, mMultiplicity(builder.getMultiplicity())
-	, mServerId(builder.getServerId())
-	, mTimestampInMilliseconds(builder.getTimestampInMilliseconds())
+	, mValues(builder.getValues())
+{
+}
+
+ResponseAttributes::ResponseAttributes(const AttributeSet& setAttributes, const Values& values)
+	: mSetAttributes(setAttributes)
+	, mValues(values)
 {
 }
 
@@ -51,69 +54,112 @@ ResponseAttributes::Builder ResponseAttributes::withUndefinedDefaults()
 	return ResponseAttributes::Builder(*ResponseAttributesDefaults::UNDEFINED);
 }
 
+void ResponseAttributes::read(const IResponseAttributes& attributes, AttributeSet& setAttributes, Values& values)
+{
+	auto responseAttributes = dynamic_cast<const ResponseAttributes*>(&attributes);
+	if (responseAttributes != nullptr)
+	{
+		setAttributes = responseAttributes->mSetAttributes;
+		values = responseAttributes->mValues;
+		return;
+	}
+
+	values.maxBeaconSizeInBytes = attributes.getMaxBeaconSizeInBytes();
+	values.maxSessionDurationInMilliseconds = attributes.getMaxSessionDurationInMilliseconds();
+	values.maxEventsPerSession = attributes.getMaxEventsPerSession();
+	values.sessionTimeoutInMilliseconds = attributes.getSessionTimeoutInMilliseconds();
+	values.sendIntervalInMilliseconds = attributes.getSendIntervalInMilliseconds();
+	values.visitStoreVersion = attributes.getVisitStoreVersion();
+	values.isCapture = attributes.isCapture();
+	values.isCaptureCrashes = attributes.isCaptureCrashes();
+	values.isCaptureErrors = attributes.isCaptureErrors();
+	values.multiplicity = attributes.getMultiplicity();
+	values.serverId = attributes.getServerId();
+	values.timestampInMilliseconds = attributes.getTimestampInMilliseconds();
+
+	setAttributes.reset();
+	for (const auto attribute : ALL_RESPONSE_ATTRIBUTES)
+	{
+		if (attributes.isAttributeSet(attribute))
+		{
+			setAttributes.set(indexOf(attribute));
+		}
+	}
+}
+
+const ResponseAttributes::AttributeSet& ResponseAttributes::getSetAttributes() const
+{
+	return mSetAttributes;
+}
+
+const ResponseAttributes::Values& ResponseAttributes::getValues() const
+{
+	return mValues;
+}
+
 int32_t ResponseAttributes::getMaxBeaconSizeInBytes() const
 {
-	return mMaxBeaconSizeInBytes;
+	return mValues.maxBeaconSizeInBytes;
 }
 
 int32_t ResponseAttributes::getMaxSessionDurationInMilliseconds() const
 {
-	return mMaxSessionDurationInMilliseconds;
+	return mValues.maxSessionDurationInMilliseconds;
 }
 
 int32_t ResponseAttributes::getMaxEventsPerSession() const
 {
-	return mMaxEventsPerSession;
+	return mValues.maxEventsPerSession;
 }
 
 int32_t ResponseAttributes::getSessionTimeoutInMilliseconds() const
 {
-	return mSessionTimeoutInMilliseconds;
+	return mValues.sessionTimeoutInMilliseconds;
 }
 
 int32_t ResponseAttributes::getSendIntervalInMilliseconds() const
 {
-	return mSendIntervalInMilliseconds;
+	return mValues.sendIntervalInMilliseconds;
 }
 
 int32_t ResponseAttributes::getVisitStoreVersion() const
 {
-	return mVisitStoreVersion;
+	return mValues.visitStoreVersion;
 }
 
 bool ResponseAttributes::isCapture() const
 {
-	return mIsCapture;
+	return mValues.isCapture;
 }
 
 bool ResponseAttributes::isCaptureCrashes() const
 {
-	return mIsCaptureCrashes;
+	return mValues.isCaptureCrashes;
 }
 
 bool ResponseAttributes::isCaptureErrors() const
 {
-	return mIsCaptureErrors;
+	return mValues.isCaptureErrors;
 }
 
 int32_t ResponseAttributes::getMultiplicity() const
 {
-	return mMultiplicity;
+	return mValues.multiplicity;
 }
 
 int32_t ResponseAttributes::getServerId() const
 {
-	return mServerId;
+	return mValues.serverId;
 }
 
 int64_t ResponseAttributes::getTimestampInMilliseconds() const
 {
-	return mTimestampInMilliseconds;
+	return mValues.timestampInMilliseconds;
 }
 
 bool ResponseAttributes::isAttributeSet(ResponseAttribute attribute) const
 {
-	return mSetAttributes.find(attribute) != mSetAttributes.end();
+	return mSetAttributes.test(indexOf(attribute));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,153 +168,65 @@ bool ResponseAttributes::isAttributeSet(ResponseAttribute attribute) const
 
 std::shared_ptr<IResponseAttributes> ResponseAttributes::merge(std::shared_ptr<IResponseAttributes> attributes) const
 {
-	auto builder = ResponseAttributes::Builder(*this);
+	AttributeSet otherSetAttributes;
+	Values otherValues = {};
+	read(*attributes, otherSetAttributes, otherValues);
 
-	applyBeaconSize(builder, attributes);
-	applySessionDuration(builder, attributes);
-	applyEventsPerSession(builder, attributes);
-	applySessionTimeout(builder, attributes);
-	applySendInterval(builder, attributes);
-	applyVisitStoreVersion(builder, attributes);
-	applyCapture(builder, attributes);
-	applyCaptureCrashes(builder, attributes);
-	applyCaptureErrors(builder, attributes);
-	applyMultiplicity(builder, attributes);
-	applyServerId(builder, attributes);
-	applyTimestamp(builder, attributes);
+	auto mergedValues = mValues;
+	mergeValues(mergedValues, otherValues, otherSetAttributes);
 
-	return builder.build();
+	return std::make_shared<ResponseAttributes>(mSetAttributes | otherSetAttributes, mergedValues);
 }
 
-void ResponseAttributes::applyBeaconSize(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
+void ResponseAttributes::mergeValues(Values& target, const Values& source, const AttributeSet& mask)
 {
-	if (attributes->isAttributeSet(ResponseAttribute::MAX_BEACON_SIZE))
+	if (mask.test(indexOf(ResponseAttribute::MAX_BEACON_SIZE)))
 	{
-		builder.withMaxBeaconSizeInBytes(attributes->getMaxBeaconSizeInBytes());
+		target.maxBeaconSizeInBytes = source.maxBeaconSizeInBytes;
 	}
-}
-
-void ResponseAttributes::applySessionDuration(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::MAX_SESSION_DURATION))
+	if (mask.test(indexOf(ResponseAttribute::MAX_SESSION_DURATION)))
 	{
-		builder.withMaxSessionDurationInMilliseconds(attributes->getMaxSessionDurationInMilliseconds());
+		target.maxSessionDurationInMilliseconds = source.maxSessionDurationInMilliseconds;
 	}
-}
-
-void ResponseAttributes::applyEventsPerSession(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::MAX_EVENTS_PER_SESSION))
+	if (mask.test(indexOf(ResponseAttribute::MAX_EVENTS_PER_SESSION)))
 	{
-		builder.withMaxEventsPerSession(attributes->getMaxEventsPerSession());
+		target.maxEventsPerSession = source.maxEventsPerSession;
 	}
-}
-
-void ResponseAttributes::applySessionTimeout(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::SESSION_IDLE_TIMEOUT))
+	if (mask.test(indexOf(ResponseAttribute::SESSION_IDLE_TIMEOUT)))
 	{
-		builder.withSessionTimeoutInMilliseconds(attributes->getSessionTimeoutInMilliseconds());
+		target.sessionTimeoutInMilliseconds = source.sessionTimeoutInMilliseconds;
 	}
-}
-
-void ResponseAttributes::applySendInterval(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::SEND_INTERVAL))
+	if (mask.test(indexOf(ResponseAttribute::SEND_INTERVAL)))
 	{
-		builder.withSendIntervalInMilliseconds(attributes->getSendIntervalInMilliseconds());
+		target.sendIntervalInMilliseconds = source.sendIntervalInMilliseconds;
 	}
-}
-
-void ResponseAttributes::applyVisitStoreVersion(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::VISIT_STORE_VERSION))
+	if (mask.test(indexOf(ResponseAttribute::VISIT_STORE_VERSION)))
 	{
-		builder.withVisitStoreVersion(attributes->getVisitStoreVersion());
+		target.visitStoreVersion = source.visitStoreVersion;
 	}
-}
-
-void ResponseAttributes::applyCapture(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::IS_CAPTURE))
+	if (mask.test(indexOf(ResponseAttribute::IS_CAPTURE)))
 	{
-		builder.withCapture(attributes->isCapture());
+		target.isCapture = source.isCapture;
 	}
-}
-
-void ResponseAttributes::applyCaptureCrashes(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::IS_CAPTURE_CRASHES))
+	if (mask.test(indexOf(ResponseAttribute::IS_CAPTURE_CRASHES)))
 	{
-		builder.withCaptureCrashes(attributes->isCaptureCrashes());
+		target.isCaptureCrashes = source.isCaptureCrashes;
 	}
-}
-
-void ResponseAttributes::applyCaptureErrors(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::IS_CAPTURE_ERRORS))
+	if (mask.test(indexOf(ResponseAttribute::IS_CAPTURE_ERRORS)))
 	{
-		builder.withCaptureErrors(attributes->isCaptureErrors());
+		target.isCaptureErrors = source.isCaptureErrors;
 	}
-}
-
-void ResponseAttributes::applyMultiplicity(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::MULTIPLICITY))
+	if (mask.test(indexOf(ResponseAttribute::MULTIPLICITY)))
 	{
-		builder.withMultiplicity(attributes->getMultiplicity());
+		target.multiplicity = source.multiplicity;
 	}
-}
-
-void ResponseAttributes::applyServerId(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::SERVER_ID))
+	if (mask.test(indexOf(ResponseAttribute::SERVER_ID)))
 	{
-		builder.withServerId(attributes->getServerId());
+		target.serverId = source.serverId;
 	}
-}
-
-void ResponseAttributes::applyTimestamp(
-	ResponseAttributes::Builder& builder,
-	std::shared_ptr<IResponseAttributes> attributes
-)
-{
-	if (attributes->isAttributeSet(ResponseAttribute::TIMESTAMP))
+	if (mask.test(indexOf(ResponseAttribute::TIMESTAMP)))
 	{
-		builder.withTimestampInMilliseconds(attributes->getTimestampInMilliseconds());
+		target.timestampInMilliseconds = source.timestampInMilliseconds;
 	}
 }
 
@@ -278,173 +236,157 @@ void ResponseAttributes::applyTimestamp(
 
 ResponseAttributes::Builder::Builder(const IResponseAttributes& defaults)
 	: mSetAttributes()
-	, mMaxBeaconSizeInBytes(defaults.getMaxBeaconSizeInBytes())
-	, mMaxSessionDurationInMilliseconds(defaults.getMaxSessionDurationInMilliseconds())
-	, mMaxEventsPerSession(defaults.getMaxEventsPerSession())
-	, mSessionTimeoutInMilliseconds(defaults.getSessionTimeoutInMilliseconds())
-	, mSendIntervalInMilliseconds(defaults.getSendIntervalInMilliseconds())
-	, mVisitStoreVersion(defaults.getVisitStoreVersion())
-	, mIsCapture(defaults.isCapture())
-	, mIsCaptureCrashes(defaults.isCaptureCrashes())
-	, mIsCaptureErrors(defaults.isCaptureErrors())
-	, mMultiplicity(defaults.getMultiplicity())
-	, mServerId(defaults.getServerId())
-	, mTimestampInMilliseconds(defaults.getTimestampInMilliseconds())
+	, mValues()
 {
-	for (const auto attribute : ALL_RESPONSE_ATTRIBUTES)
-	{
-		if (defaults.isAttributeSet(attribute)) {
-			setAttribute(attribute);
-		}
-	}
+	ResponseAttributes::read(defaults, mSetAttributes, mValues);
 }
 
 int32_t ResponseAttributes::Builder::getMaxBeaconSizeInBytes() const
 {
-	return mMaxBeaconSizeInBytes;
+	return mValues.maxBeaconSizeInBytes;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withMaxBeaconSizeInBytes(int32_t maxBeaconSizeInBytes)
 {
-	mMaxBeaconSizeInBytes = maxBeaconSizeInBytes;
+	mValues.maxBeaconSizeInBytes = maxBeaconSizeInBytes;
 	setAttribute(ResponseAttribute::MAX_BEACON_SIZE);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getMaxSessionDurationInMilliseconds() const
 {
-	return mMaxSessionDurationInMilliseconds;
+	return mValues.maxSessionDurationInMilliseconds;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withMaxSessionDurationInMilliseconds(
 	int32_t maxSessionDurationInMilliseconds
 )
 {
-	mMaxSessionDurationInMilliseconds = maxSessionDurationInMilliseconds;
+	mValues.maxSessionDurationInMilliseconds = maxSessionDurationInMilliseconds;
 	setAttribute(ResponseAttribute::MAX_SESSION_DURATION);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getMaxEventsPerSession() const
 {
-	return mMaxEventsPerSession;
+	return mValues.maxEventsPerSession;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withMaxEventsPerSession(int32_t maxEventsPerSession)
 {
-	mMaxEventsPerSession = maxEventsPerSession;
+	mValues.maxEventsPerSession = maxEventsPerSession;
 	setAttribute(ResponseAttribute::MAX_EVENTS_PER_SESSION);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getSessionTimeoutInMilliseconds() const
 {
-	return mSessionTimeoutInMilliseconds;
+	return mValues.sessionTimeoutInMilliseconds;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withSessionTimeoutInMilliseconds(
 	int32_t sessionTimeoutInMilliseconds
 )
 {
-	mSessionTimeoutInMilliseconds = sessionTimeoutInMilliseconds;
+	mValues.sessionTimeoutInMilliseconds = sessionTimeoutInMilliseconds;
 	setAttribute(ResponseAttribute::SESSION_IDLE_TIMEOUT);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getSendIntervalInMilliseconds() const
 {
-	return mSendIntervalInMilliseconds;
+	return mValues.sendIntervalInMilliseconds;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withSendIntervalInMilliseconds(
 	int32_t sendIntervalInMilliseconds
 )
 {
-	mSendIntervalInMilliseconds = sendIntervalInMilliseconds;
+	mValues.sendIntervalInMilliseconds = sendIntervalInMilliseconds;
 	setAttribute(ResponseAttribute::SEND_INTERVAL);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getVisitStoreVersion() const
 {
-	return mVisitStoreVersion;
+	return mValues.visitStoreVersion;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withVisitStoreVersion(int32_t visitStoreVersion)
 {
-	mVisitStoreVersion = visitStoreVersion;
+	mValues.visitStoreVersion = visitStoreVersion;
 	setAttribute(ResponseAttribute::VISIT_STORE_VERSION);
 	return *this;
 }
 
 bool ResponseAttributes::Builder::isCapture() const
 {
-	return mIsCapture;
+	return mValues.isCapture;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withCapture(bool capture)
 {
-	mIsCapture = capture;
+	mValues.isCapture = capture;
 	setAttribute(ResponseAttribute::IS_CAPTURE);
 	return *this;
 }
 
 bool ResponseAttributes::Builder::isCaptureCrashes() const
 {
-	return mIsCaptureCrashes;
+	return mValues.isCaptureCrashes;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withCaptureCrashes(bool captureCrashes)
 {
-	mIsCaptureCrashes = captureCrashes;
+	mValues.isCaptureCrashes = captureCrashes;
 	setAttribute(ResponseAttribute::IS_CAPTURE_CRASHES);
 	return *this;
 }
 
 bool ResponseAttributes::Builder::isCaptureErrors() const
 {
-	return mIsCaptureErrors;
+	return mValues.isCaptureErrors;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withCaptureErrors(bool captureErrors)
 {
-	mIsCaptureErrors = captureErrors;
+	mValues.isCaptureErrors = captureErrors;
 	setAttribute(ResponseAttribute::IS_CAPTURE_ERRORS);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getMultiplicity() const
 {
-	return mMultiplicity;
+	return mValues.multiplicity;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withMultiplicity(int32_t multiplicity)
 {
-	mMultiplicity = multiplicity;
+	mValues.multiplicity = multiplicity;
 	setAttribute(ResponseAttribute::MULTIPLICITY);
 	return *this;
 }
 
 int32_t ResponseAttributes::Builder::getServerId() const
 {
-	return mServerId;
+	return mValues.serverId;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withServerId(int32_t serverId)
 {
-	mServerId = serverId;
+	mValues.serverId = serverId;
 	setAttribute(ResponseAttribute::SERVER_ID);
 	return *this;
 }
 
 int64_t ResponseAttributes::Builder::getTimestampInMilliseconds() const
 {
-	return mTimestampInMilliseconds;
+	return mValues.timestampInMilliseconds;
 }
 
 ResponseAttributes::Builder& ResponseAttributes::Builder::withTimestampInMilliseconds(int64_t timestampInMilliseconds)
 {
-	mTimestampInMilliseconds = timestampInMilliseconds;
+	mValues.timestampInMilliseconds = timestampInMilliseconds;
 	setAttribute(ResponseAttribute::TIMESTAMP);
 	return *this;
 }
@@ -454,12 +396,17 @@ std::shared_ptr<IResponseAttributes> ResponseAttributes::Builder::build()
 	return std::make_shared<ResponseAttributes>(*this);
 }
 
-ResponseAttributes::AttributeSet& ResponseAttributes::Builder::getSetAttributes()
+const ResponseAttributes::AttributeSet& ResponseAttributes::Builder::getSetAttributes() const
 {
 	return mSetAttributes;
 }
 
+const ResponseAttributes::Values& ResponseAttributes::Builder::getValues() const
+{
+	return mValues;
+}
+
 void ResponseAttributes::Builder::setAttribute(ResponseAttribute attribute)
 {
-	mSetAttributes.insert(attribute);
-}
\ No newline at end of file
+	mSetAttributes.set(indexOf(attribute));
+}
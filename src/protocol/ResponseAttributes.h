@@ -19,9 +19,9 @@
 
 #include "IResponseAttributes.h"
 #include "ResponseAttribute.h"
-#include "core/util/EnumClassHash.h"
 
-#include <unordered_set>
+#include <bitset>
+#include <cstdint>
 #include <memory>
 
 namespace protocol
@@ -32,7 +32,32 @@ namespace protocol
 	class ResponseAttributes : public IResponseAttributes
 	{
 	public:
-		using AttributeSet = std::unordered_set<protocol::ResponseAttribute, core::util::EnumClassHash>;
+		///
+		/// Bit set indicating which @ref protocol::ResponseAttribute were sent by the server.
+		///
+		using AttributeSet = std::bitset<NUMBER_OF_RESPONSE_ATTRIBUTES>;
+
+		///
+		/// Plain value block holding all attribute values, indexed by @ref protocol::ResponseAttribute.
+		///
+		struct Values
+		{
+			int32_t maxBeaconSizeInBytes;
+			int32_t maxSessionDurationInMilliseconds;
+			int32_t maxEventsPerSession;
+			int32_t sessionTimeoutInMilliseconds;
+			int32_t sendIntervalInMilliseconds;
+			int32_t visitStoreVersion;
+
+			bool isCapture;
+			bool isCaptureCrashes;
+			bool isCaptureErrors;
+
+			int32_t multiplicity;
+			int32_t serverId;
+
+			int64_t timestampInMilliseconds;
+		};
 
 		class Builder
 		{
@@ -40,7 +65,9 @@ namespace protocol
 
 			Builder(const IResponseAttributes& defaults);
 
-			AttributeSet& getSetAttributes();
+			const AttributeSet& getSetAttributes() const;
+
+			const Values& getValues() const;
 
 			int32_t getMaxBeaconSizeInBytes() const;
 
@@ -172,21 +199,7 @@ namespace protocol
 
 			AttributeSet mSetAttributes;
 
-			int32_t mMaxBeaconSizeInBytes;
-			int32_t mMaxSessionDurationInMilliseconds;
-			int32_t mMaxEventsPerSession;
-			int32_t mSessionTimeoutInMilliseconds;
-			int32_t mSendIntervalInMilliseconds;
-			int32_t mVisitStoreVersion;
-
-			bool mIsCapture;
-			bool mIsCaptureCrashes;
-			bool mIsCaptureErrors;
-
-			int32_t mMultiplicity;
-			int32_t mServerId;
-
-			int64_t mTimestampInMilliseconds;
+			Values mValues;
 		};
 
 		///
@@ -196,6 +209,14 @@ namespace protocol
 		///
 		ResponseAttributes(Builder& builder);
 
+		///
+		/// Creates a new response attributes instance from the given attribute set and values.
+		///
+		/// @param setAttributes the attributes which were sent by the server
+		/// @param values the values of all attributes
+		///
+		ResponseAttributes(const AttributeSet& setAttributes, const Values& values);
+
 		///
 		/// Creates a new builder initialized with the default values for key-value parsing.
 		///
@@ -211,6 +232,29 @@ namespace protocol
 		///
 		static Builder withUndefinedDefaults();
 
+		///
+		/// Reads the set attributes and all values from the given response attributes.
+		///
+		/// @par
+		/// If @p attributes is a @ref protocol::ResponseAttributes instance, the value block is copied directly,
+		/// otherwise the virtual getters are used.
+		///
+		/// @param[in] attributes the response attributes to read from
+		/// @param[out] setAttributes receives the attributes set in @p attributes
+		/// @param[out] values receives the values of @p attributes
+		///
+		static void read(const IResponseAttributes& attributes, AttributeSet& setAttributes, Values& values);
+
+		///
+		/// Returns the attributes which were sent by the server.
+		///
+		const AttributeSet& getSetAttributes() const;
+
+		///
+		/// Returns the value block holding all attribute values.
+		///
+		const Values& getValues() const;
+
 		int32_t getMaxBeaconSizeInBytes() const override;
 
 		int32_t getMaxSessionDurationInMilliseconds() const override;
@@ -241,46 +285,14 @@ namespace protocol
 
 	private:
 
-		static inline void applyBeaconSize(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applySessionDuration(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyEventsPerSession(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applySessionTimeout(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applySendInterval(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline  void applyVisitStoreVersion(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyCapture(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyCaptureCrashes(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyCaptureErrors(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyMultiplicity(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyServerId(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
-
-		static inline void applyTimestamp(Builder& builder, std::shared_ptr<IResponseAttributes> attributes);
+		///
+		/// Copies all values from @p source to @p target for which the respective bit in @p mask is set.
+		///
+		static void mergeValues(Values& target, const Values& source, const AttributeSet& mask);
 
 		AttributeSet mSetAttributes;
-		int32_t mMaxBeaconSizeInBytes;
-		int32_t mMaxSessionDurationInMilliseconds;
-		int32_t mMaxEventsPerSession;
-		int32_t mSessionTimeoutInMilliseconds;
-		int32_t mSendIntervalInMilliseconds;
-		int32_t mVisitStoreVersion;
-
-		bool mIsCapture;
-		bool mIsCaptureCrashes;
-		bool mIsCaptureErrors;
-
-		int32_t mMultiplicity;
-		int32_t mServerId;
 
-		int64_t mTimestampInMilliseconds;
+		Values mValues;
 	};
 }
 
@@ -35,7 +35,7 @@ std::shared_ptr<IResponseAttributes> ResponseParser::parseResponse(const core::U
 
 bool ResponseParser::isKeyValuePairResponse(const core::UTF8String& responseString)
 {
-	auto response = responseString.getStringData();
+	const auto& response = responseString.getStringData();
 	return response == KEY_VALUE_RESPONSE_TYPE_MOBILE
 		|| response.find(KEY_VALUE_RESPONSE_TYPE_MOBILE_WITH_SEPARATOR) == 0;
 }
\ No newline at end of file
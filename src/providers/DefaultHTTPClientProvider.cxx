@@ -19,10 +19,38 @@
 
 using namespace providers;
 
+DefaultHTTPClientProvider::DefaultHTTPClientProvider()
+	: DefaultHTTPClientProvider(nullptr)
+{
+}
+
+DefaultHTTPClientProvider::DefaultHTTPClientProvider(std::shared_ptr<protocol::HTTPConnectionPool> connectionPool)
+	: DefaultHTTPClientProvider(connectionPool, nullptr)
+{
+}
+
+DefaultHTTPClientProvider::DefaultHTTPClientProvider(
+	std::shared_ptr<protocol::HTTPConnectionPool> connectionPool,
+	std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+)
+	: mConnectionPool(connectionPool)
+	, mMetricsRegistry(metricsRegistry)
+	, mRequestDeadline(std::chrono::steady_clock::time_point::max())
+	, mRequestDeadlineMutex()
+{
+}
+
 std::shared_ptr<protocol::IHTTPClient> DefaultHTTPClientProvider::createClient(
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 )
 {
-	return std::make_shared<protocol::HTTPClient>(logger, configuration);
+	std::lock_guard<std::mutex> lock(mRequestDeadlineMutex);
+	return std::make_shared<protocol::HTTPClient>(logger, configuration, mConnectionPool, mRequestDeadline, mMetricsRegistry);
+}
+
+void DefaultHTTPClientProvider::setRequestDeadline(std::chrono::steady_clock::time_point deadline)
+{
+	std::lock_guard<std::mutex> lock(mRequestDeadlineMutex);
+	mRequestDeadline = deadline;
 }
\ No newline at end of file
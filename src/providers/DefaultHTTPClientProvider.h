@@ -18,8 +18,14 @@
 #define _PROVIDERS_DEFAULTHTTPCLIENTPROVIDER_H
 
 #include "core/configuration/IHTTPClientConfiguration.h"
+#include "core/util/MetricsRegistry.h"
+#include "protocol/HTTPConnectionPool.h"
 #include "providers/IHTTPClientProvider.h"
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+
 namespace providers
 {
 	///
@@ -29,12 +35,49 @@ namespace providers
 	{
 	public:
 
+		///
+		/// Constructor creating clients which use their own connection per request.
+		///
+		DefaultHTTPClientProvider();
+
+		///
+		/// Constructor creating clients which reuse the connections of the given pool.
+		/// @param[in] connectionPool pool of connections shared by all created clients
+		///
+		explicit DefaultHTTPClientProvider(std::shared_ptr<protocol::HTTPConnectionPool> connectionPool);
+
+		///
+		/// Constructor creating clients which reuse the connections of the given pool and record metrics.
+		/// @param[in] connectionPool pool of connections shared by all created clients, might be @c nullptr
+		/// @param[in] metricsRegistry registry the created clients record metrics in, @c nullptr if statistics are disabled
+		///
+		DefaultHTTPClientProvider(
+			std::shared_ptr<protocol::HTTPConnectionPool> connectionPool,
+			std::shared_ptr<core::util::MetricsRegistry> metricsRegistry
+		);
+
 		~DefaultHTTPClientProvider() override = default;
 
 		std::shared_ptr<protocol::IHTTPClient> createClient(
 			std::shared_ptr<openkit::ILogger> logger,
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 		) override;
+
+		void setRequestDeadline(std::chrono::steady_clock::time_point deadline) override;
+
+	private:
+
+		/// pool of connections passed to created clients, might be @c nullptr
+		std::shared_ptr<protocol::HTTPConnectionPool> mConnectionPool;
+
+		/// registry passed to created clients, might be @c nullptr
+		std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
+
+		/// deadline passed to created clients
+		std::chrono::steady_clock::time_point mRequestDeadline;
+
+		/// mutex protecting @ref mRequestDeadline
+		std::mutex mRequestDeadlineMutex;
 	};
 }
 
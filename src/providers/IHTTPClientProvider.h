@@ -19,6 +19,7 @@
 
 #include "protocol/HTTPClient.h"
 
+#include <chrono>
 #include <memory>
 
 #include "OpenKit/ILogger.h"
@@ -47,6 +48,14 @@ namespace providers
 			std::shared_ptr<openkit::ILogger> logger,
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 		) = 0;
+
+		///
+		/// Sets the point in time until which all requests of clients created afterwards must be finished.
+		///
+		/// Requests are aborted when the deadline expires, and not started at all after it expired.
+		/// @param[in] deadline the point in time until which all requests must be finished
+		///
+		virtual void setRequestDeadline(std::chrono::steady_clock::time_point deadline) = 0;
 	};
 }
 
@@ -0,0 +1,254 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/json/JsonEventParser.h"
+#include "util/json/parser/JsonParserException.h"
+#include "util/json/lexer/JsonLexerException.h"
+#include "util/json/lexer/JsonToken.h"
+#include "util/json/lexer/JsonTokenType.h"
+
+#include <sstream>
+
+using namespace util::json;
+using namespace util::json::parser;
+
+using JsonTokenType = util::json::lexer::JsonTokenType;
+using JsonTokenView = util::json::lexer::JsonTokenView;
+
+namespace
+{
+	const char* UNTERMINATED_JSON_ARRAY_ERROR = "Unterminated JSON array";
+	const char* UNTERMINATED_JSON_OBJECT_ERROR = "Unterminated JSON object";
+}
+
+JsonEventParser::JsonEventParser(const char* input, size_t length)
+	: mLexer(input, length)
+	, mState(JsonParserState::INIT)
+	, mStateStack()
+{
+}
+
+void JsonEventParser::parse(IJsonEventHandler& handler)
+{
+	if (mState == JsonParserState::END)
+	{
+		// input was already parsed
+		return;
+	}
+
+	if (mState == JsonParserState::ERROR)
+	{
+		throw JsonParserException("JSON parser is in erroneous state");
+	}
+
+	try
+	{
+		doParse(handler);
+	}
+	catch (util::json::lexer::JsonLexerException&)
+	{
+		mState = JsonParserState::ERROR;
+		std::throw_with_nested(JsonParserException("Caught exception from lexical analysis"));
+	}
+}
+
+JsonParserState JsonEventParser::getState() const
+{
+	return mState;
+}
+
+void JsonEventParser::doParse(IJsonEventHandler& handler)
+{
+	JsonTokenView token;
+	while (mLexer.nextToken(token))
+	{
+		switch (mState)
+		{
+			case JsonParserState::INIT:
+				parseValue(token, handler, JsonParserState::END, "at start of input");
+				break;
+			case JsonParserState::IN_ARRAY_START:
+				if (token.getTokenType() == JsonTokenType::RIGHT_SQUARE_BRACKET)
+				{
+					handler.onArrayEnd();
+					closeCompositeValueAndRestoreState();
+				}
+				else
+				{
+					parseValue(token, handler, JsonParserState::IN_ARRAY_VALUE, "at beginning of array");
+				}
+				break;
+			case JsonParserState::IN_ARRAY_VALUE:
+				if (token.getTokenType() == JsonTokenType::COMMA)
+				{
+					mState = JsonParserState::IN_ARRAY_DELIMITER;
+				}
+				else if (token.getTokenType() == JsonTokenType::RIGHT_SQUARE_BRACKET)
+				{
+					handler.onArrayEnd();
+					closeCompositeValueAndRestoreState();
+				}
+				else
+				{
+					throwUnexpectedToken(token, "in array after value was parsed");
+				}
+				break;
+			case JsonParserState::IN_ARRAY_DELIMITER:
+				parseValue(token, handler, JsonParserState::IN_ARRAY_VALUE, "in array after delimiter");
+				break;
+			case JsonParserState::IN_OBJECT_START:
+				if (token.getTokenType() == JsonTokenType::RIGHT_BRACE)
+				{
+					// object is closed right after it was started
+					handler.onObjectEnd();
+					closeCompositeValueAndRestoreState();
+				}
+				else if (token.getTokenType() == JsonTokenType::VALUE_STRING)
+				{
+					handler.onKey(token);
+					mState = JsonParserState::IN_OBJECT_KEY;
+				}
+				else
+				{
+					throwUnexpectedToken(token, "encountered - object key expected");
+				}
+				break;
+			case JsonParserState::IN_OBJECT_KEY:
+				if (token.getTokenType() != JsonTokenType::COLON)
+				{
+					throwUnexpectedToken(token, "encountered - key-value delimiter expected");
+				}
+				mState = JsonParserState::IN_OBJECT_COLON;
+				break;
+			case JsonParserState::IN_OBJECT_COLON:
+				parseValue(token, handler, JsonParserState::IN_OBJECT_VALUE, "after key-value pair encountered");
+				break;
+			case JsonParserState::IN_OBJECT_VALUE:
+				if (token.getTokenType() == JsonTokenType::COMMA)
+				{
+					mState = JsonParserState::IN_OBJECT_DELIMITER;
+				}
+				else if (token.getTokenType() == JsonTokenType::RIGHT_BRACE)
+				{
+					handler.onObjectEnd();
+					closeCompositeValueAndRestoreState();
+				}
+				else
+				{
+					throwUnexpectedToken(token, "after key-value pair encountered");
+				}
+				break;
+			case JsonParserState::IN_OBJECT_DELIMITER:
+				if (token.getTokenType() != JsonTokenType::VALUE_STRING)
+				{
+					throwUnexpectedToken(token, "encountered - object key expected");
+				}
+				handler.onKey(token);
+				mState = JsonParserState::IN_OBJECT_KEY;
+				break;
+			case JsonParserState::END:
+				throwUnexpectedToken(token, "at end of input");
+				break;
+			default:
+				// this should never be reached since whenever there is a transition into the error state an exception
+				// is thrown right afterwards. this is just a precaution
+				throwUnexpectedToken(token, "in error state");
+		}
+	}
+
+	// end of input reached
+	switch (mState)
+	{
+		case JsonParserState::END:
+			// regular terminal state
+			break;
+		case JsonParserState::INIT:
+			throwParserException("No JSON object could be decoded");
+			break;
+		case JsonParserState::IN_ARRAY_START:    // fallthrough
+		case JsonParserState::IN_ARRAY_VALUE:    // fallthrough
+		case JsonParserState::IN_ARRAY_DELIMITER:
+			throwParserException(UNTERMINATED_JSON_ARRAY_ERROR);
+			break;
+		default:
+			throwParserException(UNTERMINATED_JSON_OBJECT_ERROR);
+	}
+}
+
+void JsonEventParser::parseValue(const JsonTokenView& token, IJsonEventHandler& handler,
+	JsonParserState stateAfterValue, const char* errorSuffix)
+{
+	switch (token.getTokenType())
+	{
+		case JsonTokenType::LITERAL_NULL:
+			handler.onNull();
+			mState = stateAfterValue;
+			break;
+		case JsonTokenType::LITERAL_BOOLEAN:
+			handler.onBoolean(token.getData()[0] == 't');
+			mState = stateAfterValue;
+			break;
+		case JsonTokenType::VALUE_STRING:
+			handler.onString(token);
+			mState = stateAfterValue;
+			break;
+		case JsonTokenType::VALUE_NUMBER:
+			handler.onNumber(token);
+			mState = stateAfterValue;
+			break;
+		case JsonTokenType::LEFT_SQUARE_BRACKET:
+			mStateStack.push_back(stateAfterValue);
+			handler.onArrayStart();
+			mState = JsonParserState::IN_ARRAY_START;
+			break;
+		case JsonTokenType::LEFT_BRACE:
+			mStateStack.push_back(stateAfterValue);
+			handler.onObjectStart();
+			mState = JsonParserState::IN_OBJECT_START;
+			break;
+		default:
+			throwUnexpectedToken(token, errorSuffix);
+	}
+}
+
+void JsonEventParser::closeCompositeValueAndRestoreState()
+{
+	if (mStateStack.empty())
+	{
+		// sanity check. cannot happen unless there is a programming error
+		std::stringstream stream;
+		stream << "Internal parser error: [state=\""
+			<< static_cast<std::underlying_type<JsonParserState>::type>(mState) << "\"] state stack is empty";
+		throwParserException(stream.str());
+	}
+
+	mState = mStateStack.back();
+	mStateStack.pop_back();
+}
+
+void JsonEventParser::throwUnexpectedToken(const JsonTokenView& token, const char* suffix)
+{
+	throwParserException("Unexpected token \"JsonToken {tokenType="
+		+ util::json::lexer::JsonToken::tokenTypeToString(token.getTokenType())
+		+ ", value=" + token.getValue() + "}\" " + suffix);
+}
+
+void JsonEventParser::throwParserException(const std::string& message)
+{
+	mState = JsonParserState::ERROR;
+	throw JsonParserException(message);
+}
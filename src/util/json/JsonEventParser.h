@@ -0,0 +1,129 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _UTIL_JSON_JSONEVENTPARSER_H
+#define _UTIL_JSON_JSONEVENTPARSER_H
+
+#include "util/json/lexer/JsonBufferLexer.h"
+#include "util/json/lexer/JsonTokenView.h"
+#include "util/json/parser/IJsonEventHandler.h"
+#include "util/json/parser/JsonParserState.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace util
+{
+	namespace json
+	{
+		///
+		/// Streaming JSON parser reporting the parsed input to an @ref parser::IJsonEventHandler
+		///
+		/// @par
+		/// In contrast to the @ref JsonParser no JSON value objects are created. The grammar and error messages are
+		/// the same as the ones of the @ref JsonParser. Events preceding a syntax error are already reported when the
+		/// error is detected.
+		///
+		class JsonEventParser
+		{
+		public: // functions
+
+			///
+			/// Constructor taking the JSON input
+			///
+			/// @par
+			/// The input buffer must outlive this parser.
+			///
+			/// @param input pointer to the first character of the JSON input
+			/// @param length length of the JSON input in bytes
+			///
+			JsonEventParser(const char* input, size_t length);
+
+			///
+			/// Parses the JSON input and reports it to the given @c handler.
+			///
+			/// @par
+			/// Parsing is done only once, subsequent calls do not report any events.
+			///
+			/// @param[in] handler handler receiving the parse events
+			///
+			/// @throws @ref JsonParserException if there is an error while parsing the input
+			///
+			void parse(util::json::parser::IJsonEventHandler& handler);
+
+			///
+			/// Function for retrieving the current parser state
+			///
+			/// @return returns the current state of the parser
+			///
+			util::json::parser::JsonParserState getState() const;
+
+		private: // functions
+
+			///
+			/// Parses all tokens from the lexer
+			///
+			void doParse(util::json::parser::IJsonEventHandler& handler);
+
+			///
+			/// Parses a value token in a state where a value is expected.
+			///
+			/// @param[in] token the token to parse
+			/// @param[in] handler the handler to report the value to
+			/// @param[in] stateAfterValue the state after a simple value or after the compound value was closed
+			/// @param[in] errorSuffix the error message suffix for an unexpected token
+			///
+			void parseValue(const util::json::lexer::JsonTokenView& token, util::json::parser::IJsonEventHandler& handler,
+				util::json::parser::JsonParserState stateAfterValue, const char* errorSuffix);
+
+			///
+			/// Closes the current object or array and restores the state before it was started
+			///
+			void closeCompositeValueAndRestoreState();
+
+			///
+			/// Switches into the error state and throws a @ref JsonParserException for an unexpected token
+			///
+			void throwUnexpectedToken(const util::json::lexer::JsonTokenView& token, const char* suffix);
+
+			///
+			/// Switches into the error state and throws a @ref JsonParserException with the given message
+			///
+			void throwParserException(const std::string& message);
+
+		private: // members
+
+			///
+			/// lexical analyzer
+			///
+			util::json::lexer::JsonBufferLexer mLexer;
+
+			///
+			/// current parser state
+			///
+			util::json::parser::JsonParserState mState;
+
+			///
+			/// states to restore when closing nested objects and arrays
+			///
+			std::vector<util::json::parser::JsonParserState> mStateStack;
+		};
+	}
+}
+
+#endif //_UTIL_JSON_JSONEVENTPARSER_H
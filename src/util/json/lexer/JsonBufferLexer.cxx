@@ -0,0 +1,526 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/json/lexer/JsonBufferLexer.h"
+#include "util/json/lexer/JsonLexerConstants.h"
+#include "util/json/constants/JsonLiterals.h"
+#include "core/util/StringUtil.h"
+
+#include <iomanip>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSON_BUFFER_LEXER_USE_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+using namespace util::json::lexer;
+
+namespace
+{
+	bool isJsonWhitespaceCharacter(char chr)
+	{
+		return chr == SPACE || chr == HORIZONTAL_TAB || chr == LINE_FEED || chr == CARRIAGE_RETURN;
+	}
+
+	bool isJsonStructuralCharacter(char chr)
+	{
+		switch (chr)
+		{
+			case LEFT_SQUARE_BRACKET:  // fallthrough
+			case RIGHT_SQUARE_BRACKET: // fallthrough
+			case LEFT_BRACE:           // fallthrough
+			case RIGHT_BRACE:          // fallthrough
+			case COLON:                // fallthrough
+			case COMMA:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	bool isControlCharacter(char chr)
+	{
+		return static_cast<unsigned char>(chr) <= 0x1F;
+	}
+
+	bool isDigit(char chr)
+	{
+		return chr >= '0' && chr <= '9';
+	}
+
+	int32_t hexCharacterValue(char chr)
+	{
+		if (chr >= '0' && chr <= '9')
+		{
+			return chr - '0';
+		}
+		if (chr >= 'a' && chr <= 'f')
+		{
+			return chr - 'a' + 10;
+		}
+		if (chr >= 'A' && chr <= 'F')
+		{
+			return chr - 'A' + 10;
+		}
+		return -1;
+	}
+
+#if defined(JSON_BUFFER_LEXER_USE_SSE2)
+	uint32_t countTrailingZeros(uint32_t mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<uint32_t>(index);
+#else
+		return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+	}
+#endif
+}
+
+JsonBufferLexer::JsonBufferLexer(const char* input, size_t length)
+	: mLexerState(JsonLexerState::INITIAL)
+	, mInput(input)
+	, mInputEnd(input + length)
+	, mPosition(input)
+	, mDecodedString()
+{
+}
+
+bool JsonBufferLexer::nextToken(JsonTokenView& token)
+{
+	if (mLexerState == JsonLexerState::ERROR)
+	{
+		throw JsonLexerException("JSON Lexer is in erroneous state");
+	}
+
+	if (mLexerState == JsonLexerState::END_OF_FILE)
+	{
+		return false;
+	}
+
+	// "Insignificant whitespace is allowed before or after any of the six structural characters."
+	// (https://tools.ietf.org/html/rfc8259#section-2), therefore consume all whitespace characters
+	consumeWhitespaceCharacters();
+	if (mPosition == mInputEnd)
+	{
+		mLexerState = JsonLexerState::END_OF_FILE;
+		return false;
+	}
+
+	mLexerState = JsonLexerState::PARSING;
+	try
+	{
+		token = doParseNextToken();
+	}
+	catch (JsonLexerException&)
+	{
+		mLexerState = JsonLexerState::ERROR;
+		throw;
+	}
+
+	return true;
+}
+
+JsonTokenView JsonBufferLexer::doParseNextToken()
+{
+	switch (*mPosition)
+	{
+		case LEFT_SQUARE_BRACKET:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::LEFT_SQUARE_BRACKET, nullptr, 0);
+		case RIGHT_SQUARE_BRACKET:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::RIGHT_SQUARE_BRACKET, nullptr, 0);
+		case LEFT_BRACE:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::LEFT_BRACE, nullptr, 0);
+		case RIGHT_BRACE:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::RIGHT_BRACE, nullptr, 0);
+		case COLON:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::COLON, nullptr, 0);
+		case COMMA:
+			mPosition++;
+			return JsonTokenView(JsonTokenType::COMMA, nullptr, 0);
+		case TRUE_LITERAL_START:
+			return tryParseKeywordLiteral(JsonTokenType::LITERAL_BOOLEAN, util::json::constants::JsonLiterals::BOOLEAN_TRUE_LITERAL);
+		case FALSE_LITERAL_START:
+			return tryParseKeywordLiteral(JsonTokenType::LITERAL_BOOLEAN, util::json::constants::JsonLiterals::BOOLEAN_FALSE_LITERAL);
+		case NULL_LITERAL_START:
+			return tryParseKeywordLiteral(JsonTokenType::LITERAL_NULL, util::json::constants::JsonLiterals::NULL_LITERAL);
+		case QUOTATION_MARK:
+			// string value - omit the starting "
+			mPosition++;
+			return tryParseStringToken();
+		default:
+			if (*mPosition == '-' || isDigit(*mPosition))
+			{
+				return tryParseNumberToken();
+			}
+
+			size_t length = 0;
+			auto literal = parseLiteral(length);
+			throw JsonLexerException("Unexpected literal \"" + std::string(literal, length) + "\"");
+	}
+}
+
+JsonTokenView JsonBufferLexer::tryParseKeywordLiteral(JsonTokenType tokenType, const std::string& expectedLiteral)
+{
+	size_t length = 0;
+	auto literal = parseLiteral(length);
+
+	JsonTokenView token(tokenType, literal, length);
+	if (token.valueEquals(expectedLiteral))
+	{
+		return token;
+	}
+
+	throw JsonLexerException("Unexpected literal \"" + token.getValue() + "\"");
+}
+
+JsonTokenView JsonBufferLexer::tryParseStringToken()
+{
+	auto stringStart = mPosition;
+
+	mPosition = findStringSpecialCharacter(mPosition, mInputEnd);
+	if (mPosition == mInputEnd)
+	{
+		// string is not properly terminated because EOF was reached
+		throw JsonLexerException("Unterminated string literal \"" + std::string(stringStart, mPosition) + "\"");
+	}
+
+	if (*mPosition == QUOTATION_MARK)
+	{
+		// fast path - string without any escape sequences can refer to the input
+		JsonTokenView token(JsonTokenType::VALUE_STRING, stringStart, static_cast<size_t>(mPosition - stringStart));
+		mPosition++;
+		return token;
+	}
+
+	return tryParseEscapedStringToken(stringStart);
+}
+
+JsonTokenView JsonBufferLexer::tryParseEscapedStringToken(const char* stringStart)
+{
+	mDecodedString.assign(stringStart, mPosition);
+
+	while (mPosition != mInputEnd && *mPosition != QUOTATION_MARK)
+	{
+		if (*mPosition == REVERSE_SOLIDUS)
+		{
+			mPosition++;
+			tryParseEscapeSequence();
+		}
+		else if (isControlCharacter(*mPosition))
+		{
+			std::ostringstream os;
+			os << "Invalid control character \"\\u" << std::hex << std::setw(4) << std::setfill('0') << std::uppercase
+				<< static_cast<int32_t>(*mPosition) << "\"";
+			throw JsonLexerException(os.str());
+		}
+		else
+		{
+			auto plainEnd = findStringSpecialCharacter(mPosition, mInputEnd);
+			mDecodedString.append(mPosition, plainEnd);
+			mPosition = plainEnd;
+		}
+	}
+
+	if (mPosition == mInputEnd)
+	{
+		// string is not properly terminated because EOF was reached
+		throw JsonLexerException("Unterminated string literal \"" + mDecodedString + "\"");
+	}
+
+	mPosition++;
+	return JsonTokenView(JsonTokenType::VALUE_STRING, mDecodedString.data(), mDecodedString.size());
+}
+
+void JsonBufferLexer::tryParseEscapeSequence()
+{
+	if (mPosition == mInputEnd)
+	{
+		throw JsonLexerException("Unterminated string literal \"" + mDecodedString + "\"");
+	}
+
+	auto nextChar = *mPosition++;
+	switch (nextChar)
+	{
+		case QUOTATION_MARK:  // fallthrough
+		case REVERSE_SOLIDUS: // fallthrough
+		case SOLIDUS:
+			mDecodedString.push_back(nextChar);
+			break;
+		case 'b':
+			mDecodedString.push_back(BACKSPACE);
+			break;
+		case 'f':
+			mDecodedString.push_back(FORM_FEED);
+			break;
+		case 'n':
+			mDecodedString.push_back(LINE_FEED);
+			break;
+		case 'r':
+			mDecodedString.push_back(CARRIAGE_RETURN);
+			break;
+		case 't':
+			mDecodedString.push_back(HORIZONTAL_TAB);
+			break;
+		case 'u':
+			tryParseUnicodeEscapeSequence();
+			break;
+		default:
+			throw JsonLexerException(std::string("Invalid escape sequence \"\\") + nextChar + "\"");
+	}
+}
+
+void JsonBufferLexer::tryParseUnicodeEscapeSequence()
+{
+	auto unicodeSequence = mPosition;
+	auto parsedInt = readUnicodeEscapeSequence();
+
+	if (core::util::StringUtil::isHighSurrogateCharacter(parsedInt))
+	{
+		// try to parse subsequent low surrogate
+		int32_t lowSurrogate = -1;
+		if (mInputEnd - mPosition >= 2 && mPosition[0] == REVERSE_SOLIDUS && mPosition[1] == 'u')
+		{
+			mPosition += 2;
+			lowSurrogate = readUnicodeEscapeSequence();
+		}
+
+		if (!core::util::StringUtil::isLowSurrogateCharacter(lowSurrogate))
+		{
+			throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + std::string(unicodeSequence, NUM_UNICODE_CHARACTERS) + "\"");
+		}
+
+		// convert UTF-16 surrogate pair to proper UTF-8 representation
+		std::u16string surrogatePairString{ static_cast<char16_t >(parsedInt), static_cast<char16_t>(lowSurrogate) };
+		mDecodedString.append(core::util::StringUtil::convertUtf16StringToUtf8String(surrogatePairString));
+	}
+	else if (core::util::StringUtil::isLowSurrogateCharacter(parsedInt))
+	{
+		// low surrogate character without previous high surrogate
+		throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + std::string(unicodeSequence, NUM_UNICODE_CHARACTERS) + "\"");
+	}
+	else
+	{
+		auto parsedIntHighPart = static_cast<char>((0xFF00 & parsedInt) >> 8);
+		auto parsedIntLowPart = static_cast<char>(0x00FF & parsedInt);
+		if (parsedIntHighPart)
+		{
+			mDecodedString.push_back(parsedIntHighPart);
+		}
+
+		mDecodedString.push_back(parsedIntLowPart);
+	}
+}
+
+int32_t JsonBufferLexer::readUnicodeEscapeSequence()
+{
+	auto sequenceStart = mPosition;
+	int32_t result = 0;
+
+	while (mPosition != mInputEnd && mPosition - sequenceStart < NUM_UNICODE_CHARACTERS)
+	{
+		auto hexValue = hexCharacterValue(*mPosition);
+		if (hexValue < 0)
+		{
+			throw JsonLexerException("Invalid unicode escape sequence \"\\u" + std::string(sequenceStart, mPosition + 1) + "\"");
+		}
+
+		result = (result << 4) | hexValue;
+		mPosition++;
+	}
+
+	if (mPosition == mInputEnd)
+	{
+		// string is not properly terminated, because EOF was reached
+		throw JsonLexerException("Unterminated string literal \"\\u" + std::string(sequenceStart, mPosition) + "\"");
+	}
+
+	return result;
+}
+
+JsonTokenView JsonBufferLexer::tryParseNumberToken()
+{
+	size_t length = 0;
+	auto literal = parseLiteral(length);
+
+	if (isValidNumberLiteral(literal, length))
+	{
+		return JsonTokenView(JsonTokenType::VALUE_NUMBER, literal, length);
+	}
+
+	// not a valid number literal
+	throw JsonLexerException("Invalid number literal \"" + std::string(literal, length) + "\"");
+}
+
+const char* JsonBufferLexer::parseLiteral(size_t& length)
+{
+	auto literalStart = mPosition;
+	while (mPosition != mInputEnd && !isJsonWhitespaceCharacter(*mPosition) && !isJsonStructuralCharacter(*mPosition))
+	{
+		mPosition++;
+	}
+
+	length = static_cast<size_t>(mPosition - literalStart);
+	return literalStart;
+}
+
+void JsonBufferLexer::consumeWhitespaceCharacters()
+{
+	mPosition = findNonWhitespaceCharacter(mPosition, mInputEnd);
+}
+
+bool JsonBufferLexer::isValidNumberLiteral(const char* literal, size_t length)
+{
+	// equivalent to util::json::constants::JsonLiterals::NUMBER_PATTERN_STRING
+	auto position = literal;
+	auto end = literal + length;
+
+	if (position != end && *position == '-')
+	{
+		position++;
+	}
+
+	// integer part - either a single zero or a non-zero digit followed by arbitrary digits
+	if (position == end || !isDigit(*position))
+	{
+		return false;
+	}
+	if (*position++ != '0')
+	{
+		while (position != end && isDigit(*position))
+		{
+			position++;
+		}
+	}
+
+	// optional fraction part
+	if (position != end && *position == '.')
+	{
+		position++;
+		if (position == end || !isDigit(*position))
+		{
+			return false;
+		}
+		while (position != end && isDigit(*position))
+		{
+			position++;
+		}
+	}
+
+	// optional exponent part
+	if (position != end && (*position == 'e' || *position == 'E'))
+	{
+		position++;
+		if (position != end && (*position == '+' || *position == '-'))
+		{
+			position++;
+		}
+		if (position == end || !isDigit(*position))
+		{
+			return false;
+		}
+		while (position != end && isDigit(*position))
+		{
+			position++;
+		}
+	}
+
+	return position == end;
+}
+
+const char* JsonBufferLexer::findStringSpecialCharacter(const char* begin, const char* end)
+{
+#if defined(JSON_BUFFER_LEXER_USE_SSE2)
+	const auto quotationMark = _mm_set1_epi8(QUOTATION_MARK);
+	const auto reverseSolidus = _mm_set1_epi8(REVERSE_SOLIDUS);
+	const auto maxControlCharacter = _mm_set1_epi8(0x1F);
+
+	while (end - begin >= 16)
+	{
+		auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+		auto isQuotationMark = _mm_cmpeq_epi8(chunk, quotationMark);
+		auto isReverseSolidus = _mm_cmpeq_epi8(chunk, reverseSolidus);
+		// unsigned chunk <= 0x1F, if max(chunk, 0x1F) == 0x1F
+		auto isControlCharacter = _mm_cmpeq_epi8(_mm_max_epu8(chunk, maxControlCharacter), maxControlCharacter);
+
+		auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(isQuotationMark, isReverseSolidus), isControlCharacter)));
+		if (mask != 0)
+		{
+			return begin + countTrailingZeros(mask);
+		}
+
+		begin += 16;
+	}
+#endif
+
+	while (begin != end && *begin != QUOTATION_MARK && *begin != REVERSE_SOLIDUS && !isControlCharacter(*begin))
+	{
+		begin++;
+	}
+
+	return begin;
+}
+
+const char* JsonBufferLexer::findNonWhitespaceCharacter(const char* begin, const char* end)
+{
+	// most tokens are separated by no or a single whitespace character
+	if (begin == end || !isJsonWhitespaceCharacter(*begin))
+	{
+		return begin;
+	}
+
+#if defined(JSON_BUFFER_LEXER_USE_SSE2)
+	const auto space = _mm_set1_epi8(SPACE);
+	const auto horizontalTab = _mm_set1_epi8(HORIZONTAL_TAB);
+	const auto lineFeed = _mm_set1_epi8(LINE_FEED);
+	const auto carriageReturn = _mm_set1_epi8(CARRIAGE_RETURN);
+
+	while (end - begin >= 16)
+	{
+		auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+		auto isWhitespace = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, horizontalTab)),
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, lineFeed), _mm_cmpeq_epi8(chunk, carriageReturn)));
+
+		auto mask = ~static_cast<uint32_t>(_mm_movemask_epi8(isWhitespace)) & 0xFFFF;
+		if (mask != 0)
+		{
+			return begin + countTrailingZeros(mask);
+		}
+
+		begin += 16;
+	}
+#endif
+
+	while (begin != end && isJsonWhitespaceCharacter(*begin))
+	{
+		begin++;
+	}
+
+	return begin;
+}
@@ -0,0 +1,207 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _UTIL_JSON_LEXER_JSONBUFFERLEXER_H
+#define _UTIL_JSON_LEXER_JSONBUFFERLEXER_H
+
+#include "util/json/lexer/JsonLexerState.h"
+#include "util/json/lexer/JsonTokenView.h"
+#include "util/json/lexer/JsonLexerException.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace util
+{
+	namespace json
+	{
+		namespace lexer
+		{
+			///
+			/// Lexical analyzer operating directly on a contiguous buffer of JSON data
+			///
+			/// @par
+			/// In contrast to the @ref JsonLexer reading from an @ref IResettableReader this lexer does not copy
+			/// the input. Tokens are returned as @ref JsonTokenView referring to the input buffer, only string
+			/// tokens containing escape sequences are decoded into an internal buffer. String bodies and whitespace
+			/// are scanned 16 bytes at once if SSE2 is available.
+			///
+			/// @par
+			/// The input buffer must outlive the lexer. Error messages are the same as the ones from @ref JsonLexer.
+			///
+			class JsonBufferLexer
+			{
+			public: // functions
+
+				///
+				/// Constructor taking the JSON data
+				///
+				/// @param input pointer to the first character of the JSON data
+				/// @param length length of the JSON data in bytes
+				///
+				JsonBufferLexer(const char* input, size_t length);
+
+				///
+				/// Delete the copy constructor
+				///
+				JsonBufferLexer(const JsonBufferLexer&) = delete;
+
+				///
+				/// Delete the assignment operator
+				///
+				JsonBufferLexer& operator=(const JsonBufferLexer&) = delete;
+
+				///
+				/// Reads the next token.
+				///
+				/// @par
+				/// The value of the returned token is only valid until this function is called the next time.
+				///
+				/// @param[out] token the next token, which is only updated if the function returns @c true
+				/// @return @c true if a token was read, @c false if the end of the input was reached
+				/// @throws JsonLexerException if the input is not valid JSON
+				///
+				bool nextToken(JsonTokenView& token);
+
+			private: // members
+
+				///
+				/// current state of the lexer
+				///
+				JsonLexerState mLexerState;
+
+				///
+				/// the JSON input
+				///
+				const char* const mInput;
+
+				///
+				/// end of the JSON input
+				///
+				const char* const mInputEnd;
+
+				///
+				/// current read position in the JSON input
+				///
+				const char* mPosition;
+
+				///
+				/// buffer holding the last decoded string token containing escape sequences
+				///
+				std::string mDecodedString;
+
+			private: // functions
+
+				///
+				/// Parses a token after all whitespace characters were consumed.
+				///
+				/// @return the next token
+				///
+				JsonTokenView doParseNextToken();
+
+				///
+				/// Tries to parse a literal and verifies that it's equal to the given @c expectedLiteral.
+				///
+				/// @param tokenType the token type to return
+				/// @param expectedLiteral the literal which is expected
+				/// @return the parsed token
+				///
+				JsonTokenView tryParseKeywordLiteral(JsonTokenType tokenType, const std::string& expectedLiteral);
+
+				///
+				/// Try to parse a JSON string token, the read position is right after the opening quotation mark.
+				///
+				/// @return the parsed string token
+				///
+				JsonTokenView tryParseStringToken();
+
+				///
+				/// Decodes the remainder of a string token containing escape sequences into @ref mDecodedString.
+				///
+				/// @param stringStart the first character after the opening quotation mark
+				/// @return the parsed string token
+				///
+				JsonTokenView tryParseEscapedStringToken(const char* stringStart);
+
+				///
+				/// Tries to parse an escape sequence, the read position is right after the reverse solidus.
+				///
+				void tryParseEscapeSequence();
+
+				///
+				/// Tries to parse a unicode escape sequence, the read position is right after the @c \\u.
+				///
+				void tryParseUnicodeEscapeSequence();
+
+				///
+				/// Reads the four hex characters of a unicode escape sequence
+				///
+				/// @return the parsed code unit
+				///
+				int32_t readUnicodeEscapeSequence();
+
+				///
+				/// Tries to parse a number token.
+				///
+				/// @return the parsed number token
+				///
+				JsonTokenView tryParseNumberToken();
+
+				///
+				/// Parses a literal which is terminated by either a whitespace character, a structural character or
+				/// the end of input.
+				///
+				/// @param[out] length the literal's length
+				/// @return the first character of the parsed literal
+				///
+				const char* parseLiteral(size_t& length);
+
+				///
+				/// Advances the read position to the first non-whitespace character
+				///
+				void consumeWhitespaceCharacters();
+
+				///
+				/// Tests if the given literal is a valid JSON number according to RFC 8259
+				///
+				/// @param literal the first character of the literal
+				/// @param length the literal's length
+				/// @return @c true if it is a valid number, @c false otherwise
+				///
+				static bool isValidNumberLiteral(const char* literal, size_t length);
+
+				///
+				/// Returns the first character in range [@c begin, @c end) which terminates the plain part of
+				/// a string, i.e. either a quotation mark, a reverse solidus or a control character.
+				///
+				/// @return the first terminating character or @c end if there is no such character
+				///
+				static const char* findStringSpecialCharacter(const char* begin, const char* end);
+
+				///
+				/// Returns the first character in range [@c begin, @c end) which is not a JSON whitespace character.
+				///
+				/// @return the first non-whitespace character or @c end if there is no such character
+				///
+				static const char* findNonWhitespaceCharacter(const char* begin, const char* end);
+			};
+		}
+	}
+}
+
+#endif //_UTIL_JSON_LEXER_JSONBUFFERLEXER_H
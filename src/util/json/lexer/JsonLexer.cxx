@@ -17,7 +17,6 @@
 #include "util/json/lexer/JsonLexer.h"
 #include "util/json/lexer/JsonLexerConstants.h"
 #include "util/json/constants/JsonLiterals.h"
-#include "util/json/reader/DefaultResettableReader.h"
 #include "core/util/StringUtil.h"
 
 #include <iomanip>
@@ -26,12 +25,26 @@ using namespace util::json::lexer;
 
 
 JsonLexer::JsonLexer(const std::string& input)
-	: JsonLexer(std::make_shared<util::json::reader::DefaultResettableReader>(input))
+	: mLexerState(JsonLexerState::INITIAL)
+	, mInput(std::make_shared<const std::string>(input))
+	, mBufferLexer(std::make_shared<JsonBufferLexer>(mInput->data(), mInput->size()))
+	, mReader(nullptr)
+{
+}
+
+JsonLexer::JsonLexer(const char* input, size_t length)
+	: mLexerState(JsonLexerState::INITIAL)
+	, mInput()
+	, mBufferLexer(std::make_shared<JsonBufferLexer>(input, length))
+	, mReader(nullptr)
 {
 }
 
 JsonLexer::JsonLexer(const JsonLexer::ReaderPtr input)
-	: mReader(input)
+	: mLexerState(JsonLexerState::INITIAL)
+	, mInput()
+	, mBufferLexer()
+	, mReader(input)
 {
 }
 
@@ -41,6 +54,11 @@ JsonLexer::~JsonLexer()
 
 const JsonLexer::JsonTokenPtr JsonLexer::nextToken()
 {
+	if (mBufferLexer != nullptr)
+	{
+		return nextBufferToken();
+	}
+
 	if (mLexerState == JsonLexerState::ERROR)
 	{
 		throw JsonLexerException("JSON Lexer is in erroneous state");
@@ -82,6 +100,41 @@ const JsonLexer::JsonTokenPtr JsonLexer::nextToken()
 	return nextToken;
 }
 
+const JsonLexer::JsonTokenPtr JsonLexer::nextBufferToken()
+{
+	JsonTokenView token;
+	if (!mBufferLexer->nextToken(token))
+	{
+		return nullptr;
+	}
+
+	switch (token.getTokenType())
+	{
+		case JsonTokenType::VALUE_STRING:
+			return JsonToken::createStringToken(token.getValue());
+		case JsonTokenType::VALUE_NUMBER:
+			return JsonToken::createNumberToken(token.getValue());
+		case JsonTokenType::LITERAL_BOOLEAN:
+			return *token.getData() == TRUE_LITERAL_START ? JsonToken::BOOLEAN_TRUE_TOKEN : JsonToken::BOOLEAN_FALSE_TOKEN;
+		case JsonTokenType::LITERAL_NULL:
+			return JsonToken::NULL_TOKEN;
+		case JsonTokenType::LEFT_BRACE:
+			return JsonToken::LEFT_BRACE_TOKEN;
+		case JsonTokenType::RIGHT_BRACE:
+			return JsonToken::RIGHT_BRACE_TOKEN;
+		case JsonTokenType::LEFT_SQUARE_BRACKET:
+			return JsonToken::LEFT_SQUARE_BRACKET_TOKEN;
+		case JsonTokenType::RIGHT_SQUARE_BRACKET:
+			return JsonToken::RIGHT_SQUARE_BRACKET_TOKEN;
+		case JsonTokenType::COMMA:
+			return JsonToken::COMMA_TOKEN;
+		case JsonTokenType::COLON:
+			return JsonToken::COLON_TOKEN;
+	}
+
+	return nullptr;
+}
+
 const JsonLexer::JsonTokenPtr JsonLexer::doParseNextToken()
 {
 	// parse next character
@@ -17,6 +17,7 @@
 #ifndef _UTIL_JSON_LEXER_JSONLEXER_H
 #define _UTIL_JSON_LEXER_JSONLEXER_H
 
+#include "util/json/lexer/JsonBufferLexer.h"
 #include "util/json/lexer/JsonLexerState.h"
 #include "util/json/lexer/JsonToken.h"
 #include "util/json/lexer/JsonLexerException.h"
@@ -47,10 +48,24 @@ namespace util
 				///
 				/// Constructor taking the JSON string
 				///
+				/// @par
+				/// The string is copied and analyzed by a @ref JsonBufferLexer.
+				///
 				/// @param input JSON string for lexical analysis
 				///
 				JsonLexer(const std::string& input);
 
+				///
+				/// Constructor taking a contiguous buffer of JSON data, which is analyzed without copying it.
+				///
+				/// @par
+				/// The buffer must outlive this lexer.
+				///
+				/// @param input pointer to the first character of the JSON data
+				/// @param length length of the JSON data in bytes
+				///
+				JsonLexer(const char* input, size_t length);
+
 				///
 				/// Constructor taking a @ref IResettableReader from where to read the JSON data
 				///
@@ -70,15 +85,30 @@ namespace util
 				///
 				/// current state of the lexer
 				///
-				JsonLexerState mLexerState = JsonLexerState::INITIAL;
+				JsonLexerState mLexerState;
 
 				///
-				/// the reader from where to read the JSON input
+				/// copy of the JSON string, if this lexer was constructed with a string
+				///
+				std::shared_ptr<const std::string> mInput;
+
+				///
+				/// lexer analyzing contiguous input, or @c nullptr if reading from @ref mReader
+				///
+				std::shared_ptr<JsonBufferLexer> mBufferLexer;
+
+				///
+				/// the reader from where to read the JSON input, or @c nullptr if @ref mBufferLexer is used
 				///
 				ReaderPtr mReader;
 
 			private: // functions
 
+				///
+				/// Returns the next token from @ref mBufferLexer, or @c nullptr if no next token is available.
+				///
+				const JsonTokenPtr nextBufferToken();
+
 				///
 				/// Parses a token after all whitespace characters were consumed.
 				///
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/json/lexer/JsonTokenView.h"
+
+#include <cstring>
+
+using namespace util::json::lexer;
+
+JsonTokenView::JsonTokenView()
+	: JsonTokenView(JsonTokenType::LITERAL_NULL, nullptr, 0)
+{
+}
+
+JsonTokenView::JsonTokenView(const JsonTokenType tokenType, const char* data, size_t length)
+	: mTokenType(tokenType)
+	, mData(data)
+	, mLength(length)
+{
+}
+
+JsonTokenType JsonTokenView::getTokenType() const
+{
+	return mTokenType;
+}
+
+const char* JsonTokenView::getData() const
+{
+	return mData;
+}
+
+size_t JsonTokenView::getLength() const
+{
+	return mLength;
+}
+
+std::string JsonTokenView::getValue() const
+{
+	return mLength == 0 ? std::string() : std::string(mData, mLength);
+}
+
+bool JsonTokenView::valueEquals(const std::string& value) const
+{
+	return value.size() == mLength
+		&& (mLength == 0 || std::memcmp(value.data(), mData, mLength) == 0);
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _UTIL_JSON_LEXER_JSONTOKENVIEW_H
+#define _UTIL_JSON_LEXER_JSONTOKENVIEW_H
+
+#include "util/json/lexer/JsonTokenType.h"
+
+#include <cstddef>
+#include <string>
+
+namespace util
+{
+	namespace json
+	{
+		namespace lexer
+		{
+			///
+			/// Non-owning token as produced by the @ref JsonBufferLexer
+			///
+			/// @par
+			/// The token's value refers to the lexer's input buffer, or to the lexer's internal decoding buffer
+			/// if the string token contained escape sequences. Therefore the value is only valid until
+			/// the next token is requested from the lexer.
+			///
+			class JsonTokenView
+			{
+			public: // functions
+
+				///
+				/// Default constructor creating a token of type @ref JsonTokenType::LITERAL_NULL without value
+				///
+				JsonTokenView();
+
+				///
+				/// Constructor taking the token type and the token's value
+				///
+				/// @param tokenType the type of this token
+				/// @param data pointer to the first character of this token's value
+				/// @param length length of this token's value in bytes
+				///
+				JsonTokenView(const JsonTokenType tokenType, const char* data, size_t length);
+
+				///
+				/// Returns the type of this token
+				///
+				JsonTokenType getTokenType() const;
+
+				///
+				/// Returns a pointer to the first character of this token's value
+				///
+				/// @par
+				/// The value is not null terminated, use @ref getLength to obtain the value's length.
+				///
+				const char* getData() const;
+
+				///
+				/// Returns the length of this token's value in bytes
+				///
+				size_t getLength() const;
+
+				///
+				/// Returns a copy of this token's value
+				///
+				/// @par
+				/// this function is only relevant for number, boolean and string tokens
+				///
+				std::string getValue() const;
+
+				///
+				/// Tests if this token's value is equal to the given string
+				///
+				/// @param value the string to compare to
+				/// @return @c true if the value is equal, @c false otherwise
+				///
+				bool valueEquals(const std::string& value) const;
+
+			private: // members
+
+				///
+				/// the type of this token
+				///
+				JsonTokenType mTokenType;
+
+				///
+				/// pointer to the first character of the token value
+				///
+				const char* mData;
+
+				///
+				/// length of the token value in bytes
+				///
+				size_t mLength;
+			};
+		}
+	}
+}
+
+#endif //_UTIL_JSON_LEXER_JSONTOKENVIEW_H
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _UTIL_JSON_PARSER_IJSONEVENTHANDLER_H
+#define _UTIL_JSON_PARSER_IJSONEVENTHANDLER_H
+
+#include "util/json/lexer/JsonTokenView.h"
+
+namespace util
+{
+	namespace json
+	{
+		namespace parser
+		{
+			///
+			/// Handler receiving the events emitted by the @ref JsonEventParser
+			///
+			/// @par
+			/// Token views passed to the handler are only valid for the duration of the respective call.
+			///
+			class IJsonEventHandler
+			{
+			public:
+
+				///
+				/// Destructor
+				///
+				virtual ~IJsonEventHandler() = default;
+
+				///
+				/// Called when a JSON object is started
+				///
+				virtual void onObjectStart() = 0;
+
+				///
+				/// Called when a JSON object is finished
+				///
+				virtual void onObjectEnd() = 0;
+
+				///
+				/// Called when a JSON array is started
+				///
+				virtual void onArrayStart() = 0;
+
+				///
+				/// Called when a JSON array is finished
+				///
+				virtual void onArrayEnd() = 0;
+
+				///
+				/// Called for each key of a JSON object, before the key's value is reported
+				///
+				/// @param[in] key the decoded key
+				///
+				virtual void onKey(const util::json::lexer::JsonTokenView& key) = 0;
+
+				///
+				/// Called for a JSON string value
+				///
+				/// @param[in] value the decoded string
+				///
+				virtual void onString(const util::json::lexer::JsonTokenView& value) = 0;
+
+				///
+				/// Called for a JSON number value
+				///
+				/// @param[in] value the number literal as it appears in the input
+				///
+				virtual void onNumber(const util::json::lexer::JsonTokenView& value) = 0;
+
+				///
+				/// Called for a JSON boolean value
+				///
+				/// @param[in] value the boolean value
+				///
+				virtual void onBoolean(bool value) = 0;
+
+				///
+				/// Called for a JSON null value
+				///
+				virtual void onNull() = 0;
+			};
+		}
+	}
+}
+
+#endif //_UTIL_JSON_PARSER_IJSONEVENTHANDLER_H
@@ -45,13 +45,17 @@ set(OPENKIT_SOURCES_TEST_API
 )
 
 set(OPENKIT_SOURCES_TEST_CORE
+    ${CMAKE_CURRENT_LIST_DIR}/core/BeaconSendingSchedulerTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/UTF8StringTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/mock/MockIBeaconSender.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CompressorTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/DefaultLoggerTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidatorTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/MetricsRegistryTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ObjectPoolTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/StringUtilTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueueTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/TaskExecutorTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncodingTest.cxx
 )
 
@@ -62,6 +66,7 @@ set(OPENKIT_SOURCES_TEST_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/NullRootActionTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/NullSessionTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/NullWebRequestTracerTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitCompositeTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/OpenKitTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/RootActionTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/SessionTest.cxx
@@ -81,6 +86,7 @@ set(OPENKIT_SOURCES_TEST_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParserTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseParserTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseWriterTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParserTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributesDefaultsTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributesTest.cxx
@@ -123,19 +129,23 @@ set(OPENKIT_SOURCES_TEST_CORE_COMMUNICATION
 set(OPENKIT_SOURCES_TEST_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/BeaconConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/BeaconCacheConfigurationTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/FileResponseAttributesStoreTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/HTTPClientConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/OpenKitConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/PrivacyConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfigurationTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/SharedBeaconCacheConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIBeaconCacheConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIBeaconConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIHTTPClientConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIOpenKitConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIPrivacyConfiguration.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIResponseAttributesStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIServerConfiguration.h
 )
 
 set(OPENKIT_SOURCES_TEST_CORE_CACHING
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AttachedBeaconCacheEvictorTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEntryTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecordTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEvictorTest.cxx
@@ -148,7 +158,18 @@ set(OPENKIT_SOURCES_TEST_CORE_CACHING
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIObserver.h
 )
 
+set(OPENKIT_SOURCES_TEST_CORE_SIDECAR)
+if (NOT WIN32)
+    ## shared memory rings are only supported on POSIX systems
+    set(OPENKIT_SOURCES_TEST_CORE_SIDECAR
+        ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SharedMemoryRingTest.cxx
+        ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarAgentTest.cxx
+        ${CMAKE_CURRENT_LIST_DIR}/core/sidecar/SidecarBeaconCacheTest.cxx
+    )
+endif()
+
 set(OPENKIT_SOURCES_TEST_UTIL_JSON_LEXER
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonBufferLexerTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonTokenTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonLexerTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/MockJsonLexer.h
@@ -169,6 +190,7 @@ set(OPENKIT_SOURCES_TEST_UTIL_JSON_READER
 )
 
 set(OPENKIT_SOURCES_TEST_UTIL_JSON
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonEventParserTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonParserTest.cxx
 )
 
@@ -181,6 +203,7 @@ set(OPENKIT_SOURCES_UNITTEST
     ${OPENKIT_SOURCES_TEST_CORE_COMMUNICATION}
     ${OPENKIT_SOURCES_TEST_CORE_CONFIGURATION}
     ${OPENKIT_SOURCES_TEST_CORE_OBJECTS}
+    ${OPENKIT_SOURCES_TEST_CORE_SIDECAR}
     ${OPENKIT_SOURCES_TEST_PROTOCOL}
     ${OPENKIT_SOURCES_TEST_PROVIDERS}
     ${OPENKIT_SOURCES_TEST_UTIL_JSON_LEXER}
@@ -256,6 +279,7 @@ function(build_open_kit_tests)
     source_group("Source Files\\Core\\Caching" FILES ${OPENKIT_SOURCES_TEST_CORE_CACHING})
     source_group("Source Files\\Core\\Communication" FILES ${OPENKIT_SOURCES_TEST_CORE_COMMUNICATION})
     source_group("Source Files\\Core\\Configuration" FILES ${OPENKIT_SOURCES_TEST_CORE_CONFIGURATION})
+    source_group("Source Files\\Core\\Sidecar" FILES ${OPENKIT_SOURCES_TEST_CORE_SIDECAR})
     source_group("Source Files\\Protocol" FILES ${OPENKIT_SOURCES_TEST_PROTOCOL})
     source_group("Source Files\\Providers" FILES ${OPENKIT_SOURCES_TEST_PROVIDERS})
 
@@ -586,3 +586,146 @@ TEST_F(AbstractOpenKitBuilderTest, getCrashReportingLevelReturnsChangedCrashRepo
 	ASSERT_THAT(obtained, testing::Eq(crashReportingLevel));
 }
 
+TEST_F(AbstractOpenKitBuilderTest, deferredSerializationIsDisabledByDefault)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	auto obtained = target.isDeferredSerializationEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, enableDeferredSerializationEnablesDeferredSerialization)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	target.enableDeferredSerialization();
+	auto obtained = target.isDeferredSerializationEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, statisticsAreDisabledByDefault)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	auto obtained = target.isStatisticsEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, enableStatisticsEnablesStatistics)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	target.enableStatistics();
+	auto obtained = target.isStatisticsEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, defaultServerConfigurationFileIsEmpty)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	auto obtained = target.getServerConfigurationFile();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsEmpty());
+}
+
+TEST_F(AbstractOpenKitBuilderTest, withServerConfigurationFileSetsTheFile)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	target.withServerConfigurationFile("openkit-server-config.json");
+	auto obtained = target.getServerConfigurationFile();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq("openkit-server-config.json"));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, withServerConfigurationFileIgnoresNullAndEmptyPaths)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+	target.withServerConfigurationFile("openkit-server-config.json");
+
+	// when
+	target.withServerConfigurationFile(nullptr);
+	target.withServerConfigurationFile("");
+	auto obtained = target.getServerConfigurationFile();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq("openkit-server-config.json"));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, defaultSidecarDirectoryIsEmpty)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	auto obtained = target.getSidecarDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsEmpty());
+}
+
+TEST_F(AbstractOpenKitBuilderTest, withSidecarDirectoryIgnoresNullAndEmptyPaths)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+	target.withSidecarDirectory("/dev/shm");
+
+	// when
+	target.withSidecarDirectory(nullptr);
+	target.withSidecarDirectory("");
+	auto obtained = target.getSidecarDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq("/dev/shm"));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, defaultSidecarRingCapacity)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+
+	// when
+	auto obtained = target.getSidecarRingCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_SIDECAR_RING_CAPACITY_IN_BYTES));
+}
+
+TEST_F(AbstractOpenKitBuilderTest, withSidecarRingCapacityIgnoresNonPositiveValues)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, DEVICE_ID);
+	target.withSidecarRingCapacity(64 * 1024);
+
+	// when
+	target.withSidecarRingCapacity(0);
+	target.withSidecarRingCapacity(-1);
+	auto obtained = target.getSidecarRingCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(64 * 1024)));
+}
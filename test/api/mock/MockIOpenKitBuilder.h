@@ -46,6 +46,8 @@ namespace test
 			ON_CALL(*this, getEndpointURL()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 			ON_CALL(*this, getOrigDeviceID()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 			ON_CALL(*this, getTrustManager()).WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getServerConfigurationFile()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
+			ON_CALL(*this, getSidecarDirectory()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 
 			ON_CALL(*this, getDataCollectionLevel())
 				.WillByDefault(testing::Return(core::configuration::DEFAULT_DATA_COLLECTION_LEVEL));
@@ -56,6 +58,8 @@ namespace test
 				.WillByDefault(testing::Return(openkit::LogLevel::LOG_LEVEL_WARN));
 			ON_CALL(*this, getLogger())
 				.WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getSharedRuntime())
+				.WillByDefault(testing::Return(nullptr));
 		}
 
 		~MockIOpenKitBuilder() override = default;
@@ -104,9 +108,21 @@ namespace test
 
 		MOCK_CONST_METHOD0(getCrashReportingLevel, openkit::CrashReportingLevel());
 
+		MOCK_CONST_METHOD0(isDeferredSerializationEnabled, bool());
+
+		MOCK_CONST_METHOD0(isStatisticsEnabled, bool());
+
+		MOCK_CONST_METHOD0(getServerConfigurationFile, const std::string&());
+
 		MOCK_CONST_METHOD0(getLogLevel, openkit::LogLevel());
 
 		MOCK_CONST_METHOD0(getLogger, std::shared_ptr<openkit::ILogger>());
+
+		MOCK_CONST_METHOD0(getSharedRuntime, std::shared_ptr<openkit::IOpenKitRuntime>());
+
+		MOCK_CONST_METHOD0(getSidecarDirectory, const std::string&());
+
+		MOCK_CONST_METHOD0(getSidecarRingCapacity, int64_t());
 	};
 }
 
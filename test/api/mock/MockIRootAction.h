@@ -91,6 +91,146 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD2(enterAction,
+			std::shared_ptr<openkit::IAction>(
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD2(reportEvent,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD3(reportValue,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*,
+				size_t,
+				int32_t
+			)
+		);
+
+		MOCK_METHOD3(reportValue,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*,
+				size_t,
+				double
+			)
+		);
+
+		MOCK_METHOD4(reportValue,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*,
+				size_t,
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD5(reportError,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*,
+				size_t,
+				int32_t,
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD1(reportEventRef,
+			openkit::IRootAction&(
+				const char*
+			)
+		);
+
+		MOCK_METHOD2(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				int32_t
+			)
+		);
+
+		MOCK_METHOD2(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				double
+			)
+		);
+
+		MOCK_METHOD2(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				const char*
+			)
+		);
+
+		MOCK_METHOD3(reportErrorRef,
+			openkit::IRootAction&(
+				const char*,
+				int32_t,
+				const char*
+			)
+		);
+
+		MOCK_METHOD2(reportEventRef,
+			openkit::IRootAction&(
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD3(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				size_t,
+				int32_t
+			)
+		);
+
+		MOCK_METHOD3(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				size_t,
+				double
+			)
+		);
+
+		MOCK_METHOD4(reportValueRef,
+			openkit::IRootAction&(
+				const char*,
+				size_t,
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD5(reportErrorRef,
+			openkit::IRootAction&(
+				const char*,
+				size_t,
+				int32_t,
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD2(reportEvents,
+			void(
+				const openkit::EventDescriptor*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD2(traceWebRequest,
+			std::shared_ptr<openkit::IWebRequestTracer>(
+				const char*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD0(leaveAction, void());
 	};
 }
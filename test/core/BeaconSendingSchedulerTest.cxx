@@ -0,0 +1,258 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "../api/mock/MockILogger.h"
+#include "communication/mock/MockIBeaconSendingContext.h"
+
+#include "core/BeaconSendingScheduler.h"
+#include "core/util/TaskExecutor.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+using namespace test;
+
+using BeaconSendingScheduler_t = core::BeaconSendingScheduler;
+using MockNiceIBeaconSendingContext_sp = std::shared_ptr<testing::NiceMock<MockIBeaconSendingContext>>;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using TaskExecutor_t = core::util::TaskExecutor;
+using TaskExecutor_sp = std::shared_ptr<TaskExecutor_t>;
+
+class BeaconSendingSchedulerTest : public testing::Test
+{
+protected:
+
+	MockNiceILogger_sp mockLogger;
+	MockNiceIBeaconSendingContext_sp mockContext;
+	TaskExecutor_sp executor;
+	std::atomic<bool> isTerminated;
+
+	void SetUp() override
+	{
+		mockLogger = MockILogger::createNice();
+		executor = std::make_shared<TaskExecutor_t>(1);
+		mockContext = MockIBeaconSendingContext::createNice();
+		isTerminated = false;
+
+		ON_CALL(*mockContext, isInTerminalState())
+			.WillByDefault(testing::Invoke([this]() -> bool { return isTerminated; }));
+	}
+};
+
+TEST_F(BeaconSendingSchedulerTest, contextInTerminalStateIsRemovedAndCompletesFuture)
+{
+	// with
+	isTerminated = true;
+	ON_CALL(*mockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockContext, prepareCurrentState())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(obtained.get(), testing::Eq(true));
+	ASSERT_THAT(target.getNumberOfScheduledContexts(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconSendingSchedulerTest, scheduleHandsTheExecutorToTheContext)
+{
+	// with
+	isTerminated = true;
+
+	// expect
+	EXPECT_CALL(*mockContext, setTaskExecutor(executor.get()))
+		.Times(testing::Exactly(1));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(BeaconSendingSchedulerTest, preparedStateWithoutDelayIsExecutedImmediately)
+{
+	// expect
+	EXPECT_CALL(*mockContext, prepareCurrentState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(int64_t(0)));
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([this]() { isTerminated = true; }));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(obtained.get(), testing::Eq(false));
+}
+
+TEST_F(BeaconSendingSchedulerTest, wakeUpExecutesPreparedStateBeforeDelayElapsed)
+{
+	// with
+	std::promise<void> prepared;
+
+	// expect
+	EXPECT_CALL(*mockContext, prepareCurrentState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([&prepared]() -> int64_t {
+			prepared.set_value();
+			return int64_t(60 * 60 * 1000);
+		}));
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([this]() { isTerminated = true; }));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+	auto obtained = target.schedule(mockContext);
+	prepared.get_future().wait();
+
+	// when
+	target.wakeUp(mockContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(BeaconSendingSchedulerTest, preparedStateIsExecutedIfShutdownWasRequestedDuringPreparation)
+{
+	// with
+	ON_CALL(*mockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockContext, prepareCurrentState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(int64_t(60 * 60 * 1000)));
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([this]() { isTerminated = true; }));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(obtained.get(), testing::Eq(true));
+}
+
+TEST_F(BeaconSendingSchedulerTest, preparedStateIsExecutedAfterDelay)
+{
+	// with
+	std::promise<void> prepared;
+
+	// expect
+	EXPECT_CALL(*mockContext, prepareCurrentState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([&prepared]() -> int64_t {
+			prepared.set_value();
+			return int64_t(50);
+		}));
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([this]() { isTerminated = true; }));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+	prepared.get_future().wait();
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(BeaconSendingSchedulerTest, severalContextsAreExecutedOnTheSameExecutor)
+{
+	// with
+	auto otherContext = MockIBeaconSendingContext::createNice();
+	std::atomic<bool> isOtherTerminated(false);
+	ON_CALL(*otherContext, isInTerminalState())
+		.WillByDefault(testing::Invoke([&isOtherTerminated]() -> bool { return isOtherTerminated; }));
+
+	// expect
+	EXPECT_CALL(*mockContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([this]() { isTerminated = true; }));
+	EXPECT_CALL(*otherContext, executePreparedState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([&isOtherTerminated]() { isOtherTerminated = true; }));
+
+	// given
+	BeaconSendingScheduler_t target(mockLogger, executor);
+
+	// when
+	auto obtained = target.schedule(mockContext);
+	auto otherObtained = target.schedule(otherContext);
+
+	// then
+	ASSERT_THAT(obtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(otherObtained.wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(target.getNumberOfScheduledContexts(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconSendingSchedulerTest, destructorRequestsShutdownOfScheduledContexts)
+{
+	// with
+	std::promise<void> prepared;
+	ON_CALL(*mockContext, prepareCurrentState())
+		.WillByDefault(testing::Invoke([&prepared]() -> int64_t {
+			prepared.set_value();
+			return int64_t(60 * 60 * 1000);
+		}));
+
+	// expect
+	EXPECT_CALL(*mockContext, requestShutdown())
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = std::make_shared<BeaconSendingScheduler_t>(mockLogger, executor);
+	target->schedule(mockContext);
+	prepared.get_future().wait();
+
+	// when
+	target = nullptr;
+
+	// then
+	ASSERT_THAT(executor->getNumberOfPendingTasks(), testing::Eq(size_t(0)));
+}
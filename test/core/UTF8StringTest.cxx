@@ -363,6 +363,83 @@ TEST_F(UTF8StringTest, aStringWillNotBeConstructedUsingANullPointer)
 	EXPECT_EQ(s2.getStringLength(), 0);
 }
 
+TEST_F(UTF8StringTest, aStringCanBeInitializedWithAGivenNumberOfASCIIBytes)
+{
+	Utf8String_t s("test123 - ignored", 7);
+
+	EXPECT_EQ(s.getStringData(), "test123");
+	EXPECT_EQ(s.getStringLength(), 7);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesReplacesInvalidUTF8)
+{
+	// the first 2 byte character is broken by the ASCII character
+	Utf8String_t s("\xD7y\xD7\xAA - ignored", 4);
+
+	EXPECT_EQ(s.getStringData(), "\xEF\xBF\xBDy\xD7\xAA");
+	EXPECT_EQ(s.getStringLength(), 3);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesKeepsNullCharacter)
+{
+	Utf8String_t s("test\0" "123", 7);
+
+	EXPECT_EQ(s.getStringData(), std::string("test\0" "123", 7));
+	EXPECT_EQ(s.getStringLength(), 7);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesKeepsModifiedUtf8Terminator)
+{
+	Utf8String_t s("\xD7\xAA\xC0\x80\xD7\x94", 6);
+
+	EXPECT_EQ(s.getStringData(), "\xD7\xAA\xC0\x80\xD7\x94");
+	EXPECT_EQ(s.getStringLength(), 3);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfASCIIBytesKeepsModifiedUtf8Terminator)
+{
+	Utf8String_t s("Hello\xC0\x80 World", 13);
+
+	EXPECT_EQ(s.getStringData(), "Hello\xC0\x80 World");
+	EXPECT_EQ(s.getStringLength(), 12);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesUsesSliceOfLargerBuffer)
+{
+	const char* data = "first\0second\0third";
+
+	Utf8String_t s(data + 6, 6);
+
+	EXPECT_EQ(s.getStringData(), "second");
+	EXPECT_EQ(s.getStringLength(), 6);
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesEqualsTerminatedStringForPartialModifiedUtf8Terminator)
+{
+	const char* data = "Hello\xC0\x81";
+
+	Utf8String_t s(data, 7);
+
+	EXPECT_EQ(s.getStringData(), Utf8String_t(data).getStringData());
+	EXPECT_EQ(s.getStringLength(), Utf8String_t(data).getStringLength());
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesDoesNotLookBeyondTheLengthForTheModifiedUtf8Terminator)
+{
+	Utf8String_t s("Hello\xC0\x80", 6);
+
+	EXPECT_EQ(s.getStringData(), Utf8String_t("Hello\xC0").getStringData());
+	EXPECT_EQ(s.getStringLength(), Utf8String_t("Hello\xC0").getStringLength());
+}
+
+TEST_F(UTF8StringTest, aStringInitializedWithAGivenNumberOfBytesIsEmptyForNullPointer)
+{
+	Utf8String_t s(nullptr, 7);
+
+	EXPECT_TRUE(s.empty());
+	EXPECT_EQ(s.getStringData(), "");
+}
+
 TEST_F(UTF8StringTest, aStringCanBeSearchedForASCIICharacters)
 {
 	Utf8String_t s("abc\xD7\xAA\x78\xF0\x9F\x98\x8B\x64\xEA\xA6\x85xyz");
@@ -739,6 +816,34 @@ TEST_F(UTF8StringTest, concatenateWithEmptyString)
 	EXPECT_EQ(stringData.size(), 7);
 }
 
+TEST_F(UTF8StringTest, concatenateWithLengthAppendsGivenNumberOfASCIIBytes)
+{
+	Utf8String_t s("part 1 -");
+	s.concatenate("part 2 - ignored", 6);
+
+	EXPECT_EQ(s.getStringData(), "part 1 -part 2");
+	EXPECT_EQ(s.getStringLength(), 14);
+}
+
+TEST_F(UTF8StringTest, concatenateWithLengthValidatesMultiByteCharacters)
+{
+	Utf8String_t s("\xE2\x82\xAC");
+	s.concatenate("\xC3\xA4\xE2\x82\xAC", 2);
+
+	EXPECT_EQ(s.getStringData(), "\xE2\x82\xAC\xC3\xA4");
+	EXPECT_EQ(s.getStringLength(), 2);
+}
+
+TEST_F(UTF8StringTest, reserveDoesNotChangeTheString)
+{
+	Utf8String_t s("test123");
+	s.reserve(64);
+
+	EXPECT_EQ(s.getStringData(), "test123");
+	EXPECT_EQ(s.getStringLength(), 7);
+	EXPECT_GE(s.getStringData().capacity(), 64);
+}
+
 TEST_F(UTF8StringTest, emptyString)
 {
 	Utf8String_t s("");
@@ -0,0 +1,180 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "mock/MockIBeaconCache.h"
+#include "mock/MockIBeaconCacheEvictionStrategy.h"
+#include "../configuration/mock/MockIBeaconCacheConfiguration.h"
+#include "../../api/mock/MockILogger.h"
+
+#include "core/caching/AttachedBeaconCacheEvictor.h"
+#include "core/caching/IObserver.h"
+#include "core/caching/SharedBeaconCacheEvictor.h"
+#include "core/util/CountDownLatch.h"
+#include "core/util/TaskExecutor.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <vector>
+
+using namespace test;
+
+using AttachedBeaconCacheEvictor_t = core::caching::AttachedBeaconCacheEvictor;
+using CountDownLatch_t = core::util::CountDownLatch;
+using IObserver_t = core::caching::IObserver;
+using MockNiceIBeaconCache_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCache>>;
+using MockNiceIBeaconCacheEvictionStrategy_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCacheEvictionStrategy>>;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using SharedBeaconCacheEvictor_t = core::caching::SharedBeaconCacheEvictor;
+using SharedBeaconCacheEvictor_sp = std::shared_ptr<SharedBeaconCacheEvictor_t>;
+
+class AttachedBeaconCacheEvictorTest : public testing::Test
+{
+protected:
+
+	MockNiceILogger_sp mockLogger;
+	MockNiceIBeaconCache_sp mockBeaconCache;
+	MockNiceIBeaconCacheEvictionStrategy_sp mockStrategy;
+	SharedBeaconCacheEvictor_sp sharedEvictor;
+
+	void SetUp() override
+	{
+		mockLogger = MockILogger::createNice();
+		mockBeaconCache = MockIBeaconCache::createNice();
+		mockStrategy = MockIBeaconCacheEvictionStrategy::createNice();
+		sharedEvictor = std::make_shared<SharedBeaconCacheEvictor_t>(
+			mockLogger,
+			MockIBeaconCacheConfiguration::createNice(),
+			std::make_shared<core::util::TaskExecutor>(1)
+		);
+	}
+
+	std::shared_ptr<AttachedBeaconCacheEvictor_t> createEvictor()
+	{
+		return std::make_shared<AttachedBeaconCacheEvictor_t>(mockBeaconCache, std::vector<std::shared_ptr<core::caching::IBeaconCacheEvictionStrategy>>{ mockStrategy }, sharedEvictor);
+	}
+};
+
+TEST_F(AttachedBeaconCacheEvictorTest, aNotStartedEvictorIsNotAlive)
+{
+	// given
+	auto target = createEvictor();
+
+	// then
+	ASSERT_FALSE(target->isAlive());
+	ASSERT_THAT(sharedEvictor->getNumberOfAttachedEvictors(), testing::Eq(int64_t(0)));
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, startingAttachesEvictorToSharedEvictor)
+{
+	// given
+	auto target = createEvictor();
+
+	// when
+	auto obtained = target->start();
+
+	// then
+	ASSERT_TRUE(obtained);
+	ASSERT_TRUE(target->isAlive());
+	ASSERT_THAT(sharedEvictor->getNumberOfAttachedEvictors(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, startingAnAlreadyStartedEvictorFails)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addObserver(testing::_))
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = createEvictor();
+	target->start();
+
+	// when
+	auto obtained = target->start();
+
+	// then
+	ASSERT_FALSE(obtained);
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, stoppingDetachesEvictorFromSharedEvictor)
+{
+	// given
+	auto targetOne = createEvictor();
+	auto targetTwo = createEvictor();
+	targetOne->start();
+	targetTwo->start();
+
+	// when
+	auto obtained = targetOne->stop();
+
+	// then
+	ASSERT_TRUE(obtained);
+	ASSERT_FALSE(targetOne->isAlive());
+	ASSERT_TRUE(targetTwo->isAlive());
+	ASSERT_THAT(sharedEvictor->getNumberOfAttachedEvictors(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, stoppingANotStartedEvictorFails)
+{
+	// given
+	auto target = createEvictor();
+
+	// when
+	auto obtained = target->stop();
+
+	// then
+	ASSERT_FALSE(obtained);
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, destroyingAnEvictorDetachesIt)
+{
+	// given
+	auto target = createEvictor();
+	target->start();
+
+	// when
+	target = nullptr;
+
+	// then
+	ASSERT_THAT(sharedEvictor->getNumberOfAttachedEvictors(), testing::Eq(int64_t(0)));
+}
+
+TEST_F(AttachedBeaconCacheEvictorTest, addedRecordExecutesStrategiesOnSharedThread)
+{
+	// with
+	IObserver_t* observer = nullptr;
+	ON_CALL(*mockBeaconCache, addObserver(testing::_))
+		.WillByDefault(testing::SaveArg<0>(&observer));
+	CountDownLatch_t latch(1);
+
+	// expect
+	EXPECT_CALL(*mockStrategy, execute())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([&latch]() { latch.countDown(); }));
+
+	// given
+	auto target = createEvictor();
+	target->start();
+	ASSERT_THAT(observer, testing::NotNull());
+
+	// when
+	observer->update();
+	latch.await();
+
+	// then
+	target->stop();
+}
@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 
 #include <cstring>
+#include <vector>
 
 using BeaconCacheEntry_t = core::caching::BeaconCacheEntry;
 using BeaconCacheRecord_t = core::caching::BeaconCacheRecord;
@@ -324,7 +325,7 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsChunksFromEventDataBeforeActionData)
 	ASSERT_TRUE(obtained5.equals(""));
 }
 
-TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
+TEST_F(BeaconCacheEntryTest, getChunkDoesNotGetAlreadyMarkedDataAgain)
 {
 	// given
 	BeaconCacheRecord_t dataOne(0L, "One");
@@ -345,6 +346,12 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
 
 	// then
 	ASSERT_TRUE(obtained.equals("a&One&Four&Two&Three"));
+
+	// when getting data to send once more
+	auto obtained2 = target.getChunk("a", 100, "&");
+
+	// then nothing is returned, since all data is part of the previous chunk
+	ASSERT_TRUE(obtained2.empty());
 	auto eventDataBeingSent = target.getEventDataBeingSent();
 	auto actionDataBeingSent = target.getActionDataBeingSent();
 	ASSERT_EQ(eventDataBeingSent.size(), 2);
@@ -361,28 +368,182 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
 	it++;
 	ASSERT_TRUE(it->getData().equals("Three"));
 	ASSERT_TRUE(it->isMarkedForSending());
+}
 
-	// when getting data to send once more
-	auto obtained2 = target.getChunk("a", 100, "&");
+TEST_F(BeaconCacheEntryTest, getChunkContinuesAfterPreviouslyRetrievedChunk)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+	BeaconCacheRecord_t dataThree(1L, "Three");
+	BeaconCacheRecord_t dataFour(1L, "Four");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataFour);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	target.copyDataForChunking();
+
+	// when retrieving two chunks without removing the first one
+	auto obtained = target.getChunk("a", std::strlen("a&Two&Three"), "&");
+	auto obtained2 = target.getChunk("a", std::strlen("a&Two&Three"), "&");
+
+	// then the second chunk continues with the action data
+	ASSERT_TRUE(obtained.equals("a&One&Four"));
+	ASSERT_TRUE(obtained2.equals("a&Two&Three"));
+}
+
+TEST_F(BeaconCacheEntryTest, hasMoreChunksReturnsWhetherRecordsFollowTheLastRetrievedChunk)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addActionData(dataTwo);
+
+	target.copyDataForChunking();
+
+	// then all data remains before retrieving a chunk
+	ASSERT_TRUE(target.hasMoreChunks());
+
+	// and when retrieving the first record
+	target.getChunk("a", std::strlen("a&One"), "&");
+
+	// then the second record remains
+	ASSERT_TRUE(target.hasMoreChunks());
+
+	// and when retrieving the second record
+	target.getChunk("a", std::strlen("a&Two"), "&");
+
+	// then all data is part of a retrieved chunk
+	ASSERT_FALSE(target.hasMoreChunks());
+
+	// and when removing the oldest chunk
+	target.removeDataMarkedForSending();
+
+	// then still nothing remains
+	ASSERT_FALSE(target.hasMoreChunks());
+}
+
+TEST_F(BeaconCacheEntryTest, removeDataMarkedForSendingRemovesOldestChunkOnly)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+	BeaconCacheRecord_t dataThree(1L, "Three");
+	BeaconCacheRecord_t dataFour(1L, "Four");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataFour);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	target.copyDataForChunking();
+	target.getChunk("a", std::strlen("a&One&Four&Two"), "&");
+	target.getChunk("a", std::strlen("a&One&Four&Two"), "&");
+
+	// when
+	target.removeDataMarkedForSending();
+
+	// then only the records of the second chunk are left
+	ASSERT_TRUE(target.getEventDataBeingSent().empty());
+	auto actionDataBeingSent = target.getActionDataBeingSent();
+	ASSERT_EQ(actionDataBeingSent.size(), 1);
+	ASSERT_TRUE(actionDataBeingSent.begin()->getData().equals("Three"));
+	ASSERT_TRUE(actionDataBeingSent.begin()->isMarkedForSending());
+
+	// and when removing the second chunk
+	target.removeDataMarkedForSending();
 
 	// then
-	ASSERT_TRUE(obtained2.equals("a&One&Four&Two&Three"));
-	auto eventDataBeingSent2 = target.getEventDataBeingSent();
-	auto actionDataBeingSent2 = target.getActionDataBeingSent();
-	ASSERT_EQ(eventDataBeingSent2.size(), 2);
-	it = eventDataBeingSent2.begin();
-	ASSERT_TRUE(it->getData().equals("One"));
-	ASSERT_TRUE(it->isMarkedForSending());
-	it++;
-	ASSERT_TRUE(it->getData().equals("Four"));
-	ASSERT_TRUE(it->isMarkedForSending());
-	ASSERT_EQ(actionDataBeingSent2.size(), 2);
-	it = actionDataBeingSent2.begin();
+	ASSERT_TRUE(target.getEventDataBeingSent().empty());
+	ASSERT_TRUE(target.getActionDataBeingSent().empty());
+}
+
+TEST_F(BeaconCacheEntryTest, removeDataMarkedForSendingKeepsRecordsNotBeingPartOfAChunk)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+	BeaconCacheRecord_t dataThree(1L, "Three");
+	BeaconCacheRecord_t dataFour(1L, "Four");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataFour);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	target.copyDataForChunking();
+	target.getChunk("a", 1, "&");
+
+	// when
+	target.removeDataMarkedForSending();
+
+	// then
+	auto eventDataBeingSent = target.getEventDataBeingSent();
+	ASSERT_EQ(eventDataBeingSent.size(), 1);
+	ASSERT_TRUE(eventDataBeingSent.begin()->getData().equals("Four"));
+	ASSERT_FALSE(eventDataBeingSent.begin()->isMarkedForSending());
+	ASSERT_EQ(target.getActionDataBeingSent().size(), 2);
+
+	// and when removing again without retrieving a chunk
+	target.removeDataMarkedForSending();
+
+	// then nothing is removed
+	ASSERT_EQ(target.getEventDataBeingSent().size(), 1);
+	ASSERT_EQ(target.getActionDataBeingSent().size(), 2);
+}
+
+TEST_F(BeaconCacheEntryTest, resetDataMarkedForSendingRestoresAllRetrievedChunks)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+	BeaconCacheRecord_t dataThree(1L, "Three");
+	BeaconCacheRecord_t dataFour(1L, "Four");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataFour);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	target.copyDataForChunking();
+	target.getChunk("a", 1, "&");
+	target.removeDataMarkedForSending();
+	target.getChunk("a", 1, "&");
+	target.getChunk("a", 1, "&");
+
+	// when
+	target.resetDataMarkedForSending();
+
+	// then all records which were not removed are restored
+	auto eventData = target.getEventData();
+	auto actionData = target.getActionData();
+	ASSERT_EQ(eventData.size(), 1);
+	ASSERT_TRUE(eventData.begin()->getData().equals("Four"));
+	ASSERT_FALSE(eventData.begin()->isMarkedForSending());
+	ASSERT_EQ(actionData.size(), 2);
+	auto it = actionData.begin();
 	ASSERT_TRUE(it->getData().equals("Two"));
-	ASSERT_TRUE(it->isMarkedForSending());
+	ASSERT_FALSE(it->isMarkedForSending());
 	it++;
 	ASSERT_TRUE(it->getData().equals("Three"));
-	ASSERT_TRUE(it->isMarkedForSending());
+	ASSERT_FALSE(it->isMarkedForSending());
+	ASSERT_EQ(target.getTotalNumberOfBytes(), dataTwo.getDataSizeInBytes() + dataThree.getDataSizeInBytes() + dataFour.getDataSizeInBytes());
+
+	// and when chunking again
+	target.copyDataForChunking();
+	auto obtained = target.getChunk("a", 100, "&");
+
+	// then
+	ASSERT_TRUE(obtained.equals("a&Four&Two&Three"));
 }
 
 TEST_F(BeaconCacheEntryTest, getChunksTakesSizeIntoAccount)
@@ -404,20 +565,128 @@ TEST_F(BeaconCacheEntryTest, getChunksTakesSizeIntoAccount)
 	// when requesting first chunk
 	auto obtained = target.getChunk("prefix", 1, "&");
 
-	// then only prefix is returned, since "prefix".length > maxSize (=1)
-	ASSERT_TRUE(obtained.equals("prefix"));
+	// then the first record is returned anyway, since "prefix".length > maxSize (=1)
+	ASSERT_TRUE(obtained.equals("prefix&One"));
+
+	// and when retrieving something which is one byte too short for the next two records
+	target.removeDataMarkedForSending();
+	auto obtained2 = target.getChunk("prefix", std::strlen("prefix&Four&Tw"), "&");
+
+	// then only the next record is returned
+	ASSERT_TRUE(obtained2.equals("prefix&Four"));
+
+	// and when retrieving a chunk which exactly fits the next two records
+	target.removeDataMarkedForSending();
+	auto obtained3 = target.getChunk("prefix", std::strlen("prefix&Two&Three"), "&");
+
+	// then
+	ASSERT_TRUE(obtained3.equals("prefix&Two&Three"));
+}
+
+TEST_F(BeaconCacheEntryTest, getChunkDoesNotAddActionDataIfEventDataDoesNotFit)
+{
+	// given
+	BeaconCacheRecord_t dataOne(0L, "One");
+	BeaconCacheRecord_t dataTwo(0L, "Two");
+	BeaconCacheRecord_t dataThree(1L, "Three");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataThree);
+	target.addActionData(dataTwo);
+
+	target.copyDataForChunking();
+
+	// when the second event does not fit, but the action would
+	auto obtained = target.getChunk("a", std::strlen("a&One&Two"), "&");
+
+	// then event data is still sent first
+	ASSERT_TRUE(obtained.equals("a&One"));
+	auto actionDataBeingSent = target.getActionDataBeingSent();
+	ASSERT_EQ(actionDataBeingSent.size(), 1);
+	ASSERT_FALSE(actionDataBeingSent.begin()->isMarkedForSending());
+}
+
+TEST_F(BeaconCacheEntryTest, getChunkMeasuresSizeInBytesForMultiByteData)
+{
+	// given
+	const char* multiByteData = "\xC3\xA4\xC3\xB6\xC3\xBC"; // 3 characters, 6 bytes
+	BeaconCacheRecord_t dataOne(0L, multiByteData);
+	BeaconCacheRecord_t dataTwo(1L, multiByteData);
 
-	// and when retrieving something which is one character longer than "prefix"
-	auto obtained2 = target.getChunk("prefix", std::strlen("prefix"), "&");
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addEventData(dataTwo);
 
-	// then only prefix is returned, since "prefix".length > maxSize (=1)
-	ASSERT_TRUE(obtained2.equals("prefix&One"));
+	target.copyDataForChunking();
 
-	// and when retrieving another chunk
-	auto obtained3 = target.getChunk("prefix", std::strlen("prefix&One"), "&");
+	// when the second record fits in characters, but is one byte too large
+	auto maxSize = std::strlen("a&") + 2 * std::strlen(multiByteData);
+	auto obtained = target.getChunk("a", maxSize, "&");
 
 	// then
-	ASSERT_TRUE(obtained3.equals("prefix&One&Four"));
+	Utf8String_t expected("a&");
+	expected.concatenate(multiByteData);
+	ASSERT_TRUE(obtained.equals(expected));
+
+	// and when the chunk size is exactly large enough for both records
+	target.resetDataMarkedForSending();
+	target.copyDataForChunking();
+	auto obtained2 = target.getChunk("a", maxSize + 1, "&");
+
+	// then
+	expected.concatenate("&");
+	expected.concatenate(multiByteData);
+	ASSERT_TRUE(obtained2.equals(expected));
+}
+
+TEST_F(BeaconCacheEntryTest, getChunkNeverExceedsMaxSizeInBytesForMultiByteData)
+{
+	// given
+	const size_t maxSize = 100;
+	const char* records[] = { "\xE2\x82\xAC", "\xF0\x9F\x98\x80\xF0\x9F\x98\x80", "a\xC3\xA4", "\xE6\x97\xA5\xE6\x9C\xAC" };
+
+	BeaconCacheEntry_t target;
+	for (int32_t i = 0; i < 100; i++)
+	{
+		target.addEventData(BeaconCacheRecord_t(i, records[i % 4]));
+		target.addActionData(BeaconCacheRecord_t(i, records[(i + 1) % 4]));
+	}
+
+	target.copyDataForChunking();
+
+	// when retrieving all chunks
+	std::vector<size_t> chunkSizes;
+	auto obtained = target.getChunk("prefix", maxSize, "&");
+	while (!obtained.empty())
+	{
+		chunkSizes.push_back(obtained.getStringData().size());
+
+		target.removeDataMarkedForSending();
+		obtained = target.getChunk("prefix", maxSize, "&");
+	}
+
+	// then no chunk exceeds the maximum size
+	size_t totalSizeInBytes = 0;
+	for (auto chunkSize : chunkSizes)
+	{
+		ASSERT_LE(chunkSize, maxSize);
+		totalSizeInBytes += chunkSize - std::strlen("prefix");
+	}
+
+	// and all chunks except the last one are filled up, so that not even the largest record would fit any more
+	for (size_t i = 0; i + 1 < chunkSizes.size(); i++)
+	{
+		ASSERT_GT(chunkSizes[i] + std::strlen("&") + std::strlen(records[1]), maxSize);
+	}
+
+	// and all data has been sent
+	size_t expectedSizeInBytes = 0;
+	for (auto record : records)
+	{
+		expectedSizeInBytes += 50 * (std::strlen("&") + std::strlen(record));
+	}
+	ASSERT_EQ(totalSizeInBytes, expectedSizeInBytes);
 }
 
 TEST_F(BeaconCacheEntryTest, removeDataMarkedForSendingReturnsIfDataHasNotBeenCopied)
@@ -229,3 +229,47 @@ TEST_F(BeaconCacheEvictorTest, triggeringEvictionStrategiesInThread)
 	ASSERT_TRUE(stopped);
 	ASSERT_FALSE(evictor.isAlive());
 }
+
+TEST_F(BeaconCacheEvictorTest, updatesWhileEvictingTriggerOnlyOneMoreEviction)
+{
+	// with
+	CountDownLatch_t firstEvictionStartedLatch(1);
+	CountDownLatch_t continueFirstEvictionLatch(1);
+	CountDownLatch_t secondEvictionStartedLatch(1);
+	int32_t numberOfEvictions = 0;
+
+	ON_CALL(*mockStrategyOne, execute())
+		.WillByDefault(testing::Invoke(
+			[&]() -> void
+			{
+				numberOfEvictions++;
+				if (numberOfEvictions == 1)
+				{
+					firstEvictionStartedLatch.countDown();
+					continueFirstEvictionLatch.await();
+				}
+				else
+				{
+					secondEvictionStartedLatch.countDown();
+				}
+			}
+		));
+
+	// given
+	BeaconCacheEvictor_t target(mockLogger, mockBeaconCache, { mockStrategyOne });
+	target.start();
+
+	// when
+	target.update();
+	firstEvictionStartedLatch.await();
+	for (int i = 0; i < 5; i++)
+	{
+		target.update();
+	}
+	continueFirstEvictionLatch.countDown();
+	secondEvictionStartedLatch.await();
+	target.stopAndJoin();
+
+	// then
+	ASSERT_THAT(numberOfEvictions, testing::Eq(2));
+}
@@ -20,6 +20,7 @@
 #include "core/UTF8String.h"
 #include "core/caching/BeaconCache.h"
 #include "core/caching/BeaconCacheRecord.h"
+#include "core/util/MetricsRegistry.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -33,6 +34,7 @@ using BeaconCacheRecord_t = core::caching::BeaconCacheRecord;
 using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
 using MockNiceIObserver_t = testing::NiceMock<MockIObserver>;
 using MockStrictIObserver_t = testing::StrictMock<MockIObserver>;
+using MetricsRegistry_t = core::util::MetricsRegistry;
 using Utf8String_t = core::UTF8String;
 
 class BeaconCacheTest : public testing::Test
@@ -53,7 +55,7 @@ TEST_F(BeaconCacheTest, aDefaultConstructedCacheDoesNotContainBeacons)
 	BeaconCache_t target(mockLogger);
 
 	// then
-	ASSERT_TRUE(target.getBeaconIDs().empty());
+	ASSERT_TRUE(target.getBeaconIDs()->empty());
 	ASSERT_EQ(target.getNumBytesInCache(), 0L);
 }
 
@@ -66,8 +68,8 @@ TEST_F(BeaconCacheTest, addEventDataAddsBeaconIdToCache)
 	target.addEventData(1, 1000L, "a");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getEvents(1).size(), 1);
 	ASSERT_TRUE(target.getEvents(1).begin()->equals("a"));
 
@@ -75,9 +77,9 @@ TEST_F(BeaconCacheTest, addEventDataAddsBeaconIdToCache)
 	target.addEventData(2, 1100L, "b");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 2);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(2), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 2);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(2));
 	ASSERT_EQ(target.getEvents(1).size(), 1);
 	ASSERT_TRUE(target.getEvents(1).begin()->equals("a"));
 	ASSERT_EQ(target.getEvents(2).size(), 1);
@@ -93,8 +95,8 @@ TEST_F(BeaconCacheTest, addEventDataAddsDataToAlreadyExistingBeaconId)
 	target.addEventData(1, 1000L, "a");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getEvents(1).size(), 1);
 	ASSERT_TRUE(target.getEvents(1).begin()->equals("a"));
 
@@ -102,8 +104,8 @@ TEST_F(BeaconCacheTest, addEventDataAddsDataToAlreadyExistingBeaconId)
 	target.addEventData(1, 1100L, "bc");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getEvents(1).size(), 2);
 	auto v = target.getEvents(1);
 	ASSERT_TRUE(std::find(v.begin(), v.end(), Utf8String_t("a")) != v.end());
@@ -144,6 +146,61 @@ TEST_F(BeaconCacheTest, addEventDataNotifiesObserver)
 	target.addEventData(666, 1200L, "xyz");
 }
 
+TEST_F(BeaconCacheTest, addEventDataWithMultipleRecordsAddsAllRecords)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addEventData(1, 1000L, "a");
+
+	std::vector<BeaconCacheRecord_t> records;
+	records.emplace_back(1100L, "bc");
+	records.emplace_back(1200L, "def");
+
+	// when
+	target.addEventData(1, records);
+
+	// then
+	ASSERT_THAT(target.getEvents(1), testing::ElementsAre(Utf8String_t("a"), Utf8String_t("bc"), Utf8String_t("def")));
+	ASSERT_EQ(target.getNumBytesInCache(), BeaconCacheRecord_t(1000L, "a").getDataSizeInBytes()
+		+ records[0].getDataSizeInBytes() + records[1].getDataSizeInBytes());
+}
+
+TEST_F(BeaconCacheTest, addEventDataWithMultipleRecordsNotifiesObserverOnce)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	MockNiceIObserver_t observer;
+
+	target.addObserver(&observer);
+
+	std::vector<BeaconCacheRecord_t> records;
+	records.emplace_back(1000L, "a");
+	records.emplace_back(1100L, "b");
+	records.emplace_back(1200L, "c");
+
+	// expect
+	EXPECT_CALL(observer, update())
+		.Times(testing::Exactly(1));
+
+	// when
+	target.addEventData(1, records);
+}
+
+TEST_F(BeaconCacheTest, addEventDataWithoutRecordsDoesNotCreateCacheEntry)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	MockStrictIObserver_t observer;
+
+	target.addObserver(&observer);
+
+	// when
+	target.addEventData(1, std::vector<BeaconCacheRecord_t>());
+
+	// then
+	ASSERT_TRUE(target.getBeaconIDs()->empty());
+}
+
 TEST_F(BeaconCacheTest, addActionDataAddsBeaconIdToCache)
 {
 	// given
@@ -153,8 +210,8 @@ TEST_F(BeaconCacheTest, addActionDataAddsBeaconIdToCache)
 	target.addActionData(1, 1000L, "a");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getActions(1).size(), 1);
 	ASSERT_TRUE(target.getActions(1).begin()->equals("a"));
 
@@ -162,9 +219,9 @@ TEST_F(BeaconCacheTest, addActionDataAddsBeaconIdToCache)
 	target.addActionData(2, 1100L, "b");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 2);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(2), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 2);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(2));
 	ASSERT_EQ(target.getActions(1).size(), 1);
 	ASSERT_TRUE(target.getActions(1).begin()->equals("a"));
 	ASSERT_EQ(target.getActions(2).size(), 1);
@@ -180,8 +237,8 @@ TEST_F(BeaconCacheTest, addActionDataAddsDataToAlreadyExistingBeaconId)
 	target.addActionData(1, 1000L, "a");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getActions(1).size(), 1);
 	ASSERT_TRUE(target.getActions(1).begin()->equals("a"));
 
@@ -189,8 +246,8 @@ TEST_F(BeaconCacheTest, addActionDataAddsDataToAlreadyExistingBeaconId)
 	target.addActionData(1, 1100L, "bc");
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
 	ASSERT_EQ(target.getActions(1).size(), 2);
 	auto v = target.getActions(1);
 	ASSERT_TRUE(std::find(v.begin(), v.end(), Utf8String_t("a")) != v.end());
@@ -243,14 +300,14 @@ TEST_F(BeaconCacheTest, deleteCacheEntryRemovesTheGivenBeacon)
 	target.deleteCacheEntry(1);
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(42), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 1);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(42));
 
 	// and when removing beacon with id 42
 	target.deleteCacheEntry(42);
 
 	// then
-	ASSERT_TRUE(target.getBeaconIDs().empty());
+	ASSERT_TRUE(target.getBeaconIDs()->empty());
 }
 
 TEST_F(BeaconCacheTest, deleteCacheEntryDecrementsCacheSize)
@@ -303,12 +360,99 @@ TEST_F(BeaconCacheTest, deleteCacheEntriesDoesNothingIfGivenBeaconIDIsNotInCache
 	target.deleteCacheEntry(666);
 
 	// then
-	ASSERT_EQ(target.getBeaconIDs().size(), 2);
-	ASSERT_EQ(target.getBeaconIDs().count(1), 1);
-	ASSERT_EQ(target.getBeaconIDs().count(42), 1);
+	ASSERT_EQ(target.getBeaconIDs()->size(), 2);
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(1));
+	ASSERT_THAT(*target.getBeaconIDs(), testing::Contains(42));
 	ASSERT_EQ(target.getNumBytesInCache(), cachedSize);
 }
 
+TEST_F(BeaconCacheTest, getBeaconIDsReturnsSnapshotNotAffectedByLaterModifications)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addEventData(1, 1000L, "a");
+
+	// when
+	auto obtained = target.getBeaconIDs();
+	target.addEventData(42, 1000L, "z");
+	target.deleteCacheEntry(1);
+
+	// then
+	ASSERT_THAT(*obtained, testing::ElementsAre(1));
+	ASSERT_THAT(*target.getBeaconIDs(), testing::ElementsAre(42));
+}
+
+TEST_F(BeaconCacheTest, getBeaconIDsReturnsSameSnapshotIfNoBeaconWasAddedOrDeleted)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addEventData(1, 1000L, "a");
+
+	// when
+	auto obtained = target.getBeaconIDs();
+	target.addActionData(1, 1000L, "b");
+
+	// then
+	ASSERT_EQ(obtained, target.getBeaconIDs());
+}
+
+TEST_F(BeaconCacheTest, visitEventDataVisitsAllEventRecordsInOrder)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addEventData(1, 1000L, "a");
+	target.addEventData(1, 1001L, "iii");
+	target.addActionData(1, 1002L, "b");
+	target.addEventData(42, 1003L, "z");
+
+	// when
+	std::vector<Utf8String_t> obtained;
+	target.visitEventData(1, [&obtained](const BeaconCacheRecord_t& record)
+	{
+		obtained.push_back(record.getData());
+	});
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(Utf8String_t("a"), Utf8String_t("iii")));
+}
+
+TEST_F(BeaconCacheTest, visitActionDataVisitsAllActionRecordsInOrder)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1002L, "b");
+	target.addActionData(42, 1003L, "z");
+
+	// when
+	std::vector<Utf8String_t> obtained;
+	target.visitActionData(1, [&obtained](const BeaconCacheRecord_t& record)
+	{
+		obtained.push_back(record.getData());
+	});
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(Utf8String_t("a"), Utf8String_t("iii")));
+}
+
+TEST_F(BeaconCacheTest, visitingDataDoesNothingIfGivenBeaconIDIsNotInCache)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addEventData(1, 1000L, "a");
+	target.addActionData(1, 1000L, "b");
+
+	// when
+	auto numVisited = 0;
+	auto visitor = [&numVisited](const BeaconCacheRecord_t&) { numVisited++; };
+	target.visitEventData(42, visitor);
+	target.visitActionData(42, visitor);
+
+	// then
+	ASSERT_EQ(numVisited, 0);
+}
+
 TEST_F(BeaconCacheTest, getNextBeaconChunkReturnsNullIfGivenBeaconIDDoesNotExist)
 {
 	// given
@@ -337,8 +481,8 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkCopiesDataForSending)
 	// when
 	auto obtained = target.getNextBeaconChunk(1, "prefix", 0, "&");
 
-	// then
-	ASSERT_TRUE(obtained.equals("prefix"));
+	// then at least one record is returned
+	ASSERT_TRUE(obtained.equals("prefix&b"));
 
 	ASSERT_TRUE(target.getActions(1).empty());
 	ASSERT_TRUE(target.getEvents(1).empty());
@@ -385,7 +529,7 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkRetrievesNextChunk)
 	target.addEventData(1, 1001L, "jjj");
 
 	// when
-	auto obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	auto obtained = target.getNextBeaconChunk(1, "prefix", 12, "&");
 
 	// then
 	ASSERT_TRUE(obtained.equals("prefix&b&jjj"));
@@ -408,6 +552,44 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkRetrievesNextChunk)
 	ASSERT_TRUE(it2->isMarkedForSending());
 }
 
+TEST_F(BeaconCacheTest, hasMoreChunksReturnsTrueIfDataRemainsAfterRetrievedChunk)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+
+	// when
+	target.getNextBeaconChunk(1, "prefix", 9, "&");
+
+	// then
+	ASSERT_TRUE(target.hasMoreChunks(1));
+}
+
+TEST_F(BeaconCacheTest, hasMoreChunksReturnsFalseIfRetrievedChunkContainsAllData)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+
+	// when
+	target.getNextBeaconChunk(1, "prefix", 100, "&");
+
+	// then
+	ASSERT_FALSE(target.hasMoreChunks(1));
+}
+
+TEST_F(BeaconCacheTest, hasMoreChunksReturnsFalseIfGivenBeaconIDDoesNotExist)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+
+	// when, then
+	ASSERT_FALSE(target.hasMoreChunks(2));
+}
+
 TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 {
 	// given
@@ -419,7 +601,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 	target.addEventData(1, 1001L, "jjj");
 
 	// when retrieving the first chunk and removing retrieved chunks
-	auto obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	auto obtained = target.getNextBeaconChunk(1, "prefix", 12, "&");
 	target.removeChunkedData(1);
 
 	// then
@@ -435,7 +617,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 	ASSERT_TRUE(target.getEventsBeingSent(1).empty());
 
 	// when retrieving the second chunk and removing retrieved chunks
-	obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	obtained = target.getNextBeaconChunk(1, "prefix", 12, "&");
 	target.removeChunkedData(1);
 
 	// then
@@ -456,7 +638,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataDoesNothingIfCalledWithNonExistingBeaco
 	target.addEventData(1, 1001L, "jjj");
 
 	// when retrieving the first chunk and removing retrieved chunks
-	auto obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	auto obtained = target.getNextBeaconChunk(1, "prefix", 12, "&");
 	target.removeChunkedData(2);
 
 	// then
@@ -487,7 +669,7 @@ TEST_F(BeaconCacheTest, resetChunkedRestoresData)
 	target.addEventData(1, 1001L, "jjj");
 
 	// do same step we'd do when we send the
-	target.getNextBeaconChunk(1, "prefix", 10, "&");
+	target.getNextBeaconChunk(1, "prefix", 12, "&");
 
 	// data has been copied, but still add some new event & action data
 	target.addActionData(1, 6666L, "123");
@@ -528,7 +710,7 @@ TEST_F(BeaconCacheTest, resetChunkedRestoresCacheSize)
 	target.addEventData(1, 1001L, "jjj");
 
 	// do same step we'd do when we send the
-	target.getNextBeaconChunk(1, "prefix", 10, "&");
+	target.getNextBeaconChunk(1, "prefix", 12, "&");
 
 	// data has been copied, but still add some new event & action data
 	target.addActionData(1, 6666L, "123");
@@ -551,7 +733,7 @@ TEST_F(BeaconCacheTest, resetChunkedNotifiesObservers)
 	target.addEventData(1, 1001L, "jjj");
 
 	// do same step we'd do when we send the
-	target.getNextBeaconChunk(1, "prefix", 10, "&");
+	target.getNextBeaconChunk(1, "prefix", 12, "&");
 
 	// data has been copied, but still add some new event & action data
 	target.addActionData(1, 6666L, "123");
@@ -576,7 +758,7 @@ TEST_F(BeaconCacheTest, resetChunkedDoesNothingIfEntryDoesNotExist)
 	target.addEventData(1, 1001L, "jjj");
 
 	// do same step we'd do when we send the
-	target.getNextBeaconChunk(1, "prefix", 10, "&");
+	target.getNextBeaconChunk(1, "prefix", 12, "&");
 
 	// data has been copied, but still add some new event & action data
 	target.addActionData(1, 6666L, "123");
@@ -656,6 +838,76 @@ TEST_F(BeaconCacheTest, evictRecordsByNumber)
 	ASSERT_EQ(obtained, 2);
 }
 
+TEST_F(BeaconCacheTest, addedRecordsAreCountedInMetricsRegistry)
+{
+	// given
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	BeaconCache_t target(mockLogger, metricsRegistry);
+
+	// when
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+	target.addEventData(2, 1001L, "c");
+
+	// then
+	ASSERT_THAT(metricsRegistry->getActionRecordsAdded().getValue(), testing::Eq(int64_t(1)));
+	ASSERT_THAT(metricsRegistry->getEventRecordsAdded().getValue(), testing::Eq(int64_t(2)));
+}
+
+TEST_F(BeaconCacheTest, recordsAddedAtOnceAreCountedInMetricsRegistry)
+{
+	// given
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	BeaconCache_t target(mockLogger, metricsRegistry);
+
+	std::vector<BeaconCacheRecord_t> records;
+	records.emplace_back(1000L, "a");
+	records.emplace_back(1001L, "b");
+	records.emplace_back(1002L, "c");
+
+	// when
+	target.addEventData(1, records);
+
+	// then
+	ASSERT_THAT(metricsRegistry->getEventRecordsAdded().getValue(), testing::Eq(int64_t(3)));
+}
+
+TEST_F(BeaconCacheTest, evictedRecordsAreCountedInMetricsRegistry)
+{
+	// given
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	BeaconCache_t target(mockLogger, metricsRegistry);
+	target.addActionData(1, 1000L, "a");
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1000L, "b");
+	target.addEventData(1, 1001L, "jjj");
+
+	// when
+	target.evictRecordsByAge(1, 1001);
+	target.evictRecordsByNumber(1, 1);
+
+	// then
+	ASSERT_THAT(metricsRegistry->getRecordsEvictedByAge().getValue(), testing::Eq(int64_t(2)));
+	ASSERT_THAT(metricsRegistry->getRecordsEvictedBySpace().getValue(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(BeaconCacheTest, chunkSizeIsRecordedInMetricsRegistry)
+{
+	// given
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	BeaconCache_t target(mockLogger, metricsRegistry);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+
+	// when
+	auto obtained = target.getNextBeaconChunk(1, "prefix", 1024, "&");
+
+	// then
+	auto chunkSize = metricsRegistry->getBeaconChunkSize().getSnapshot();
+	ASSERT_THAT(chunkSize.count, testing::Eq(int64_t(1)));
+	ASSERT_THAT(chunkSize.sum, testing::Eq(int64_t(obtained.getStringData().size())));
+}
+
 TEST_F(BeaconCacheTest, isEmptyGivesTrueIfBeaconDoesNotExistInCache)
 {
 	// given
@@ -693,3 +945,39 @@ TEST_F(BeaconCacheTest, isEmptyGivesTrueIfBeaconDoesNotContainActiveData)
 	ASSERT_TRUE(target.isEmpty(1));
 }
 
+TEST_F(BeaconCacheTest, getNumberOfRecordsGivesZeroIfBeaconDoesNotExistInCache)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+
+	// then
+	ASSERT_THAT(target.getNumberOfRecords(666), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconCacheTest, getNumberOfRecordsGivesNumberOfActionAndEventRecords)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1000L, "b");
+
+	// then
+	ASSERT_THAT(target.getNumberOfRecords(1), testing::Eq(size_t(3)));
+}
+
+TEST_F(BeaconCacheTest, getNumberOfRecordsIncludesRecordsBeingSent)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1000L, "b");
+
+	target.getNextBeaconChunk(1, "prefix", 0, "&");
+	target.addEventData(1, 1001L, "jjj");
+
+	// then
+	ASSERT_THAT(target.getNumberOfRecords(1), testing::Eq(size_t(3)));
+}
@@ -280,7 +280,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
 		std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this)
 	);
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 
 	// then
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
@@ -324,7 +324,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionLogsEvictionResultIfDebugIsEnab
 		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
 		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 	ON_CALL(*mockBeaconCache, evictRecordsByNumber(1, testing::_))
 		.WillByDefault(testing::Return(5));
 	ON_CALL(*mockBeaconCache, evictRecordsByNumber(42, testing::_))
@@ -360,7 +360,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogEvictionResultIfDebug
 		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
 		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 	ON_CALL(*mockBeaconCache, evictRecordsByNumber(1, testing::_))
 		.WillByDefault(testing::Return(5));
 	ON_CALL(*mockBeaconCache, evictRecordsByNumber(42, testing::_))
@@ -382,7 +382,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionRunsUntilTheCacheSizeIsLessThan
 	);
 
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 
 	// then
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
@@ -426,7 +426,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedBet
 	}
 	));
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 
 	// then
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
@@ -452,7 +452,7 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfNumBytesInCacheFallsBelo
 		std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this)
 	);
 	ON_CALL(*mockBeaconCache, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 
 	// then
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
@@ -316,7 +316,7 @@ TEST_F(TimeEvictionStrategyTest, executeEvictionStopsIfNoBeaconIdsAreAvailableIn
 		std::bind(&TimeEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this)
 	);
 	ON_CALL(*mockBeaconCacheStrict, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>()));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>())));
 
 	// when executing the first time
 	EXPECT_CALL(*mockBeaconCacheStrict, getBeaconIDs())
@@ -343,7 +343,7 @@ TEST_F(TimeEvictionStrategyTest, executeEvictionCallsEvictionForEachBeaconSepara
 		std::bind(&TimeEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this)
 	);
 	ON_CALL(*mockBeaconCacheStrict, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 } )));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 } ))));
 
 	// then verify interactions
 	EXPECT_CALL(*mockBeaconCacheStrict, getBeaconIDs())
@@ -389,7 +389,7 @@ TEST_F(TimeEvictionStrategyTest, executeEvictionLogsTheNumberOfRecordsRemoved)
 		.WillOnce(testing::Return(2099L))		// 2099 for TimeEvictionStrategy::shouldRun()
 		.WillOnce(testing::Return(2099L));		// 2099 for TimeEvictionStrategy::doExecute() with no beacons
 	ON_CALL(*mockBeaconCacheNice, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 	ON_CALL(*mockBeaconCacheNice, evictRecordsByAge(1, testing::_))
 		.WillByDefault(testing::Return(2));
 	ON_CALL(*mockBeaconCacheNice, evictRecordsByAge(42, testing::_))
@@ -422,7 +422,7 @@ TEST_F(TimeEvictionStrategyTest, executeEvictionIsStoppedIfThreadGetsInterrupted
 			}
 		));
 	ON_CALL(*mockBeaconCacheStrict, getBeaconIDs())
-		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>({ 1, 42 }))));
 
 	// then verify interactions
 	EXPECT_CALL(*mockBeaconCacheStrict, getBeaconIDs())
@@ -25,13 +25,18 @@
 #include "gmock/gmock.h"
 
 #include <memory>
+#include <vector>
 
 namespace test
 {
 	class MockIBeaconCache : public core::caching::IBeaconCache
 	{
 	public:
-		MockIBeaconCache() = default;
+		MockIBeaconCache()
+		{
+			ON_CALL(*this, getBeaconIDs())
+				.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>()));
+		}
 
 		~MockIBeaconCache() override = default;
 
@@ -59,6 +64,13 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD2(addEventData,
+			void(
+				int32_t,
+				const std::vector<core::caching::BeaconCacheRecord>&
+			)
+		);
+
 		MOCK_METHOD3(addActionData,
 			void(
 				int32_t,
@@ -67,6 +79,22 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD5(addBeacon,
+			void(
+				int32_t,
+				int64_t,
+				int32_t,
+				const core::UTF8String&,
+				const core::UTF8String&
+			)
+		);
+
+		MOCK_METHOD1(endBeacon,
+			void(
+				int32_t
+			)
+		);
+
 		MOCK_METHOD1(deleteCacheEntry,
 			void(
 				int32_t
@@ -94,7 +122,27 @@ namespace test
 			)
 		);
 
-		MOCK_METHOD0(getBeaconIDs, const std::unordered_set<int32_t>());
+		MOCK_METHOD1(hasMoreChunks,
+			bool(
+				int32_t
+			)
+		);
+
+		MOCK_METHOD0(getBeaconIDs, BeaconIDSnapshot());
+
+		MOCK_METHOD2(visitEventData,
+			void(
+				int32_t,
+				const RecordVisitor&
+			)
+		);
+
+		MOCK_METHOD2(visitActionData,
+			void(
+				int32_t,
+				const RecordVisitor&
+			)
+		);
 
 		MOCK_METHOD2(evictRecordsByAge,
 			uint32_t(
@@ -117,6 +165,12 @@ namespace test
 				int32_t
 			)
 		);
+
+		MOCK_METHOD1(getNumberOfRecords,
+			size_t(
+				int32_t
+			)
+		);
 	};
 }
 #endif
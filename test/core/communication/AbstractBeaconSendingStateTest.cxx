@@ -81,3 +81,45 @@ TEST_F(AbstractBeaconSendingStateTest, aTestBeaconSendingSetsNextStateAsShutdown
 }
 
 
+
+TEST_F(AbstractBeaconSendingStateTest, prepareExecutionDoesNotDelayByDefault)
+{
+	// with
+	auto mockContext = MockIBeaconSendingContext::createStrict();
+
+	// given
+	auto target = MockAbstractBeaconSendingState::createStrict();
+
+	// when
+	auto obtained = target->prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(0)));
+}
+
+TEST_F(AbstractBeaconSendingStateTest, executePreparedExecutesStateAndSetsShutdownState)
+{
+	// with
+	auto mockShutdownState = MockIBeaconSendingState::createNice();
+	auto mockContext = MockIBeaconSendingContext::createStrict();
+
+	// expect
+	EXPECT_CALL(*mockContext, isShutdownRequested())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(true));
+	EXPECT_CALL(*mockContext, setNextState(testing::Eq(mockShutdownState)))
+		.Times(1);
+
+	// given
+	auto target = MockAbstractBeaconSendingState::createStrict();
+
+	// expect
+	EXPECT_CALL(*target, getShutdownState())
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(mockShutdownState));
+	EXPECT_CALL(*target, doExecute(testing::Ref(*mockContext)))
+		.Times(1);
+
+	// when
+	target->executePrepared(*mockContext);
+}
@@ -221,4 +221,91 @@ TEST_F(BeaconSendingCaptureOffStateTest, aBeaconSendingCaptureOffStateDoesDoesNo
 
 	// when calling execute
 	target.execute(*mockContext);
-}
\ No newline at end of file
+}
+TEST_F(BeaconSendingCaptureOffStateTest, prepareExecutionReturnsSleepTimeWithoutSleeping)
+{
+	// with
+	int64_t sleepTime = 1234;
+
+	// expect
+	EXPECT_CALL(*mockContext, disableCaptureAndClear())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, sleep(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockHTTPClient, sendStatusRequest())
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingCaptureOffState_t target(sleepTime);
+
+	// when
+	auto obtained = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(sleepTime));
+}
+
+TEST_F(BeaconSendingCaptureOffStateTest, prepareExecutionReturnsNoDelayIfStatusCheckIntervalExpired)
+{
+	// with
+	ON_CALL(*mockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(int64_t(3) * 60 * 60 * 1000));
+	ON_CALL(*mockContext, getLastStatusCheckTime())
+		.WillByDefault(testing::Return(int64_t(0)));
+
+	// given
+	auto target = BeaconSendingCaptureOffState_t();
+
+	// when
+	auto obtained = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(0)));
+}
+
+TEST_F(BeaconSendingCaptureOffStateTest, executePreparedSendsStatusRequestAndStoresPreparedTimestamp)
+{
+	// with
+	ON_CALL(*mockContext, isCaptureOn())
+		.WillByDefault(testing::Return(false));
+	EXPECT_CALL(*mockContext, getCurrentTimestamp())
+		.WillOnce(testing::Return(int64_t(100)))
+		.WillRepeatedly(testing::Return(int64_t(5000)));
+
+	// expect
+	EXPECT_CALL(*mockHTTPClient, sendStatusRequest())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, setLastStatusCheckTime(100))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, sleep(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingCaptureOffState_t target(1234);
+	target.prepareExecution(*mockContext);
+
+	// when
+	target.executePrepared(*mockContext);
+}
+
+TEST_F(BeaconSendingCaptureOffStateTest, executePreparedDoesNotSendStatusRequestWhenShutdownWasRequestedWhileWaiting)
+{
+	// with
+	ON_CALL(*mockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockHTTPClient, sendStatusRequest())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setLastStatusCheckTime(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingFlushSessionsState()))
+		.Times(testing::Exactly(1));
+
+	// given
+	BeaconSendingCaptureOffState_t target(1234);
+	target.prepareExecution(*mockContext);
+
+	// when
+	target.executePrepared(*mockContext);
+}
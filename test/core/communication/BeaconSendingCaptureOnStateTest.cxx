@@ -780,3 +780,67 @@ TEST_F(BeaconSendingCaptureOnStateTest, aBeaconSendingCaptureOnStateTransitionsT
 	// when
 	target.execute(*mockContext);
 }
+
+TEST_F(BeaconSendingCaptureOnStateTest, prepareExecutionReturnsDefaultSleepTimeWithoutSleeping)
+{
+	// expect
+	EXPECT_CALL(*mockContext, sleep())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, sleep(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, getAllNotConfiguredSessions())
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingCaptureOnState_t target;
+
+	// when
+	auto obtained = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(1000)));
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, executePreparedSendsFinishedSessionsWithoutSleeping)
+{
+	// given
+	std::vector<SessionInternals_sp> finishedSessions = { mockSession3Finished };
+	ON_CALL(*mockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mockSession3Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockContext, sleep())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession3Finished, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+
+	// given
+	BeaconSendingCaptureOnState_t target;
+
+	// when
+	target.executePrepared(*mockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, nothingIsSentIfShutdownWasRequestedWhilePrepared)
+{
+	// given
+	std::vector<SessionInternals_sp> finishedSessions = { mockSession3Finished };
+	ON_CALL(*mockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockSession3Finished, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingFlushSessionsState()))
+		.Times(testing::Exactly(1));
+
+	// given
+	BeaconSendingCaptureOnState_t target;
+
+	// when
+	target.executePrepared(*mockContext);
+}
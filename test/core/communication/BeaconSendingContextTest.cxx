@@ -22,6 +22,7 @@
 #include "../configuration/mock/MockIBeaconConfiguration.h"
 #include "../configuration/mock/MockIHTTPClientConfiguration.h"
 #include "../configuration/mock/MockIPrivacyConfiguration.h"
+#include "../configuration/mock/MockIResponseAttributesStore.h"
 #include "../objects/mock/MockSessionInternals.h"
 #include "../../api/mock/MockILogger.h"
 #include "../../api/mock/MockISslTrustManager.h"
@@ -36,18 +37,23 @@
 #include "core/communication/IBeaconSendingState.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
 #include "core/configuration/ServerConfiguration.h"
+#include "core/util/MetricsRegistry.h"
 #include "protocol/StatusResponse.h"
 #include "protocol/ResponseAttributes.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace test;
 
 using BeaconSendingContext_t = core::communication::BeaconSendingContext;
 using BeaconSendingContextBuilder_sp = std::shared_ptr<TestBeaconSendingContextBuilder>;
 using IBeaconSendingState_t = core::communication::IBeaconSendingState;
 using IBeaconSendingState_up = std::unique_ptr<IBeaconSendingState_t>;
+using MetricsRegistry_t = core::util::MetricsRegistry;
 using IHTTPClientConfiguration_sp = std::shared_ptr<core::configuration::IHTTPClientConfiguration>;
 using MockIHTTPClientConfiguration_sp = std::shared_ptr<MockIHTTPClientConfiguration>;
 using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
@@ -143,6 +149,57 @@ TEST_F(BeaconSendingContextTest, executeCurrentStateCallsExecuteOnCurrentState)
 	target->executeCurrentState();
 }
 
+TEST_F(BeaconSendingContextTest, prepareCurrentStateCallsPrepareExecutionOnCurrentState)
+{
+	// with
+	auto mockState = new MockIBeaconSendingState();
+
+	// expect
+	EXPECT_CALL(*mockState, prepareExecution(testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(int64_t(42)));
+	EXPECT_CALL(*mockState, execute(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	auto target = createBeaconSendingContext()
+		->with(std::unique_ptr<IBeaconSendingState_t>(mockState))
+		.build();
+
+	// when
+	auto obtained = target->prepareCurrentState();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(42)));
+}
+
+TEST_F(BeaconSendingContextTest, executePreparedStateCallsExecutePreparedAndSwitchesState)
+{
+	// with
+	auto mockState = new MockIBeaconSendingState();
+	auto mockNextState = MockIBeaconSendingState::createNice();
+	BeaconSendingContext_t* context = nullptr;
+
+	// expect
+	EXPECT_CALL(*mockState, executePrepared(testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Invoke([&context, mockNextState](core::communication::IBeaconSendingContext&) {
+			context->setNextState(mockNextState);
+		}));
+
+	// given
+	auto target = createBeaconSendingContext()
+		->with(std::unique_ptr<IBeaconSendingState_t>(mockState))
+		.build();
+	context = target.get();
+
+	// when
+	target->executePreparedState();
+
+	// then
+	ASSERT_THAT(target->getCurrentState(), testing::Eq(mockNextState));
+}
+
 TEST_F(BeaconSendingContextTest, initCompleteSuccessAndWait)
 {
 	// given
@@ -169,6 +226,123 @@ TEST_F(BeaconSendingContextTest, requestShutdown)
 	ASSERT_THAT(target->isShutdownRequested(), testing::Eq(true));
 }
 
+TEST_F(BeaconSendingContextTest, shutdownDeadlineIsNotSetByDefault)
+{
+	// given
+	auto target = createBeaconSendingContext()->build();
+
+	// then
+	ASSERT_THAT(target->getShutdownDeadline(), testing::Eq(std::chrono::steady_clock::time_point::max()));
+}
+
+TEST_F(BeaconSendingContextTest, setShutdownDeadlineAlsoBoundsHTTPRequests)
+{
+	// with
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+	// expect
+	EXPECT_CALL(*mockHTTPClientProvider, setRequestDeadline(deadline))
+		.Times(1);
+
+	// given
+	auto target = createBeaconSendingContext()->build();
+
+	// when
+	target->setShutdownDeadline(deadline);
+
+	// then
+	ASSERT_THAT(target->getShutdownDeadline(), testing::Eq(deadline));
+}
+
+TEST_F(BeaconSendingContextTest, finishFlushReturnsAccumulatedFlushedAndDroppedRecords)
+{
+	// given
+	auto mockSessionOne = MockSessionInternals::createNice();
+	auto mockSessionTwo = MockSessionInternals::createNice();
+	auto target = createBeaconSendingContext()->build();
+	target->addSession(mockSessionOne);
+	target->addSession(mockSessionTwo);
+
+	// when
+	target->completeSessionFlush(mockSessionOne, 3, 0);
+	target->completeSessionFlush(mockSessionTwo, 4, 5);
+	auto obtained = target->finishFlush(true);
+
+	// then
+	ASSERT_THAT(obtained.isCompleted, testing::Eq(true));
+	ASSERT_THAT(obtained.numberOfFlushedRecords, testing::Eq(7));
+	ASSERT_THAT(obtained.numberOfDroppedRecords, testing::Eq(5));
+	ASSERT_THAT(target->getSessionCount(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconSendingContextTest, finishFlushCountsRecordsOfSessionsNotFlushedAsDropped)
+{
+	// with
+	auto mockSessionOne = MockSessionInternals::createNice();
+	auto mockSessionTwo = MockSessionInternals::createNice();
+	ON_CALL(*mockSessionTwo, getNumberOfRecords())
+		.WillByDefault(testing::Return(6));
+
+	// given
+	auto target = createBeaconSendingContext()->build();
+	target->addSession(mockSessionOne);
+	target->addSession(mockSessionTwo);
+	target->completeSessionFlush(mockSessionOne, 3, 1);
+
+	// when
+	auto obtained = target->finishFlush(false);
+
+	// then
+	ASSERT_THAT(obtained.isCompleted, testing::Eq(false));
+	ASSERT_THAT(obtained.numberOfFlushedRecords, testing::Eq(3));
+	ASSERT_THAT(obtained.numberOfDroppedRecords, testing::Eq(7));
+}
+
+TEST_F(BeaconSendingContextTest, sessionsFlushedAfterFinishFlushAreRemovedButNotCountedAgain)
+{
+	// with
+	auto mockSession = MockSessionInternals::createNice();
+	ON_CALL(*mockSession, getNumberOfRecords())
+		.WillByDefault(testing::Return(6));
+
+	// given
+	auto target = createBeaconSendingContext()->build();
+	target->addSession(mockSession);
+	auto abandoned = target->finishFlush(false);
+
+	// when
+	target->completeSessionFlush(mockSession, 6, 0);
+	auto obtained = target->finishFlush(true);
+
+	// then
+	ASSERT_THAT(abandoned.numberOfDroppedRecords, testing::Eq(6));
+	ASSERT_THAT(obtained.numberOfFlushedRecords, testing::Eq(0));
+	ASSERT_THAT(obtained.numberOfDroppedRecords, testing::Eq(0));
+	ASSERT_THAT(target->getSessionCount(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconSendingContextTest, getNumberOfUnsentRecordsSumsUpRecordsOfAllSessions)
+{
+	// with
+	auto mockSessionOne = MockSessionInternals::createNice();
+	ON_CALL(*mockSessionOne, getNumberOfRecords())
+		.WillByDefault(testing::Return(2));
+	auto mockSessionTwo = MockSessionInternals::createNice();
+	ON_CALL(*mockSessionTwo, getNumberOfRecords())
+		.WillByDefault(testing::Return(3));
+
+	// given
+	auto target = createBeaconSendingContext()->build();
+	target->addSession(mockSessionOne);
+	target->addSession(mockSessionTwo);
+
+	// when
+	auto obtained = target->getNumberOfUnsentRecords();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(5)));
+}
+
 TEST_F(BeaconSendingContextTest, initCompleteFailureAndWait)
 {
 	// given
@@ -979,3 +1153,167 @@ TEST_F(BeaconSendingContextTest, getCurrentServerIdReturnsServerIdOfHttpClientCo
 	ASSERT_THAT(obtained, testing::Eq(serverId));
 }
 
+
+TEST_F(BeaconSendingContextTest, storedResponseAttributesAreUsedAsInitialServerConfiguration)
+{
+	// with
+	auto storedAttributes = protocol::ResponseAttributes::withUndefinedDefaults()
+		.withServerId(73)
+		.withCapture(false)
+		.build();
+	auto mockStore = MockIResponseAttributesStore::createNice();
+	ON_CALL(*mockStore, load()).WillByDefault(testing::Return(storedAttributes));
+
+	// given
+	auto target = createBeaconSendingContext()->with(mockStore).build();
+
+	// then
+	ASSERT_THAT(target->getCurrentServerID(), testing::Eq(73));
+	ASSERT_THAT(target->isCaptureOn(), testing::Eq(false));
+	ASSERT_THAT(target->getLastResponseAttributes()->getServerId(), testing::Eq(73));
+}
+
+TEST_F(BeaconSendingContextTest, addSessionConfiguresSessionWithStoredServerConfiguration)
+{
+	// with
+	auto storedAttributes = protocol::ResponseAttributes::withUndefinedDefaults()
+		.withServerId(73)
+		.withMultiplicity(5)
+		.build();
+	auto mockStore = MockIResponseAttributesStore::createNice();
+	ON_CALL(*mockStore, load()).WillByDefault(testing::Return(storedAttributes));
+	auto mockSession = MockSessionInternals::createNice();
+
+	// expect
+	std::shared_ptr<core::configuration::IServerConfiguration> serverConfigCapture = nullptr;
+	EXPECT_CALL(*mockSession, updateServerConfiguration(testing::_))
+		.Times(1)
+		.WillOnce(testing::SaveArg<0>(&serverConfigCapture));
+
+	// given
+	auto target = createBeaconSendingContext()->with(mockStore).build();
+
+	// when
+	target->addSession(mockSession);
+
+	// then
+	ASSERT_THAT(serverConfigCapture, testing::NotNull());
+	ASSERT_THAT(serverConfigCapture->getServerId(), testing::Eq(73));
+	ASSERT_THAT(serverConfigCapture->getMultiplicity(), testing::Eq(5));
+}
+
+TEST_F(BeaconSendingContextTest, addSessionDoesNotConfigureSessionIfNothingIsStored)
+{
+	// with
+	auto mockStore = MockIResponseAttributesStore::createNice();
+	auto mockSession = MockSessionInternals::createNice();
+
+	// expect
+	EXPECT_CALL(*mockSession, updateServerConfiguration(testing::_)).Times(0);
+
+	// given
+	auto target = createBeaconSendingContext()->with(mockStore).build();
+
+	// when
+	target->addSession(mockSession);
+}
+
+TEST_F(BeaconSendingContextTest, addSessionDoesNotConfigureSessionAfterStatusResponseWasReceived)
+{
+	// with
+	auto storedAttributes = protocol::ResponseAttributes::withUndefinedDefaults().withServerId(73).build();
+	auto mockStore = MockIResponseAttributesStore::createNice();
+	ON_CALL(*mockStore, load()).WillByDefault(testing::Return(storedAttributes));
+	auto response = protocol::StatusResponse::createSuccessResponse(
+		mockLogger,
+		protocol::ResponseAttributes::withUndefinedDefaults().withCapture(true).build(),
+		200,
+		protocol::IStatusResponse::ResponseHeaders()
+	);
+	auto mockSession = MockSessionInternals::createNice();
+
+	// expect
+	EXPECT_CALL(*mockSession, updateServerConfiguration(testing::_)).Times(0);
+
+	// given
+	auto target = createBeaconSendingContext()->with(mockStore).build();
+	target->handleStatusResponse(response);
+
+	// when
+	target->addSession(mockSession);
+}
+
+TEST_F(BeaconSendingContextTest, successfulResponseAttributesAreMergedAndStored)
+{
+	// with
+	auto storedAttributes = protocol::ResponseAttributes::withUndefinedDefaults().withServerId(73).build();
+	auto mockStore = MockIResponseAttributesStore::createNice();
+	ON_CALL(*mockStore, load()).WillByDefault(testing::Return(storedAttributes));
+	auto response = protocol::StatusResponse::createSuccessResponse(
+		mockLogger,
+		protocol::ResponseAttributes::withUndefinedDefaults().withMultiplicity(5).build(),
+		200,
+		protocol::IStatusResponse::ResponseHeaders()
+	);
+
+	// expect
+	std::shared_ptr<protocol::IResponseAttributes> attributesCapture = nullptr;
+	EXPECT_CALL(*mockStore, store(testing::_))
+		.Times(1)
+		.WillOnce(testing::DoAll(testing::SaveArg<0>(&attributesCapture), testing::Return(true)));
+
+	// given
+	auto target = createBeaconSendingContext()->with(mockStore).build();
+
+	// when
+	target->updateLastResponseAttributesFrom(response);
+
+	// then
+	ASSERT_THAT(attributesCapture, testing::NotNull());
+	ASSERT_THAT(attributesCapture->getServerId(), testing::Eq(73));
+	ASSERT_THAT(attributesCapture->getMultiplicity(), testing::Eq(5));
+}
+
+TEST_F(BeaconSendingContextTest, executeCurrentStateRecordsTimeInStateInMetricsRegistry)
+{
+	// with
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	auto mockState = new MockIBeaconSendingState();
+	ON_CALL(*mockState, getStateType())
+		.WillByDefault(testing::Return(IBeaconSendingState_t::StateType::BEACON_SENDING_CAPTURE_ON_STATE));
+	ON_CALL(*mockState, execute(testing::_))
+		.WillByDefault(testing::InvokeWithoutArgs([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }));
+
+	// given
+	auto target = createBeaconSendingContext()
+		->with(std::unique_ptr<IBeaconSendingState_t>(mockState))
+		.with(metricsRegistry)
+		.build();
+
+	// when
+	target->executeCurrentState();
+
+	// then
+	ASSERT_THAT(metricsRegistry->getTimeInCaptureOnState().getValue(), testing::Ge(int64_t(20)));
+	ASSERT_THAT(metricsRegistry->getTimeInInitialState().getValue(), testing::Eq(int64_t(0)));
+}
+
+TEST_F(BeaconSendingContextTest, addAndRemoveSessionUpdateSendingSessionsInMetricsRegistry)
+{
+	// with
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	auto mockSessionOne = MockSessionInternals::createNice();
+	auto mockSessionTwo = MockSessionInternals::createNice();
+
+	// given
+	auto target = createBeaconSendingContext()->with(metricsRegistry).build();
+
+	// when
+	target->addSession(mockSessionOne);
+	target->addSession(mockSessionTwo);
+	target->removeSession(mockSessionOne);
+	target->removeSession(mockSessionOne);
+
+	// then
+	ASSERT_THAT(metricsRegistry->getSendingSessions().getValue(), testing::Eq(int64_t(1)));
+}
@@ -26,6 +26,10 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <vector>
 
 using namespace test;
@@ -250,3 +254,211 @@ TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateStops
 	// when
 	target.execute(*mockContext);
 }
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateDoesNotSendAfterShutdownDeadlineExpired)
+{
+	// with
+	ON_CALL(*mockContext, getShutdownDeadline())
+		.WillByDefault(testing::Return(std::chrono::steady_clock::now() - std::chrono::seconds(1)));
+
+	// expect
+	EXPECT_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession1Open, clearCapturedData())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession2Open, clearCapturedData())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession3Closed, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession3Closed, clearCapturedData())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, completeSessionFlush(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(3));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateCountsSentAndNotSentRecords)
+{
+	// with
+	EXPECT_CALL(*mockSession3Closed, getNumberOfRecords())
+		.WillOnce(testing::Return(5))
+		.WillOnce(testing::Return(1));
+
+	// expect
+	EXPECT_CALL(*mockContext, completeSessionFlush(testing::_, testing::_, testing::_))
+		.Times(testing::AnyNumber());
+	EXPECT_CALL(*mockContext, completeSessionFlush(SessionInternals_sp(mockSession3Closed), 4, 1))
+		.Times(testing::Exactly(1));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateSendsSessionsWithReportedFailuresFirst)
+{
+	// with
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isTooManyRequestsResponse())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mockSession1Open, hasReportedFailures())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.WillByDefault(testing::Return(errorResponse));
+
+	// expect
+	EXPECT_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession3Closed, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateSendsOldestSessionsFirst)
+{
+	// with
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isTooManyRequestsResponse())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mockSession1Open, getStartTime())
+		.WillByDefault(testing::Return(20));
+	ON_CALL(*mockSession2Open, getStartTime())
+		.WillByDefault(testing::Return(10));
+	ON_CALL(*mockSession3Closed, getStartTime())
+		.WillByDefault(testing::Return(30));
+	ON_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.WillByDefault(testing::Return(errorResponse));
+
+	// expect
+	EXPECT_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession3Closed, sendBeacon(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateSendsEachSessionOnceUsingTheTaskExecutor)
+{
+	// with
+	core::util::TaskExecutor taskExecutor(BeaconSendingFlushSessionState_t::MAX_FLUSH_THREADS);
+	ON_CALL(*mockContext, getTaskExecutor())
+		.WillByDefault(testing::Return(&taskExecutor));
+
+	// expect
+	EXPECT_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockSession3Closed, sendBeacon(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, completeSessionFlush(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(3));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+
+	// when
+	target.execute(*mockContext);
+
+	// then
+	ASSERT_THAT(taskExecutor.getNumberOfPendingTasks(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateDoesNotWaitForFlushTasksOnItsOwnExecutorThread)
+{
+	// with
+	core::util::TaskExecutor taskExecutor(1);
+	ON_CALL(*mockContext, getTaskExecutor())
+		.WillByDefault(testing::Return(&taskExecutor));
+
+	// expect
+	EXPECT_CALL(*mockContext, completeSessionFlush(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(3));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+	std::promise<void> executed;
+	auto isExecuted = executed.get_future();
+
+	// when
+	taskExecutor.schedule([this, &target, &executed]()
+	{
+		target.execute(*mockContext);
+		executed.set_value();
+	});
+
+	// then
+	ASSERT_THAT(isExecuted.wait_for(std::chrono::seconds(10)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionStateSendsSessionsConcurrentlyOnStandaloneExecutor)
+{
+	// with an executor like the one of a standalone OpenKit, executing the state on one of its threads
+	core::util::TaskExecutor taskExecutor(BeaconSendingFlushSessionState_t::MAX_FLUSH_THREADS);
+	ON_CALL(*mockContext, getTaskExecutor())
+		.WillByDefault(testing::Return(&taskExecutor));
+
+	// and the sessions sent after the most important one waiting for each other
+	std::atomic<int32_t> numSendingSessions(0);
+	std::atomic<int32_t> numConcurrentlySentSessions(0);
+	auto mockStatusResponse = MockIStatusResponse::createNice();
+	auto sendConcurrently = [&numSendingSessions, &numConcurrentlySentSessions, mockStatusResponse]()
+	{
+		numSendingSessions++;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (numSendingSessions < 2 && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+		if (numSendingSessions >= 2)
+		{
+			numConcurrentlySentSessions++;
+		}
+		return std::static_pointer_cast<protocol::IStatusResponse>(mockStatusResponse);
+	};
+	ON_CALL(*mockSession2Open, sendBeacon(testing::_))
+		.WillByDefault(testing::InvokeWithoutArgs(sendConcurrently));
+	ON_CALL(*mockSession1Open, sendBeacon(testing::_))
+		.WillByDefault(testing::InvokeWithoutArgs(sendConcurrently));
+
+	// given
+	BeaconSendingFlushSessionState_t target;
+	std::promise<void> executed;
+	auto isExecuted = executed.get_future();
+
+	// when
+	taskExecutor.schedule([this, &target, &executed]()
+	{
+		target.execute(*mockContext);
+		executed.set_value();
+	});
+
+	// then
+	ASSERT_THAT(isExecuted.wait_for(std::chrono::seconds(10)), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(numConcurrentlySentSessions.load(), testing::Eq(2));
+}
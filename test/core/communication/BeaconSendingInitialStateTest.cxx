@@ -502,3 +502,120 @@ TEST_F(BeaconSendingInitialStateTest, receivingTooManyRequestsResponseDisablesCa
 	// when
 	target.execute(*mockContext);
 }
+
+TEST_F(BeaconSendingInitialStateTest, prepareExecutionDoesNotDelayTheFirstStatusRequest)
+{
+	// given
+	BeaconSendingInitialState_t target;
+
+	// when
+	auto obtained = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(0)));
+}
+
+TEST_F(BeaconSendingInitialStateTest, executePreparedPerformsStateTransitionOnSuccessfulStatusResponse)
+{
+	// with
+	ON_CALL(*mockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockContext, handleStatusResponse(testing::Eq(mockStatusResponse)))
+		.Times(1);
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingCaptureOnState()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, setInitCompleted(true))
+		.Times(1);
+
+	// given
+	BeaconSendingInitialState_t target;
+	target.prepareExecution(*mockContext);
+
+	// when
+	target.executePrepared(*mockContext);
+}
+
+TEST_F(BeaconSendingInitialStateTest, unsuccessfulPreparedExecutionDelaysNextStatusRequestWithoutSleeping)
+{
+	// with
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockHTTPClient, sendStatusRequest())
+		.WillByDefault(testing::Return(errorResponse));
+
+	// expect, retries of a single status request still sleep
+	EXPECT_CALL(*mockContext, sleep(testing::_))
+		.Times(testing::AnyNumber());
+	EXPECT_CALL(*mockContext, sleep(testing::Eq(int64_t(BeaconSendingInitialState_t::REINIT_DELAY_MILLISECONDS[0].count()))))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setInitCompleted(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setNextState(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	BeaconSendingInitialState_t target;
+	target.executePrepared(*mockContext);
+
+	// when
+	auto obtainedOne = target.prepareExecution(*mockContext);
+	target.executePrepared(*mockContext);
+	auto obtainedTwo = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtainedOne, testing::Eq(int64_t(BeaconSendingInitialState_t::REINIT_DELAY_MILLISECONDS[0].count())));
+	ASSERT_THAT(obtainedTwo, testing::Eq(int64_t(BeaconSendingInitialState_t::REINIT_DELAY_MILLISECONDS[1].count())));
+}
+
+TEST_F(BeaconSendingInitialStateTest, tooManyRequestsResponseInPreparedExecutionDelaysByRetryAfter)
+{
+	// with
+	int64_t sleepTime = 1234;
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isTooManyRequestsResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*errorResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*errorResponse, getRetryAfterInMilliseconds())
+		.WillByDefault(testing::Return(sleepTime));
+	ON_CALL(*mockHTTPClient, sendStatusRequest())
+		.WillByDefault(testing::Return(errorResponse));
+
+	// expect
+	EXPECT_CALL(*mockContext, disableCaptureAndClear())
+		.Times(1);
+
+	// given
+	BeaconSendingInitialState_t target;
+	target.executePrepared(*mockContext);
+
+	// when
+	auto obtained = target.prepareExecution(*mockContext);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(sleepTime));
+}
+
+TEST_F(BeaconSendingInitialStateTest, preparedExecutionAbortsInitIfShutdownWasRequested)
+{
+	// with
+	ON_CALL(*mockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockHTTPClient, sendStatusRequest())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mockContext, setInitCompleted(false))
+		.Times(1);
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingTerminalState()))
+		.Times(1);
+
+	// given
+	BeaconSendingInitialState_t target;
+
+	// when
+	target.executePrepared(*mockContext);
+}
@@ -27,6 +27,8 @@
 #include "core/communication/BeaconSendingContext.h"
 #include "core/communication/IBeaconSendingState.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
+#include "core/configuration/IResponseAttributesStore.h"
+#include "core/util/MetricsRegistry.h"
 #include "providers/IHTTPClientProvider.h"
 #include "providers/ITimingProvider.h"
 
@@ -42,6 +44,8 @@ namespace test
 			, mClientConfig(nullptr)
 			, mClientProvider(nullptr)
 			, mTimingProvider(nullptr)
+			, mResponseAttributesStore(nullptr)
+			, mMetricsRegistry(nullptr)
 			, mState(nullptr)
 		{
 		}
@@ -72,6 +76,20 @@ namespace test
 			return *this;
 		}
 
+		TestBeaconSendingContextBuilder& with(
+			std::shared_ptr<core::configuration::IResponseAttributesStore> responseAttributesStore
+		)
+		{
+			mResponseAttributesStore = responseAttributesStore;
+			return *this;
+		}
+
+		TestBeaconSendingContextBuilder& with(std::shared_ptr<core::util::MetricsRegistry> metricsRegistry)
+		{
+			mMetricsRegistry = metricsRegistry;
+			return *this;
+		}
+
 		TestBeaconSendingContextBuilder& with(std::unique_ptr<core::communication::IBeaconSendingState> state)
 		{
 			mState = std::move(state);
@@ -92,6 +110,8 @@ namespace test
 					clientConfig,
 					clientProvider,
 					timingProvider,
+					mResponseAttributesStore,
+					mMetricsRegistry,
 					std::move(mState)
 				);
 			}
@@ -100,7 +120,9 @@ namespace test
 				logger,
 				clientConfig,
 				clientProvider,
-				timingProvider
+				timingProvider,
+				mResponseAttributesStore,
+				mMetricsRegistry
 			);
 		}
 
@@ -109,6 +131,8 @@ namespace test
 		std::shared_ptr<core::configuration::IHTTPClientConfiguration> mClientConfig;
 		std::shared_ptr<providers::IHTTPClientProvider> mClientProvider;
 		std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+		std::shared_ptr<core::configuration::IResponseAttributesStore> mResponseAttributesStore;
+		std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
 		std::unique_ptr<core::communication::IBeaconSendingState> mState;
 	};
 }
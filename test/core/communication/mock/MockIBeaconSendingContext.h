@@ -26,6 +26,7 @@
 
 #include "gmock/gmock.h"
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -59,6 +60,9 @@ class MockIBeaconSendingContext
 
 			ON_CALL(*this, getLastResponseAttributes())
 				.WillByDefault(testing::Return(protocol::ResponseAttributes::withUndefinedDefaults().build()));
+
+			ON_CALL(*this, getShutdownDeadline())
+				.WillByDefault(testing::Return(std::chrono::steady_clock::time_point::max()));
 		}
 
 		~MockIBeaconSendingContext() override = default;
@@ -75,10 +79,44 @@ class MockIBeaconSendingContext
 
 		MOCK_METHOD0(executeCurrentState, void());
 
+		MOCK_METHOD0(prepareCurrentState, int64_t());
+
+		MOCK_METHOD0(executePreparedState, void());
+
 		MOCK_METHOD0(requestShutdown, void());
 
 		MOCK_CONST_METHOD0(isShutdownRequested, bool());
 
+		MOCK_METHOD1(setShutdownDeadline,
+			void(
+				std::chrono::steady_clock::time_point
+			)
+		);
+
+		MOCK_CONST_METHOD0(getShutdownDeadline, std::chrono::steady_clock::time_point());
+
+		MOCK_METHOD3(completeSessionFlush,
+			void(
+				std::shared_ptr<core::objects::SessionInternals>,
+				size_t,
+				size_t
+			)
+		);
+
+		MOCK_METHOD1(finishFlush,
+			openkit::ShutdownResult(
+				bool
+			)
+		);
+
+		MOCK_METHOD1(setTaskExecutor,
+			void(
+				core::util::TaskExecutor*
+			)
+		);
+
+		MOCK_CONST_METHOD0(getTaskExecutor, core::util::TaskExecutor*());
+
 		MOCK_METHOD0(waitForInit, bool());
 
 		MOCK_METHOD1(waitForInit,
@@ -165,6 +203,8 @@ class MockIBeaconSendingContext
 
 		MOCK_METHOD0(getSessionCount, size_t());
 
+		MOCK_METHOD0(getNumberOfUnsentRecords, size_t());
+
 		MOCK_CONST_METHOD0(getCurrentServerID, int32_t());
 
 		MOCK_METHOD1(addSession,
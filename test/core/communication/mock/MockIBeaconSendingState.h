@@ -57,6 +57,18 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD1(prepareExecution,
+			int64_t(
+				core::communication::IBeaconSendingContext&
+			)
+		);
+
+		MOCK_METHOD1(executePrepared,
+			void(
+				core::communication::IBeaconSendingContext&
+			)
+		);
+
 		MOCK_METHOD0(getShutdownState, std::shared_ptr<core::communication::IBeaconSendingState>());
 
 		MOCK_CONST_METHOD0(isTerminalState, bool());
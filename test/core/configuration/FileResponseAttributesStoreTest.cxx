@@ -0,0 +1,192 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "../../api/mock/MockILogger.h"
+
+#include "core/configuration/FileResponseAttributesStore.h"
+#include "protocol/ResponseAttribute.h"
+#include "protocol/ResponseAttributes.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace test;
+
+using FileResponseAttributesStore_t = core::configuration::FileResponseAttributesStore;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using ResponseAttribute_t = protocol::ResponseAttribute;
+using ResponseAttributes_t = protocol::ResponseAttributes;
+
+class FileResponseAttributesStoreTest : public testing::Test
+{
+protected:
+
+	const std::string FILE_PATH = "FileResponseAttributesStoreTest.json";
+	const std::string TEMPORARY_FILE_PATH = FILE_PATH + ".tmp";
+
+	MockNiceILogger_sp mockLogger;
+
+	void SetUp() override
+	{
+		mockLogger = MockILogger::createNice();
+		std::remove(FILE_PATH.c_str());
+	}
+
+	void TearDown() override
+	{
+		std::remove(FILE_PATH.c_str());
+		std::remove(TEMPORARY_FILE_PATH.c_str());
+	}
+
+	void writeFile(const std::string& content)
+	{
+		std::ofstream file(FILE_PATH, std::ios::out | std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+};
+
+TEST_F(FileResponseAttributesStoreTest, loadReturnsNullIfFileDoesNotExist)
+{
+	// given
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// when
+	auto obtained = target.load();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(FileResponseAttributesStoreTest, loadReturnsNullIfFileContainsInvalidJson)
+{
+	// given
+	writeFile("{\"dynamicConfig\":");
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// expect
+	EXPECT_CALL(*mockLogger, mockWarning(testing::_)).Times(1);
+
+	// when
+	auto obtained = target.load();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(FileResponseAttributesStoreTest, loadDoesNotThrowIfFileContainsValuesOfUnexpectedType)
+{
+	// given
+	writeFile("{\"mobileAgentConfig\":{\"maxBeaconSizeKb\":\"large\",\"sendIntervalSec\":[1]},\"dynamicConfig\":7}");
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// when, then
+	ASSERT_NO_THROW(target.load());
+}
+
+TEST_F(FileResponseAttributesStoreTest, storedAttributesAreLoadedByAnotherStore)
+{
+	// given
+	auto attributes = ResponseAttributes_t::withUndefinedDefaults()
+		.withServerId(42)
+		.withMultiplicity(3)
+		.withMaxBeaconSizeInBytes(100 * 1024)
+		.withCapture(false)
+		.build();
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// when
+	auto stored = target.store(attributes);
+	auto obtained = FileResponseAttributesStore_t(mockLogger, FILE_PATH).load();
+
+	// then
+	ASSERT_THAT(stored, testing::Eq(true));
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(42));
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(3));
+	ASSERT_THAT(obtained->getMaxBeaconSizeInBytes(), testing::Eq(100 * 1024));
+	ASSERT_THAT(obtained->isCapture(), testing::Eq(false));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::SEND_INTERVAL), testing::Eq(false));
+}
+
+TEST_F(FileResponseAttributesStoreTest, storeReplacesPreviouslyStoredAttributes)
+{
+	// given
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+	target.store(ResponseAttributes_t::withUndefinedDefaults().withServerId(1).build());
+
+	// when
+	target.store(ResponseAttributes_t::withUndefinedDefaults().withServerId(2).build());
+	auto obtained = target.load();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(2));
+}
+
+TEST_F(FileResponseAttributesStoreTest, storeDoesNotRewriteUnchangedAttributes)
+{
+	// given
+	auto attributes = ResponseAttributes_t::withUndefinedDefaults().withServerId(42).build();
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+	target.store(attributes);
+	writeFile("modified");
+
+	// when
+	auto obtained = target.store(attributes);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	std::ifstream file(FILE_PATH);
+	std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	ASSERT_THAT(content, testing::Eq("modified"));
+}
+
+TEST_F(FileResponseAttributesStoreTest, storeReturnsFalseForNullAttributes)
+{
+	// given
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// when
+	auto obtained = target.store(nullptr);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(FileResponseAttributesStoreTest, storeDoesNotOverwriteTemporaryFileOfAnotherWriter)
+{
+	// given
+	{
+		std::ofstream file(TEMPORARY_FILE_PATH, std::ios::out | std::ios::binary | std::ios::trunc);
+		file << "foreign";
+	}
+	FileResponseAttributesStore_t target(mockLogger, FILE_PATH);
+
+	// when
+	auto obtained = target.store(ResponseAttributes_t::withUndefinedDefaults().withServerId(42).build());
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	std::ifstream file(TEMPORARY_FILE_PATH);
+	std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	ASSERT_THAT(content, testing::Eq("foreign"));
+	ASSERT_THAT(FileResponseAttributesStore_t(mockLogger, FILE_PATH).load()->getServerId(), testing::Eq(42));
+}
@@ -227,4 +227,65 @@ TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopies
 
 	// then
 	ASSERT_THAT(obtained->getTrustManager(), testing::Eq(trustManager));
-}
\ No newline at end of file
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesDeferredSerializationFlag)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, isDeferredSerializationEnabled())
+		.Times(1)
+		.WillOnce(testing::Return(true));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->isDeferredSerializationEnabled(), testing::Eq(true));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderInSidecarModeDisablesDeferredSerialization)
+{
+	// with
+	const std::string sidecarDirectory = "/dev/shm";
+	ON_CALL(*mockOpenKitBuilder, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockOpenKitBuilder, getSidecarDirectory())
+		.WillByDefault(testing::ReturnRef(sidecarDirectory));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->isDeferredSerializationEnabled(), testing::Eq(false));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesStatisticsFlag)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, isStatisticsEnabled())
+		.Times(1)
+		.WillOnce(testing::Return(true));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->isStatisticsEnabled(), testing::Eq(true));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesServerConfigurationFile)
+{
+	// with
+	const std::string serverConfigurationFile = "openkit-server-config.json";
+
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getServerConfigurationFile())
+		.Times(1)
+		.WillOnce(testing::ReturnRef(serverConfigurationFile));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getServerConfigurationFile(), testing::Eq(serverConfigurationFile));
+}
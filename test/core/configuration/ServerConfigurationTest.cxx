@@ -231,6 +231,40 @@ TEST_F(ServerConfigurationTest, creatingAServerConfigurationFromResponseAttribut
 	ASSERT_THAT(target->getMultiplicity(), testing::Eq(multiplicity));
 }
 
+TEST_F(ServerConfigurationTest, creatingAServerConfigurationFromResponseAttributesInstanceCopiesAllValues)
+{
+	// with
+	auto attributes = protocol::ResponseAttributes::withUndefinedDefaults()
+		.withCapture(false)
+		.withCaptureCrashes(false)
+		.withCaptureErrors(true)
+		.withSendIntervalInMilliseconds(1234)
+		.withServerId(73)
+		.withMaxBeaconSizeInBytes(37)
+		.withMultiplicity(5)
+		.withMaxSessionDurationInMilliseconds(4321)
+		.withMaxEventsPerSession(17)
+		.withSessionTimeoutInMilliseconds(2345)
+		.withVisitStoreVersion(2)
+		.build();
+
+	// when
+	auto target = ServerConfiguration_t::from(attributes);
+
+	// then
+	ASSERT_THAT(target->isCaptureEnabled(), testing::Eq(false));
+	ASSERT_THAT(target->isCrashReportingEnabled(), testing::Eq(false));
+	ASSERT_THAT(target->isErrorReportingEnabled(), testing::Eq(true));
+	ASSERT_THAT(target->getSendIntervalInMilliseconds(), testing::Eq(1234));
+	ASSERT_THAT(target->getServerId(), testing::Eq(73));
+	ASSERT_THAT(target->getBeaconSizeInBytes(), testing::Eq(37));
+	ASSERT_THAT(target->getMultiplicity(), testing::Eq(5));
+	ASSERT_THAT(target->getMaxSessionDurationInMilliseconds(), testing::Eq(4321));
+	ASSERT_THAT(target->getMaxEventsPerSession(), testing::Eq(17));
+	ASSERT_THAT(target->getSessionTimeoutInMilliseconds(), testing::Eq(2345));
+	ASSERT_THAT(target->getVisitStoreVersion(), testing::Eq(2));
+}
+
 TEST_F(ServerConfigurationTest, sendingDataToTheServerIsAllowedIfCapturingIsEnabledAndMultiplicityIsGreaterThanZero)
 {
 	// with
@@ -0,0 +1,133 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "mock/MockIBeaconCacheConfiguration.h"
+
+#include "core/configuration/SharedBeaconCacheConfiguration.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace test;
+
+using MockNiceIBeaconCacheConfiguration_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCacheConfiguration>>;
+using SharedBeaconCacheConfiguration_t = core::configuration::SharedBeaconCacheConfiguration;
+
+class SharedBeaconCacheConfigurationTest : public testing::Test
+{
+protected:
+	MockNiceIBeaconCacheConfiguration_sp mockInstanceConfiguration;
+	MockNiceIBeaconCacheConfiguration_sp mockGlobalConfiguration;
+	int64_t numberOfShares;
+
+	void SetUp() override
+	{
+		mockInstanceConfiguration = MockIBeaconCacheConfiguration::createNice();
+		mockGlobalConfiguration = MockIBeaconCacheConfiguration::createNice();
+		numberOfShares = 1;
+
+		ON_CALL(*mockInstanceConfiguration, getMaxRecordAge())
+			.WillByDefault(testing::Return(int64_t(17)));
+		ON_CALL(*mockInstanceConfiguration, getCacheSizeLowerBound())
+			.WillByDefault(testing::Return(int64_t(100)));
+		ON_CALL(*mockInstanceConfiguration, getCacheSizeUpperBound())
+			.WillByDefault(testing::Return(int64_t(200)));
+		ON_CALL(*mockGlobalConfiguration, getMaxRecordAge())
+			.WillByDefault(testing::Return(int64_t(42)));
+		ON_CALL(*mockGlobalConfiguration, getCacheSizeLowerBound())
+			.WillByDefault(testing::Return(int64_t(800)));
+		ON_CALL(*mockGlobalConfiguration, getCacheSizeUpperBound())
+			.WillByDefault(testing::Return(int64_t(1000)));
+	}
+
+	std::shared_ptr<SharedBeaconCacheConfiguration_t> createConfiguration()
+	{
+		return std::make_shared<SharedBeaconCacheConfiguration_t>(
+			mockInstanceConfiguration,
+			mockGlobalConfiguration,
+			[this]() { return numberOfShares; }
+		);
+	}
+};
+
+TEST_F(SharedBeaconCacheConfigurationTest, maxRecordAgeIsTakenFromInstanceConfiguration)
+{
+	// given
+	auto target = createConfiguration();
+
+	// then
+	ASSERT_THAT(target->getMaxRecordAge(), testing::Eq(int64_t(17)));
+}
+
+TEST_F(SharedBeaconCacheConfigurationTest, singleShareGetsGlobalBoundaries)
+{
+	// given
+	auto target = createConfiguration();
+
+	// then
+	ASSERT_THAT(target->getCacheSizeLowerBound(), testing::Eq(int64_t(800)));
+	ASSERT_THAT(target->getCacheSizeUpperBound(), testing::Eq(int64_t(1000)));
+}
+
+TEST_F(SharedBeaconCacheConfigurationTest, boundariesAreSplitEquallyBetweenShares)
+{
+	// given
+	numberOfShares = 4;
+	auto target = createConfiguration();
+
+	// then
+	ASSERT_THAT(target->getCacheSizeLowerBound(), testing::Eq(int64_t(200)));
+	ASSERT_THAT(target->getCacheSizeUpperBound(), testing::Eq(int64_t(250)));
+}
+
+TEST_F(SharedBeaconCacheConfigurationTest, boundariesFollowTheCurrentNumberOfShares)
+{
+	// given
+	auto target = createConfiguration();
+
+	// when
+	numberOfShares = 2;
+
+	// then
+	ASSERT_THAT(target->getCacheSizeUpperBound(), testing::Eq(int64_t(500)));
+}
+
+TEST_F(SharedBeaconCacheConfigurationTest, shareIsAtLeastOneByte)
+{
+	// given
+	numberOfShares = 2000;
+	auto target = createConfiguration();
+
+	// then
+	ASSERT_THAT(target->getCacheSizeLowerBound(), testing::Eq(int64_t(1)));
+	ASSERT_THAT(target->getCacheSizeUpperBound(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(SharedBeaconCacheConfigurationTest, nonPositiveGlobalBoundaryIsNotSplit)
+{
+	// with
+	ON_CALL(*mockGlobalConfiguration, getCacheSizeUpperBound())
+		.WillByDefault(testing::Return(int64_t(-1)));
+
+	// given
+	numberOfShares = 4;
+	auto target = createConfiguration();
+
+	// then
+	ASSERT_THAT(target->getCacheSizeUpperBound(), testing::Eq(int64_t(-1)));
+}
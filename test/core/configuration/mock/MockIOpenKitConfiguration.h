@@ -57,6 +57,8 @@ namespace test
 
 			ON_CALL(*this, getTrustManager())
 				.WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getServerConfigurationFile())
+				.WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 		}
 
 		~MockIOpenKitConfiguration() override = default;
@@ -96,6 +98,12 @@ namespace test
 		MOCK_CONST_METHOD0(getDefaultServerId, int32_t());
 
 		MOCK_CONST_METHOD0(getTrustManager, std::shared_ptr<openkit::ISSLTrustManager>());
+
+		MOCK_CONST_METHOD0(isDeferredSerializationEnabled, bool());
+
+		MOCK_CONST_METHOD0(isStatisticsEnabled, bool());
+
+		MOCK_CONST_METHOD0(getServerConfigurationFile, const std::string&());
 	};
 }
 
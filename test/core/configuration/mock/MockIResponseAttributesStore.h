@@ -0,0 +1,61 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _TEST_CORE_CONFIGURATION_MOCK_MOCKIRESPONSEATTRIBUTESSTORE_H
+#define _TEST_CORE_CONFIGURATION_MOCK_MOCKIRESPONSEATTRIBUTESSTORE_H
+
+#include "core/configuration/IResponseAttributesStore.h"
+#include "protocol/IResponseAttributes.h"
+
+#include "gmock/gmock.h"
+
+#include <memory>
+
+namespace test
+{
+	class MockIResponseAttributesStore
+		: public core::configuration::IResponseAttributesStore
+	{
+	public:
+
+		MockIResponseAttributesStore()
+		{
+			ON_CALL(*this, load())
+				.WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, store(testing::_))
+				.WillByDefault(testing::Return(true));
+		}
+
+		~MockIResponseAttributesStore() override = default;
+
+		static std::shared_ptr<testing::NiceMock<MockIResponseAttributesStore>> createNice()
+		{
+			return std::make_shared<testing::NiceMock<MockIResponseAttributesStore>>();
+		}
+
+		static std::shared_ptr<testing::StrictMock<MockIResponseAttributesStore>> createStrict()
+		{
+			return std::make_shared<testing::StrictMock<MockIResponseAttributesStore>>();
+		}
+
+		MOCK_METHOD0(load, std::shared_ptr<protocol::IResponseAttributes>());
+
+		MOCK_METHOD1(store, bool(std::shared_ptr<protocol::IResponseAttributes>));
+	};
+}
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "gmock/gmock.h"
 
+#include <chrono>
 #include <memory>
 
 namespace test
@@ -55,7 +56,11 @@ namespace test
 
 		MOCK_CONST_METHOD0(isInitialized, bool());
 
-		MOCK_METHOD0(shutdown, void());
+		MOCK_METHOD1(shutdown,
+			openkit::ShutdownResult(
+				std::chrono::steady_clock::time_point /* deadline */
+			)
+		);
 
 		MOCK_CONST_METHOD0(getCurrentServerID, int32_t());
 
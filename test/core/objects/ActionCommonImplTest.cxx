@@ -29,16 +29,23 @@
 #include "core/objects/NullAction.h"
 #include "core/objects/NullWebRequestTracer.h"
 #include "core/objects/WebRequestTracer.h"
+#include "core/util/ObjectPool.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <cstring>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 using namespace test;
 
 using ActionCommonImpl_t = core::objects::ActionCommonImpl;
 using ActionCommonImpl_sp = std::shared_ptr<ActionCommonImpl_t>;
+using EventDescriptor_t = openkit::EventDescriptor;
+using EventDescriptorType_t = openkit::EventDescriptorType;
+using EventType_t = protocol::EventType;
 using IActionCommon_t = core::objects::IActionCommon;
 using IOpenKitObject_t = core::objects::IOpenKitObject;
 using IRootAction_t = openkit::IRootAction;
@@ -51,6 +58,8 @@ using MockNiceIOpenKitObject_t = testing::NiceMock<MockIOpenKitObject>;
 using MockStrictIRootAction_t = testing::StrictMock<MockIRootAction>;
 using NullAction_t = core::objects::NullAction;
 using NullWebRequestTracer_t = core::objects::NullWebRequestTracer;
+using ObjectPool_t = core::util::ObjectPool;
+using ReportedEvent_t = protocol::ReportedEvent;
 using Utf8String_t = core::UTF8String;
 using WebRequestTracer_t = core::objects::WebRequestTracer;
 
@@ -105,6 +114,39 @@ TEST_F(ActionCommonImplTest, reportEvent)
 	target->reportEvent(eventName.getStringData().c_str());
 }
 
+TEST_F(ActionCommonImplTest, reportEventWithLengthReportsGivenNumberOfBytes)
+{
+	// with
+	const char* eventName = "Test Event - ignored";
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportEvent(testing::Eq(ACTION_ID), Utf8String_t("Test Event")))
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportEvent(eventName, 10);
+}
+
+TEST_F(ActionCommonImplTest, reportEventWithZeroLengthDoesNothing)
+{
+	// given
+	auto target = createAction();
+
+	// expect
+	std::stringstream stream;
+	stream << target->toString() << " reportEvent: eventName must not be null or empty";
+	EXPECT_CALL(*mockNiceLogger, mockWarning(stream.str()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockNiceBeacon, reportEvent(testing::_, testing::_))
+		.Times(testing::Exactly(0));
+
+	// when
+	target->reportEvent("Test Event", 0);
+}
+
 TEST_F(ActionCommonImplTest, reportEventDoesNothingIfEventNameIsNull)
 {
 	// given
@@ -215,6 +257,23 @@ TEST_F(ActionCommonImplTest, reportValueIntWithValidValue)
 	target->reportValue(eventName, value);
 }
 
+TEST_F(ActionCommonImplTest, reportValueIntWithLengthReportsGivenNumberOfBytesOfName)
+{
+	// with
+	const char* valueName = "IntegerValue - ignored";
+	const int32_t value = 42;
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportValue(testing::Eq(ACTION_ID), Utf8String_t("IntegerValue"), testing::TypedEq<int32_t>(value)))
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportValue(valueName, 12, value);
+}
+
 TEST_F(ActionCommonImplTest, reportValueIntLogsInvocation)
 {
 	// with
@@ -291,6 +350,23 @@ TEST_F(ActionCommonImplTest, reportValueDoubleWithValidValue)
 	target->reportValue(eventName, value);
 }
 
+TEST_F(ActionCommonImplTest, reportValueDoubleWithLengthReportsGivenNumberOfBytesOfName)
+{
+	// with
+	const char* valueName = "DoubleValue - ignored";
+	const double value = 3.1415;
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportValue(testing::Eq(ACTION_ID), Utf8String_t("DoubleValue"), testing::TypedEq<double>(value)))
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportValue(valueName, 11, value);
+}
+
 TEST_F(ActionCommonImplTest, reportValueDoubleLogsInvocation)
 {
 	// with
@@ -369,6 +445,25 @@ TEST_F(ActionCommonImplTest, reportValueStringWithValueNull)
 	target->reportValue(eventName, value);
 }
 
+TEST_F(ActionCommonImplTest, reportValueStringWithLengthReportsGivenNumberOfBytes)
+{
+	// with
+	const char* buffer = "StringValueThis is a string";
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportValue(
+			testing::Eq(ACTION_ID),
+			Utf8String_t("StringValue"),
+			testing::TypedEq<const Utf8String_t&>(Utf8String_t("This is a string"))
+	)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportValue(buffer, 11, buffer + 11, 16);
+}
+
 TEST_F(ActionCommonImplTest, reportValueStringLogsInvocation)
 {
 	// with
@@ -406,6 +501,27 @@ TEST_F(ActionCommonImplTest, reportErrorWithAllValuesSet)
 	target->reportError(errorName, errorCode, errorReason);
 }
 
+TEST_F(ActionCommonImplTest, reportErrorWithLengthReportsGivenNumberOfBytes)
+{
+	// with
+	const char* buffer = "FATAL ErrorSome reason";
+	const int32_t errorCode = 0x8005037;
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportError(
+			testing::Eq(ACTION_ID),
+			Utf8String_t("FATAL Error"),
+			testing::Eq(errorCode),
+			Utf8String_t("Some reason")
+	)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	//when
+	target->reportError(buffer, 11, errorCode, buffer + 11, 11);
+}
+
 TEST_F(ActionCommonImplTest, reportErrorWithNullErrorNameDoesNotReportTheError)
 {
 	// given
@@ -482,6 +598,137 @@ TEST_F(ActionCommonImplTest, reportErrorLogsInvocation)
 	target->reportError(errorName, errorCode, errorReason);
 }
 
+static EventDescriptor_t createEventDescriptor(EventDescriptorType_t type, const char* name)
+{
+	auto descriptor = EventDescriptor_t();
+	descriptor.type = type;
+	descriptor.name = name;
+	descriptor.nameLength = name != nullptr ? strlen(name) : 0;
+	return descriptor;
+}
+
+TEST_F(ActionCommonImplTest, reportEventsForwardsAllEventsToBeaconInOneCall)
+{
+	// with
+	EventDescriptor_t events[] = {
+		createEventDescriptor(EventDescriptorType_t::NAMED_EVENT, "event"),
+		createEventDescriptor(EventDescriptorType_t::VALUE_INT, "int value"),
+		createEventDescriptor(EventDescriptorType_t::VALUE_DOUBLE, "double value"),
+		createEventDescriptor(EventDescriptorType_t::VALUE_STRING, "string value"),
+		createEventDescriptor(EventDescriptorType_t::FAILURE_ERROR, "error")
+	};
+	events[1].intValue = 42;
+	events[2].doubleValue = 3.125;
+	events[3].stringValue = "value";
+	events[3].stringValueLength = 5;
+	events[4].intValue = -1;
+	events[4].stringValue = "reason";
+	events[4].stringValueLength = 6;
+
+	std::vector<ReportedEvent_t> obtained;
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportEvents(testing::Eq(ACTION_ID), testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::SaveArg<1>(&obtained));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportEvents(events, 5);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(5)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(EventType_t::NAMED_EVENT));
+	ASSERT_THAT(obtained[0].name, testing::Eq(Utf8String_t("event")));
+	ASSERT_THAT(obtained[1].type, testing::Eq(EventType_t::VALUE_INT));
+	ASSERT_THAT(obtained[1].intValue, testing::Eq(42));
+	ASSERT_THAT(obtained[2].type, testing::Eq(EventType_t::VALUE_DOUBLE));
+	ASSERT_THAT(obtained[2].doubleValue, testing::Eq(3.125));
+	ASSERT_THAT(obtained[3].type, testing::Eq(EventType_t::VALUE_STRING));
+	ASSERT_THAT(obtained[3].stringValue, testing::Eq(Utf8String_t("value")));
+	ASSERT_THAT(obtained[4].type, testing::Eq(EventType_t::FAILURE_ERROR));
+	ASSERT_THAT(obtained[4].name, testing::Eq(Utf8String_t("error")));
+	ASSERT_THAT(obtained[4].intValue, testing::Eq(-1));
+	ASSERT_THAT(obtained[4].stringValue, testing::Eq(Utf8String_t("reason")));
+}
+
+TEST_F(ActionCommonImplTest, reportEventsUsesGivenLengthOfStrings)
+{
+	// with
+	const char* buffer = "event nameand value";
+	auto event = createEventDescriptor(EventDescriptorType_t::VALUE_STRING, buffer);
+	event.nameLength = 10;
+	event.stringValue = buffer + 14;
+	event.stringValueLength = 5;
+
+	std::vector<ReportedEvent_t> obtained;
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportEvents(testing::_, testing::_))
+		.WillOnce(testing::SaveArg<1>(&obtained));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportEvents(&event, 1);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].name, testing::Eq(Utf8String_t("event name")));
+	ASSERT_THAT(obtained[0].stringValue, testing::Eq(Utf8String_t("value")));
+}
+
+TEST_F(ActionCommonImplTest, reportEventsSkipsEventsWithNullOrEmptyName)
+{
+	// with
+	EventDescriptor_t events[] = {
+		createEventDescriptor(EventDescriptorType_t::NAMED_EVENT, nullptr),
+		createEventDescriptor(EventDescriptorType_t::NAMED_EVENT, "event"),
+		createEventDescriptor(EventDescriptorType_t::VALUE_INT, "")
+	};
+
+	std::vector<ReportedEvent_t> obtained;
+
+	// given
+	auto target = createAction();
+
+	// expect
+	std::stringstream first;
+	first << target->toString() << " reportEvents: name of event at index 0 must not be null or empty";
+	std::stringstream third;
+	third << target->toString() << " reportEvents: name of event at index 2 must not be null or empty";
+	EXPECT_CALL(*mockNiceLogger, mockWarning(first.str()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockNiceLogger, mockWarning(third.str()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockNiceBeacon, reportEvents(testing::_, testing::_))
+		.WillOnce(testing::SaveArg<1>(&obtained));
+
+	// when
+	target->reportEvents(events, 3);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].name, testing::Eq(Utf8String_t("event")));
+}
+
+TEST_F(ActionCommonImplTest, reportEventsWithoutEventsDoesNotReportToBeacon)
+{
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportEvents(testing::_, testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportEvents(nullptr, 3);
+	target->reportEvents(nullptr, 0);
+}
+
 TEST_F(ActionCommonImplTest, traceWebRequestWithValidUrlStringGivesAppropriateTracer)
 {
 	// with
@@ -501,6 +748,26 @@ TEST_F(ActionCommonImplTest, traceWebRequestWithValidUrlStringGivesAppropriateTr
 	obtained->stop(0);
 }
 
+TEST_F(ActionCommonImplTest, traceWebRequestWithLengthUsesGivenNumberOfBytesOfUrl)
+{
+	// with
+	const char* url = "http://example.com/pages/ - ignored";
+
+	// given
+	auto target = createAction();
+
+	// when
+	auto obtained = target->traceWebRequest(url, 25);
+
+	// then
+	auto tracer = std::dynamic_pointer_cast<WebRequestTracer_t>(obtained);
+	ASSERT_THAT(tracer, testing::NotNull());
+	ASSERT_THAT(tracer->getURL(), testing::Eq(Utf8String_t("http://example.com/pages/")));
+
+	// break dependency cycle: obtained contained in child objects of target
+	obtained->stop(0);
+}
+
 TEST_F(ActionCommonImplTest, traceWebRequestWithUrlContainingParameters)
 {
 	// with
@@ -1077,6 +1344,23 @@ TEST_F(ActionCommonImplTest, reportStringValueDoesNothingIfActionIsLeft)
 }
 
 
+TEST_F(ActionCommonImplTest, reportEventsDoesNothingIfActionIsLeft)
+{
+	// with
+	auto event = createEventDescriptor(EventDescriptorType_t::NAMED_EVENT, "eventName");
+
+	// expect
+	EXPECT_CALL(*mockNiceBeacon, reportEvents(testing::_, testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	auto target = createAction();
+	target->leaveAction();
+
+	// when
+	target->reportEvents(&event, 1);
+}
+
 TEST_F(ActionCommonImplTest, reportErrorDoesNothingIfActionIsLeft)
 {
 	// with
@@ -1217,6 +1501,56 @@ TEST_F(ActionCommonImplTest, enterActionGivesLeafActionInstance)
 	obtained->leaveAction();
 }
 
+TEST_F(ActionCommonImplTest, enterActionAllocatesLeafActionFromObjectPool)
+{
+	// with
+	const char* actionName = "child action";
+	auto rootAction = std::make_shared<MockStrictIRootAction_t>();
+	auto target = createAction();
+	size_t numberOfCachedBlocksBefore = 0;
+	size_t numberOfCachedBlocksAfter = 0;
+
+	// when running on a fresh thread, having an empty pool
+	std::thread([&]()
+	{
+		auto objectPool = ObjectPool_t::getThreadLocalPool();
+		auto obtained = target->enterAction(rootAction, actionName);
+		numberOfCachedBlocksBefore = objectPool->getNumberOfCachedBlocks();
+
+		obtained->leaveAction();
+		obtained = nullptr;
+		numberOfCachedBlocksAfter = objectPool->getNumberOfCachedBlocks();
+	}).join();
+
+	// then leaf action and its implementation are returned to the pool
+	ASSERT_THAT(numberOfCachedBlocksBefore, testing::Eq(size_t(0)));
+	ASSERT_THAT(numberOfCachedBlocksAfter, testing::Eq(size_t(2)));
+}
+
+TEST_F(ActionCommonImplTest, traceWebRequestAllocatesTracerFromObjectPool)
+{
+	// with
+	auto target = createAction();
+	size_t numberOfCachedBlocksBefore = 0;
+	size_t numberOfCachedBlocksAfter = 0;
+
+	// when running on a fresh thread, having an empty pool
+	std::thread([&]()
+	{
+		auto objectPool = ObjectPool_t::getThreadLocalPool();
+		auto obtained = target->traceWebRequest("https://localhost");
+		numberOfCachedBlocksBefore = objectPool->getNumberOfCachedBlocks();
+
+		obtained->stop(200);
+		obtained = nullptr;
+		numberOfCachedBlocksAfter = objectPool->getNumberOfCachedBlocks();
+	}).join();
+
+	// then
+	ASSERT_THAT(numberOfCachedBlocksBefore, testing::Eq(size_t(0)));
+	ASSERT_THAT(numberOfCachedBlocksAfter, testing::Eq(size_t(1)));
+}
+
 TEST_F(ActionCommonImplTest, enterActionAddsLeafActionToListOfChildObjects)
 {
 	// with
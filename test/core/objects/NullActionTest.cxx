@@ -153,4 +153,60 @@ TEST_F(NullActionTest, leaveActionWithNullParent)
 
 	// then
 	ASSERT_THAT(obtained, testing::IsNull());
-}
\ No newline at end of file
+}
+TEST_F(NullActionTest, reportEventRefReturnsSelf)
+{
+	// given
+	auto target = createNullAction();
+
+	// when
+	auto& obtained = target->reportEventRef("event name");
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+}
+
+TEST_F(NullActionTest, reportValueRefReturnsSelf)
+{
+	// given
+	auto target = createNullAction();
+
+	// when
+	auto& obtained = target->reportValueRef("value name", 12)
+		.reportValueRef("value name", 37.73)
+		.reportValueRef("value name", "value");
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+}
+
+TEST_F(NullActionTest, reportErrorRefReturnsSelf)
+{
+	// given
+	auto target = createNullAction();
+
+	// when
+	auto& obtained = target->reportErrorRef("error name", 1337, "something bad");
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+}
+
+TEST_F(NullActionTest, explicitLengthVariantsReturnSelf)
+{
+	// given
+	auto target = createNullAction();
+
+	// when
+	auto obtained = target->reportEvent("event name", 5)
+		->reportValue("value name", 5, 12)
+		->reportValue("value name", 5, 37.73)
+		->reportValue("value name", 5, "value", 5)
+		->reportError("error name", 5, 1337, "something bad", 9);
+	auto& obtainedRef = target->reportEventRef("event name", 5)
+		.reportErrorRef("error name", 5, 1337, "something bad", 9);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(target));
+	ASSERT_THAT(&obtainedRef, testing::Eq(target.get()));
+}
@@ -57,6 +57,20 @@ TEST_F(NullRootActionTest, enteredActionHasNullRootActionAsParent)
 	ASSERT_THAT(nullRootAction, testing::Eq(target));
 }
 
+TEST_F(NullRootActionTest, enterActionReturnsSameNullActionOnEveryCall)
+{
+	// given
+	auto target = NullRootAction_t::INSTANCE;
+
+	// when
+	auto first = target->enterAction("action name");
+	auto second = target->enterAction("other action name");
+
+	// then
+	ASSERT_THAT(first, testing::Eq(second));
+	ASSERT_THAT(first, testing::Eq(NullRootAction_t::CHILD_ACTION));
+}
+
 TEST_F(NullRootActionTest, reportEventReturnsSelf)
 {
 	// given
@@ -125,4 +139,53 @@ TEST_F(NullRootActionTest, traceWebRequestReturnsNullWebRequestTracer)
 	auto nullRootAction = std::dynamic_pointer_cast<NullWebRequestTracer_t>(obtained);
 	ASSERT_THAT(nullRootAction, testing::NotNull());
 	ASSERT_THAT(nullRootAction, testing::Eq(NullWebRequestTracer_t::INSTANCE));
-}
\ No newline at end of file
+}
+TEST_F(NullRootActionTest, reportRefVariantsReturnSelf)
+{
+	// given
+	auto target = NullRootAction_t::INSTANCE;
+
+	// when
+	auto& obtained = target->reportEventRef("event name")
+		.reportValueRef("value name", 12)
+		.reportValueRef("value name", 37.73)
+		.reportValueRef("value name", "value")
+		.reportErrorRef("error name", 1337, "something bad");
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+}
+
+TEST_F(NullRootActionTest, explicitLengthVariantsReturnSelf)
+{
+	// given
+	auto target = NullRootAction_t::INSTANCE;
+
+	// when
+	target->reportEvent("event name", 5)
+		->reportValue("value name", 5, 12)
+		->reportValue("value name", 5, 37.73)
+		->reportValue("value name", 5, "value", 5);
+	auto obtained = target->reportError("error name", 5, 1337, "something bad", 9);
+	auto& obtainedRef = target->reportEventRef("event name", 5)
+		.reportValueRef("value name", 5, 12)
+		.reportValueRef("value name", 5, 37.73)
+		.reportValueRef("value name", 5, "value", 5)
+		.reportErrorRef("error name", 5, 1337, "something bad", 9);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(target));
+	ASSERT_THAT(&obtainedRef, testing::Eq(target.get()));
+}
+
+TEST_F(NullRootActionTest, enterActionWithLengthReturnsSameNullAction)
+{
+	// given
+	auto target = NullRootAction_t::INSTANCE;
+
+	// when
+	auto obtained = target->enterAction("action name", 6);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(NullRootAction_t::CHILD_ACTION));
+}
@@ -55,4 +55,15 @@ TEST_F(NullSessionTest, traceWebRequestReturnsNullWebRequestTracer)
 	auto nullTracer = std::dynamic_pointer_cast<NullWebRequestTracer_t>(obtained);
 	ASSERT_THAT(nullTracer, testing::NotNull());
 	ASSERT_THAT(nullTracer, testing::Eq(NullWebRequestTracer_t::INSTANCE));
-}
\ No newline at end of file
+}
+TEST_F(NullSessionTest, enterActionWithLengthReturnsNullRootAction)
+{
+	// given
+	auto target = NullSession_t::INSTANCE;
+
+	// when
+	auto obtained = target->enterAction("action name", 6);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(std::static_pointer_cast<openkit::IRootAction>(NullRootAction_t::INSTANCE)));
+}
@@ -0,0 +1,284 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mock/MockIOpenKitObject.h"
+
+#include "core/objects/OpenKitComposite.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace test;
+
+using IOpenKitObject_sp = std::shared_ptr<core::objects::IOpenKitObject>;
+using MockNiceIOpenKitObject_t = testing::NiceMock<MockIOpenKitObject>;
+
+class OpenKitCompositeTest : public testing::Test
+{
+protected:
+
+	///
+	/// Minimal composite, closing its children like the OpenKit objects do
+	///
+	class TestComposite : public core::objects::OpenKitComposite
+	{
+	public:
+
+		TestComposite()
+			: mMutex()
+		{
+		}
+
+		void onChildClosed(IOpenKitObject_sp childObject) override
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			removeChildFromList(childObject);
+		}
+
+		void close() override
+		{
+			closeChildObjects(mMutex);
+		}
+
+		IOpenKitObject_sp removeFirstChild()
+		{
+			return removeFirstChildFromList();
+		}
+
+	private:
+
+		std::mutex mMutex;
+	};
+
+	///
+	/// Child object notifying its parent on close
+	///
+	class TestChild : public core::objects::IOpenKitObject, public std::enable_shared_from_this<TestChild>
+	{
+	public:
+
+		TestChild(TestComposite& parent, std::vector<int32_t>& closedChildren, int32_t id)
+			: mParent(parent)
+			, mClosedChildren(closedChildren)
+			, mId(id)
+		{
+		}
+
+		void close() override
+		{
+			mClosedChildren.push_back(mId);
+			mParent.onChildClosed(shared_from_this());
+		}
+
+	private:
+
+		TestComposite& mParent;
+		std::vector<int32_t>& mClosedChildren;
+		const int32_t mId;
+	};
+};
+
+TEST_F(OpenKitCompositeTest, newCompositeHasNoChildObjects)
+{
+	// given
+	TestComposite target;
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::IsEmpty());
+	ASSERT_THAT(target.getNumberOfChildObjects(), testing::Eq(size_t(0)));
+}
+
+TEST_F(OpenKitCompositeTest, childObjectsAreKeptInInsertionOrder)
+{
+	// given
+	TestComposite target;
+	IOpenKitObject_sp childOne = MockIOpenKitObject::createNice();
+	IOpenKitObject_sp childTwo = MockIOpenKitObject::createNice();
+	IOpenKitObject_sp childThree = MockIOpenKitObject::createNice();
+
+	// when
+	target.storeChildInList(childOne);
+	target.storeChildInList(childTwo);
+	target.storeChildInList(childThree);
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::ElementsAre(childOne, childTwo, childThree));
+	ASSERT_THAT(target.getNumberOfChildObjects(), testing::Eq(size_t(3)));
+}
+
+TEST_F(OpenKitCompositeTest, removingFirstMiddleAndLastChildObjectKeepsOrder)
+{
+	// given
+	TestComposite target;
+	std::vector<IOpenKitObject_sp> children;
+	for (int32_t i = 0; i < 5; i++)
+	{
+		children.push_back(MockIOpenKitObject::createNice());
+		target.storeChildInList(children.back());
+	}
+
+	// when
+	target.removeChildFromList(children[2]);
+	target.removeChildFromList(children[0]);
+	target.removeChildFromList(children[4]);
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::ElementsAre(children[1], children[3]));
+	ASSERT_THAT(target.getNumberOfChildObjects(), testing::Eq(size_t(2)));
+
+	// and when adding a child after the last one was removed
+	target.storeChildInList(children[4]);
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::ElementsAre(children[1], children[3], children[4]));
+}
+
+TEST_F(OpenKitCompositeTest, removingChildObjectNotContainedHasNoEffect)
+{
+	// given
+	TestComposite target;
+	TestComposite otherComposite;
+	IOpenKitObject_sp child = MockIOpenKitObject::createNice();
+	IOpenKitObject_sp otherChild = MockIOpenKitObject::createNice();
+	target.storeChildInList(child);
+	otherComposite.storeChildInList(otherChild);
+
+	// when
+	target.removeChildFromList(otherChild);
+	target.removeChildFromList(MockIOpenKitObject::createNice());
+	target.removeChildFromList(nullptr);
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::ElementsAre(child));
+	ASSERT_THAT(otherComposite.getCopyOfChildObjects(), testing::ElementsAre(otherChild));
+}
+
+TEST_F(OpenKitCompositeTest, storingChildObjectTwiceHasNoEffect)
+{
+	// given
+	TestComposite target;
+	TestComposite otherComposite;
+	IOpenKitObject_sp child = MockIOpenKitObject::createNice();
+	target.storeChildInList(child);
+
+	// when
+	target.storeChildInList(child);
+	otherComposite.storeChildInList(child);
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::ElementsAre(child));
+	ASSERT_THAT(otherComposite.getCopyOfChildObjects(), testing::IsEmpty());
+}
+
+TEST_F(OpenKitCompositeTest, compositeKeepsChildObjectsAlive)
+{
+	// given
+	TestComposite target;
+	auto child = MockIOpenKitObject::createNice();
+	std::weak_ptr<MockNiceIOpenKitObject_t> weakChild = child;
+	target.storeChildInList(child);
+
+	// when
+	child = nullptr;
+
+	// then
+	ASSERT_THAT(weakChild.expired(), testing::Eq(false));
+
+	// and when
+	target.removeFirstChild();
+
+	// then
+	ASSERT_THAT(weakChild.expired(), testing::Eq(true));
+}
+
+TEST_F(OpenKitCompositeTest, removeFirstChildFromListReturnsChildObjectsInInsertionOrder)
+{
+	// given
+	TestComposite target;
+	IOpenKitObject_sp childOne = MockIOpenKitObject::createNice();
+	IOpenKitObject_sp childTwo = MockIOpenKitObject::createNice();
+	target.storeChildInList(childOne);
+	target.storeChildInList(childTwo);
+
+	// when, then
+	ASSERT_THAT(target.removeFirstChild(), testing::Eq(childOne));
+	ASSERT_THAT(target.removeFirstChild(), testing::Eq(childTwo));
+	ASSERT_THAT(target.removeFirstChild(), testing::IsNull());
+}
+
+TEST_F(OpenKitCompositeTest, closeClosesChildObjectsInInsertionOrder)
+{
+	// given
+	TestComposite target;
+	std::vector<int32_t> closedChildren;
+	for (int32_t i = 0; i < 3; i++)
+	{
+		target.storeChildInList(std::make_shared<TestChild>(target, closedChildren, i));
+	}
+
+	// when
+	target.close();
+
+	// then
+	ASSERT_THAT(closedChildren, testing::ElementsAre(0, 1, 2));
+	ASSERT_THAT(target.getNumberOfChildObjects(), testing::Eq(size_t(0)));
+}
+
+TEST_F(OpenKitCompositeTest, closeClosesChildObjectsNotRemovingThemselves)
+{
+	// given
+	TestComposite target;
+	auto childOne = MockIOpenKitObject::createStrict();
+	auto childTwo = MockIOpenKitObject::createStrict();
+	target.storeChildInList(childOne);
+	target.storeChildInList(childTwo);
+
+	// expect
+	testing::InSequence s;
+	EXPECT_CALL(*childOne, close()).Times(1);
+	EXPECT_CALL(*childTwo, close()).Times(1);
+
+	// when
+	target.close();
+
+	// then
+	ASSERT_THAT(target.getCopyOfChildObjects(), testing::IsEmpty());
+}
+
+TEST_F(OpenKitCompositeTest, destroyingCompositeWithManyChildObjectsDoesNotOverflowStack)
+{
+	// given
+	std::weak_ptr<MockNiceIOpenKitObject_t> weakChild;
+	{
+		TestComposite target;
+		for (int32_t i = 0; i < 200000; i++)
+		{
+			auto child = MockIOpenKitObject::createNice();
+			if (i == 0)
+			{
+				weakChild = child;
+			}
+			target.storeChildInList(child);
+		}
+	}
+
+	// then
+	ASSERT_THAT(weakChild.expired(), testing::Eq(true));
+}
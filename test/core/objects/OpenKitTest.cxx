@@ -32,15 +32,18 @@
 #include "core/objects/NullSession.h"
 #include "core/objects/OpenKit.h"
 #include "core/objects/Session.h"
+#include "core/util/MetricsRegistry.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <chrono>
 #include <memory>
 
 using namespace test;
 
 using IOpenKitObject_t = core::objects::IOpenKitObject;
+using MetricsRegistry_t = core::util::MetricsRegistry;
 using NullSession_t = core::objects::NullSession;
 using MockIBeaconCache_sp = std::shared_ptr<MockIBeaconCache>;
 using MockIBeaconCacheEvictor_sp = std::shared_ptr<MockIBeaconCacheEvictor>;
@@ -248,7 +251,7 @@ TEST_F(OpenKitTest, shutdownStopsTheBeaconCacheEvictor)
 	auto beaconCacheEvictor = MockIBeaconCacheEvictor::createStrict();
 
 	// expect
-	EXPECT_CALL(*beaconCacheEvictor, stop()).Times(1);
+	EXPECT_CALL(*beaconCacheEvictor, stop(testing::_)).Times(1);
 
 	// given
 	auto target = createOpenKit()
@@ -265,7 +268,7 @@ TEST_F(OpenKitTest, shutdownShutsDownBeaconSender)
 	auto beaconSender = MockIBeaconSender::createStrict();
 
 	// expect
-	EXPECT_CALL(*beaconSender, shutdown()).Times(1);
+	EXPECT_CALL(*beaconSender, shutdown(testing::_)).Times(1);
 
 	// given
 	auto target = createOpenKit()
@@ -276,6 +279,78 @@ TEST_F(OpenKitTest, shutdownShutsDownBeaconSender)
 	target->shutdown();
 }
 
+TEST_F(OpenKitTest, shutdownWithTimeoutPassesDeadlineToBeaconSender)
+{
+	// with
+	auto beaconSender = MockIBeaconSender::createNice();
+	auto timeoutMillis = int64_t(5000);
+	auto minDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMillis);
+
+	// expect
+	EXPECT_CALL(*beaconSender, shutdown(testing::Ge(minDeadline))).Times(1);
+
+	// given
+	auto target = createOpenKit()
+		->with(beaconSender)
+		.build();
+
+	// when
+	target->shutdown(timeoutMillis);
+}
+
+TEST_F(OpenKitTest, shutdownWithTimeoutReturnsResultOfBeaconSender)
+{
+	// with
+	openkit::ShutdownResult senderResult;
+	senderResult.isCompleted = false;
+	senderResult.numberOfFlushedRecords = 17;
+	senderResult.numberOfDroppedRecords = 4;
+
+	auto beaconSender = MockIBeaconSender::createNice();
+	ON_CALL(*beaconSender, shutdown(testing::_))
+		.WillByDefault(testing::Return(senderResult));
+
+	// given
+	auto target = createOpenKit()
+		->with(beaconSender)
+		.build();
+
+	// when
+	auto obtained = target->shutdown(int64_t(5000));
+
+	// then
+	ASSERT_THAT(obtained.isCompleted, testing::Eq(false));
+	ASSERT_THAT(obtained.numberOfFlushedRecords, testing::Eq(17));
+	ASSERT_THAT(obtained.numberOfDroppedRecords, testing::Eq(4));
+}
+
+TEST_F(OpenKitTest, shutdownWithTimeoutASecondTimeReturnsCompletedResultWithoutRecords)
+{
+	// with
+	openkit::ShutdownResult senderResult;
+	senderResult.isCompleted = true;
+	senderResult.numberOfFlushedRecords = 17;
+	senderResult.numberOfDroppedRecords = 4;
+
+	auto beaconSender = MockIBeaconSender::createNice();
+	ON_CALL(*beaconSender, shutdown(testing::_))
+		.WillByDefault(testing::Return(senderResult));
+
+	// given
+	auto target = createOpenKit()
+		->with(beaconSender)
+		.build();
+	target->shutdown(int64_t(5000));
+
+	// when
+	auto obtained = target->shutdown(int64_t(5000));
+
+	// then
+	ASSERT_THAT(obtained.isCompleted, testing::Eq(true));
+	ASSERT_THAT(obtained.numberOfFlushedRecords, testing::Eq(0));
+	ASSERT_THAT(obtained.numberOfDroppedRecords, testing::Eq(0));
+}
+
 TEST_F(OpenKitTest, shutdownClosesAllChildObjects)
 {
 	// with
@@ -324,8 +399,8 @@ TEST_F(OpenKitTest, callingShutdownASecondTimeReturnsImmediately)
 	auto childObjectTwo = MockIOpenKitObject::createStrict();
 
 	// expect
-	EXPECT_CALL(*beaconCacheEvictor, stop()).Times(1);
-	EXPECT_CALL(*beaconSender, shutdown()).Times(1);
+	EXPECT_CALL(*beaconCacheEvictor, stop(testing::_)).Times(1);
+	EXPECT_CALL(*beaconSender, shutdown(testing::_)).Times(1);
 	EXPECT_CALL(*childObjectOne, close()).Times(1);
 	EXPECT_CALL(*childObjectTwo, close()).Times(1);
 
@@ -500,4 +575,46 @@ TEST_F(OpenKitTest, onChildClosedRemovesArgumentFromListOfChildren)
 	// then
 	childObjects = target->getCopyOfChildObjects();
 	ASSERT_THAT(childObjects.size(), testing::Eq(0));
-}
\ No newline at end of file
+}
+
+TEST_F(OpenKitTest, getStatisticsReturnsDisabledStatisticsWithoutMetricsRegistry)
+{
+	// given
+	auto target = createOpenKit()->build();
+
+	// when
+	auto obtained = target->getStatistics();
+
+	// then
+	ASSERT_THAT(obtained.isEnabled, testing::Eq(false));
+	ASSERT_THAT(obtained.numberOfEventRecordsAdded, testing::Eq(int64_t(0)));
+	ASSERT_THAT(obtained.beaconCacheSizeInBytes, testing::Eq(int64_t(0)));
+}
+
+TEST_F(OpenKitTest, getStatisticsContainsValuesOfMetricsRegistryAndBeaconCache)
+{
+	// with
+	auto metricsRegistry = std::make_shared<MetricsRegistry_t>();
+	metricsRegistry->getEventRecordsAdded().add(7);
+	ON_CALL(*mockBeaconCache, getBeaconIDs())
+		.WillByDefault(testing::Return(std::make_shared<const std::vector<int32_t>>(std::vector<int32_t>{ 1, 2 })));
+	ON_CALL(*mockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(int64_t(100)));
+	ON_CALL(*mockBeaconCache, getNumberOfRecords(1))
+		.WillByDefault(testing::Return(size_t(3)));
+	ON_CALL(*mockBeaconCache, getNumberOfRecords(2))
+		.WillByDefault(testing::Return(size_t(4)));
+
+	// given
+	auto target = createOpenKit()->with(metricsRegistry).build();
+
+	// when
+	auto obtained = target->getStatistics();
+
+	// then
+	ASSERT_THAT(obtained.isEnabled, testing::Eq(true));
+	ASSERT_THAT(obtained.numberOfEventRecordsAdded, testing::Eq(int64_t(7)));
+	ASSERT_THAT(obtained.beaconCacheSizeInBytes, testing::Eq(int64_t(100)));
+	ASSERT_THAT(obtained.numberOfCachedSessions, testing::Eq(int64_t(2)));
+	ASSERT_THAT(obtained.numberOfCachedRecords, testing::Eq(int64_t(7)));
+}
@@ -179,4 +179,243 @@ TEST_F(RootActionTest, leaveActionDelegatesToCommonImpl)
 
 	// when
 	target->leaveAction();
-}
\ No newline at end of file
+}
+TEST_F(RootActionTest, reportEventRefDelegatesToCommonImpl)
+{
+	// with
+	const char* eventName = "event name";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportEvent(eventName)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportEventRef(eventName);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportValueRefIntDelegatesToCommonImpl)
+{
+	// with
+	const char* valueName = "IntValue";
+	const int32_t value = 42;
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportValue(testing::Eq(valueName), testing::TypedEq<int32_t>(value))).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportValueRef(valueName, value);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportValueRefDoubleDelegatesToCommonImpl)
+{
+	// with
+	const char* valueName = "DoubleValue";
+	const double value = 42.1337;
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportValue(testing::Eq(valueName), testing::TypedEq<double>(value))).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportValueRef(valueName, value);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportValueRefStringDelegatesToCommonImpl)
+{
+	// with
+	const char* valueName = "StringValue";
+	const char* value = "value";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportValue(testing::Eq(valueName), testing::TypedEq<const char*>(value))).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportValueRef(valueName, value);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportErrorRefDelegatesToCommonImpl)
+{
+	// with
+	const char* errorName = "FATAL ERROR";
+	const int32_t errorCode = 42;
+	const char* reason = "Some reason for this fatal error";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportError(errorName, errorCode, reason)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportErrorRef(errorName, errorCode, reason);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportEventsDelegatesToCommonImpl)
+{
+	// with
+	openkit::EventDescriptor events[2] = {};
+	events[0].type = openkit::EventDescriptorType::NAMED_EVENT;
+	events[0].name = "event";
+	events[0].nameLength = 5;
+	events[1].type = openkit::EventDescriptorType::VALUE_INT;
+	events[1].name = "value";
+	events[1].nameLength = 5;
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportEvents(events, 2)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportEvents(events, 2);
+}
+
+TEST_F(RootActionTest, enterActionWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* actionName = "root action";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, enterAction(testing::_, actionName, 4)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->enterAction(actionName, 4);
+}
+
+TEST_F(RootActionTest, reportEventWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* eventName = "event name";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportEvent(eventName, 5)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	auto obtained = target->reportEvent(eventName, 5);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(target));
+}
+
+TEST_F(RootActionTest, reportValueStringWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* valueName = "StringValue";
+	const char* value = "value";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportValue(valueName, 6, value, 3)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+
+	// when
+	target->reportValue(valueName, 6, value, 3);
+}
+
+TEST_F(RootActionTest, reportValueRefIntWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* valueName = "IntValue";
+	const int32_t value = 42;
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportValue(valueName, 3, testing::TypedEq<int32_t>(value))).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportValueRef(valueName, 3, value);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, reportErrorRefWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* errorName = "FATAL ERROR";
+	const int32_t errorCode = 42;
+	const char* reason = "Some reason for this fatal error";
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, reportError(errorName, 5, errorCode, reason, 11)).Times(testing::Exactly(1));
+
+	// given
+	auto target = createAction();
+	const auto useCount = target.use_count();
+
+	// when
+	auto& obtained = target->reportErrorRef(errorName, 5, errorCode, reason, 11);
+
+	// then
+	ASSERT_THAT(&obtained, testing::Eq(target.get()));
+	ASSERT_THAT(target.use_count(), testing::Eq(useCount));
+}
+
+TEST_F(RootActionTest, traceWebRequestWithLengthDelegatesToCommonImpl)
+{
+	// with
+	const char* url = "https::localhost:9999/1";
+	auto tracer = MockIWebRequestTracerInternals::createStrict();
+
+	// expect
+	EXPECT_CALL(*mockActionImpl, traceWebRequest(url, 16)).Times(testing::Exactly(1));
+
+	// given
+	ON_CALL(*mockActionImpl, traceWebRequest(testing::_, testing::_))
+		.WillByDefault(testing::Return(tracer));
+
+	auto target = createAction();
+
+	// when
+	auto obtained = target->traceWebRequest(url, 16);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(tracer));
+}
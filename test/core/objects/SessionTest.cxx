@@ -155,6 +155,35 @@ TEST_F(SessionTest, enterActionWitnNonEmptyNameGivesRootAction)
 	obtained->leaveAction();
 }
 
+TEST_F(SessionTest, enterActionWithLengthUsesGivenNumberOfBytesOfName)
+{
+	// given
+	auto target = createSession()->build();
+
+	// when
+	auto obtained = target->enterAction("some action - ignored", 11);
+
+	// then
+	auto rootAction = std::dynamic_pointer_cast<RootAction_t>(obtained);
+	ASSERT_THAT(rootAction, testing::NotNull());
+	ASSERT_THAT(rootAction->getActionImpl()->getName(), testing::Eq(Utf8String_t("some action")));
+
+	// break dependency cycle: root action in child objects of session
+	obtained->leaveAction();
+}
+
+TEST_F(SessionTest, enterActionWithZeroLengthGivesNullRootActionObject)
+{
+	// given
+	auto target = createSession()->build();
+
+	// when
+	auto obtained = target->enterAction("some action", 0);
+
+	// then
+	ASSERT_THAT(std::dynamic_pointer_cast<NullRootAction_t>(obtained), testing::NotNull());
+}
+
 TEST_F(SessionTest, enterActionAlwaysGivesANewInstance)
 {
 	// given
@@ -358,6 +387,24 @@ TEST_F(SessionTest, identifyUserWithNonEmptyTagReportsUser)
 	target->identifyUser(userTag);
 }
 
+TEST_F(SessionTest, identifyUserWithLengthReportsGivenNumberOfBytesOfTag)
+{
+	// with
+	auto mockBeaconNice = MockIBeacon::createNice();
+
+	// expect
+	EXPECT_CALL(*mockBeaconNice, identifyUser(Utf8String_t("user")))
+		.Times(1);
+
+	// given
+	auto target = createSession()
+		->with(mockBeaconNice)
+		.build();
+
+	// when
+	target->identifyUser("user - ignored", 4);
+}
+
 TEST_F(SessionTest, identifyUserMultipleTimesAlwaysCallsBeacon)
 {
 	// with
@@ -500,6 +547,25 @@ TEST_F(SessionTest, reportingCrashWithNullReasonAndStacktraceWorks)
 	target->reportCrash(errorName, reason, stacktrace);
 }
 
+TEST_F(SessionTest, reportCrashWithLengthReportsGivenNumberOfBytes)
+{
+	// with
+	auto mockBeaconNice = MockIBeacon::createNice();
+	const char* buffer = "errorNamereasonstacktrace";
+
+	// expect
+	EXPECT_CALL(*mockBeaconNice, reportCrash(Utf8String_t("errorName"), Utf8String_t("reason"), Utf8String_t("stacktrace")))
+		.Times(1);
+
+	// given
+	auto target = createSession()
+		->with(mockBeaconNice)
+		.build();
+
+	// when
+	target->reportCrash(buffer, 9, buffer + 9, 6, buffer + 15, 10);
+}
+
 TEST_F(SessionTest, reportingCrashWithEmptyReasonAndStacktraceStringWorks)
 {
 	// with
@@ -691,6 +757,27 @@ TEST_F(SessionTest, endingASessionRemovesItselfFromParent)
 	target->end();
 }
 
+TEST_F(SessionTest, sessionDoesNotKeepParentAlive)
+{
+	// with
+	auto mockParent = MockIOpenKitComposite::createStrict();
+	std::weak_ptr<testing::StrictMock<MockIOpenKitComposite>> weakParent = mockParent;
+
+	// given
+	auto target = createSession()
+		->with(mockParent)
+		.build();
+
+	// when
+	mockParent = nullptr;
+
+	// then
+	ASSERT_THAT(weakParent.expired(), testing::Eq(true));
+
+	// and when, then ending the session without parent is possible
+	target->end();
+}
+
 TEST_F(SessionTest, endLogsInvocation)
 {
 	// with
@@ -766,6 +853,60 @@ TEST_F(SessionTest, isEmptyForwardsCallToBeacon)
 	target->isEmpty();
 }
 
+TEST_F(SessionTest, getNumberOfRecordsForwardsCallToBeacon)
+{
+	// with
+	auto mockBeaconStrict = MockIBeacon::createStrict();
+
+	// expect
+	EXPECT_CALL(*mockBeaconStrict, getNumberOfRecords())
+		.Times(1);
+
+	// given
+	auto target = createSession()
+		->with(mockBeaconStrict)
+		.build();
+
+	// when
+	target->getNumberOfRecords();
+}
+
+TEST_F(SessionTest, hasReportedFailuresForwardsCallToBeacon)
+{
+	// with
+	auto mockBeaconStrict = MockIBeacon::createStrict();
+
+	// expect
+	EXPECT_CALL(*mockBeaconStrict, hasReportedFailures())
+		.Times(1);
+
+	// given
+	auto target = createSession()
+		->with(mockBeaconStrict)
+		.build();
+
+	// when
+	target->hasReportedFailures();
+}
+
+TEST_F(SessionTest, getStartTimeForwardsCallToBeacon)
+{
+	// with
+	auto mockBeaconStrict = MockIBeacon::createStrict();
+
+	// expect
+	EXPECT_CALL(*mockBeaconStrict, getSessionStartTime())
+		.Times(1);
+
+	// given
+	auto target = createSession()
+		->with(mockBeaconStrict)
+		.build();
+
+	// when
+	target->getStartTime();
+}
+
 TEST_F(SessionTest, updateServerConfigurationForwardsCallToBeacon)
 {
 	// with
@@ -991,6 +1132,26 @@ TEST_F(SessionTest, traceWebRequestWithValidUrlStringGivesAppropriateTracer)
 	target->removeChildFromList(std::dynamic_pointer_cast<IOpenKitObject_t>(obtained));
 }
 
+TEST_F(SessionTest, traceWebRequestWithLengthUsesGivenNumberOfBytesOfUrl)
+{
+	// with
+	const char* url = "http://example.com/pages/ - ignored";
+
+	// given
+	auto target = createSession()->build();
+
+	// when
+	auto obtained = target->traceWebRequest(url, 25);
+
+	// then
+	auto tracer = std::dynamic_pointer_cast<WebRequestTracer_t>(obtained);
+	ASSERT_THAT(tracer, testing::NotNull());
+	ASSERT_THAT(tracer->getURL(), testing::Eq(Utf8String_t("http://example.com/pages/")));
+
+	// break dependency cycle: tracer as child in session
+	target->removeChildFromList(std::dynamic_pointer_cast<IOpenKitObject_t>(obtained));
+}
+
 TEST_F(SessionTest, traceWebRequestWithValidUrlStringAddsTracerToListOfChildren)
 {
 	// with
@@ -137,3 +137,95 @@ TEST_F(WebRequestTracerURLValidityTest, urlStoredDoesNotContainRequestParameters
 	// then
 	ASSERT_EQ(target->getURL(), "https://www.google.com/foo/bar");
 }
+
+TEST_F(WebRequestTracerURLValidityTest, aSchemeWithoutSeparatorIsInvalid)
+{
+	// then
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http:"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http:/"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http:/some.host"));
+}
+
+TEST_F(WebRequestTracerURLValidityTest, anURLRequiresAtLeastOneCharacterAfterTheScheme)
+{
+	// then
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http://"));
+	ASSERT_TRUE(WebRequestTracer_t::isValidURLScheme("http://a"));
+	ASSERT_TRUE(WebRequestTracer_t::isValidURLScheme("http://?"));
+}
+
+TEST_F(WebRequestTracerURLValidityTest, anURLContainingLineTerminatorsIsInvalid)
+{
+	// then
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http://some.host\n"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http://some.host/\r\n/path"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("http://some.host/path?query=\n"));
+}
+
+TEST_F(WebRequestTracerURLValidityTest, anURLMayContainMultiByteCharacters)
+{
+	// then
+	ASSERT_TRUE(WebRequestTracer_t::isValidURLScheme("http://some.host/\xE2\x82\xAC"));
+	ASSERT_FALSE(WebRequestTracer_t::isValidURLScheme("htt\xC3\xA4p://some.host"));
+}
+
+TEST_F(WebRequestTracerURLValidityTest, urlStoredIsCutAtTheFirstQuestionMark)
+{
+	// given
+	Utf8String_t url("https://some.host/\xE2\x82\xAC/path?foo=bar?baz");
+	auto target = createWebRequestTracer()
+		->withUrl(url)
+		.build();
+
+	// then
+	ASSERT_EQ(target->getURL(), "https://some.host/\xE2\x82\xAC/path");
+	ASSERT_EQ(target->getURL().getStringLength(), size_t(24));
+}
+
+TEST_F(WebRequestTracerURLValidityTest, urlEndingWithQuestionMarkIsStoredWithoutIt)
+{
+	// given
+	Utf8String_t url("https://some.host/path?");
+	auto target = createWebRequestTracer()
+		->withUrl(url)
+		.build();
+
+	// then
+	ASSERT_EQ(target->getURL(), "https://some.host/path");
+}
+
+TEST_F(WebRequestTracerURLValidityTest, ifURLContainsALineTerminatorTheDefaultValueIsUsed)
+{
+	// given
+	Utf8String_t url("https://some.host/path?foo=bar\r\n");
+	auto target = createWebRequestTracer()
+		->withUrl(url)
+		.build();
+
+	// then
+	ASSERT_EQ(target->getURL(), "<unknown>");
+}
+
+TEST_F(WebRequestTracerURLValidityTest, getLengthWithoutQueryReturnsNumberOfBytesBeforeTheFirstQuestionMark)
+{
+	// then
+	ASSERT_EQ(WebRequestTracer_t::getLengthWithoutQuery("https://some.host/path?foo=bar?baz"), size_t(22));
+	ASSERT_EQ(WebRequestTracer_t::getLengthWithoutQuery("https://some.host/path"), size_t(22));
+	ASSERT_EQ(WebRequestTracer_t::getLengthWithoutQuery("1337://foo"), std::string::npos);
+}
+
+TEST_F(WebRequestTracerURLValidityTest, urlIsCutAtTheGivenLengthWithoutQuery)
+{
+	// given
+	auto target = std::make_shared<WebRequestTracer_t>(
+		logger,
+		mockParent,
+		mockBeacon,
+		Utf8String_t("https://some.host/path?foo=bar"),
+		size_t(22)
+	);
+
+	// then
+	ASSERT_EQ(target->getURL(), "https://some.host/path");
+}
@@ -34,6 +34,7 @@
 #include "core/configuration/IOpenKitConfiguration.h"
 #include "core/configuration/IPrivacyConfiguration.h"
 #include "core/objects/OpenKit.h"
+#include "core/util/MetricsRegistry.h"
 #include "providers/ISessionIDProvider.h"
 #include "providers/ITimingProvider.h"
 #include "providers/IThreadIDProvider.h"
@@ -56,6 +57,7 @@ namespace test
 			, mBeaconCache(nullptr)
 			, mBeaconSender(nullptr)
 			, mBeaconCacheEvictor(nullptr)
+			, mMetricsRegistry(nullptr)
 		{
 		}
 
@@ -115,6 +117,12 @@ namespace test
 			return *this;
 		}
 
+		TestOpenKitBuilder& with(std::shared_ptr<core::util::MetricsRegistry> metricsRegistry)
+		{
+			mMetricsRegistry = metricsRegistry;
+			return *this;
+		}
+
 		std::shared_ptr<core::objects::OpenKit> build()
 		{
 			auto logger = mLogger != nullptr
@@ -154,7 +162,8 @@ namespace test
 				sessionIdProvider,
 				beaconCache,
 				beaconSender,
-				beaconCacheEvictor
+				beaconCacheEvictor,
+				mMetricsRegistry
 			);
 		}
 
@@ -169,6 +178,7 @@ namespace test
 		std::shared_ptr<core::caching::IBeaconCache> mBeaconCache;
 		std::shared_ptr<core::IBeaconSender> mBeaconSender;
 		std::shared_ptr<core::caching::IBeaconCacheEvictor> mBeaconCacheEvictor;
+		std::shared_ptr<core::util::MetricsRegistry> mMetricsRegistry;
 	};
 }
 
@@ -77,7 +77,8 @@ namespace test
 				logger,
 				parent,
 				beacon,
-				mUrl
+				mUrl,
+				core::objects::WebRequestTracer::getLengthWithoutQuery(mUrl)
 			);
 		}
 
@@ -61,12 +61,27 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD3(enterAction,
+			std::shared_ptr<openkit::IAction>(
+				std::shared_ptr<openkit::IRootAction>,
+				const char*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD1(reportEvent,
 			void(
 				const char*
 			)
 		);
 
+		MOCK_METHOD2(reportEvent,
+			void(
+				const char*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD2(reportValue,
 			void(
 				const char*,
@@ -88,6 +103,31 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD3(reportValue,
+			void(
+				const char*,
+				size_t,
+				int32_t
+			)
+		);
+
+		MOCK_METHOD3(reportValue,
+			void(
+				const char*,
+				size_t,
+				double
+			)
+		);
+
+		MOCK_METHOD4(reportValue,
+			void(
+				const char*,
+				size_t,
+				const char*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD3(reportError,
 			void(
 				const char*,
@@ -96,12 +136,36 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD5(reportError,
+			void(
+				const char*,
+				size_t,
+				int32_t,
+				const char*,
+				size_t
+			)
+		);
+
+		MOCK_METHOD2(reportEvents,
+			void(
+				const openkit::EventDescriptor*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD1(traceWebRequest,
 			std::shared_ptr<openkit::IWebRequestTracer>(
 				const char*
 			)
 		);
 
+		MOCK_METHOD2(traceWebRequest,
+			std::shared_ptr<openkit::IWebRequestTracer>(
+				const char*,
+				size_t
+			)
+		);
+
 		MOCK_METHOD0(leaveAction, bool());
 
 		MOCK_CONST_METHOD0(isActionLeft, bool());
@@ -81,6 +81,38 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD2(enterAction,
+			std::shared_ptr<openkit::IRootAction>(
+				const char*, /* actionName */
+				size_t /* actionNameLength */
+			)
+		);
+
+		MOCK_METHOD2(identifyUser,
+			void(
+				const char*, /* userTag */
+				size_t /* userTagLength */
+			)
+		);
+
+		MOCK_METHOD6(reportCrash,
+			void(
+				const char*, /* errorName */
+				size_t, /* errorNameLength */
+				const char*, /* reason */
+				size_t, /* reasonLength */
+				const char*, /* stacktrace */
+				size_t /* stacktraceLength */
+			)
+		);
+
+		MOCK_METHOD2(traceWebRequest,
+			std::shared_ptr<openkit::IWebRequestTracer>(
+				const char*, /* url */
+				size_t /* urlLength */
+			)
+		);
+
 		MOCK_METHOD0(end, void());
 
 		MOCK_METHOD0(startSession, void());
@@ -93,6 +125,12 @@ namespace test
 
 		MOCK_CONST_METHOD0(isEmpty, bool());
 
+		MOCK_CONST_METHOD0(getNumberOfRecords, size_t());
+
+		MOCK_CONST_METHOD0(hasReportedFailures, bool());
+
+		MOCK_CONST_METHOD0(getStartTime, int64_t());
+
 		MOCK_METHOD0(clearCapturedData, void());
 
 		MOCK_CONST_METHOD0(isSessionEnded, bool());
@@ -0,0 +1,446 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "core/sidecar/SharedMemoryRing.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using SharedMemoryRing_t = core::sidecar::SharedMemoryRing;
+using SidecarRecord_t = core::sidecar::SidecarRecord;
+using SidecarRecordType_t = core::sidecar::SidecarRecordType;
+
+///
+/// A record copied out of the ring, since the payload of a visited record is only valid during the visit
+///
+struct ReadRecord
+{
+	SidecarRecordType_t type;
+	int32_t beaconID;
+	int32_t value;
+	int64_t timestamp;
+	std::string payload;
+};
+
+class SharedMemoryRingTest : public testing::Test
+{
+protected:
+
+	std::string directory;
+
+	void SetUp() override
+	{
+		char directoryTemplate[] = "SharedMemoryRingTest-XXXXXX";
+		ASSERT_THAT(mkdtemp(directoryTemplate), testing::NotNull());
+		directory = directoryTemplate;
+	}
+
+	void TearDown() override
+	{
+		for (const auto& path : SharedMemoryRing_t::listRingFiles(directory))
+		{
+			std::remove(path.c_str());
+		}
+		std::remove((directory + "/other.txt").c_str());
+		rmdir(directory.c_str());
+	}
+
+	std::string ringPath(const std::string& name = "openkit-test.ring")
+	{
+		return directory + "/" + name;
+	}
+
+	static bool writeData(SharedMemoryRing_t& ring, const std::string& payload, int32_t value = 0)
+	{
+		return ring.write(SidecarRecordType_t::EVENT_DATA, 1, 2, value, payload.data(), payload.size());
+	}
+
+	static std::vector<ReadRecord> readAll(SharedMemoryRing_t& ring, size_t maxRecords = 1024)
+	{
+		std::vector<ReadRecord> records;
+		ring.read([&records](const SidecarRecord_t& record)
+		{
+			ReadRecord copy = { record.type, record.beaconID, record.value, record.timestamp,
+				std::string(record.payload, record.payloadSize) };
+			records.push_back(copy);
+		}, maxRecords);
+
+		return records;
+	}
+};
+
+TEST_F(SharedMemoryRingTest, createdRingCanBeOpenedByConsumer)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// when
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+
+	// then
+	ASSERT_THAT(producer, testing::NotNull());
+	ASSERT_THAT(consumer, testing::NotNull());
+	ASSERT_THAT(consumer->getCapacity(), testing::Eq(uint64_t(8 * 1024)));
+	ASSERT_THAT(consumer->getProducerProcessID(), testing::Eq(int64_t(getpid())));
+	ASSERT_THAT(consumer->getPath(), testing::Eq(ringPath()));
+}
+
+TEST_F(SharedMemoryRingTest, capacityIsAtLeastMinimumCapacity)
+{
+	// when
+	auto target = SharedMemoryRing_t::create(ringPath(), 1);
+
+	// then
+	ASSERT_THAT(target->getCapacity(), testing::Eq(SharedMemoryRing_t::MIN_CAPACITY));
+}
+
+TEST_F(SharedMemoryRingTest, createFailsIfRingFileAlreadyExists)
+{
+	// given
+	auto existing = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// when
+	auto obtained = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// then
+	ASSERT_THAT(existing, testing::NotNull());
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(SharedMemoryRingTest, openFailsForFileWhichIsNoRing)
+{
+	// given
+	{
+		std::ofstream file(ringPath("openkit-other.ring"), std::ios::out | std::ios::binary | std::ios::trunc);
+		file << std::string(16 * 1024, 'x');
+	}
+
+	// when
+	auto obtained = SharedMemoryRing_t::open(ringPath("openkit-other.ring"));
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(SharedMemoryRingTest, openFailsForMissingFile)
+{
+	// when
+	auto obtained = SharedMemoryRing_t::open(ringPath());
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(SharedMemoryRingTest, recordsAreReadInWrittenOrder)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+
+	// when
+	ASSERT_TRUE(producer->write(SidecarRecordType_t::BEACON_START, 7, 1000, 3, "start", 5));
+	ASSERT_TRUE(producer->write(SidecarRecordType_t::EVENT_DATA, 7, 1001, 0, "et=1", 4));
+	ASSERT_TRUE(producer->write(SidecarRecordType_t::ACTION_DATA, 7, 1002, 0, "et=2", 4));
+	ASSERT_TRUE(producer->write(SidecarRecordType_t::BEACON_END, 7, 1003, 0, nullptr, 0));
+	auto obtained = readAll(*consumer);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(4)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::BEACON_START));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(7));
+	ASSERT_THAT(obtained[0].value, testing::Eq(3));
+	ASSERT_THAT(obtained[0].timestamp, testing::Eq(1000));
+	ASSERT_THAT(obtained[0].payload, testing::Eq("start"));
+	ASSERT_THAT(obtained[1].type, testing::Eq(SidecarRecordType_t::EVENT_DATA));
+	ASSERT_THAT(obtained[1].payload, testing::Eq("et=1"));
+	ASSERT_THAT(obtained[2].type, testing::Eq(SidecarRecordType_t::ACTION_DATA));
+	ASSERT_THAT(obtained[2].timestamp, testing::Eq(1002));
+	ASSERT_THAT(obtained[3].type, testing::Eq(SidecarRecordType_t::BEACON_END));
+	ASSERT_THAT(obtained[3].payload.empty(), testing::Eq(true));
+	ASSERT_THAT(producer->getNumberOfWrittenRecords(), testing::Eq(uint64_t(4)));
+}
+
+TEST_F(SharedMemoryRingTest, readRecordsAreNotReadAgain)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+	writeData(*producer, "a");
+	readAll(*consumer);
+
+	// when
+	auto obtained = readAll(*consumer);
+
+	// then
+	ASSERT_THAT(obtained.empty(), testing::Eq(true));
+}
+
+TEST_F(SharedMemoryRingTest, readStopsAfterMaximumNumberOfRecords)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+	for (int32_t i = 0; i < 5; i++)
+	{
+		writeData(*producer, "a", i);
+	}
+
+	// when
+	auto first = readAll(*consumer, 3);
+	auto second = readAll(*consumer, 3);
+
+	// then
+	ASSERT_THAT(first.size(), testing::Eq(size_t(3)));
+	ASSERT_THAT(second.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(second[0].value, testing::Eq(3));
+	ASSERT_THAT(second[1].value, testing::Eq(4));
+}
+
+TEST_F(SharedMemoryRingTest, dataRecordIsDroppedIfRingIsFull)
+{
+	// given
+	auto target = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	std::string payload(100, 'x');
+	uint64_t numberOfWrittenRecords = 0;
+	while (writeData(*target, payload))
+	{
+		numberOfWrittenRecords++;
+	}
+
+	// when
+	auto obtained = writeData(*target, payload);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(numberOfWrittenRecords, testing::Gt(uint64_t(0)));
+	ASSERT_THAT(target->getNumberOfWrittenRecords(), testing::Eq(numberOfWrittenRecords));
+	ASSERT_THAT(target->getNumberOfDroppedRecords(), testing::Eq(uint64_t(2)));
+	ASSERT_THAT(target->getNumberOfDroppedBytes(), testing::Eq(uint64_t(200)));
+}
+
+TEST_F(SharedMemoryRingTest, controlRecordUsesSpaceReservedForControlRecords)
+{
+	// given
+	auto target = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	std::string payload(100, 'x');
+	while (writeData(*target, payload))
+	{
+	}
+
+	// when
+	auto obtained = target->write(SidecarRecordType_t::BEACON_END, 1, 2, 0, nullptr, 0);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+}
+
+TEST_F(SharedMemoryRingTest, recordLargerThanRingIsDropped)
+{
+	// given
+	auto target = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	std::string payload(SharedMemoryRing_t::MIN_CAPACITY, 'x');
+
+	// when
+	auto obtained = writeData(*target, payload);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target->getNumberOfDroppedRecords(), testing::Eq(uint64_t(1)));
+}
+
+TEST_F(SharedMemoryRingTest, spaceIsReleasedAfterReading)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+	std::string payload(100, 'x');
+	while (writeData(*producer, payload))
+	{
+	}
+
+	// when
+	readAll(*consumer);
+	auto obtained = writeData(*producer, payload);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+}
+
+TEST_F(SharedMemoryRingTest, recordsWrapAroundTheEndOfTheBuffer)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+
+	// when, then
+	for (int32_t i = 0; i < 1000; i++)
+	{
+		// varying sizes, so that all kinds of remaining space at the end of the buffer occur
+		std::string payload(static_cast<size_t>(i % 301), static_cast<char>('a' + i % 26));
+		ASSERT_TRUE(writeData(*producer, payload, i));
+		if (i % 3 == 0)
+		{
+			ASSERT_TRUE(writeData(*producer, "x", -1));
+		}
+
+		auto obtained = readAll(*consumer);
+
+		ASSERT_THAT(obtained.size(), testing::Eq(i % 3 == 0 ? size_t(2) : size_t(1)));
+		ASSERT_THAT(obtained[0].value, testing::Eq(i));
+		ASSERT_THAT(obtained[0].payload, testing::Eq(payload));
+	}
+	ASSERT_THAT(producer->getNumberOfDroppedRecords(), testing::Eq(uint64_t(0)));
+}
+
+TEST_F(SharedMemoryRingTest, recordsAreTransferredBetweenConcurrentProducerAndConsumer)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), SharedMemoryRing_t::MIN_CAPACITY);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+	const int32_t numberOfRecords = 100000;
+
+	// when
+	std::thread producerThread([&producer, numberOfRecords]()
+	{
+		for (int32_t i = 0; i < numberOfRecords; i++)
+		{
+			auto payload = std::to_string(i);
+			producer->write(SidecarRecordType_t::EVENT_DATA, 1, i, i, payload.data(), payload.size());
+		}
+		producer->markClosed();
+	});
+
+	int32_t lastValue = -1;
+	uint64_t numberOfReadRecords = 0;
+	bool isOrdered = true;
+	auto visitor = [&](const SidecarRecord_t& record)
+	{
+		isOrdered = isOrdered && record.value > lastValue && std::string(record.payload, record.payloadSize) == std::to_string(record.value);
+		lastValue = record.value;
+		numberOfReadRecords++;
+	};
+	while (!consumer->isClosed())
+	{
+		consumer->read(visitor, 64);
+	}
+	while (consumer->read(visitor, 64) > 0)
+	{
+	}
+	producerThread.join();
+
+	// then
+	ASSERT_THAT(isOrdered, testing::Eq(true));
+	ASSERT_THAT(numberOfReadRecords, testing::Eq(consumer->getNumberOfWrittenRecords()));
+	ASSERT_THAT(numberOfReadRecords + consumer->getNumberOfDroppedRecords(), testing::Eq(uint64_t(numberOfRecords)));
+}
+
+TEST_F(SharedMemoryRingTest, closedRingIsReportedToConsumer)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+	ASSERT_THAT(consumer->isClosed(), testing::Eq(false));
+
+	// when
+	producer->markClosed();
+
+	// then
+	ASSERT_THAT(consumer->isClosed(), testing::Eq(true));
+}
+
+TEST_F(SharedMemoryRingTest, producerOfOwnRingIsAlive)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// when
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+
+	// then
+	ASSERT_THAT(consumer->isProducerAlive(), testing::Eq(true));
+}
+
+TEST_F(SharedMemoryRingTest, serverIDIsNotSetInitially)
+{
+	// when
+	auto target = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// then
+	ASSERT_THAT(target->getServerID(), testing::Eq(-1));
+}
+
+TEST_F(SharedMemoryRingTest, serverIDPublishedByConsumerIsVisibleToProducer)
+{
+	// given
+	auto producer = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+	auto consumer = SharedMemoryRing_t::open(ringPath());
+
+	// when
+	consumer->setServerID(42);
+
+	// then
+	ASSERT_THAT(producer->getServerID(), testing::Eq(42));
+}
+
+TEST_F(SharedMemoryRingTest, listRingFilesReturnsSortedRingFilesOnly)
+{
+	// given
+	SharedMemoryRing_t::create(ringPath("openkit-2.ring"), 8 * 1024);
+	SharedMemoryRing_t::create(ringPath("openkit-1.ring"), 8 * 1024);
+	{
+		std::ofstream file(directory + "/other.txt");
+		file << "other";
+	}
+
+	// when
+	auto obtained = SharedMemoryRing_t::listRingFiles(directory);
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(ringPath("openkit-1.ring"), ringPath("openkit-2.ring")));
+}
+
+TEST_F(SharedMemoryRingTest, createdRingFilePathsAreUnique)
+{
+	// when
+	auto first = SharedMemoryRing_t::createRingFilePath(directory);
+	auto second = SharedMemoryRing_t::createRingFilePath(directory);
+
+	// then
+	ASSERT_THAT(first, testing::Ne(second));
+	ASSERT_THAT(first.find(directory + "/openkit-" + std::to_string(getpid()) + "-"), testing::Eq(size_t(0)));
+}
+
+TEST_F(SharedMemoryRingTest, removeDeletesRingFile)
+{
+	// given
+	auto target = SharedMemoryRing_t::create(ringPath(), 8 * 1024);
+
+	// when
+	target->remove();
+
+	// then
+	ASSERT_THAT(SharedMemoryRing_t::listRingFiles(directory).empty(), testing::Eq(true));
+}
@@ -0,0 +1,439 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "../mock/MockIBeaconSender.h"
+#include "../caching/mock/MockIBeaconCacheEvictor.h"
+#include "../configuration/mock/MockIOpenKitConfiguration.h"
+#include "../configuration/mock/MockIPrivacyConfiguration.h"
+#include "../../api/mock/MockILogger.h"
+#include "../../providers/mock/MockISessionIDProvider.h"
+#include "../../providers/mock/MockITimingProvider.h"
+#include "../../DefaultValues.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCache.h"
+#include "core/sidecar/SharedMemoryRing.h"
+#include "core/sidecar/SidecarAgent.h"
+#include "core/sidecar/SidecarBeaconCache.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace test;
+
+using BeaconCache_t = core::caching::BeaconCache;
+using BeaconCache_sp = std::shared_ptr<BeaconCache_t>;
+using MockNiceIBeaconCacheEvictor_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCacheEvictor>>;
+using MockNiceIBeaconSender_sp = std::shared_ptr<testing::NiceMock<MockIBeaconSender>>;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using MockNiceIOpenKitConfiguration_sp = std::shared_ptr<testing::NiceMock<MockIOpenKitConfiguration>>;
+using MockNiceIPrivacyConfiguration_sp = std::shared_ptr<testing::NiceMock<MockIPrivacyConfiguration>>;
+using MockNiceISessionIDProvider_sp = std::shared_ptr<testing::NiceMock<MockISessionIDProvider>>;
+using MockNiceITimingProvider_sp = std::shared_ptr<testing::NiceMock<MockITimingProvider>>;
+using SharedMemoryRing_t = core::sidecar::SharedMemoryRing;
+using SharedMemoryRing_sp = std::shared_ptr<SharedMemoryRing_t>;
+using SidecarAgent_t = core::sidecar::SidecarAgent;
+using SidecarAgent_sp = std::shared_ptr<SidecarAgent_t>;
+using SidecarBeaconCache_t = core::sidecar::SidecarBeaconCache;
+using SidecarRecordType_t = core::sidecar::SidecarRecordType;
+using Utf8String_t = core::UTF8String;
+
+const Utf8String_t APP_ID("appID");
+const Utf8String_t APP_NAME("appName");
+const int32_t AGENT_BEACON_ID = 42;
+const int32_t WORKER_BEACON_ID = 7;
+
+class SidecarAgentTest : public testing::Test
+{
+protected:
+
+	std::string directory;
+
+	MockNiceILogger_sp mockLogger;
+	MockNiceIPrivacyConfiguration_sp mockPrivacyConfig;
+	MockNiceIOpenKitConfiguration_sp mockOpenKitConfig;
+	MockNiceITimingProvider_sp mockTimingProvider;
+	MockNiceISessionIDProvider_sp mockSessionIdProvider;
+	MockNiceIBeaconSender_sp mockBeaconSender;
+	MockNiceIBeaconCacheEvictor_sp mockBeaconCacheEvictor;
+	BeaconCache_sp beaconCache;
+
+	std::vector<SidecarAgent_sp> agents;
+
+	void SetUp() override
+	{
+		char directoryTemplate[] = "SidecarAgentTest-XXXXXX";
+		ASSERT_THAT(mkdtemp(directoryTemplate), testing::NotNull());
+		directory = directoryTemplate;
+
+		mockLogger = MockILogger::createNice();
+		mockPrivacyConfig = MockIPrivacyConfiguration::createNice();
+
+		mockOpenKitConfig = MockIOpenKitConfiguration::createNice();
+		ON_CALL(*mockOpenKitConfig, getApplicationId())
+			.WillByDefault(testing::ReturnRef(APP_ID));
+		ON_CALL(*mockOpenKitConfig, getApplicationName())
+			.WillByDefault(testing::ReturnRef(APP_NAME));
+		ON_CALL(*mockOpenKitConfig, getOperatingSystem())
+			.WillByDefault(testing::ReturnRef(DefaultValues::UTF8_EMPTY_STRING));
+		ON_CALL(*mockOpenKitConfig, getManufacturer())
+			.WillByDefault(testing::ReturnRef(DefaultValues::UTF8_EMPTY_STRING));
+		ON_CALL(*mockOpenKitConfig, getModelId())
+			.WillByDefault(testing::ReturnRef(DefaultValues::UTF8_EMPTY_STRING));
+
+		mockTimingProvider = MockITimingProvider::createNice();
+		mockSessionIdProvider = MockISessionIDProvider::createNice();
+		ON_CALL(*mockSessionIdProvider, getNextSessionID())
+			.WillByDefault(testing::Return(AGENT_BEACON_ID));
+
+		mockBeaconSender = MockIBeaconSender::createNice();
+		mockBeaconCacheEvictor = MockIBeaconCacheEvictor::createNice();
+		beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	}
+
+	void TearDown() override
+	{
+		// sessions created by an agent reference it, shutdown closes them
+		for (const auto& agent : agents)
+		{
+			agent->shutdown(0);
+		}
+		agents.clear();
+
+		for (const auto& path : SharedMemoryRing_t::listRingFiles(directory))
+		{
+			std::remove(path.c_str());
+		}
+		rmdir(directory.c_str());
+	}
+
+	SidecarAgent_sp createAgent()
+	{
+		auto agent = std::make_shared<SidecarAgent_t>(
+			mockLogger,
+			mockPrivacyConfig,
+			mockOpenKitConfig,
+			mockTimingProvider,
+			mockSessionIdProvider,
+			beaconCache,
+			mockBeaconSender,
+			mockBeaconCacheEvictor,
+			nullptr,
+			directory
+		);
+		agents.push_back(agent);
+
+		return agent;
+	}
+
+	SharedMemoryRing_sp createRing(const std::string& name = "openkit-worker.ring", uint64_t capacity = 64 * 1024)
+	{
+		return SharedMemoryRing_t::create(directory + "/" + name, capacity);
+	}
+
+	std::shared_ptr<SidecarBeaconCache_t> createWorkerCache(SharedMemoryRing_sp ring)
+	{
+		return std::make_shared<SidecarBeaconCache_t>(mockLogger, ring, nullptr);
+	}
+};
+
+TEST_F(SidecarAgentTest, scanRingDirectoryAttachesNewRings)
+{
+	// given
+	auto firstRing = createRing("openkit-1.ring");
+	auto secondRing = createRing("openkit-2.ring");
+	auto target = createAgent();
+
+	// when
+	auto obtained = target->scanRingDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(2)));
+	ASSERT_THAT(target->getNumberOfAttachedRings(), testing::Eq(size_t(2)));
+}
+
+TEST_F(SidecarAgentTest, scanRingDirectoryDoesNotAttachRingsTwice)
+{
+	// given
+	auto ring = createRing();
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	auto obtained = target->scanRingDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfAttachedRings(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SidecarAgentTest, scanRingDirectoryPublishesServerIDToRings)
+{
+	// with
+	ON_CALL(*mockBeaconSender, getCurrentServerID())
+		.WillByDefault(testing::Return(17));
+
+	// given
+	auto ring = createRing();
+	auto target = createAgent();
+
+	// when
+	target->scanRingDirectory();
+
+	// then
+	ASSERT_THAT(ring->getServerID(), testing::Eq(17));
+}
+
+TEST_F(SidecarAgentTest, beaconStartRecordCreatesSession)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconSender, addSession(testing::_))
+		.Times(1);
+
+	// given
+	auto ring = createRing();
+	createWorkerCache(ring)->addBeacon(WORKER_BEACON_ID, 1234, 3, "10.0.0.1", "vv=3");
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	auto obtained = target->pollRings();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(1)));
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target->getNumberOfChildObjects(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target->getNumberOfReadRecords(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(SidecarAgentTest, eventAndActionRecordsAreAddedToBeaconCache)
+{
+	// given
+	auto ring = createRing();
+	auto workerCache = createWorkerCache(ring);
+	workerCache->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	workerCache->addEventData(WORKER_BEACON_ID, 1235, "et=1");
+	workerCache->addActionData(WORKER_BEACON_ID, 1236, "et=2");
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(beaconCache->getEvents(AGENT_BEACON_ID), testing::ElementsAre(Utf8String_t("et=1")));
+	ASSERT_THAT(beaconCache->getActions(AGENT_BEACON_ID), testing::ElementsAre(Utf8String_t("et=2")));
+}
+
+TEST_F(SidecarAgentTest, deleteRecordClearsBeaconData)
+{
+	// given
+	auto ring = createRing();
+	auto workerCache = createWorkerCache(ring);
+	workerCache->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	workerCache->addEventData(WORKER_BEACON_ID, 1235, "et=1");
+	workerCache->deleteCacheEntry(WORKER_BEACON_ID);
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(beaconCache->getEvents(AGENT_BEACON_ID).empty(), testing::Eq(true));
+}
+
+TEST_F(SidecarAgentTest, beaconEndRecordEndsSession)
+{
+	// given
+	auto ring = createRing();
+	auto workerCache = createWorkerCache(ring);
+	workerCache->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	workerCache->addEventData(WORKER_BEACON_ID, 1235, "et=1");
+	workerCache->endBeacon(WORKER_BEACON_ID);
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfChildObjects(), testing::Eq(size_t(0)));
+	ASSERT_THAT(beaconCache->getEvents(AGENT_BEACON_ID).size(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SidecarAgentTest, recordsOfUnknownBeaconsAreCountedAsOrphaned)
+{
+	// given
+	auto ring = createRing();
+	auto workerCache = createWorkerCache(ring);
+	workerCache->addEventData(WORKER_BEACON_ID, 1235, "et=1");
+	workerCache->endBeacon(WORKER_BEACON_ID);
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(target->getNumberOfOrphanedRecords(), testing::Eq(int64_t(2)));
+	ASSERT_THAT(beaconCache->getBeaconIDs()->empty(), testing::Eq(true));
+}
+
+TEST_F(SidecarAgentTest, malformedBeaconStartRecordIsCountedAsOrphaned)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconSender, addSession(testing::_))
+		.Times(0);
+
+	// given
+	auto ring = createRing();
+	ring->write(SidecarRecordType_t::BEACON_START, WORKER_BEACON_ID, 1234, 3, "\xff\xff", 2);
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(target->getNumberOfOrphanedRecords(), testing::Eq(int64_t(1)));
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(0)));
+}
+
+TEST_F(SidecarAgentTest, closedRingIsDetachedAndRemovedAfterReadingAllRecords)
+{
+	// given
+	auto ring = createRing();
+	auto workerCache = createWorkerCache(ring);
+	workerCache->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	workerCache->addEventData(WORKER_BEACON_ID, 1235, "et=1");
+	ring->markClosed();
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	auto obtained = target->pollRings();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(2)));
+	ASSERT_THAT(target->getNumberOfAttachedRings(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfChildObjects(), testing::Eq(size_t(0)));
+	ASSERT_THAT(SharedMemoryRing_t::listRingFiles(directory).empty(), testing::Eq(true));
+	ASSERT_THAT(beaconCache->getEvents(AGENT_BEACON_ID).size(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SidecarAgentTest, recordsDroppedByWorkersAreReported)
+{
+	// given
+	auto ring = createRing("openkit-worker.ring", SharedMemoryRing_t::MIN_CAPACITY);
+	std::string payload(100, 'x');
+	while (ring->write(SidecarRecordType_t::EVENT_DATA, WORKER_BEACON_ID, 1, 0, payload.data(), payload.size()))
+	{
+	}
+	auto target = createAgent();
+	target->scanRingDirectory();
+
+	// when
+	auto droppedWhileAttached = target->getNumberOfDroppedRecords();
+	ring->markClosed();
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(droppedWhileAttached, testing::Eq(int64_t(1)));
+	ASSERT_THAT(target->getNumberOfDroppedRecords(), testing::Eq(int64_t(1)));
+	ASSERT_THAT(target->getNumberOfDroppedBytes(), testing::Eq(int64_t(100)));
+}
+
+TEST_F(SidecarAgentTest, initializeStartsEvictorAndSender)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCacheEvictor, start())
+		.Times(1);
+	EXPECT_CALL(*mockBeaconSender, initialize())
+		.Times(1);
+
+	// given
+	auto target = createAgent();
+
+	// when
+	target->initialize();
+}
+
+TEST_F(SidecarAgentTest, shutdownEndsSessionsAndShutsDownSender)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCacheEvictor, stop(testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconSender, shutdown(testing::_))
+		.Times(1);
+
+	// given
+	auto ring = createRing();
+	createWorkerCache(ring)->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	auto target = createAgent();
+	target->scanRingDirectory();
+	target->pollRings();
+
+	// when
+	target->shutdown(1000);
+
+	// then
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfChildObjects(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNumberOfAttachedRings(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SidecarAgentTest, noSessionIsCreatedAfterShutdown)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconSender, addSession(testing::_))
+		.Times(0);
+
+	// given
+	auto ring = createRing();
+	createWorkerCache(ring)->addBeacon(WORKER_BEACON_ID, 1234, 3, "", "vv=3");
+	auto target = createAgent();
+	target->scanRingDirectory();
+	target->shutdown(1000);
+
+	// when
+	target->pollRings();
+
+	// then
+	ASSERT_THAT(target->getNumberOfOpenSessions(), testing::Eq(size_t(0)));
+}
+
+TEST_F(SidecarAgentTest, statisticsAreDisabledWithoutMetricsRegistry)
+{
+	// given
+	auto target = createAgent();
+
+	// when
+	auto obtained = target->getStatistics();
+
+	// then
+	ASSERT_THAT(obtained.isEnabled, testing::Eq(false));
+}
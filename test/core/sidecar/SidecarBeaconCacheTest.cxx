@@ -0,0 +1,237 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "../../api/mock/MockILogger.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCacheRecord.h"
+#include "core/sidecar/SharedMemoryRing.h"
+#include "core/sidecar/SidecarBeaconCache.h"
+#include "core/util/MetricsRegistry.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace test;
+
+using BeaconCacheRecord_t = core::caching::BeaconCacheRecord;
+using MetricsRegistry_t = core::util::MetricsRegistry;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using SharedMemoryRing_t = core::sidecar::SharedMemoryRing;
+using SharedMemoryRing_sp = std::shared_ptr<SharedMemoryRing_t>;
+using SidecarBeaconCache_t = core::sidecar::SidecarBeaconCache;
+using SidecarRecord_t = core::sidecar::SidecarRecord;
+using SidecarRecordType_t = core::sidecar::SidecarRecordType;
+using Utf8String_t = core::UTF8String;
+
+class SidecarBeaconCacheTest : public testing::Test
+{
+protected:
+
+	const std::string RING_PATH = "SidecarBeaconCacheTest.ring";
+
+	MockNiceILogger_sp mockLogger;
+	std::shared_ptr<MetricsRegistry_t> metricsRegistry;
+	SharedMemoryRing_sp ring;
+
+	void SetUp() override
+	{
+		std::remove(RING_PATH.c_str());
+
+		mockLogger = MockILogger::createNice();
+		metricsRegistry = std::make_shared<MetricsRegistry_t>();
+		ring = SharedMemoryRing_t::create(RING_PATH, 64 * 1024);
+	}
+
+	void TearDown() override
+	{
+		std::remove(RING_PATH.c_str());
+	}
+
+	std::shared_ptr<SidecarBeaconCache_t> createCache()
+	{
+		return std::make_shared<SidecarBeaconCache_t>(mockLogger, ring, metricsRegistry);
+	}
+
+	std::vector<SidecarRecord_t> readRecords(std::vector<std::string>& payloads)
+	{
+		std::vector<SidecarRecord_t> records;
+		ring->read([&records, &payloads](const SidecarRecord_t& record)
+		{
+			payloads.push_back(std::string(record.payload, record.payloadSize));
+			records.push_back(record);
+		}, 1024);
+
+		return records;
+	}
+};
+
+TEST_F(SidecarBeaconCacheTest, addEventDataWritesEventRecordToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<std::string> payloads;
+
+	// when
+	target->addEventData(1, 1000, "et=1");
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::EVENT_DATA));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(1));
+	ASSERT_THAT(obtained[0].timestamp, testing::Eq(1000));
+	ASSERT_THAT(payloads[0], testing::Eq("et=1"));
+	ASSERT_THAT(metricsRegistry->getEventRecordsAdded().getValue(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(SidecarBeaconCacheTest, addEventDataWritesAllRecordsToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<BeaconCacheRecord_t> records = { BeaconCacheRecord_t(1000, "et=1"), BeaconCacheRecord_t(1001, "et=2") };
+	std::vector<std::string> payloads;
+
+	// when
+	target->addEventData(1, records);
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(obtained[1].timestamp, testing::Eq(1001));
+	ASSERT_THAT(payloads, testing::ElementsAre("et=1", "et=2"));
+	ASSERT_THAT(metricsRegistry->getEventRecordsAdded().getValue(), testing::Eq(int64_t(2)));
+}
+
+TEST_F(SidecarBeaconCacheTest, addActionDataWritesActionRecordToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<std::string> payloads;
+
+	// when
+	target->addActionData(2, 1000, "et=1");
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::ACTION_DATA));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(2));
+	ASSERT_THAT(payloads[0], testing::Eq("et=1"));
+	ASSERT_THAT(metricsRegistry->getActionRecordsAdded().getValue(), testing::Eq(int64_t(1)));
+}
+
+TEST_F(SidecarBeaconCacheTest, addBeaconWritesBeaconStartRecordToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<std::string> payloads;
+
+	// when
+	target->addBeacon(3, 1234, 5, "10.0.0.1", "vv=3");
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::BEACON_START));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(3));
+	ASSERT_THAT(obtained[0].timestamp, testing::Eq(1234));
+	ASSERT_THAT(obtained[0].value, testing::Eq(5));
+
+	uint32_t ipAddressLength = 0;
+	std::memcpy(&ipAddressLength, payloads[0].data(), sizeof(ipAddressLength));
+	ASSERT_THAT(ipAddressLength, testing::Eq(uint32_t(8)));
+	ASSERT_THAT(payloads[0].substr(sizeof(ipAddressLength)), testing::Eq("10.0.0.1vv=3"));
+}
+
+TEST_F(SidecarBeaconCacheTest, endBeaconWritesBeaconEndRecordToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<std::string> payloads;
+
+	// when
+	target->endBeacon(4);
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::BEACON_END));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(4));
+}
+
+TEST_F(SidecarBeaconCacheTest, deleteCacheEntryWritesDeleteRecordToRing)
+{
+	// given
+	auto target = createCache();
+	std::vector<std::string> payloads;
+
+	// when
+	target->deleteCacheEntry(5);
+	auto obtained = readRecords(payloads);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].type, testing::Eq(SidecarRecordType_t::DELETE_DATA));
+	ASSERT_THAT(obtained[0].beaconID, testing::Eq(5));
+}
+
+TEST_F(SidecarBeaconCacheTest, recordsDroppedByFullRingAreCounted)
+{
+	// given
+	ring = SharedMemoryRing_t::create(RING_PATH + ".small", SharedMemoryRing_t::MIN_CAPACITY);
+	auto target = createCache();
+	Utf8String_t data(std::string(100, 'x').c_str());
+
+	// when
+	for (int32_t i = 0; i < 100; i++)
+	{
+		target->addEventData(1, 1000, data);
+	}
+	ring->remove();
+
+	// then
+	ASSERT_THAT(metricsRegistry->getSidecarRecordsDropped().getValue(), testing::Gt(int64_t(0)));
+	ASSERT_THAT(metricsRegistry->getSidecarRecordsDropped().getValue(), testing::Eq(int64_t(ring->getNumberOfDroppedRecords())));
+	ASSERT_THAT(metricsRegistry->getSidecarBytesDropped().getValue(), testing::Eq(int64_t(ring->getNumberOfDroppedBytes())));
+	ASSERT_THAT(metricsRegistry->getEventRecordsAdded().getValue(), testing::Eq(int64_t(100)));
+}
+
+TEST_F(SidecarBeaconCacheTest, cacheDoesNotHoldAnyData)
+{
+	// given
+	auto target = createCache();
+
+	// when
+	target->addEventData(1, 1000, "et=1");
+	target->addActionData(1, 1000, "et=2");
+
+	// then
+	ASSERT_THAT(target->getBeaconIDs()->empty(), testing::Eq(true));
+	ASSERT_THAT(target->getNumBytesInCache(), testing::Eq(int64_t(0)));
+	ASSERT_THAT(target->isEmpty(1), testing::Eq(true));
+	ASSERT_THAT(target->getNumberOfRecords(1), testing::Eq(size_t(0)));
+	ASSERT_THAT(target->getNextBeaconChunk(1, "prefix", 1024, "&").empty(), testing::Eq(true));
+}
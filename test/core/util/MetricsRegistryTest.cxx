@@ -0,0 +1,234 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "core/util/MetricsRegistry.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <thread>
+#include <vector>
+
+using Counter_t = core::util::Counter;
+using Gauge_t = core::util::Gauge;
+using Histogram_t = core::util::Histogram;
+using MetricsRegistry_t = core::util::MetricsRegistry;
+
+class MetricsRegistryTest : public testing::Test
+{
+};
+
+TEST_F(MetricsRegistryTest, counterStartsWithZero)
+{
+	// given
+	Counter_t target;
+
+	// then
+	ASSERT_THAT(target.getValue(), testing::Eq(int64_t(0)));
+}
+
+TEST_F(MetricsRegistryTest, counterAddsGivenAmounts)
+{
+	// given
+	Counter_t target;
+
+	// when
+	target.add(40);
+	target.increment();
+	target.increment();
+
+	// then
+	ASSERT_THAT(target.getValue(), testing::Eq(int64_t(42)));
+}
+
+TEST_F(MetricsRegistryTest, counterCountsAllConcurrentIncrements)
+{
+	// given
+	Counter_t target;
+	std::vector<std::thread> threads;
+
+	// when
+	for (auto i = 0; i < 4; i++)
+	{
+		threads.emplace_back([&target]()
+		{
+			for (auto j = 0; j < 1000; j++)
+			{
+				target.increment();
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then
+	ASSERT_THAT(target.getValue(), testing::Eq(int64_t(4000)));
+}
+
+TEST_F(MetricsRegistryTest, gaugeCanBeIncreasedAndDecreased)
+{
+	// given
+	Gauge_t target;
+
+	// when
+	target.add(5);
+	target.add(-2);
+
+	// then
+	ASSERT_THAT(target.getValue(), testing::Eq(int64_t(3)));
+}
+
+TEST_F(MetricsRegistryTest, gaugeCanBeSet)
+{
+	// given
+	Gauge_t target;
+	target.add(5);
+
+	// when
+	target.set(17);
+
+	// then
+	ASSERT_THAT(target.getValue(), testing::Eq(int64_t(17)));
+}
+
+TEST_F(MetricsRegistryTest, valuesLessThanOneAreCountedInFirstBucket)
+{
+	// then
+	ASSERT_THAT(Histogram_t::getBucketIndex(-5), testing::Eq(size_t(0)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(0), testing::Eq(size_t(0)));
+}
+
+TEST_F(MetricsRegistryTest, bucketBoundsArePowersOfTwo)
+{
+	// then
+	ASSERT_THAT(Histogram_t::getBucketIndex(1), testing::Eq(size_t(1)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(2), testing::Eq(size_t(2)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(3), testing::Eq(size_t(2)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(4), testing::Eq(size_t(3)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(1023), testing::Eq(size_t(10)));
+	ASSERT_THAT(Histogram_t::getBucketIndex(1024), testing::Eq(size_t(11)));
+}
+
+TEST_F(MetricsRegistryTest, largeValuesAreCountedInLastBucket)
+{
+	// then
+	ASSERT_THAT(Histogram_t::getBucketIndex(INT64_MAX), testing::Eq(openkit::NUMBER_OF_HISTOGRAM_BUCKETS - 1));
+	ASSERT_THAT(Histogram_t::getBucketIndex(int64_t(1) << 40), testing::Eq(openkit::NUMBER_OF_HISTOGRAM_BUCKETS - 1));
+}
+
+TEST_F(MetricsRegistryTest, histogramSnapshotContainsRecordedValues)
+{
+	// given
+	Histogram_t target;
+
+	// when
+	target.record(0);
+	target.record(3);
+	target.record(2);
+	target.record(100);
+
+	// then
+	auto obtained = target.getSnapshot();
+	ASSERT_THAT(obtained.count, testing::Eq(int64_t(4)));
+	ASSERT_THAT(obtained.sum, testing::Eq(int64_t(105)));
+	ASSERT_THAT(obtained.buckets[0], testing::Eq(int64_t(1)));
+	ASSERT_THAT(obtained.buckets[2], testing::Eq(int64_t(2)));
+	ASSERT_THAT(obtained.buckets[7], testing::Eq(int64_t(1)));
+}
+
+TEST_F(MetricsRegistryTest, histogramCountsNegativeValuesAsZero)
+{
+	// given
+	Histogram_t target;
+
+	// when
+	target.record(-10);
+
+	// then
+	auto obtained = target.getSnapshot();
+	ASSERT_THAT(obtained.count, testing::Eq(int64_t(1)));
+	ASSERT_THAT(obtained.sum, testing::Eq(int64_t(0)));
+	ASSERT_THAT(obtained.buckets[0], testing::Eq(int64_t(1)));
+}
+
+TEST_F(MetricsRegistryTest, snapshotOfNewRegistryIsEnabledAndZero)
+{
+	// given
+	MetricsRegistry_t target;
+
+	// when
+	auto obtained = target.getSnapshot();
+
+	// then
+	ASSERT_THAT(obtained.isEnabled, testing::Eq(true));
+	ASSERT_THAT(obtained.numberOfEventRecordsAdded, testing::Eq(int64_t(0)));
+	ASSERT_THAT(obtained.numberOfHTTPRequests, testing::Eq(int64_t(0)));
+	ASSERT_THAT(obtained.httpRequestDurationInMillis.count, testing::Eq(int64_t(0)));
+}
+
+TEST_F(MetricsRegistryTest, snapshotContainsAllMetrics)
+{
+	// given
+	MetricsRegistry_t target;
+
+	// when
+	target.getEventRecordsAdded().add(1);
+	target.getActionRecordsAdded().add(2);
+	target.getRecordsEvictedByAge().add(3);
+	target.getRecordsEvictedBySpace().add(4);
+	target.getBeaconChunkSize().record(5);
+	target.getUncompressedBeaconBytes().add(6);
+	target.getCompressedBeaconBytes().add(7);
+	target.getBeaconSendDuration().record(8);
+	target.getHTTPRequests().add(9);
+	target.getHTTPRetries().add(10);
+	target.getHTTPErrors().add(11);
+	target.getHTTPTooManyRequestsResponses().add(12);
+	target.getHTTPRequestDuration().record(13);
+	target.getSendingSessions().set(14);
+	target.getTimeInInitialState().add(15);
+	target.getTimeInCaptureOnState().add(16);
+	target.getTimeInCaptureOffState().add(17);
+	target.getTimeInFlushSessionsState().add(18);
+	target.getSidecarRecordsDropped().add(19);
+	target.getSidecarBytesDropped().add(20);
+	auto obtained = target.getSnapshot();
+
+	// then
+	ASSERT_THAT(obtained.numberOfEventRecordsAdded, testing::Eq(int64_t(1)));
+	ASSERT_THAT(obtained.numberOfActionRecordsAdded, testing::Eq(int64_t(2)));
+	ASSERT_THAT(obtained.numberOfRecordsEvictedByAge, testing::Eq(int64_t(3)));
+	ASSERT_THAT(obtained.numberOfRecordsEvictedBySpace, testing::Eq(int64_t(4)));
+	ASSERT_THAT(obtained.beaconChunkSizeInBytes.sum, testing::Eq(int64_t(5)));
+	ASSERT_THAT(obtained.numberOfUncompressedBeaconBytes, testing::Eq(int64_t(6)));
+	ASSERT_THAT(obtained.numberOfCompressedBeaconBytes, testing::Eq(int64_t(7)));
+	ASSERT_THAT(obtained.beaconSendDurationInMillis.sum, testing::Eq(int64_t(8)));
+	ASSERT_THAT(obtained.numberOfHTTPRequests, testing::Eq(int64_t(9)));
+	ASSERT_THAT(obtained.numberOfHTTPRetries, testing::Eq(int64_t(10)));
+	ASSERT_THAT(obtained.numberOfHTTPErrors, testing::Eq(int64_t(11)));
+	ASSERT_THAT(obtained.numberOfHTTPTooManyRequestsResponses, testing::Eq(int64_t(12)));
+	ASSERT_THAT(obtained.httpRequestDurationInMillis.sum, testing::Eq(int64_t(13)));
+	ASSERT_THAT(obtained.numberOfSendingSessions, testing::Eq(int64_t(14)));
+	ASSERT_THAT(obtained.timeInInitialStateInMillis, testing::Eq(int64_t(15)));
+	ASSERT_THAT(obtained.timeInCaptureOnStateInMillis, testing::Eq(int64_t(16)));
+	ASSERT_THAT(obtained.timeInCaptureOffStateInMillis, testing::Eq(int64_t(17)));
+	ASSERT_THAT(obtained.timeInFlushSessionsStateInMillis, testing::Eq(int64_t(18)));
+	ASSERT_THAT(obtained.numberOfSidecarRecordsDropped, testing::Eq(int64_t(19)));
+	ASSERT_THAT(obtained.numberOfSidecarBytesDropped, testing::Eq(int64_t(20)));
+}
@@ -0,0 +1,218 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/util/ObjectPool.h"
+#include "core/util/PoolAllocator.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using ObjectPool_t = core::util::ObjectPool;
+
+class ObjectPoolTest : public testing::Test
+{
+};
+
+TEST_F(ObjectPoolTest, newPoolHasNoCachedBlocks)
+{
+	// given
+	ObjectPool_t target;
+
+	// then
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(size_t(0)));
+}
+
+TEST_F(ObjectPoolTest, releasedBlockIsReusedForSameSize)
+{
+	// given
+	ObjectPool_t target;
+	auto block = target.allocate(48);
+	target.deallocate(block, 48);
+
+	// when
+	auto obtained = target.allocate(48);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(block));
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(size_t(0)));
+
+	target.deallocate(obtained, 48);
+}
+
+TEST_F(ObjectPoolTest, releasedBlockIsNotReusedForDifferentSize)
+{
+	// given
+	ObjectPool_t target;
+	auto block = target.allocate(48);
+	target.deallocate(block, 48);
+
+	// when
+	auto obtained = target.allocate(64);
+
+	// then
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(size_t(1)));
+
+	target.deallocate(obtained, 64);
+}
+
+TEST_F(ObjectPoolTest, numberOfCachedBlocksIsLimited)
+{
+	// given
+	ObjectPool_t target(2);
+	auto blockOne = target.allocate(32);
+	auto blockTwo = target.allocate(32);
+	auto blockThree = target.allocate(32);
+
+	// when
+	target.deallocate(blockOne, 32);
+	target.deallocate(blockTwo, 32);
+	target.deallocate(blockThree, 32);
+
+	// then
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(size_t(2)));
+}
+
+TEST_F(ObjectPoolTest, blocksOfTooManyDifferentSizesAreNotCached)
+{
+	// given
+	ObjectPool_t target;
+	std::vector<std::pair<void*, size_t>> blocks;
+	for (size_t i = 0; i <= ObjectPool_t::MAX_NUMBER_OF_BLOCK_SIZES; i++)
+	{
+		auto size = (i + 1) * 16;
+		blocks.push_back({ target.allocate(size), size });
+	}
+
+	// when
+	for (const auto& block : blocks)
+	{
+		target.deallocate(block.first, block.second);
+	}
+
+	// then
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(ObjectPool_t::MAX_NUMBER_OF_BLOCK_SIZES));
+}
+
+TEST_F(ObjectPoolTest, deallocatingNullptrIsIgnored)
+{
+	// given
+	ObjectPool_t target;
+
+	// when
+	target.deallocate(nullptr, 16);
+
+	// then
+	ASSERT_THAT(target.getNumberOfCachedBlocks(), testing::Eq(size_t(0)));
+}
+
+TEST_F(ObjectPoolTest, threadLocalPoolIsSameWithinThread)
+{
+	// when
+	auto obtained = ObjectPool_t::getThreadLocalPool();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(ObjectPool_t::getThreadLocalPool(), testing::Eq(obtained));
+}
+
+TEST_F(ObjectPoolTest, threadLocalPoolDiffersBetweenThreads)
+{
+	// given
+	auto pool = ObjectPool_t::getThreadLocalPool();
+	ObjectPool_t* obtained = nullptr;
+
+	// when
+	std::thread([&obtained]()
+	{
+		obtained = ObjectPool_t::getThreadLocalPool();
+	}).join();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained, testing::Ne(pool));
+}
+
+TEST_F(ObjectPoolTest, allocateSharedReturnsObjectsToThreadLocalPool)
+{
+	// given
+	size_t numberOfCachedBlocksAllocated = 1;
+	size_t numberOfCachedBlocksReleased = 0;
+
+	// when running on a fresh thread, having an empty pool
+	std::thread([&]()
+	{
+		auto pool = ObjectPool_t::getThreadLocalPool();
+		auto obtained = core::util::allocateShared<std::vector<int32_t>>(3, 7);
+		ASSERT_THAT(*obtained, testing::ElementsAre(7, 7, 7));
+		numberOfCachedBlocksAllocated = pool->getNumberOfCachedBlocks();
+
+		obtained = nullptr;
+		numberOfCachedBlocksReleased = pool->getNumberOfCachedBlocks();
+	}).join();
+
+	// then
+	ASSERT_THAT(numberOfCachedBlocksAllocated, testing::Eq(size_t(0)));
+	ASSERT_THAT(numberOfCachedBlocksReleased, testing::Eq(size_t(1)));
+}
+
+TEST_F(ObjectPoolTest, objectReleasedOnAnotherThreadIsCachedInPoolOfThatThread)
+{
+	// given
+	auto object = core::util::allocateShared<int64_t>(42);
+	size_t numberOfCachedBlocks = 0;
+
+	// when
+	std::thread([&]()
+	{
+		object = nullptr;
+		numberOfCachedBlocks = ObjectPool_t::getThreadLocalPool()->getNumberOfCachedBlocks();
+	}).join();
+
+	// then
+	ASSERT_THAT(numberOfCachedBlocks, testing::Eq(size_t(1)));
+}
+
+TEST_F(ObjectPoolTest, allocateSharedCanBeUsedConcurrently)
+{
+	// given
+	std::vector<std::thread> threads;
+	std::vector<size_t> numberOfCachedBlocks(4, 0);
+
+	// when
+	for (size_t i = 0; i < numberOfCachedBlocks.size(); i++)
+	{
+		threads.push_back(std::thread([i, &numberOfCachedBlocks]()
+		{
+			for (int32_t j = 0; j < 1000; j++)
+			{
+				auto object = core::util::allocateShared<int64_t>(j);
+				ASSERT_THAT(*object, testing::Eq(j));
+			}
+			numberOfCachedBlocks[i] = ObjectPool_t::getThreadLocalPool()->getNumberOfCachedBlocks();
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then each thread reused a single block
+	ASSERT_THAT(numberOfCachedBlocks, testing::Each(testing::Eq(size_t(1))));
+}
@@ -0,0 +1,234 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "core/util/CountDownLatch.h"
+#include "core/util/TaskExecutor.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+using CountDownLatch_t = core::util::CountDownLatch;
+using TaskExecutor_t = core::util::TaskExecutor;
+
+class TaskExecutorTest : public testing::Test
+{
+};
+
+TEST_F(TaskExecutorTest, atLeastOneThreadIsStarted)
+{
+	// given
+	TaskExecutor_t target(0);
+
+	// then
+	ASSERT_THAT(target.getNumberOfThreads(), testing::Eq(size_t(1)));
+}
+
+TEST_F(TaskExecutorTest, configuredNumberOfThreadsIsStarted)
+{
+	// given
+	TaskExecutor_t target(3);
+
+	// then
+	ASSERT_THAT(target.getNumberOfThreads(), testing::Eq(size_t(3)));
+}
+
+TEST_F(TaskExecutorTest, scheduledTaskIsExecuted)
+{
+	// with
+	std::promise<void> executed;
+
+	// given
+	TaskExecutor_t target(1);
+
+	// when
+	auto obtained = target.schedule([&executed]() { executed.set_value(); });
+
+	// then
+	ASSERT_THAT(obtained, testing::Ne(TaskExecutor_t::INVALID_TASK_ID));
+	ASSERT_THAT(executed.get_future().wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(TaskExecutorTest, tasksAreExecutedInTheOrderOfTheirDueTime)
+{
+	// with
+	std::mutex mutex;
+	std::vector<int32_t> order;
+	CountDownLatch_t latch(3);
+	auto record = [&mutex, &order, &latch](int32_t value)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			order.push_back(value);
+		}
+		latch.countDown();
+	};
+
+	// given
+	TaskExecutor_t target(1);
+
+	// when
+	target.schedule(std::bind(record, 3), std::chrono::milliseconds(60));
+	target.schedule(std::bind(record, 1));
+	target.schedule(std::bind(record, 2), std::chrono::milliseconds(30));
+	latch.await();
+
+	// then
+	ASSERT_THAT(order, testing::ElementsAre(1, 2, 3));
+}
+
+TEST_F(TaskExecutorTest, delayedTaskIsPendingUntilDue)
+{
+	// given
+	TaskExecutor_t target(1);
+
+	// when
+	target.schedule([]() {}, std::chrono::hours(1));
+
+	// then
+	ASSERT_THAT(target.getNumberOfPendingTasks(), testing::Eq(size_t(1)));
+}
+
+TEST_F(TaskExecutorTest, rescheduledTaskIsExecutedEarlier)
+{
+	// with
+	std::promise<void> executed;
+
+	// given
+	TaskExecutor_t target(1);
+	auto taskID = target.schedule([&executed]() { executed.set_value(); }, std::chrono::hours(1));
+
+	// when
+	auto obtained = target.reschedule(taskID, std::chrono::milliseconds::zero());
+
+	// then
+	ASSERT_TRUE(obtained);
+	ASSERT_THAT(executed.get_future().wait_for(std::chrono::seconds(5)), testing::Eq(std::future_status::ready));
+}
+
+TEST_F(TaskExecutorTest, reschedulingAnUnknownTaskFails)
+{
+	// given
+	TaskExecutor_t target(1);
+
+	// when
+	auto obtained = target.reschedule(42, std::chrono::milliseconds::zero());
+
+	// then
+	ASSERT_FALSE(obtained);
+}
+
+TEST_F(TaskExecutorTest, cancelledTaskIsNotExecuted)
+{
+	// with
+	std::atomic<bool> executed(false);
+
+	// given
+	TaskExecutor_t target(1);
+	auto taskID = target.schedule([&executed]() { executed = true; }, std::chrono::hours(1));
+
+	// when
+	auto obtained = target.cancel(taskID);
+
+	// then
+	ASSERT_TRUE(obtained);
+	ASSERT_THAT(target.getNumberOfPendingTasks(), testing::Eq(size_t(0)));
+	ASSERT_FALSE(executed);
+}
+
+TEST_F(TaskExecutorTest, cancellingARunningTaskWaitsUntilItIsFinished)
+{
+	// with
+	std::promise<void> started;
+	std::atomic<bool> finished(false);
+
+	// given
+	TaskExecutor_t target(1);
+	auto taskID = target.schedule([&started, &finished]()
+	{
+		started.set_value();
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		finished = true;
+	});
+	started.get_future().wait();
+
+	// when
+	auto obtained = target.cancel(taskID);
+
+	// then
+	ASSERT_FALSE(obtained);
+	ASSERT_TRUE(finished);
+}
+
+TEST_F(TaskExecutorTest, shutdownDiscardsPendingTasks)
+{
+	// with
+	std::atomic<bool> executed(false);
+
+	// given
+	TaskExecutor_t target(1);
+	target.schedule([&executed]() { executed = true; }, std::chrono::hours(1));
+
+	// when
+	auto obtained = target.shutdown(std::chrono::seconds(5));
+
+	// then
+	ASSERT_TRUE(obtained);
+	ASSERT_THAT(target.getNumberOfPendingTasks(), testing::Eq(size_t(0)));
+	ASSERT_FALSE(executed);
+}
+
+TEST_F(TaskExecutorTest, shutdownReturnsFalseIfRunningTaskDoesNotFinishInTime)
+{
+	// with
+	std::promise<void> started;
+	CountDownLatch_t release(1);
+
+	// given
+	TaskExecutor_t target(1);
+	target.schedule([&started, &release]()
+	{
+		started.set_value();
+		release.await();
+	});
+	started.get_future().wait();
+
+	// when
+	auto obtained = target.shutdown(std::chrono::milliseconds(10));
+
+	// then
+	ASSERT_FALSE(obtained);
+
+	release.countDown();
+}
+
+TEST_F(TaskExecutorTest, noTasksAreScheduledAfterShutdown)
+{
+	// given
+	TaskExecutor_t target(1);
+	target.shutdown(std::chrono::seconds(5));
+
+	// when
+	auto obtained = target.schedule([]() {});
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(TaskExecutor_t::INVALID_TASK_ID));
+}
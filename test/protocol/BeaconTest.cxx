@@ -45,12 +45,15 @@
 #include "protocol/EventType.h"
 #include "protocol/ProtocolConstants.h"
 
+#include <limits>
 #include <sstream>
 
 using namespace test;
 
+using Beacon_t = protocol::Beacon;
 using BeaconBuilder_sp = std::shared_ptr<TestBeaconBuilder>;
 using BeaconCache_t = core::caching::BeaconCache;
+using BeaconCacheRecord_t = core::caching::BeaconCacheRecord;
 using CrashReportingLevel_t = openkit::CrashReportingLevel;
 using DataCollectionLevel_t = openkit::DataCollectionLevel;
 using EventType_t = protocol::EventType;
@@ -65,6 +68,7 @@ using MockISessionIDProvider_sp = std::shared_ptr<MockISessionIDProvider>;
 using MockIThreadIDProvider_sp = std::shared_ptr<MockIThreadIDProvider>;
 using MockITimingProvider_sp = std::shared_ptr<MockITimingProvider>;
 using MockIBeaconCache_sp = std::shared_ptr<MockIBeaconCache>;
+using ReportedEvent_t = protocol::ReportedEvent;
 using UrlEncoding_t = core::util::URLEncoding;
 using Utf8String_t = core::UTF8String;
 using WebRequestTracer_t = core::objects::WebRequestTracer;
@@ -165,6 +169,22 @@ protected:
 
 		return builder;
 	}
+
+	std::shared_ptr<protocol::Beacon> createRemoteBeacon(const Utf8String_t& immutableBeaconData)
+	{
+		return std::make_shared<protocol::Beacon>(
+			mockLogger,
+			mockBeaconCache,
+			mockBeaconConfiguration,
+			Utf8String_t("10.0.0.1"),
+			SESSION_ID + 1,
+			1234,
+			immutableBeaconData,
+			mockSessionIDProvider,
+			mockTimingProvider,
+			nullptr
+		);
+	}
 };
 
 TEST_F(BeaconTest, defaultBeaconConfigurationDoesNotDisableCapturing)
@@ -399,6 +419,8 @@ TEST_F(BeaconTest, addEndSessionEvent)
 		0,											// session end time
 		testing::Eq(s.str())
 	)).Times(1);
+	EXPECT_CALL(*mockBeaconCache, endBeacon(SESSION_ID))
+		.Times(1);
 
 	// given
 	auto target = createBeacon()->build();
@@ -849,7 +871,7 @@ TEST_F(BeaconTest, canAddSentBytesToWebRequestTracer)
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesSent(numBytesSent)->stop(-1); // will add the web request to the beacon
@@ -882,7 +904,7 @@ TEST_F(BeaconTest, canAddSentBytesValueZeroToWebRequestTracer)
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesSent(numBytesSent)->stop(-1); // will add the web request to the beacon
@@ -914,7 +936,7 @@ TEST_F(BeaconTest, cannotAddSentBytesWithInvalidValueSmallerZeroToWebRequestTrac
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesSent(numBytesSent)->stop(-1); // will add the web request to the beacon
@@ -947,7 +969,7 @@ TEST_F(BeaconTest, canAddReceivedBytesToWebRequestTracer)
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesReceived(numBytesReceived)->stop(-1); // will add the web request to the beacon
@@ -980,7 +1002,7 @@ TEST_F(BeaconTest, canAddReceivedBytesValueZeroToWebRequestTracer)
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesReceived(numBytesReceived)->stop(-1); // will add the web request to the beacon
@@ -1012,7 +1034,7 @@ TEST_F(BeaconTest, cannotAddReceivedBytesWithInvalidValueSmallerZeroToWebRequest
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()->setBytesReceived(numBytesReceived)->stop(-1); // will add the web request to the beacon
@@ -1047,7 +1069,7 @@ TEST_F(BeaconTest, canAddBothSentBytesAndReceivedBytesToWebRequestTracer)
 	// given
 	auto target = createBeacon()->build();
 
-	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url);
+	auto tracer = std::make_shared<WebRequestTracer_t>(mockLogger, mockParent, target, url, url.getStringData().size());
 
 	// when
 	tracer->start()
@@ -1140,7 +1162,7 @@ TEST_F(BeaconTest, sendValidData)
 		.WillByDefault(testing::Return(responseCode));
 
 	auto httpClient = MockIHTTPClient::createNice();
-	ON_CALL(*httpClient, sendBeaconRequest(testing::_, testing::_))
+	ON_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
 		.WillByDefault(testing::Return(statusResponse));
 
 	auto httpClientProvider = MockIHTTPClientProvider::createNice();
@@ -1148,7 +1170,7 @@ TEST_F(BeaconTest, sendValidData)
 		.WillByDefault(testing::Return(httpClient));
 
 	// expect
-	EXPECT_CALL(*httpClient, sendBeaconRequest(testing::Eq(ipAddress), testing::_))
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::Eq(ipAddress), testing::_))
 		.Times(1);
 
 	// given
@@ -1180,7 +1202,7 @@ TEST_F(BeaconTest, sendDataAndFakeErrorResponse)
 		.WillByDefault(testing::Return(true));
 
 	auto httpClient = MockIHTTPClient::createNice();
-	ON_CALL(*httpClient, sendBeaconRequest(testing::_, testing::_))
+	ON_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
 		.WillByDefault(testing::Return(statusResponse));
 
 	auto httpClientProvider = MockIHTTPClientProvider::createNice();
@@ -1188,7 +1210,7 @@ TEST_F(BeaconTest, sendDataAndFakeErrorResponse)
 		.WillByDefault(testing::Return(httpClient));
 
 	// expect
-	EXPECT_CALL(*httpClient, sendBeaconRequest(testing::Eq(ipAddress), testing::_))
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::Eq(ipAddress), testing::_))
 		.Times(1);
 
 	// given
@@ -1206,226 +1228,852 @@ TEST_F(BeaconTest, sendDataAndFakeErrorResponse)
 	ASSERT_THAT(obtained->getResponseCode(), testing::Eq(responseCode));
 }
 
-TEST_F(BeaconTest, clearDataFromBeaconCache)
+TEST_F(BeaconTest, sendSendsAllChunksAndRemovesThemFromBeaconCache)
 {
-	// given
+	// with
+	ON_CALL(*mockServerConfiguration, getBeaconSizeInBytes())
+		.WillByDefault(testing::Return(1)); // each chunk contains only one record
 	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
 
+	auto statusResponse = MockIStatusResponse::createNice();
+	ON_CALL(*statusResponse, getResponseCode())
+		.WillByDefault(testing::Return(200));
+
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	// expect
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
+		.Times(3)
+		.WillRepeatedly(testing::Return(statusResponse));
+
+	// given
 	auto target = createBeacon()
 		->with(beaconCache)
 		.build();
 
-	auto action = MockIActionCommon::createNice();
-
-	target->addAction(action);
-	target->reportValue(ACTION_ID, "IntValue", 42);
-	target->reportValue(ACTION_ID, "DoubleValue", 3.1415);
-	target->reportValue(ACTION_ID, "StringValue", "HelloWorld");
-	target->reportEvent(ACTION_ID, "SomeEvent");
-	target->reportError(ACTION_ID, "SomeError", -123, "SomeReason");
-	target->reportCrash("SomeCrash", "SomeReason", "SomeStacktrace");
-	target->endSession();
+	target->reportEvent(ACTION_ID, "FirstEvent");
+	target->reportEvent(ACTION_ID, "SecondEvent");
+	target->reportEvent(ACTION_ID, "ThirdEvent");
 
 	// when
-	target->clearData();
+	auto obtained = target->send(httpClientProvider);
 
 	// then
+	ASSERT_THAT(obtained, testing::Eq(statusResponse));
 	ASSERT_THAT(target->isEmpty(), testing::Eq(true));
 }
 
-TEST_F(BeaconTest, clearDataForwardsCallToBeaconCache)
+TEST_F(BeaconTest, sendSendsAllChunksPreparedAheadAndRemovesThemFromBeaconCache)
 {
+	// with
+	ON_CALL(*mockServerConfiguration, getBeaconSizeInBytes())
+		.WillByDefault(testing::Return(1)); // each chunk contains only one record
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto statusResponse = MockIStatusResponse::createNice();
+	ON_CALL(*statusResponse, getResponseCode())
+		.WillByDefault(testing::Return(200));
+
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
 	// expect
-	EXPECT_CALL(*mockBeaconCache, deleteCacheEntry(SESSION_ID))
-		.Times(1);
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
+		.Times(3)
+		.WillRepeatedly(testing::Return(statusResponse));
 
 	// given
-	auto target = createBeacon()->build();
+	Beacon_t::globalInit();
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	target->reportEvent(ACTION_ID, "FirstEvent");
+	target->reportEvent(ACTION_ID, "SecondEvent");
+	target->reportEvent(ACTION_ID, "ThirdEvent");
 
 	// when
-	target->clearData();
+	auto obtained = target->send(httpClientProvider);
+	Beacon_t::globalDestroy();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(statusResponse));
+	ASSERT_THAT(target->isEmpty(), testing::Eq(true));
 }
 
-TEST_F(BeaconTest, noSessionIsAddedIfCapturingDisabled)
+TEST_F(BeaconTest, sendDoesNotPrepareAnotherChunkIfCacheHasNoMoreChunks)
 {
-	// given
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	// with
+	auto statusResponse = MockIStatusResponse::createNice();
+
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, getNextBeaconChunk(SESSION_ID, testing::_, testing::_, testing::_))
+		.Times(1)
+		.WillOnce(testing::Return(Utf8String_t("chunk")));
+	EXPECT_CALL(*mockBeaconCache, hasMoreChunks(SESSION_ID))
+		.Times(1)
+		.WillOnce(testing::Return(false));
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
+		.Times(1)
+		.WillOnce(testing::Return(statusResponse));
+	EXPECT_CALL(*mockBeaconCache, removeChunkedData(SESSION_ID))
+		.Times(1);
 
+	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->endSession();
+	// when
+	target->send(httpClientProvider);
 }
 
-TEST_F(BeaconTest, noActionIsAddedIfCapturingDisabled)
+TEST_F(BeaconTest, sendDoesNotPrepareAnotherChunkIfSendingFails)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
 
-	auto action = MockIActionCommon::createNice();
-	ON_CALL(*action, getID())
-		.WillByDefault(testing::Return(ACTION_ID));
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, getNextBeaconChunk(SESSION_ID, testing::_, testing::_, testing::_))
+		.Times(1)
+		.WillOnce(testing::Return(Utf8String_t("chunk")));
+	EXPECT_CALL(*mockBeaconCache, hasMoreChunks(SESSION_ID))
+		.Times(1)
+		.WillOnce(testing::Return(true));
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
+		.Times(1)
+		.WillOnce(testing::Return(errorResponse));
+	EXPECT_CALL(*mockBeaconCache, resetChunkedData(SESSION_ID))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, removeChunkedData(SESSION_ID))
+		.Times(0);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->addAction(action);
+	// when
+	auto obtained = target->send(httpClientProvider);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(errorResponse));
 }
 
-TEST_F(BeaconTest, noIntValueIsReportedIfCapturingIsDisabled)
+TEST_F(BeaconTest, sendRestoresAllNotSentChunksIfSendingFails)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+	ON_CALL(*mockServerConfiguration, getBeaconSizeInBytes())
+		.WillByDefault(testing::Return(1)); // each chunk contains only one record
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto successResponse = MockIStatusResponse::createNice();
+	ON_CALL(*successResponse, isErroneousResponse())
 		.WillByDefault(testing::Return(false));
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
 
-	int32_t value = 42;
-	Utf8String_t valueName("IntValue");
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	// expect
+	EXPECT_CALL(*httpClient, sendCompressedBeaconRequest(testing::_, testing::_))
+		.Times(4)
+		.WillOnce(testing::Return(successResponse))
+		.WillOnce(testing::Return(errorResponse))
+		.WillRepeatedly(testing::Return(successResponse));
 
 	// given
-	auto target = createBeacon()->build();
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
 
-	// when, expect no interaction with beacon cache
-	target->reportValue(ACTION_ID, valueName, value);
+	target->reportEvent(ACTION_ID, "FirstEvent");
+	target->reportEvent(ACTION_ID, "SecondEvent");
+	target->reportEvent(ACTION_ID, "ThirdEvent");
+
+	// when sending fails for the second chunk
+	auto obtained = target->send(httpClientProvider);
+
+	// then the second and the already prepared third chunk are restored
+	ASSERT_THAT(obtained, testing::Eq(errorResponse));
+	ASSERT_THAT(target->isEmpty(), testing::Eq(false));
+
+	// and when sending again
+	obtained = target->send(httpClientProvider);
+
+	// then the remaining two chunks are sent
+	ASSERT_THAT(obtained, testing::Eq(successResponse));
+	ASSERT_THAT(target->isEmpty(), testing::Eq(true));
 }
 
-TEST_F(BeaconTest, noDoubleValueIsReportedIfCapturingIsDisabled)
+TEST_F(BeaconTest, clearDataFromBeaconCache)
 {
-	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
 
-	double value = 42.1337;
-	Utf8String_t valueName("DoubleValue");
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
 
-	// given
-	auto target = createBeacon()->build();
+	auto action = MockIActionCommon::createNice();
 
-	// when, expect no interaction with beacon cache
-	target->reportValue(ACTION_ID, valueName, value);
+	target->addAction(action);
+	target->reportValue(ACTION_ID, "IntValue", 42);
+	target->reportValue(ACTION_ID, "DoubleValue", 3.1415);
+	target->reportValue(ACTION_ID, "StringValue", "HelloWorld");
+	target->reportEvent(ACTION_ID, "SomeEvent");
+	target->reportError(ACTION_ID, "SomeError", -123, "SomeReason");
+	target->reportCrash("SomeCrash", "SomeReason", "SomeStacktrace");
+	target->endSession();
+
+	// when
+	target->clearData();
+
+	// then
+	ASSERT_THAT(target->isEmpty(), testing::Eq(true));
 }
 
-TEST_F(BeaconTest, noStringValueIsReportedIfCapturingIsDisabled)
+TEST_F(BeaconTest, clearDataForwardsCallToBeaconCache)
 {
-	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
-
-	Utf8String_t value("HelloWorld");
-	Utf8String_t valueName("StringValue");
+	// expect
+	EXPECT_CALL(*mockBeaconCache, deleteCacheEntry(SESSION_ID))
+		.Times(1);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->reportValue(ACTION_ID, valueName, value);
+	// when
+	target->clearData();
 }
 
-TEST_F(BeaconTest, noEventIsReportedIfCapturingDisabled)
+TEST_F(BeaconTest, reportEventsAddsAllEventsToBeaconCacheAtOnce)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	std::vector<ReportedEvent_t> events;
+	events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+	events.emplace_back(EventType_t::VALUE_INT, "someValue");
+	events.back().intValue = 42;
+	events.emplace_back(EventType_t::FAILURE_ERROR, "someError");
+	events.back().intValue = -123;
+	events.back().stringValue = "someReason";
 
-	Utf8String_t eventName("event name");
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_, testing::_))
+		.Times(0);
+	EXPECT_CALL(*mockBeaconCache, addEventData(SESSION_ID, testing::SizeIs(3)))
+		.Times(1);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->reportEvent(ACTION_ID, eventName);
+	// when
+	target->reportEvents(ACTION_ID, events);
 }
 
-TEST_F(BeaconTest, noEventIsReportedIfDataSendingIsDisallowed)
+TEST_F(BeaconTest, reportEventsSerializesEventsLikeSingleCalls)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isSendingDataAllowed())
-		.WillByDefault(testing::Return(false));
+	std::vector<ReportedEvent_t> events;
+	events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+	events.emplace_back(EventType_t::VALUE_DOUBLE, "someValue");
+	events.back().doubleValue = 3.125;
+	events.emplace_back(EventType_t::FAILURE_ERROR, "someError");
+	events.back().intValue = -123;
+	events.back().stringValue = "someReason";
 
-	Utf8String_t eventName("event name");
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
 
-	// given
-	auto target = createBeacon()->build();
+	// when
+	target->reportEvents(ACTION_ID, events);
 
-	// when, expect no interaction with beacon cache
-	target->reportEvent(ACTION_ID, eventName);
+	// then
+	std::vector<std::string> obtained;
+	beaconCache->visitEventData(SESSION_ID, [&obtained](const core::caching::BeaconCacheRecord& record)
+	{
+		obtained.push_back(record.getData().getStringData());
+	});
+
+	std::stringstream event;
+	event << "et=" << static_cast<int32_t>(EventType_t::NAMED_EVENT)
+		<< "&na=someEvent&it=" << THREAD_ID << "&pa=" << ACTION_ID << "&s0=1&t0=0";
+	std::stringstream value;
+	value << "et=" << static_cast<int32_t>(EventType_t::VALUE_DOUBLE)
+		<< "&na=someValue&it=" << THREAD_ID << "&pa=" << ACTION_ID << "&s0=2&t0=0&vl=3.125000";
+	std::stringstream error;
+	error << "et=" << static_cast<int32_t>(EventType_t::FAILURE_ERROR)
+		<< "&na=someError&it=" << THREAD_ID << "&pa=" << ACTION_ID << "&s0=3&t0=0&ev=-123&rs=someReason&tt=c";
+	ASSERT_THAT(obtained, testing::ElementsAre(event.str(), value.str(), error.str()));
+	ASSERT_THAT(target->hasReportedFailures(), testing::Eq(true));
 }
 
-TEST_F(BeaconTest, noErrorIsReportedIfCapturingDisabled)
+TEST_F(BeaconTest, reportEventsSkipsEventsDisallowedByPrivacySettings)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+	ON_CALL(*mockPrivacyConfiguration, isValueReportingAllowed())
 		.WillByDefault(testing::Return(false));
 
-	Utf8String_t eventName("event name");
-	int32_t errorCode = 123;
-	Utf8String_t reason("error reason");
+	std::vector<ReportedEvent_t> events;
+	events.emplace_back(EventType_t::VALUE_INT, "someValue");
+	events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+	events.emplace_back(EventType_t::VALUE_STRING, "someOtherValue");
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addEventData(SESSION_ID, testing::SizeIs(1)))
+		.Times(1);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->reportError(ACTION_ID, eventName, errorCode, reason);
+	// when
+	target->reportEvents(ACTION_ID, events);
 }
 
-TEST_F(BeaconTest, noErrorIsReportedIfSendingErrorDataDisallowed)
+TEST_F(BeaconTest, reportEventsDoesNotAddAnythingIfDataSendingDisallowed)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isSendingErrorsAllowed())
+	ON_CALL(*mockServerConfiguration, isSendingDataAllowed())
 		.WillByDefault(testing::Return(false));
 
-	Utf8String_t eventName("event name");
-	int32_t errorCode = 123;
-	Utf8String_t reason("error reason");
+	std::vector<ReportedEvent_t> events;
+	events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_))
+		.Times(0);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->reportError(ACTION_ID, eventName, errorCode, reason);
+	// when
+	target->reportEvents(ACTION_ID, events);
 }
 
-TEST_F(BeaconTest, noCrashIsReportedIfCapturingIsDisabled)
+TEST_F(BeaconTest, reportedEventsAreDeferredIfSerializationIsDeferred)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
 
-	Utf8String_t eventName("event name");
-	Utf8String_t reason("some reason");
-	Utf8String_t stacktrace("some stacktrace");
+	std::vector<ReportedEvent_t> events;
+	events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+	events.emplace_back(EventType_t::VALUE_INT, "someValue");
 
-	// given
-	auto target = createBeacon()->build();
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
 
-	// when, expect no interaction with beacon cache
-	target->reportCrash(eventName, reason, stacktrace);
+	// when
+	target->reportEvents(ACTION_ID, events);
+
+	// then
+	ASSERT_THAT(beaconCache->isEmpty(SESSION_ID), testing::Eq(true));
+	ASSERT_THAT(target->getNumberOfRecords(), testing::Eq(size_t(2)));
 }
 
-TEST_F(BeaconTest, noCrashIsReportedIfSendingCrashDataDisallowed)
+TEST_F(BeaconTest, reportedValueIsNotAddedToBeaconCacheIfSerializationIsDeferred)
 {
 	// with
-	ON_CALL(*mockServerConfiguration, isSendingCrashesAllowed())
-		.WillByDefault(testing::Return(false));
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
 
-	Utf8String_t eventName("event name");
-	Utf8String_t reason("some reason");
-	Utf8String_t stacktrace("some stacktrace");
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_, testing::_))
+		.Times(0);
 
 	// given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
-	target->reportCrash(eventName, reason, stacktrace);
+	// when
+	target->reportValue(ACTION_ID, "IntValue", 42);
 }
 
-TEST_F(BeaconTest, noWebRequestIsReportedIfCapturingDisabled)
+TEST_F(BeaconTest, deferredValueIsAddedToBeaconCacheOnSend)
 {
-	// given
-	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
-		.WillByDefault(testing::Return(false));
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	Utf8String_t valueName("IntValue");
+	int32_t value = 42;
+
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	// expect
+	std::stringstream s;
+	s << "et=" << static_cast<int32_t>(EventType_t::VALUE_INT)	// event type
+		<< "&na=" << valueName.getStringData()		// name of reported value
+		<< "&it=" << THREAD_ID						// thread ID
+		<< "&pa=" << ACTION_ID						// parent action
+		<< "&s0=1"									// sequence number of reported value
+		<< "&t0=0"									// event time since session start
+		<< "&vl=" << value							// reported value
+	;
+	testing::InSequence sequence;
+	EXPECT_CALL(*mockBeaconCache, addEventData(
+		SESSION_ID,									// session ID
+		testing::ElementsAre(testing::AllOf(
+			testing::Property(&BeaconCacheRecord_t::getTimestamp, 0),	// timestamp when value was reported
+			testing::Property(&BeaconCacheRecord_t::getData, testing::Eq(s.str()))
+		))
+	)).Times(1);
+	EXPECT_CALL(*mockBeaconCache, getNextBeaconChunk(SESSION_ID, testing::_, testing::_, testing::_))
+		.Times(1);
+
+	// given
+	auto target = createBeacon()->build();
+	target->reportValue(ACTION_ID, valueName, value);
+
+	// when
+	target->send(httpClientProvider);
+}
+
+TEST_F(BeaconTest, isEmptyReturnsFalseIfDeferredEventsArePending)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	target->reportEvent(ACTION_ID, "SomeEvent");
+
+	// when
+	auto obtained = target->isEmpty();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(beaconCache->isEmpty(SESSION_ID), testing::Eq(true));
+}
+
+TEST_F(BeaconTest, clearDataDropsDeferredEvents)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	target->reportValue(ACTION_ID, "DoubleValue", 3.1415);
+	target->reportError(ACTION_ID, "SomeError", -123, "SomeReason");
+
+	// when
+	target->clearData();
+
+	// then
+	ASSERT_THAT(target->isEmpty(), testing::Eq(true));
+}
+
+TEST_F(BeaconTest, getNumberOfRecordsCountsDeferredAndCachedRecords)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	target->reportCrash("SomeCrash", "SomeReason", "SomeStacktrace");
+	target->reportEvent(ACTION_ID, "SomeEvent");
+	target->reportValue(ACTION_ID, "IntValue", 42);
+
+	// when
+	auto obtained = target->getNumberOfRecords();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(3)));
+	ASSERT_THAT(beaconCache->getNumberOfRecords(SESSION_ID), testing::Eq(size_t(1)));
+}
+
+TEST_F(BeaconTest, deferredEventsAreAddedToBeaconCacheIfMaximumNumberIsReached)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	for (size_t i = 1; i < Beacon_t::MAX_DEFERRED_EVENT_RECORDS; i++)
+	{
+		target->reportEvent(ACTION_ID, "SomeEvent");
+	}
+	ASSERT_THAT(beaconCache->isEmpty(SESSION_ID), testing::Eq(true));
+
+	// when
+	target->reportEvent(ACTION_ID, "SomeEvent");
+
+	// then
+	ASSERT_THAT(beaconCache->getNumberOfRecords(SESSION_ID), testing::Eq(Beacon_t::MAX_DEFERRED_EVENT_RECORDS));
+	ASSERT_THAT(beaconCache->getNumBytesInCache(), testing::Gt(int64_t(0)));
+	ASSERT_THAT(target->getNumberOfRecords(), testing::Eq(Beacon_t::MAX_DEFERRED_EVENT_RECORDS));
+}
+
+TEST_F(BeaconTest, deferredEventsReportedTogetherAreAddedToBeaconCacheIfMaximumNumberIsReached)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	std::vector<ReportedEvent_t> events;
+	for (size_t i = 0; i < Beacon_t::MAX_DEFERRED_EVENT_RECORDS + 1; i++)
+	{
+		events.emplace_back(EventType_t::NAMED_EVENT, "someEvent");
+	}
+
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+
+	// when
+	target->reportEvents(ACTION_ID, events);
+
+	// then
+	ASSERT_THAT(beaconCache->getNumberOfRecords(SESSION_ID), testing::Eq(Beacon_t::MAX_DEFERRED_EVENT_RECORDS + 1));
+	ASSERT_THAT(target->getNumberOfRecords(), testing::Eq(Beacon_t::MAX_DEFERRED_EVENT_RECORDS + 1));
+}
+
+TEST_F(BeaconTest, deferredEventsAreAddedToBeaconCacheBeforeDirectlySerializedRecords)
+{
+	// with
+	ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+		.WillByDefault(testing::Return(true));
+
+	// given
+	auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	auto target = createBeacon()
+		->with(beaconCache)
+		.build();
+	target->reportEvent(ACTION_ID, "SomeEvent");
+
+	// when
+	target->identifyUser("SomeUser");
+
+	// then
+	ASSERT_THAT(beaconCache->getNumberOfRecords(SESSION_ID), testing::Eq(size_t(2)));
+	ASSERT_THAT(target->getNumberOfRecords(), testing::Eq(size_t(2)));
+}
+
+TEST_F(BeaconTest, deferredAndImmediateSerializationProduceTheSameChunk)
+{
+	// with
+	ON_CALL(*mockPrivacyConfiguration, isSessionReportingAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockPrivacyConfiguration, isUserIdentificationAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockPrivacyConfiguration, isCrashReportingAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockServerConfiguration, isSendingCrashesAllowed())
+		.WillByDefault(testing::Return(true));
+
+	auto createChunk = [this](bool isSerializationDeferred)
+	{
+		ON_CALL(*mockOpenKitConfiguration, isDeferredSerializationEnabled())
+			.WillByDefault(testing::Return(isSerializationDeferred));
+
+		auto beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+		auto target = createBeacon()
+			->with(beaconCache)
+			.build();
+
+		target->reportEvent(ACTION_ID, "SomeEvent");
+		target->identifyUser("SomeUser");
+		target->reportValue(ACTION_ID, "IntValue", 42);
+		target->reportCrash("SomeCrash", "SomeReason", "SomeStacktrace");
+		target->reportError(ACTION_ID, "SomeError", -123, "SomeReason");
+		target->endSession();
+
+		return beaconCache->getNextBeaconChunk(SESSION_ID, "", 1024 * 1024, "&").getStringData();
+	};
+
+	// when
+	auto immediateChunk = createChunk(false);
+	auto deferredChunk = createChunk(true);
+
+	// then
+	ASSERT_THAT(immediateChunk, testing::HasSubstr("SomeError"));
+	ASSERT_THAT(deferredChunk, testing::Eq(immediateChunk));
+}
+
+TEST_F(BeaconTest, hasReportedFailuresReturnsFalseIfNoErrorOrCrashWasReported)
+{
+	// given
+	auto target = createBeacon()
+		->with(std::make_shared<BeaconCache_t>(mockLogger))
+		.build();
+	target->reportEvent(ACTION_ID, "SomeEvent");
+
+	// then
+	ASSERT_THAT(target->hasReportedFailures(), testing::Eq(false));
+}
+
+TEST_F(BeaconTest, hasReportedFailuresReturnsTrueIfErrorWasReported)
+{
+	// given
+	auto target = createBeacon()
+		->with(std::make_shared<BeaconCache_t>(mockLogger))
+		.build();
+	target->reportError(ACTION_ID, "SomeError", -123, "SomeReason");
+
+	// then
+	ASSERT_THAT(target->hasReportedFailures(), testing::Eq(true));
+}
+
+TEST_F(BeaconTest, hasReportedFailuresReturnsTrueIfCrashWasReported)
+{
+	// given
+	auto target = createBeacon()
+		->with(std::make_shared<BeaconCache_t>(mockLogger))
+		.build();
+	target->reportCrash("SomeCrash", "SomeReason", "SomeStacktrace");
+
+	// then
+	ASSERT_THAT(target->hasReportedFailures(), testing::Eq(true));
+}
+
+TEST_F(BeaconTest, getSessionStartTimeReturnsTimestampOfBeaconCreation)
+{
+	// with
+	int64_t timestamp = 42;
+	ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(timestamp));
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when
+	auto obtained = target->getSessionStartTime();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(timestamp));
+}
+
+TEST_F(BeaconTest, noSessionIsAddedIfCapturingDisabled)
+{
+	// given
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, endBeacon(SESSION_ID))
+		.Times(1);
+
+	auto target = createBeacon()->build();
+
+	// when, expect no data added to beacon cache
+	target->endSession();
+}
+
+TEST_F(BeaconTest, noActionIsAddedIfCapturingDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	auto action = MockIActionCommon::createNice();
+	ON_CALL(*action, getID())
+		.WillByDefault(testing::Return(ACTION_ID));
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->addAction(action);
+}
+
+TEST_F(BeaconTest, noIntValueIsReportedIfCapturingIsDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	int32_t value = 42;
+	Utf8String_t valueName("IntValue");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportValue(ACTION_ID, valueName, value);
+}
+
+TEST_F(BeaconTest, noDoubleValueIsReportedIfCapturingIsDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	double value = 42.1337;
+	Utf8String_t valueName("DoubleValue");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportValue(ACTION_ID, valueName, value);
+}
+
+TEST_F(BeaconTest, noStringValueIsReportedIfCapturingIsDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t value("HelloWorld");
+	Utf8String_t valueName("StringValue");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportValue(ACTION_ID, valueName, value);
+}
+
+TEST_F(BeaconTest, noEventIsReportedIfCapturingDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportEvent(ACTION_ID, eventName);
+}
+
+TEST_F(BeaconTest, noEventIsReportedIfDataSendingIsDisallowed)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isSendingDataAllowed())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportEvent(ACTION_ID, eventName);
+}
+
+TEST_F(BeaconTest, noErrorIsReportedIfCapturingDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+	int32_t errorCode = 123;
+	Utf8String_t reason("error reason");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportError(ACTION_ID, eventName, errorCode, reason);
+}
+
+TEST_F(BeaconTest, noErrorIsReportedIfSendingErrorDataDisallowed)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isSendingErrorsAllowed())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+	int32_t errorCode = 123;
+	Utf8String_t reason("error reason");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportError(ACTION_ID, eventName, errorCode, reason);
+}
+
+TEST_F(BeaconTest, noCrashIsReportedIfCapturingIsDisabled)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+	Utf8String_t reason("some reason");
+	Utf8String_t stacktrace("some stacktrace");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportCrash(eventName, reason, stacktrace);
+}
+
+TEST_F(BeaconTest, noCrashIsReportedIfSendingCrashDataDisallowed)
+{
+	// with
+	ON_CALL(*mockServerConfiguration, isSendingCrashesAllowed())
+		.WillByDefault(testing::Return(false));
+
+	Utf8String_t eventName("event name");
+	Utf8String_t reason("some reason");
+	Utf8String_t stacktrace("some stacktrace");
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when, expect no interaction with beacon cache
+	target->reportCrash(eventName, reason, stacktrace);
+}
+
+TEST_F(BeaconTest, noWebRequestIsReportedIfCapturingDisabled)
+{
+	// given
+	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
+		.WillByDefault(testing::Return(false));
 
 	auto target = createBeacon()
 			->build();
@@ -1487,6 +2135,73 @@ TEST_F(BeaconTest, webRequestIsReportedForIfWebRequestTracingAllowed)
 	target->addWebRequest(ACTION_ID, mockWebRequestTracer);
 }
 
+TEST_F(BeaconTest, createTagFormatsExtremeValues)
+{
+	// with
+	ON_CALL(*mockThreadIdProvider, getThreadID())
+		.WillByDefault(testing::Return(std::numeric_limits<int32_t>::min()));
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when
+	auto obtained = target->createTag(std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min());
+
+	// then
+	std::stringstream s;
+	s << "MT"
+		<< "_" << protocol::PROTOCOL_VERSION
+		<< "_" << SERVER_ID
+		<< "_" << DEVICE_ID
+		<< "_" << SESSION_ID
+		<< "_" << APP_ID.getStringData()
+		<< "_2147483647_-2147483648_-2147483648"
+	;
+	ASSERT_THAT(obtained.getStringData(), testing::Eq(s.str()));
+}
+
+TEST_F(BeaconTest, createTagUsesUpdatedServerId)
+{
+	// given
+	auto target = createBeacon()->build();
+	auto tagBeforeUpdate = target->createTag(ACTION_ID, 1);
+
+	// when
+	ON_CALL(*mockServerConfiguration, getServerId())
+		.WillByDefault(testing::Return(SERVER_ID + 1));
+	auto obtained = target->createTag(ACTION_ID, 1);
+
+	// then
+	std::stringstream s;
+	s << "MT"
+		<< "_" << protocol::PROTOCOL_VERSION
+		<< "_" << (SERVER_ID + 1)
+		<< "_" << DEVICE_ID
+		<< "_" << SESSION_ID
+		<< "_" << APP_ID.getStringData()
+		<< "_" << ACTION_ID
+		<< "_" << THREAD_ID
+		<< "_" << 1
+	;
+	ASSERT_THAT(obtained.getStringData(), testing::Eq(s.str()));
+	ASSERT_THAT(obtained, testing::Ne(tagBeforeUpdate));
+}
+
+TEST_F(BeaconTest, createTagReusesTagPrefix)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitConfiguration, getApplicationIdPercentEncoded())
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when
+	target->createTag(ACTION_ID, 1);
+	target->createTag(ACTION_ID, 2);
+	target->createTag(ACTION_ID + 1, 3);
+}
+
 TEST_F(BeaconTest, beaconReturnsEmptyTagIfWebRequestTracingDisallowed)
 {
 	// with
@@ -1818,10 +2533,14 @@ TEST_F(BeaconTest, sessionNotReportedIfSessionReportingDisallowed)
 	ON_CALL(*mockPrivacyConfiguration, isSessionReportingAllowed())
 		.WillByDefault(testing::Return(false));
 
+	// expect
+	EXPECT_CALL(*mockBeaconCache, endBeacon(SESSION_ID))
+		.Times(1);
+
 	//given
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
+	// when, expect no data added to beacon cache
 	target->endSession();
 }
 
@@ -1831,9 +2550,13 @@ TEST_F(BeaconTest, sessionNotReportedIfDataSendingDisallowed)
 	ON_CALL(*mockServerConfiguration, isSendingDataAllowed())
 		.WillByDefault(testing::Return(false));
 
+	// expect
+	EXPECT_CALL(*mockBeaconCache, endBeacon(SESSION_ID))
+		.Times(1);
+
 	auto target = createBeacon()->build();
 
-	// when, expect no interaction with beacon cache
+	// when, expect no data added to beacon cache
 	target->endSession();
 }
 
@@ -1846,6 +2569,8 @@ TEST_F(BeaconTest, sessionReportedIfSessionReportingAllowed)
 	// expect
 	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_, testing::_))
 		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, endBeacon(SESSION_ID))
+		.Times(1);
 
 	//given
 	auto target = createBeacon()->build();
@@ -2088,6 +2813,8 @@ TEST_F(BeaconTest, namedEventIsReportedIfErrorReportingAllowed)
 TEST_F(BeaconTest, sessionStartIsReported)
 {
 	// expect
+	EXPECT_CALL(*mockBeaconCache, addBeacon(SESSION_ID, testing::_, testing::_, testing::_, testing::_))
+		.Times(1);
 	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_, testing::_))
 		.Times(1);
 
@@ -2107,6 +2834,8 @@ TEST_F(BeaconTest, sessionStartIsReportedRegardlessOfPrivacyConfiguration)
 		.WillByDefault(testing::Return(privacyConfig));
 
 	// expect
+	EXPECT_CALL(*mockBeaconCache, addBeacon(SESSION_ID, testing::_, testing::_, testing::_, testing::_))
+		.Times(1);
 	EXPECT_CALL(*mockBeaconCache, addEventData(testing::_, testing::_, testing::_))
 		.Times(1);
 	EXPECT_CALL(*privacyConfig, isDeviceIdSendingAllowed())
@@ -2131,9 +2860,13 @@ TEST_F(BeaconTest, noSessionStartIsReportedIfCapturingDisabled)
 	ON_CALL(*mockServerConfiguration, isCaptureEnabled())
 		.WillByDefault(testing::Return(false));
 
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addBeacon(SESSION_ID, testing::_, testing::_, testing::_, testing::_))
+		.Times(1);
+
 	auto target = createBeacon()->build();
 
-	// when, expect on interaction on beacon cache
+	// when, expect no data added to beacon cache
 	target->startSession();
 }
 
@@ -2240,4 +2973,84 @@ TEST_F(BeaconTest, useInternalBeaconIdForAccessingBeaconCacheWhenSessionNumberRe
 
 	// when
 	target->clearData();
-}
\ No newline at end of file
+}
+TEST_F(BeaconTest, startSessionAnnouncesBeaconToBeaconCache)
+{
+	// with
+	ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(4321));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addBeacon(SESSION_ID, 4321, SESSION_ID, testing::Eq(Utf8String_t("127.0.0.1")), testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, addEventData(SESSION_ID, testing::_, testing::_))
+		.Times(1);
+
+	// given
+	auto target = createBeacon()
+		->withIpAddress("127.0.0.1")
+		.build();
+
+	// when
+	target->startSession();
+}
+
+TEST_F(BeaconTest, remoteBeaconDoesNotReportSessionStartOrEnd)
+{
+	// given
+	auto target = createRemoteBeacon("vv=3");
+
+	// when, expect no interaction with beacon cache
+	target->startSession();
+	target->endSession();
+}
+
+TEST_F(BeaconTest, remoteBeaconUsesRecordedSessionData)
+{
+	// given
+	auto target = createRemoteBeacon("vv=3");
+
+	// when, then
+	ASSERT_THAT(target->getSessionNumber(), testing::Eq(SESSION_ID + 1));
+	ASSERT_THAT(target->getSessionStartTime(), testing::Eq(1234));
+	ASSERT_THAT(target->getClientIPAddress(), testing::Eq(Utf8String_t("10.0.0.1")));
+}
+
+TEST_F(BeaconTest, remoteBeaconAddsRecordedDataToBeaconCache)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCache, addEventData(SESSION_ID, 17, testing::Eq(Utf8String_t("et=1"))))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, addActionData(SESSION_ID, 18, testing::Eq(Utf8String_t("et=2"))))
+		.Times(1);
+
+	// given
+	auto target = createRemoteBeacon("vv=3");
+
+	// when
+	target->addEventData(17, "et=1");
+	target->addActionData(18, "et=2");
+}
+
+TEST_F(BeaconTest, remoteBeaconChunkPrefixStartsWithRecordedBeaconData)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCache, getNextBeaconChunk(SESSION_ID, testing::Truly(
+		[](const Utf8String_t& prefix) { return prefix.getStringData().find("vv=3&st=1234") == 0; }
+	), testing::_, testing::_))
+		.Times(1);
+
+	// given
+	auto httpClient = MockIHTTPClient::createNice();
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	auto target = createRemoteBeacon("vv=3&st=1234");
+
+	// when
+	auto obtained = target->send(httpClientProvider);
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
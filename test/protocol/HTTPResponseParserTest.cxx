@@ -203,3 +203,72 @@ TEST_F(HTTPResponseParserTest, multipleLinesWithSimilarKeyMergesValues)
 	ASSERT_NE(obtainedHeaders.end(), obtainedHeaders.find("set-cookie"));
 	ASSERT_THAT(obtainedHeaders.find("set-cookie")->second, testing::ElementsAre(std::string("Test=test_value"), std::string("foo=bar")));
 }
+
+TEST_F(HTTPResponseParserTest, relevantHeadersOnlyParserRecordsRetryAfterCaseInsensitive)
+{
+	// given
+	auto target = HttpResponseParser_t(false);
+	auto headerString = std::string("Retry-After: 600\r\n");
+
+	// when adding the line
+	auto obtained = target.responseHeaderData(headerString.data(), sizeof(std::string::value_type), headerString.length());
+
+	// then
+	ASSERT_EQ(headerString.length(), obtained);
+
+	auto obtainedHeaders = target.getResponseHeaders();
+	ASSERT_NE(obtainedHeaders.end(), obtainedHeaders.find("retry-after"));
+	ASSERT_EQ(std::vector<std::string>{"600"}, obtainedHeaders.find("retry-after")->second);
+}
+
+TEST_F(HTTPResponseParserTest, relevantHeadersOnlyParserSkipsOtherHeaders)
+{
+	// given
+	auto target = HttpResponseParser_t(false);
+	auto headerStringOne = std::string("Content-Length: 42\r\n");
+	auto headerStringTwo = std::string("Retry-After-Foo: 42\r\n");
+	auto headerStringThree = std::string("Retry: 42\r\n");
+
+	// when adding the lines
+	auto obtainedOne = target.responseHeaderData(headerStringOne.data(), sizeof(std::string::value_type), headerStringOne.length());
+	auto obtainedTwo = target.responseHeaderData(headerStringTwo.data(), sizeof(std::string::value_type), headerStringTwo.length());
+	auto obtainedThree = target.responseHeaderData(headerStringThree.data(), sizeof(std::string::value_type), headerStringThree.length());
+
+	// then
+	ASSERT_EQ(headerStringOne.length(), obtainedOne);
+	ASSERT_EQ(headerStringTwo.length(), obtainedTwo);
+	ASSERT_EQ(headerStringThree.length(), obtainedThree);
+	ASSERT_TRUE(target.getResponseHeaders().empty());
+}
+
+TEST_F(HTTPResponseParserTest, relevantHeadersOnlyParserMergesValuesOfSimilarKeys)
+{
+	// given
+	auto target = HttpResponseParser_t(false);
+	auto headerStringOne = std::string("RETRY-AFTER:1\r\n");
+	auto headerStringTwo = std::string("retry-after:\t2 \r\n");
+
+	// when adding the lines
+	target.responseHeaderData(headerStringOne.data(), sizeof(std::string::value_type), headerStringOne.length());
+	target.responseHeaderData(headerStringTwo.data(), sizeof(std::string::value_type), headerStringTwo.length());
+
+	// then
+	auto obtainedHeaders = target.getResponseHeaders();
+	ASSERT_NE(obtainedHeaders.end(), obtainedHeaders.find("retry-after"));
+	ASSERT_THAT(obtainedHeaders.find("retry-after")->second, testing::ElementsAre(std::string("1"), std::string("2")));
+}
+
+TEST_F(HTTPResponseParserTest, whitespaceOnlyValueGivesEmptyValue)
+{
+	// given
+	auto target = HttpResponseParser_t();
+	auto headerString = std::string("X-Foo: \t \r\n");
+
+	// when adding the line
+	target.responseHeaderData(headerString.data(), sizeof(std::string::value_type), headerString.length());
+
+	// then
+	auto obtainedHeaders = target.getResponseHeaders();
+	ASSERT_NE(obtainedHeaders.end(), obtainedHeaders.find("x-foo"));
+	ASSERT_EQ(std::vector<std::string>{""}, obtainedHeaders.find("x-foo")->second);
+}
@@ -423,4 +423,94 @@ TEST_F(JsonResponseParserTest, parseIgnoresUnknownTokens)
 
 		ASSERT_THAT(obtained->isAttributeSet(attribute), testing::Eq(false));
 	}
-}
\ No newline at end of file
+}
+TEST_F(JsonResponseParserTest, parseIgnoresKnownKeysOutsideOfTheirObject)
+{
+	// given
+	input << "{";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_MAX_BEACON_SIZE_IN_KB << "\": 1,";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_APP_CONFIG << "\": {";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_MULTIPLICITY << "\": 2,";
+	input << "    \"nested\": { \"" << JsonResponseParser_t::RESPONSE_KEY_CAPTURE << "\": 0 },";
+	input << "    \"array\": [ { \"" << JsonResponseParser_t::RESPONSE_KEY_REPORT_CRASHES << "\": 0 } ]";
+	input << "  },";
+	input << "  \"unknownObject\": { \"" << JsonResponseParser_t::RESPONSE_KEY_TIMESTAMP_IN_MILLIS << "\": 3 }";
+	input << "}";
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(input.str());
+
+	// then
+	for (const auto attribute : protocol::ALL_RESPONSE_ATTRIBUTES)
+	{
+		ASSERT_THAT(obtained->isAttributeSet(attribute), testing::Eq(false));
+	}
+}
+
+TEST_F(JsonResponseParserTest, parseIgnoresKnownKeysWithUnexpectedValueType)
+{
+	// given
+	input << "{";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_AGENT_CONFIG << "\": 5,";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_APP_CONFIG << "\": {";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_CAPTURE << "\": \"1\",";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_REPORT_CRASHES << "\": true,";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_REPORT_ERRORS << "\": null";
+	input << "  },";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_TIMESTAMP_IN_MILLIS << "\": {}";
+	input << "}";
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(input.str());
+
+	// then
+	for (const auto attribute : protocol::ALL_RESPONSE_ATTRIBUTES)
+	{
+		ASSERT_THAT(obtained->isAttributeSet(attribute), testing::Eq(false));
+	}
+}
+
+TEST_F(JsonResponseParserTest, parseConvertsFloatingPointAndLargeNumbers)
+{
+	// given
+	input << "{";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_DYNAMIC_CONFIG << "\": {";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_MULTIPLICITY << "\": 2.9,";
+	input << "    \"" << JsonResponseParser_t::RESPONSE_KEY_SERVER_ID << "\": 1e1";
+	input << "  },";
+	input << "  \"" << JsonResponseParser_t::RESPONSE_KEY_TIMESTAMP_IN_MILLIS << "\": -9223372036854775808";
+	input << "}";
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(2));
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(10));
+	ASSERT_THAT(obtained->getTimestampInMilliseconds(), testing::Eq(INT64_MIN));
+}
+
+TEST_F(JsonResponseParserTest, parseIgnoresNumbersOutOfRange)
+{
+	// given
+	input << "{ \"" << JsonResponseParser_t::RESPONSE_KEY_TIMESTAMP_IN_MILLIS << "\": 9223372036854775808 }";
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::TIMESTAMP), testing::Eq(false));
+}
+
+TEST_F(JsonResponseParserTest, parsingAnUnterminatedObjectThrowsException)
+{
+	// when
+	try
+	{
+		JsonResponseParser_t::parse("{\"" + JsonResponseParser_t::RESPONSE_KEY_APP_CONFIG + "\": {}");
+		FAIL() << "expected JsonParserException to be thrown";
+	} catch(JsonParserException_t&)
+	{
+		// expected
+	}
+}
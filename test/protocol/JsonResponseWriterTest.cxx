@@ -0,0 +1,98 @@
+/**
+* Copyright 2018-2019 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "protocol/JsonResponseParser.h"
+#include "protocol/JsonResponseWriter.h"
+#include "protocol/ResponseAttribute.h"
+#include "protocol/ResponseAttributes.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using JsonResponseParser_t = protocol::JsonResponseParser;
+using JsonResponseWriter_t = protocol::JsonResponseWriter;
+using ResponseAttribute_t = protocol::ResponseAttribute;
+using ResponseAttributes_t = protocol::ResponseAttributes;
+
+class JsonResponseWriterTest : public testing::Test
+{
+};
+
+TEST_F(JsonResponseWriterTest, writingAttributesWithoutSetAttributesGivesAnEmptyObject)
+{
+	// given
+	auto attributes = ResponseAttributes_t::withUndefinedDefaults().build();
+
+	// when
+	auto obtained = JsonResponseWriter_t::write(*attributes);
+
+	// then
+	ASSERT_THAT(obtained.getStringData(), testing::Eq("{}"));
+}
+
+TEST_F(JsonResponseWriterTest, writtenAttributesAreParsedToTheSameAttributes)
+{
+	// given
+	auto attributes = ResponseAttributes_t::withUndefinedDefaults()
+		.withMaxBeaconSizeInBytes(100 * 1024)
+		.withMaxSessionDurationInMilliseconds(120 * 60 * 1000)
+		.withMaxEventsPerSession(200)
+		.withSessionTimeoutInMilliseconds(600 * 1000)
+		.withSendIntervalInMilliseconds(120 * 1000)
+		.withVisitStoreVersion(2)
+		.withCapture(false)
+		.withCaptureCrashes(false)
+		.withCaptureErrors(true)
+		.withMultiplicity(3)
+		.withServerId(42)
+		.withTimestampInMilliseconds(1234567890123)
+		.build();
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(JsonResponseWriter_t::write(*attributes));
+
+	// then
+	ASSERT_THAT(obtained->getMaxBeaconSizeInBytes(), testing::Eq(100 * 1024));
+	ASSERT_THAT(obtained->getMaxSessionDurationInMilliseconds(), testing::Eq(120 * 60 * 1000));
+	ASSERT_THAT(obtained->getMaxEventsPerSession(), testing::Eq(200));
+	ASSERT_THAT(obtained->getSessionTimeoutInMilliseconds(), testing::Eq(600 * 1000));
+	ASSERT_THAT(obtained->getSendIntervalInMilliseconds(), testing::Eq(120 * 1000));
+	ASSERT_THAT(obtained->getVisitStoreVersion(), testing::Eq(2));
+	ASSERT_THAT(obtained->isCapture(), testing::Eq(false));
+	ASSERT_THAT(obtained->isCaptureCrashes(), testing::Eq(false));
+	ASSERT_THAT(obtained->isCaptureErrors(), testing::Eq(true));
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(3));
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(42));
+	ASSERT_THAT(obtained->getTimestampInMilliseconds(), testing::Eq(1234567890123));
+}
+
+TEST_F(JsonResponseWriterTest, onlySetAttributesAreWritten)
+{
+	// given
+	auto attributes = ResponseAttributes_t::withUndefinedDefaults()
+		.withServerId(42)
+		.build();
+
+	// when
+	auto obtained = JsonResponseParser_t::parse(JsonResponseWriter_t::write(*attributes));
+
+	// then
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::SERVER_ID), testing::Eq(true));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::MULTIPLICITY), testing::Eq(false));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::MAX_BEACON_SIZE), testing::Eq(false));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::IS_CAPTURE), testing::Eq(false));
+}
@@ -255,4 +255,80 @@ TEST_F(KeyValueResponseParserTest, parseResponseWithAllParametersSet)
 	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::VISIT_STORE_VERSION), testing::Eq(false));
 	ASSERT_THAT(obtained->getTimestampInMilliseconds(), testing::Eq(defaults->getTimestampInMilliseconds()));
 	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::TIMESTAMP), testing::Eq(false));
-}
\ No newline at end of file
+}
+TEST_F(KeyValueResponseParserTest, parseResponseUsesFirstOccurrenceOfDuplicateKey)
+{
+	// given
+	input << "type=m";
+	input << "&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=";
+	input << "&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=12";
+	input << "&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=13";
+
+	// when
+	auto obtained = KeyValueResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(12));
+}
+
+TEST_F(KeyValueResponseParserTest, parseResponseSkipsMalformedPairs)
+{
+	// given
+	input << "type=m&&=1&bl&" << KeyValueResponseParser_t::RESPONSE_KEY_MULTIPLICITY << "=3&";
+
+	// when
+	auto obtained = KeyValueResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::MAX_BEACON_SIZE), testing::Eq(false));
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(3));
+}
+
+TEST_F(KeyValueResponseParserTest, parseResponseStopsNumberAtFirstNonDigit)
+{
+	// given
+	input << "type=m&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "= -12abc";
+
+	// when
+	auto obtained = KeyValueResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(-12));
+}
+
+TEST_F(KeyValueResponseParserTest, parseResponseThrowsIfValueIsNotANumber)
+{
+	// given
+	input << "type=m&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=abc";
+
+	// when, then
+	ASSERT_THROW(KeyValueResponseParser_t::parse(input.str()), std::invalid_argument);
+}
+
+TEST_F(KeyValueResponseParserTest, parseResponseThrowsIfValueIsOutOfRange)
+{
+	// given
+	input << "type=m&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=2147483648";
+
+	// when, then
+	ASSERT_THROW(KeyValueResponseParser_t::parse(input.str()), std::out_of_range);
+}
+
+TEST_F(KeyValueResponseParserTest, parseResponseAcceptsInt32Limits)
+{
+	// given
+	input << "type=m";
+	input << "&" << KeyValueResponseParser_t::RESPONSE_KEY_SERVER_ID << "=-2147483648";
+	input << "&" << KeyValueResponseParser_t::RESPONSE_KEY_MULTIPLICITY << "=2147483647";
+
+	// when
+	auto obtained = KeyValueResponseParser_t::parse(input.str());
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(INT32_MIN));
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(INT32_MAX));
+}
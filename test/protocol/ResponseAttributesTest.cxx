@@ -1131,4 +1131,69 @@ TEST_F(ResponseAttributesTest, mergeTakesTimestampFromMergeSourceIfSetInSourceAn
 	// then
 	ASSERT_THAT(obtained, testing::NotNull());
 	ASSERT_THAT(obtained->getTimestampInMilliseconds(), testing::Eq(timestamp));
-}
\ No newline at end of file
+}
+TEST_F(ResponseAttributesTest, mergeTakesOnlySetValuesFromOtherResponseAttributesImplementation)
+{
+	// given
+	auto toMerge = MockIResponseAttributes::createNice();
+	ON_CALL(*toMerge, isAttributeSet(testing::_)).WillByDefault(testing::Return(false));
+	ON_CALL(*toMerge, isAttributeSet(ResponseAttribute_t::SERVER_ID)).WillByDefault(testing::Return(true));
+	ON_CALL(*toMerge, getServerId()).WillByDefault(testing::Return(42));
+	ON_CALL(*toMerge, getMultiplicity()).WillByDefault(testing::Return(37));
+	auto target = ResponseAttributes_t::withUndefinedDefaults().withMultiplicity(7).build();
+
+	// when
+	auto obtained = target->merge(toMerge);
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(42));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::SERVER_ID), testing::Eq(true));
+	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(7));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::MULTIPLICITY), testing::Eq(true));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::TIMESTAMP), testing::Eq(false));
+}
+
+TEST_F(ResponseAttributesTest, mergeDoesNotModifyMergeTarget)
+{
+	// given
+	auto source = ResponseAttributes_t::withUndefinedDefaults().withServerId(42).build();
+	auto target = ResponseAttributes_t::withUndefinedDefaults().withServerId(7).build();
+
+	// when
+	target->merge(source);
+
+	// then
+	ASSERT_THAT(target->getServerId(), testing::Eq(7));
+}
+
+TEST_F(ResponseAttributesTest, getSetAttributesHasBitOfEachSetAttribute)
+{
+	// given
+	auto target = ResponseAttributes_t::withUndefinedDefaults()
+		.withCapture(false)
+		.withTimestampInMilliseconds(17)
+		.build();
+
+	// when
+	auto obtained = std::static_pointer_cast<ResponseAttributes_t>(target)->getSetAttributes();
+
+	// then
+	ASSERT_THAT(obtained.count(), testing::Eq(2u));
+	ASSERT_THAT(obtained.test(static_cast<size_t>(ResponseAttribute_t::IS_CAPTURE)), testing::Eq(true));
+	ASSERT_THAT(obtained.test(static_cast<size_t>(ResponseAttribute_t::TIMESTAMP)), testing::Eq(true));
+}
+
+TEST_F(ResponseAttributesTest, builderCreatedFromResponseAttributesTakesOverSetAttributesAndValues)
+{
+	// given
+	auto source = ResponseAttributes_t::withUndefinedDefaults().withServerId(42).build();
+
+	// when
+	auto obtained = ResponseAttributes_t::Builder(*source).build();
+
+	// then
+	ASSERT_THAT(obtained->getServerId(), testing::Eq(42));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::SERVER_ID), testing::Eq(true));
+	ASSERT_THAT(obtained->isAttributeSet(ResponseAttribute_t::MULTIPLICITY), testing::Eq(false));
+}
@@ -121,6 +121,13 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD2(reportEvents,
+			void(
+				int32_t, /* actionID */
+				const std::vector<protocol::ReportedEvent>& /* events */
+			)
+		);
+
 		MOCK_METHOD3(reportCrash,
 			void(
 				const core::UTF8String&, /* errorName */
@@ -150,6 +157,12 @@ namespace test
 
 		MOCK_CONST_METHOD0(isEmpty, bool());
 
+		MOCK_CONST_METHOD0(getNumberOfRecords, size_t());
+
+		MOCK_CONST_METHOD0(hasReportedFailures, bool());
+
+		MOCK_CONST_METHOD0(getSessionStartTime, int64_t());
+
 		MOCK_METHOD0(clearData, void());
 
 		MOCK_CONST_METHOD0(getSessionNumber, int32_t());
@@ -23,6 +23,7 @@
 #include "gmock/gmock.h"
 
 #include <memory>
+#include <vector>
 
 namespace test
 {
@@ -37,6 +38,8 @@ namespace test
 				.WillByDefault(testing::Return(nullptr));
 			ON_CALL(*this, sendBeaconRequest(testing::_, testing::_))
 				.WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, sendCompressedBeaconRequest(testing::_, testing::_))
+				.WillByDefault(testing::Return(nullptr));
 			ON_CALL(*this, sendNewSessionRequest())
 				.WillByDefault(testing::Return(nullptr));
 		}
@@ -65,6 +68,13 @@ namespace test
 			)
 		);
 
+		MOCK_METHOD2(sendCompressedBeaconRequest,
+			std::shared_ptr<protocol::IStatusResponse>(
+				const core::UTF8String&, /* clientIPAddress */
+				const std::vector<unsigned char>& /* compressedBeaconData */
+			)
+		);
+
 		MOCK_METHOD0(sendNewSessionRequest, std::shared_ptr<protocol::IStatusResponse>());
 	};
 }
@@ -24,6 +24,7 @@
 
 #include "gmock/gmock.h"
 
+#include <chrono>
 #include <memory>
 
 namespace test {
@@ -58,6 +59,12 @@ namespace test {
 				std::shared_ptr<core::configuration::IHTTPClientConfiguration>
 			)
 		);
+
+		MOCK_METHOD1(setRequestDeadline,
+			void(
+				std::chrono::steady_clock::time_point
+			)
+		);
 	};
 }
 
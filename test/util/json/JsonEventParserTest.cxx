@@ -0,0 +1,191 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/json/JsonEventParser.h"
+#include "util/json/JsonParser.h"
+#include "util/json/parser/IJsonEventHandler.h"
+#include "util/json/parser/JsonParserException.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+using namespace util::json;
+using namespace util::json::parser;
+
+class RecordingJsonEventHandler : public IJsonEventHandler
+{
+public:
+
+	std::vector<std::string> events;
+
+	RecordingJsonEventHandler()
+		: events()
+	{
+	}
+
+	void onObjectStart() override { events.push_back("{"); }
+
+	void onObjectEnd() override { events.push_back("}"); }
+
+	void onArrayStart() override { events.push_back("["); }
+
+	void onArrayEnd() override { events.push_back("]"); }
+
+	void onKey(const util::json::lexer::JsonTokenView& key) override { events.push_back("key:" + key.getValue()); }
+
+	void onString(const util::json::lexer::JsonTokenView& value) override { events.push_back("string:" + value.getValue()); }
+
+	void onNumber(const util::json::lexer::JsonTokenView& value) override { events.push_back("number:" + value.getValue()); }
+
+	void onBoolean(bool value) override { events.push_back(value ? "boolean:true" : "boolean:false"); }
+
+	void onNull() override { events.push_back("null"); }
+};
+
+class JsonEventParserTest : public testing::Test
+{
+protected:
+
+	RecordingJsonEventHandler handler;
+
+	static std::string getParserExceptionMessage(const std::string& input, IJsonEventHandler& handler)
+	{
+		JsonEventParser target(input.data(), input.size());
+		try
+		{
+			target.parse(handler);
+		}
+		catch (JsonParserException& e)
+		{
+			return e.getMessage();
+		}
+
+		return "no exception thrown";
+	}
+
+	static std::string getDomParserExceptionMessage(const std::string& input)
+	{
+		JsonParser target(input);
+		try
+		{
+			target.parse();
+		}
+		catch (JsonParserException& e)
+		{
+			return e.getMessage();
+		}
+
+		return "no exception thrown";
+	}
+};
+
+TEST_F(JsonEventParserTest, parsingSimpleValueReportsValue)
+{
+	// given
+	const std::string input = " 42 ";
+	JsonEventParser target(input.data(), input.size());
+
+	// when
+	target.parse(handler);
+
+	// then
+	ASSERT_THAT(handler.events, testing::ElementsAre("number:42"));
+	ASSERT_THAT(target.getState(), testing::Eq(JsonParserState::END));
+}
+
+TEST_F(JsonEventParserTest, parsingNestedValuesReportsEventsInDocumentOrder)
+{
+	// given
+	const std::string input = R"({"a": [1, "b", {"c\"": null}], "d": {"e": true, "f": false}, "g": []})";
+	JsonEventParser target(input.data(), input.size());
+
+	// when
+	target.parse(handler);
+
+	// then
+	ASSERT_THAT(handler.events, testing::ElementsAreArray(std::vector<std::string>{
+		"{",
+		"key:a", "[", "number:1", "string:b", "{", "key:c\"", "null", "}", "]",
+		"key:d", "{", "key:e", "boolean:true", "key:f", "boolean:false", "}",
+		"key:g", "[", "]",
+		"}"}));
+	ASSERT_THAT(target.getState(), testing::Eq(JsonParserState::END));
+}
+
+TEST_F(JsonEventParserTest, parsingTwiceDoesNotReportEventsAgain)
+{
+	// given
+	const std::string input = "[true]";
+	JsonEventParser target(input.data(), input.size());
+	target.parse(handler);
+
+	// when
+	target.parse(handler);
+
+	// then
+	ASSERT_THAT(handler.events, testing::ElementsAre("[", "boolean:true", "]"));
+}
+
+TEST_F(JsonEventParserTest, parsingInvalidInputGivesSameErrorsAsJsonParser)
+{
+	for (auto input : { "", "  ", "[", "[1", "[1,", "{", "{\"a\"", "{\"a\":", "{\"a\":1", "{\"a\":1,",
+		"]", ",", "[,", "[1 2]", "[1,]", "{1}", "{\"a\" 1}", "{\"a\":}", "{\"a\":1 \"b\"}", "{\"a\":1,}", "1 2" })
+	{
+		// when
+		auto obtained = getParserExceptionMessage(input, handler);
+
+		// then
+		ASSERT_THAT(obtained, testing::Eq(getDomParserExceptionMessage(input))) << "for input " << input;
+	}
+}
+
+TEST_F(JsonEventParserTest, lexerErrorsAreReportedAsNestedException)
+{
+	// when, then
+	ASSERT_THAT(getParserExceptionMessage("[foo]", handler), testing::Eq("Caught exception from lexical analysis"));
+}
+
+TEST_F(JsonEventParserTest, parsingAfterAnErrorThrowsAnException)
+{
+	// given
+	const std::string input = "[1 2]";
+	JsonEventParser target(input.data(), input.size());
+	try
+	{
+		target.parse(handler);
+		FAIL() << "Expected JsonParserException to be thrown";
+	}
+	catch (JsonParserException&)
+	{
+		// expected
+	}
+
+	// when, then
+	ASSERT_THAT(target.getState(), testing::Eq(JsonParserState::ERROR));
+	try
+	{
+		target.parse(handler);
+		FAIL() << "Expected JsonParserException to be thrown";
+	}
+	catch (JsonParserException& e)
+	{
+		ASSERT_THAT(e.getMessage(), testing::Eq("JSON parser is in erroneous state"));
+	}
+}
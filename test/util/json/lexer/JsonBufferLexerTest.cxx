@@ -0,0 +1,239 @@
+/**
+ * Copyright 2018-2019 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "util/json/lexer/JsonBufferLexer.h"
+#include "util/json/lexer/JsonTokenType.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstring>
+
+using namespace util::json::lexer;
+
+class JsonBufferLexerTest : public testing::Test
+{
+protected:
+
+	static void assertNextTokenThrowsLexerException(JsonBufferLexer& lexer, const std::string& message)
+	{
+		JsonTokenView token;
+		try
+		{
+			lexer.nextToken(token);
+			FAIL() << "Expected JsonLexerException to be thrown";
+		}
+		catch (JsonLexerException& e)
+		{
+			ASSERT_THAT(e.getMessage(), testing::Eq(message));
+		}
+	}
+};
+
+TEST_F(JsonBufferLexerTest, lexingEmptyBufferReturnsNoToken)
+{
+	// given
+	JsonBufferLexer target(nullptr, 0);
+	JsonTokenView token;
+
+	// when
+	auto obtained = target.nextToken(token);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(JsonBufferLexerTest, stringTokenWithoutEscapeSequencesRefersToInput)
+{
+	// given
+	const std::string input = R"( "Hello World!" )";
+	JsonBufferLexer target(input.data(), input.size());
+	JsonTokenView token;
+
+	// when
+	auto obtained = target.nextToken(token);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::VALUE_STRING));
+	ASSERT_THAT(token.getData(), testing::Eq(input.data() + 2));
+	ASSERT_THAT(token.getValue(), testing::Eq("Hello World!"));
+}
+
+TEST_F(JsonBufferLexerTest, numberAndLiteralTokensReferToInput)
+{
+	// given
+	const std::string input = "[-12.5e+3,true,false,null]";
+	JsonBufferLexer target(input.data(), input.size());
+	JsonTokenView token;
+
+	// when, then
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::LEFT_SQUARE_BRACKET));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::VALUE_NUMBER));
+	ASSERT_THAT(token.getData(), testing::Eq(input.data() + 1));
+	ASSERT_THAT(token.getValue(), testing::Eq("-12.5e+3"));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::COMMA));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::LITERAL_BOOLEAN));
+	ASSERT_THAT(token.getValue(), testing::Eq("true"));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::LITERAL_BOOLEAN));
+	ASSERT_THAT(token.getValue(), testing::Eq("false"));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::LITERAL_NULL));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::RIGHT_SQUARE_BRACKET));
+
+	ASSERT_THAT(target.nextToken(token), testing::Eq(false));
+}
+
+TEST_F(JsonBufferLexerTest, stringTokenWithEscapeSequencesIsDecoded)
+{
+	// given
+	const std::string input = R"("a rather long string, which contains \"escape\" sequences \u0041\t")";
+	JsonBufferLexer target(input.data(), input.size());
+	JsonTokenView token;
+
+	// when
+	auto obtained = target.nextToken(token);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::VALUE_STRING));
+	ASSERT_THAT(token.getValue(), testing::Eq("a rather long string, which contains \"escape\" sequences A\t"));
+}
+
+TEST_F(JsonBufferLexerTest, stringTerminatorIsFoundAtEveryPosition)
+{
+	for (size_t length = 0; length < 40; length++)
+	{
+		// given
+		auto input = "\"" + std::string(length, 'x') + "\" ";
+		JsonBufferLexer target(input.data(), input.size());
+		JsonTokenView token;
+
+		// when
+		auto obtained = target.nextToken(token);
+
+		// then
+		ASSERT_THAT(obtained, testing::Eq(true));
+		ASSERT_THAT(token.getLength(), testing::Eq(length));
+		ASSERT_THAT(target.nextToken(token), testing::Eq(false));
+	}
+}
+
+TEST_F(JsonBufferLexerTest, escapeSequenceIsFoundAtEveryPosition)
+{
+	for (size_t length = 0; length < 40; length++)
+	{
+		// given
+		auto input = "\"" + std::string(length, 'x') + "\\n" + std::string(length, 'y') + "\"";
+		JsonBufferLexer target(input.data(), input.size());
+		JsonTokenView token;
+
+		// when
+		auto obtained = target.nextToken(token);
+
+		// then
+		ASSERT_THAT(obtained, testing::Eq(true));
+		ASSERT_THAT(token.getValue(), testing::Eq(std::string(length, 'x') + "\n" + std::string(length, 'y')));
+	}
+}
+
+TEST_F(JsonBufferLexerTest, controlCharacterIsFoundAtEveryPosition)
+{
+	for (size_t length = 0; length < 40; length++)
+	{
+		// given
+		auto input = "\"" + std::string(length, 'x') + "\x1F" + std::string(length, 'y') + "\"";
+		JsonBufferLexer target(input.data(), input.size());
+
+		// when, then
+		assertNextTokenThrowsLexerException(target, "Invalid control character \"\\u001F\"");
+	}
+}
+
+TEST_F(JsonBufferLexerTest, multiByteCharactersAreNotTreatedAsControlCharacters)
+{
+	// given
+	const std::string input = "\"\xC3\xA4\xC3\xB6\xC3\xBC \xF0\x9D\x84\x9E \xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\"";
+	JsonBufferLexer target(input.data(), input.size());
+	JsonTokenView token;
+
+	// when
+	auto obtained = target.nextToken(token);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(token.getValue(), testing::Eq(input.substr(1, input.size() - 2)));
+}
+
+TEST_F(JsonBufferLexerTest, longWhitespaceSequencesAreSkipped)
+{
+	for (size_t length = 0; length < 40; length++)
+	{
+		// given
+		auto input = std::string(length, ' ') + "\t\r\n" + std::string(length, '\n') + "1" + std::string(length, '\t');
+		JsonBufferLexer target(input.data(), input.size());
+		JsonTokenView token;
+
+		// when
+		auto obtained = target.nextToken(token);
+
+		// then
+		ASSERT_THAT(obtained, testing::Eq(true));
+		ASSERT_THAT(token.getTokenType(), testing::Eq(JsonTokenType::VALUE_NUMBER));
+		ASSERT_THAT(token.getValue(), testing::Eq("1"));
+		ASSERT_THAT(target.nextToken(token), testing::Eq(false));
+	}
+}
+
+TEST_F(JsonBufferLexerTest, invalidNumberLiteralsThrowAnException)
+{
+	for (auto literal : { "-", "01", "1.", "1.e5", "1e", "1e+", "--1", "1x" })
+	{
+		// given
+		JsonBufferLexer target(literal, std::strlen(literal));
+
+		// when, then
+		assertNextTokenThrowsLexerException(target, std::string("Invalid number literal \"") + literal + "\"");
+	}
+}
+
+TEST_F(JsonBufferLexerTest, requestingNextTokenAfterLexerExceptionHasBeenThrownThrowsAnException)
+{
+	// given
+	const std::string input = "[foo";
+	JsonBufferLexer target(input.data(), input.size());
+	JsonTokenView token;
+	target.nextToken(token);
+	assertNextTokenThrowsLexerException(target, "Unexpected literal \"foo\"");
+
+	// when, then
+	assertNextTokenThrowsLexerException(target, "JSON Lexer is in erroneous state");
+}
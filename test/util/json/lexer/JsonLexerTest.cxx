@@ -16,11 +16,13 @@
 
 #include "util/json/lexer/JsonLexer.h"
 #include "util/json/lexer/JsonTokenType.h"
+#include "util/json/reader/DefaultResettableReader.h"
 #include "../reader/MockResettableReader.h"
 #include "core/util/StringUtil.h"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <cstring>
 #include <exception>
 
 
@@ -906,6 +908,52 @@ TEST_F(JsonLexerTest, lexingCompoundTokenStringGivesTokensInAppropriateOrder)
 	ASSERT_THAT(obtained, testing::IsNull());
 }
 
+TEST_F(JsonLexerTest, lexingFromReaderGivesTokensInAppropriateOrder)
+{
+	// given
+	auto reader = std::make_shared<util::json::reader::DefaultResettableReader>(R"({"a\tb": [-1e3, null, true] })");
+	auto target = JsonLexer(reader);
+
+	// when, then
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::LEFT_BRACE));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::VALUE_STRING, "a\tb"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::COLON));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::LEFT_SQUARE_BRACKET));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::VALUE_NUMBER, "-1e3"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::COMMA));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::LITERAL_NULL, "null"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::COMMA));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::LITERAL_BOOLEAN, "true"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::RIGHT_SQUARE_BRACKET));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::RIGHT_BRACE));
+	ASSERT_THAT(target.nextToken(), testing::IsNull());
+}
+
+TEST_F(JsonLexerTest, lexingFromReaderGivesSameErrorsAsLexingFromBuffer)
+{
+	for (auto input : { R"("\u00)", R"("\uD834\u0021")", R"("foo)", "trUe", "01" })
+	{
+		// given
+		auto readerTarget = JsonLexer(std::make_shared<util::json::reader::DefaultResettableReader>(input));
+		auto bufferTarget = JsonLexer(input, std::strlen(input));
+
+		// when
+		std::string bufferMessage;
+		try
+		{
+			bufferTarget.nextToken();
+			FAIL() << "Expected JsonLexerException to be thrown";
+		}
+		catch (JsonLexerException& e)
+		{
+			bufferMessage = e.getMessage();
+		}
+
+		// then
+		assertNextTokenThrowsLexerException(readerTarget, bufferMessage);
+	}
+}
+
 TEST_F(JsonLexerTest, ioFailuresAreCaughtAndTransformedToLexerExceptions)
 {
 	// given